@@ -2783,3 +2783,186 @@ std::string dish::TypeToString(const dish::iAtomic::TypeT type)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+
+namespace
+{
+
+    //  Replaces arg1 by the result of an arithmetic operator: computed inline
+    //  by integer or real if both operands are numbers, or else by the
+    //  function table on the boxed operands.
+    template< typename IntegerF, typename RealF >
+    INLINE void arithmetic(dish::ValueHandle &arg1, dish::ValueHandle &arg2, const dish::TwoArgOpF table[dish::iAtomic::typeNUM][dish::iAtomic::typeNUM], IntegerF integer, RealF real)
+    {
+        if(arg1.IsInteger() && arg2.IsInteger())
+        {
+            arg1.SetInteger(integer(arg1.AsInteger(), arg2.AsInteger()));
+        }
+        else if(arg1.IsNumeric() && arg2.IsNumeric())
+        {
+            arg1.SetReal(real(arg1.AsReal(), arg2.AsReal()));
+        }
+        else
+        {
+            arg1.Set(table[arg1.Type()][arg2.Type()](*arg1.Box(), *arg2.Box()));
+        }
+    }
+    
+    //  As arithmetic(), for the comparison operators.
+    template< typename IntegerF, typename RealF >
+    INLINE void comparison(dish::ValueHandle &arg1, dish::ValueHandle &arg2, const dish::TwoArgBoolOpF table[dish::iAtomic::typeNUM][dish::iAtomic::typeNUM], IntegerF integer, RealF real)
+    {
+        if(arg1.IsInteger() && arg2.IsInteger())
+        {
+            arg1.SetBoolean(integer(arg1.AsInteger(), arg2.AsInteger()));
+        }
+        else if(arg1.IsNumeric() && arg2.IsNumeric())
+        {
+            arg1.SetBoolean(real(arg1.AsReal(), arg2.AsReal()));
+        }
+        else
+        {
+            arg1.SetBoolean(table[arg1.Type()][arg2.Type()](*arg1.Box(), *arg2.Box()));
+        }
+    }
+    
+    //  As arithmetic(), for the logical operators, which treat all booleans,
+    //  integers and reals alike.
+    template< typename BooleanF >
+    INLINE void logical(dish::ValueHandle &arg1, dish::ValueHandle &arg2, const dish::TwoArgBoolOpF table[dish::iAtomic::typeNUM][dish::iAtomic::typeNUM], BooleanF boolean)
+    {
+        if(arg1.IsPrimitive() && arg2.IsPrimitive())
+        {
+            arg1.SetBoolean(boolean(arg1.AsBoolean(), arg2.AsBoolean()));
+        }
+        else
+        {
+            arg1.SetBoolean(table[arg1.Type()][arg2.Type()](*arg1.Box(), *arg2.Box()));
+        }
+    }
+
+}
+
+void dish::OpNeg(dish::ValueHandle &arg)
+{
+    if(arg.IsInteger())
+    {
+        arg.SetInteger(-arg.AsInteger());
+    }
+    else if(arg.IsReal())
+    {
+        ScopedCheckForError checkforerror;
+        
+        arg.SetReal(-arg.AsReal());
+    }
+    else
+    {
+        arg.Set(OpNeg_FuncTable[arg.Type()](*arg.Box()));
+    }
+}
+
+void dish::OpAdd(dish::ValueHandle &arg1, dish::ValueHandle &arg2)
+{
+    arithmetic(arg1, arg2, OpAdd_FuncTable,
+        [](const IntegerT &lhs, const IntegerT &rhs) { return lhs + rhs; },
+        [](const RealT &lhs, const RealT &rhs) { ScopedCheckForError checkforerror; return lhs + rhs; });
+}
+
+void dish::OpSub(dish::ValueHandle &arg1, dish::ValueHandle &arg2)
+{
+    arithmetic(arg1, arg2, OpSub_FuncTable,
+        [](const IntegerT &lhs, const IntegerT &rhs) { return lhs - rhs; },
+        [](const RealT &lhs, const RealT &rhs) { ScopedCheckForError checkforerror; return lhs - rhs; });
+}
+
+void dish::OpMul(dish::ValueHandle &arg1, dish::ValueHandle &arg2)
+{
+    arithmetic(arg1, arg2, OpMul_FuncTable,
+        [](const IntegerT &lhs, const IntegerT &rhs) { return lhs * rhs; },
+        [](const RealT &lhs, const RealT &rhs) { ScopedCheckForError checkforerror; return lhs * rhs; });
+}
+
+void dish::OpDiv(dish::ValueHandle &arg1, dish::ValueHandle &arg2)
+{
+    arithmetic(arg1, arg2, OpDiv_FuncTable,
+        [](const IntegerT &lhs, const IntegerT &rhs) { return dish::Divide(lhs, rhs); },
+        [](const RealT &lhs, const RealT &rhs) { return dish::Divide(lhs, rhs); });
+}
+
+void dish::OpMod(dish::ValueHandle &arg1, dish::ValueHandle &arg2)
+{
+    arithmetic(arg1, arg2, OpMod_FuncTable,
+        [](const IntegerT &lhs, const IntegerT &rhs) { return dish::Modulus(lhs, rhs); },
+        [](const RealT &lhs, const RealT &rhs) { return dish::Modulus(lhs, rhs); });
+}
+
+void dish::OpNot(dish::ValueHandle &arg)
+{
+    if(arg.IsPrimitive())
+    {
+        arg.SetBoolean(!arg.AsBoolean());
+    }
+    else
+    {
+        arg.SetBoolean(OpNot_FuncTable[arg.Type()](*arg.Box()));
+    }
+}
+
+void dish::OpAnd(dish::ValueHandle &arg1, dish::ValueHandle &arg2)
+{
+    logical(arg1, arg2, OpAnd_FuncTable, [](const BooleanT &lhs, const BooleanT &rhs) { return (lhs && rhs); });
+}
+
+void dish::OpOr(dish::ValueHandle &arg1, dish::ValueHandle &arg2)
+{
+    logical(arg1, arg2, OpOr_FuncTable, [](const BooleanT &lhs, const BooleanT &rhs) { return (lhs || rhs); });
+}
+
+void dish::OpXor(dish::ValueHandle &arg1, dish::ValueHandle &arg2)
+{
+    logical(arg1, arg2, OpXor_FuncTable, [](const BooleanT &lhs, const BooleanT &rhs) { return (lhs != rhs); });
+}
+
+void dish::OpLessThan(dish::ValueHandle &arg1, dish::ValueHandle &arg2)
+{
+    comparison(arg1, arg2, OpLessThan_FuncTable,
+        [](const IntegerT &lhs, const IntegerT &rhs) { return (lhs < rhs); },
+        [](const RealT &lhs, const RealT &rhs) { return (lhs < rhs); });
+}
+
+void dish::OpLessThanOrEqual(dish::ValueHandle &arg1, dish::ValueHandle &arg2)
+{
+    comparison(arg1, arg2, OpLessThanOrEqual_FuncTable,
+        [](const IntegerT &lhs, const IntegerT &rhs) { return (lhs <= rhs); },
+        [](const RealT &lhs, const RealT &rhs) { return ((lhs <= rhs) || dish::IsEqual(lhs, rhs)); });
+}
+
+void dish::OpEqual(dish::ValueHandle &arg1, dish::ValueHandle &arg2)
+{
+    comparison(arg1, arg2, OpEqual_FuncTable,
+        [](const IntegerT &lhs, const IntegerT &rhs) { return (lhs == rhs); },
+        [](const RealT &lhs, const RealT &rhs) { return dish::IsEqual(lhs, rhs); });
+}
+
+void dish::OpNotEqual(dish::ValueHandle &arg1, dish::ValueHandle &arg2)
+{
+    comparison(arg1, arg2, OpNotEqual_FuncTable,
+        [](const IntegerT &lhs, const IntegerT &rhs) { return (lhs != rhs); },
+        [](const RealT &lhs, const RealT &rhs) { return !dish::IsEqual(lhs, rhs); });
+}
+
+void dish::OpGreaterThanOrEqual(dish::ValueHandle &arg1, dish::ValueHandle &arg2)
+{
+    comparison(arg1, arg2, OpGreaterThanOrEqual_FuncTable,
+        [](const IntegerT &lhs, const IntegerT &rhs) { return (lhs >= rhs); },
+        [](const RealT &lhs, const RealT &rhs) { return ((lhs >= rhs) || dish::IsEqual(lhs, rhs)); });
+}
+
+void dish::OpGreaterThan(dish::ValueHandle &arg1, dish::ValueHandle &arg2)
+{
+    comparison(arg1, arg2, OpGreaterThan_FuncTable,
+        [](const IntegerT &lhs, const IntegerT &rhs) { return (lhs > rhs); },
+        [](const RealT &lhs, const RealT &rhs) { return (lhs > rhs); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
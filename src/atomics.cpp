@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdio>
+#include <typeinfo>
 
 #include "atomics.h"
 #include "exception.h"
@@ -98,6 +99,11 @@ std::shared_ptr< dish::iAtomic > dish::iAtomic::Clone() const
     return clone;
 }
 
+bool dish::iAtomic::IsAliased() const
+{
+    return false;
+}
+
 const bool &dish::iAtomic::IsLocked() const throw()
 {
     return mLocked;
@@ -165,22 +171,22 @@ void dish::iAtomic::Assign(const iValueAtomic &rhs)
 
 void dish::iAtomic::Assign(const dish::BooleanT &rhs)
 {
-    Assign(*BooleanValue::MakeLockedValue(rhs));
+    Assign(std::shared_ptr< iAtomic >(BooleanValue::MakeLockedValue(rhs)));
 }
 
 void dish::iAtomic::Assign(const dish::IntegerT &rhs)
 {
-    Assign(*IntegerValue::MakeValue(rhs));
+    Assign(std::shared_ptr< iAtomic >(IntegerValue::MakeValue(rhs)));
 }
 
 void dish::iAtomic::Assign(const dish::RealT &rhs)
 {
-    Assign(*RealValue::MakeValue(rhs));
+    Assign(std::shared_ptr< iAtomic >(RealValue::MakeValue(rhs)));
 }
 
 void dish::iAtomic::Assign(const dish::StringT &rhs)
 {
-    Assign(*StringValue::MakeValue(rhs));
+    Assign(std::shared_ptr< iAtomic >(StringValue::MakeValue(rhs)));
 }
 
 dish::IntegerT dish::iAtomic::Members(dish::iStructureAtomic::MemberNameSetT &members) const
@@ -220,6 +226,21 @@ std::shared_ptr< dish::iAtomic > dish::iAtomic::Member(const std::string &member
     throw NoSuchMemberException(message.str());
 }
 
+std::shared_ptr< dish::iAtomic > dish::iAtomic::InspectMember(const std::string &member) const
+{
+    return Member(member);
+}
+
+std::shared_ptr< dish::iAtomic > dish::iAtomic::Member(const std::string &member, dish::iAtomic::MemberCacheT &cache) const
+{
+    return Member(member);
+}
+
+std::shared_ptr< dish::iAtomic > dish::iAtomic::InspectMember(const std::string &member, dish::iAtomic::MemberCacheT &cache) const
+{
+    return InspectMember(member);
+}
+
 dish::IntegerT dish::iAtomic::Add(std::shared_ptr< dish::iAtomic > element)
 {
     std::stringstream message;
@@ -262,6 +283,16 @@ void dish::iAtomic::Swap(const dish::IntegerT &a, const dish::IntegerT &b)
     throw IllegalTypeException(message.str());
 }
 
+std::shared_ptr< dish::iAtomic > dish::iAtomic::InspectElement(const dish::IntegerT &index) const
+{
+    return Element(index);
+}
+
+void dish::iAtomic::InspectElement(const dish::IntegerT &index, dish::ValueHandle &value) const
+{
+    value.Set(InspectElement(index));
+}
+
 dish::IntegerT dish::iAtomic::Add(std::shared_ptr< dish::iAtomic > key, std::shared_ptr< dish::iAtomic > value)
 {
     std::stringstream message;
@@ -294,6 +325,64 @@ std::shared_ptr< dish::iAtomic > dish::iAtomic::Lookup(const dish::StringT &key)
     throw IllegalTypeException(message.str());
 }
 
+std::shared_ptr< const dish::iAtomic::KeyListT > dish::iAtomic::SortedKeys() const
+{
+    std::shared_ptr< iAtomic > keys(Keys());
+    
+    std::shared_ptr< KeyListT > sorted(std::make_shared< KeyListT >());
+    
+    for(IntegerT i(keys->Member("start")->AsInteger()), last_i(keys->Member("finish")->AsInteger()); i <= last_i; ++i)
+    {
+        sorted->push_back(keys->InspectElement(i)->AsString());
+    }
+    
+    return sorted;
+}
+
+std::shared_ptr< dish::iAtomic > dish::iAtomic::InspectLookup(const dish::StringT &key) const
+{
+    return Lookup(key);
+}
+
+std::shared_ptr< dish::iAtomic > dish::iAtomic::Lookup(const dish::IntegerT &key) const
+{
+    std::stringstream str;
+    str << key;
+    
+    return Lookup(str.str());
+}
+
+std::shared_ptr< dish::iAtomic > dish::iAtomic::InspectLookup(const dish::IntegerT &key) const
+{
+    std::stringstream str;
+    str << key;
+    
+    return InspectLookup(str.str());
+}
+
+bool dish::iAtomic::FirstEntry(dish::iAtomic::CursorT &cursor) const
+{
+    cursor.Keys = SortedKeys();
+    cursor.Position = 0;
+    
+    return !cursor.Keys->empty();
+}
+
+bool dish::iAtomic::NextEntry(dish::iAtomic::CursorT &cursor) const
+{
+    return (++cursor.Position < cursor.Keys->size());
+}
+
+std::shared_ptr< dish::iAtomic > dish::iAtomic::EntryValue(const dish::iAtomic::CursorT &cursor) const
+{
+    return Lookup(cursor.Key());
+}
+
+void dish::iAtomic::CopyEntryValue(const dish::iAtomic::CursorT &cursor, std::shared_ptr< dish::iAtomic > &copy) const
+{
+    copy = EntryValue(cursor)->Clone();
+}
+
 std::shared_ptr< dish::iAtomic > dish::iAtomic::Declare() const
 {
     std::stringstream message;
@@ -482,7 +571,7 @@ dish::IntegerT dish::IntegerTypeAtomic::Count(0);
  
 std::shared_ptr< dish::iAtomic > dish::IntegerTypeAtomic::Copy() const
 {
-    return std::shared_ptr< iAtomic >(new IntegerTypeAtomic(mInitialValue));
+    return MakeShared< IntegerTypeAtomic >([&](void *memory) { ::new(memory) IntegerTypeAtomic(mInitialValue); });
 }
  
 std::shared_ptr< dish::iAtomic > dish::IntegerTypeAtomic::Declare() const
@@ -508,7 +597,7 @@ dish::IntegerT dish::RangedIntegerTypeAtomic::Count(0);
  
 std::shared_ptr< dish::iAtomic > dish::RangedIntegerTypeAtomic::Copy() const
 {
-    return std::shared_ptr< iAtomic >(new RangedIntegerTypeAtomic(mMinimumRange, mMaximumRange, mRangeBoundary, mInitialValue));
+    return MakeShared< RangedIntegerTypeAtomic >([&](void *memory) { ::new(memory) RangedIntegerTypeAtomic(mMinimumRange, mMaximumRange, mRangeBoundary, mInitialValue); });
 }
  
 std::shared_ptr< dish::iAtomic > dish::RangedIntegerTypeAtomic::Declare() const
@@ -558,7 +647,7 @@ dish::IntegerT dish::RealTypeAtomic::Count(0);
  
 std::shared_ptr< dish::iAtomic > dish::RealTypeAtomic::Copy() const
 {
-    return std::shared_ptr< iAtomic >(new RealTypeAtomic());
+    return MakeShared< RealTypeAtomic >([&](void *memory) { ::new(memory) RealTypeAtomic(); });
 }
  
 std::shared_ptr< dish::iAtomic > dish::RealTypeAtomic::Declare() const
@@ -584,7 +673,7 @@ dish::IntegerT dish::RangedRealTypeAtomic::Count(0);
  
 std::shared_ptr< dish::iAtomic > dish::RangedRealTypeAtomic::Copy() const
 {
-    return std::shared_ptr< iAtomic >(new RangedRealTypeAtomic(mMinimumRange, mMaximumRange, mRangeBoundary, mInitialValue));
+    return MakeShared< RangedRealTypeAtomic >([&](void *memory) { ::new(memory) RangedRealTypeAtomic(mMinimumRange, mMaximumRange, mRangeBoundary, mInitialValue); });
 }
  
 std::shared_ptr< dish::iAtomic > dish::RangedRealTypeAtomic::Declare() const
@@ -634,7 +723,7 @@ dish::IntegerT dish::StringTypeAtomic::Count(0);
  
 std::shared_ptr< dish::iAtomic > dish::StringTypeAtomic::Copy() const
 {
-    return std::shared_ptr< iAtomic >(new StringTypeAtomic());
+    return MakeShared< StringTypeAtomic >([&](void *memory) { ::new(memory) StringTypeAtomic(); });
 }
  
 std::shared_ptr< dish::iAtomic > dish::StringTypeAtomic::Declare() const
@@ -672,7 +761,7 @@ dish::ArrayTypeAtomic::ArrayTypeAtomic(const dish::IntegerT &min, const dish::In
  
 std::shared_ptr< dish::iAtomic > dish::ArrayTypeAtomic::Copy() const
 {
-    return std::shared_ptr< iAtomic >(new ArrayTypeAtomic(mMinimumIndex, mMaximumIndex, mType->Copy()));
+    return MakeShared< ArrayTypeAtomic >([&](void *memory) { ::new(memory) ArrayTypeAtomic(mMinimumIndex, mMaximumIndex, mType->Copy()); });
 }
 
 std::shared_ptr< dish::iAtomic > dish::ArrayTypeAtomic::Declare() const
@@ -721,6 +810,66 @@ void dish::DictionaryTypeAtomic::Print(std::ostream &out, const std::string::siz
     out << "dictionary";
 }
 
+/******************************************************************************
+
+    dish::StructureShape class definitions
+
+ ******************************************************************************/
+
+const std::size_t dish::StructureShape::NOT_FOUND(static_cast< std::size_t >(-1));
+
+dish::IntegerT dish::StructureShape::Count(0);
+
+const dish::StructureShape &dish::StructureShape::Empty()
+{
+    static const StructureShape empty((NameListT()));
+    
+    return empty;
+}
+
+std::size_t dish::StructureShape::Find(const std::string &name) const
+{
+    const NameListT::const_iterator elem(std::lower_bound(mNames.begin(), mNames.end(), name));
+    
+    if((mNames.end() != elem) && (name == *elem))
+    {
+        return static_cast< std::size_t >(elem - mNames.begin());
+    }
+    
+    return NOT_FOUND;
+}
+
+std::map< dish::StructureShape::NameListT, std::unique_ptr< dish::StructureShape > > &dish::StructureShape::shapes()
+{
+    static std::map< NameListT, std::unique_ptr< StructureShape > > shapes;
+    
+    return shapes;
+}
+
+const dish::StructureShape &dish::StructureShape::With(const std::string &name) const
+{
+    assert(NOT_FOUND == Find(name));
+    
+    const StructureShape *&transition(mTransitions[name]);
+    
+    if(0 == transition)
+    {
+        NameListT names(mNames);
+        names.insert(std::lower_bound(names.begin(), names.end(), name), name);
+        
+        std::unique_ptr< StructureShape > &shape(shapes()[names]);
+        
+        if(0 == shape.get())
+        {
+            shape.reset(new StructureShape(names));
+        }
+        
+        transition = shape.get();
+    }
+    
+    return *transition;
+}
+
 /******************************************************************************
 
     dish::StructureTypeAtomic class definitions
@@ -788,6 +937,9 @@ void dish::StructureTypeAtomic::Add(const std::string &id, std::shared_ptr< dish
     }
 
     mMemberList.push_back(std::make_pair(id, type));
+    
+    mShape = 0;
+    mOffsets.clear();
 }
  
 std::shared_ptr< dish::iAtomic > dish::StructureTypeAtomic::Copy() const
@@ -807,13 +959,33 @@ std::shared_ptr< dish::iAtomic > dish::StructureTypeAtomic::Copy() const
 
 std::shared_ptr< dish::iAtomic > dish::StructureTypeAtomic::Declare() const
 {
-    std::shared_ptr< StructureValue > structure(StructureValue::MakeValue());
+    if(0 == mShape)
+    {
+        const StructureShape *shape(&StructureShape::Empty());
+        
+        for(MemberListT::const_iterator i(mMemberList.begin()), last_i(mMemberList.end()); i != last_i; ++i)
+        {
+            shape = &shape->With(i->first);
+        }
+        
+        for(MemberListT::const_iterator i(mMemberList.begin()), last_i(mMemberList.end()); i != last_i; ++i)
+        {
+            mOffsets.push_back(shape->Find(i->first));
+        }
+        
+        mShape = shape;
+    }
+    
+    std::shared_ptr< StructureValue > structure(MakeShared< StructureValue >([&](void *memory) { ::new(memory) StructureValue(*mShape); }));
+    
+    StructureValue::MemberSetT &members(structure->members());
+    std::vector< std::size_t >::const_iterator offset(mOffsets.begin());
     
     std::for_each(
         mMemberList.begin(), mMemberList.end(),
         [&](const MemberListT::value_type &elem)
         {
-            structure->Add(elem.first, elem.second->Declare());
+            members[*offset++] = elem.second->Declare();
         }
     );
     
@@ -1021,6 +1193,11 @@ std::shared_ptr< dish::iAtomic > dish::ReferenceValue::Clone() const
     return mValue->Clone();
 }
 
+bool dish::ReferenceValue::IsAliased() const
+{
+    return true;
+}
+
 dish::BooleanT dish::ReferenceValue::AsBoolean() const
 {
     return mValue->AsBoolean();
@@ -1076,6 +1253,21 @@ std::shared_ptr< dish::iAtomic > dish::ReferenceValue::Member(const std::string
     return mValue->Member(member);
 }
 
+std::shared_ptr< dish::iAtomic > dish::ReferenceValue::InspectMember(const std::string &member) const
+{
+    return mValue->InspectMember(member);
+}
+
+std::shared_ptr< dish::iAtomic > dish::ReferenceValue::Member(const std::string &member, dish::iAtomic::MemberCacheT &cache) const
+{
+    return mValue->Member(member, cache);
+}
+
+std::shared_ptr< dish::iAtomic > dish::ReferenceValue::InspectMember(const std::string &member, dish::iAtomic::MemberCacheT &cache) const
+{
+    return mValue->InspectMember(member, cache);
+}
+
 dish::IntegerT dish::ReferenceValue::Add(std::shared_ptr< dish::iAtomic > element)
 {
     return mValue->Add(element);
@@ -1091,6 +1283,16 @@ std::shared_ptr< dish::iAtomic > dish::ReferenceValue::Element(const dish::Integ
     return mValue->Element(index);
 }
 
+std::shared_ptr< dish::iAtomic > dish::ReferenceValue::InspectElement(const dish::IntegerT &index) const
+{
+    return mValue->InspectElement(index);
+}
+
+void dish::ReferenceValue::InspectElement(const dish::IntegerT &index, dish::ValueHandle &value) const
+{
+    mValue->InspectElement(index, value);
+}
+
 dish::IntegerT dish::ReferenceValue::Add(std::shared_ptr< dish::iAtomic > key, std::shared_ptr< dish::iAtomic > value)
 {
     return mValue->Add(key, value);
@@ -1106,6 +1308,31 @@ std::shared_ptr< dish::iAtomic > dish::ReferenceValue::Lookup(const dish::String
     return mValue->Lookup(key);
 }
 
+std::shared_ptr< dish::iAtomic > dish::ReferenceValue::InspectLookup(const dish::StringT &key) const
+{
+    return mValue->InspectLookup(key);
+}
+
+std::shared_ptr< const dish::iAtomic::KeyListT > dish::ReferenceValue::SortedKeys() const
+{
+    return mValue->SortedKeys();
+}
+
+std::shared_ptr< dish::iAtomic > dish::ReferenceValue::Lookup(const dish::IntegerT &key) const
+{
+    return mValue->Lookup(key);
+}
+
+std::shared_ptr< dish::iAtomic > dish::ReferenceValue::InspectLookup(const dish::IntegerT &key) const
+{
+    return mValue->InspectLookup(key);
+}
+
+void dish::ReferenceValue::CopyEntryValue(const dish::iAtomic::CursorT &cursor, std::shared_ptr< dish::iAtomic > &copy) const
+{
+    mValue->CopyEntryValue(cursor, copy);
+}
+
 std::shared_ptr< dish::iAtomic > dish::ReferenceValue::Declare() const
 {
     return mValue->Declare();
@@ -1444,7 +1671,11 @@ std::shared_ptr< dish::IntegerValue > dish::IntegerValue::MakeValue(const dish::
         return elem.second;
     }
     
+#ifdef RECYCLE_PRIMITIVES
     return std::shared_ptr< IntegerValue >(new IntegerValue(value, locked));
+#else
+    return MakeShared< IntegerValue >([&](void *memory) { ::new(memory) IntegerValue(value, locked); });
+#endif
 }
 
 void dish::IntegerValue::PrintTableStatistics(std::ostream &out)
@@ -2198,6 +2429,17 @@ std::shared_ptr< dish::iAtomic > dish::StringValue::Clone() const
     return StringValue::MakeValue(mValue, IsLocked());
 }
 
+/******************************************************************************
+
+    dish::EntryKeyValue class definitions
+
+ ******************************************************************************/
+ 
+std::shared_ptr< dish::iAtomic > dish::EntryKeyValue::Copy() const
+{
+    return StringValue::MakeValue(mValue, UNLOCKED);
+}
+
 /******************************************************************************
 
     dish::ArrayValue class definitions
@@ -2205,138 +2447,542 @@ std::shared_ptr< dish::iAtomic > dish::StringValue::Clone() const
  ******************************************************************************/
  
 dish::IntegerT dish::ArrayValue::Count(0);
+dish::IntegerT dish::ArrayValue::Shares(0);
+dish::IntegerT dish::ArrayValue::Unshares(0);
+dish::IntegerT dish::ArrayValue::Packs(0);
+dish::IntegerT dish::ArrayValue::Proxies(0);
 
 dish::ArrayValue::ArrayValue(const dish::IntegerT &mini, const dish::IntegerT &nelem, std::shared_ptr< dish::iAtomic > type) : dish::iAtomic(),
-    mValue(),
+    mStorage(std::make_shared< StorageT >(this, false)),
     mIndexOffset(-mini),
-    
     mInitialized(false),
+    
     mFinishV(),
     mLengthV(),
-    mStartV()
+    mStartV(),
+    
+    mProxy(),
+    mProxyIndex(0)
 {
     assert(nelem >= 0);
     assert(type);
-
-    mValue.resize(nelem);
     
-    std::for_each(
-        mValue.begin(), mValue.end(),
-        [&](ArrayT::value_type &element)
+    const TypeAtomic * const typeatomic(dynamic_cast< const TypeAtomic * >(type.get()));
+    
+    if((0 != typeatomic) && (nelem > 0))
+    {
+        //  Every element starts out as a copy of the first.
+        std::shared_ptr< iAtomic > first(type->Declare());
+        
+        const std::type_info &elemtype(typeid(*first));
+        
+        PackedValueT value;
+        value.Integer = 0;
+        
+        if(typeid(IntegerValue) == elemtype)
         {
-            element = type->Declare();
+            mStorage->Packed = std::make_shared< PackedT >(typeInteger);
+            value.Integer = first->AsInteger();
         }
-    );
-    
-    ++Count;
-}
-
-void dish::ArrayValue::Lock() throw()
-{
-    std::for_each(
-        mValue.begin(), mValue.end(),
-        [&](ArrayT::value_type &element)
+        
+        else if(typeid(RealValue) == elemtype)
         {
-            element->Lock();
+            mStorage->Packed = std::make_shared< PackedT >(typeReal);
+            value.Real = first->AsReal();
         }
-    );
+        
+        else if(typeid(BooleanValue) == elemtype)
+        {
+            mStorage->Packed = std::make_shared< PackedT >(typeBoolean);
+            value.Boolean = first->AsBoolean();
+        }
+        
+        if(packed())
+        {
+            mStorage->Packed->Values.assign(nelem, value);
+            typeatomic->declare(nelem - 1);
+            
+            ++Packs;
+        }
+        else
+        {
+            elements().reserve(nelem);
+            elements().push_back(first);
+        }
+    }
     
-    iAtomic::Lock();
+    while(!packed() && (static_cast< IntegerT >(elements().size()) < nelem))
+    {
+        elements().push_back(type->Declare());
+    }
+    
+    ++Count;
 }
- 
-dish::TypeAtomic::TypeT dish::ArrayValue::Type() const throw()
+
+dish::ArrayValue::~ArrayValue()
 {
-    return typeArray;
+    if(this == mStorage->Owner)
+    {
+        mStorage->Owner = 0;
+    }
 }
- 
-std::shared_ptr< dish::iAtomic > dish::ArrayValue::Copy() const
+
+bool dish::ArrayValue::packs(const dish::iAtomic &element) const
 {
-    std::shared_ptr< ArrayValue > value(new ArrayValue(-mIndexOffset, mValue.size()));
+    if(element.IsLocked())
+    {
+        return false;
+    }
     
-    ArrayT::const_iterator i(mValue.begin());
+    const std::type_info &elemtype(typeid(element));
     
-    std::for_each(
-        value->mValue.begin(), value->mValue.end(),
-        [&](ArrayT::value_type &element)
-        {
-            element = (*i++)->Clone();
-        }
-    );
+    switch(mStorage->Packed->Type)
+    {
+        case typeInteger: return (typeid(IntegerValue) == elemtype);
+        case typeReal: return (typeid(RealValue) == elemtype);
+        case typeBoolean: return (typeid(BooleanValue) == elemtype);
+        
+        default: break;
+    }
     
-    return value;
+    return false;
 }
 
-dish::StringT dish::ArrayValue::AsString() const
+dish::ArrayValue::PackedValueT dish::ArrayValue::pack(const dish::iAtomic &element) const
 {
-    std::stringstream str;
-    
-    str << "Array [";
-    str << -mIndexOffset;
-    str << ", ";
-    str << (static_cast< IntegerT >(mValue.size()) - mIndexOffset - 1);
-    str << "]{ ";
-    
-    std::for_each(
-        mValue.begin(), mValue.end(),
-        [&](const ArrayT::value_type &value)
-        {
-            str << value->AsString();
-            str << ", ";
-        }
-    );
+    PackedValueT value;
     
-    str << " }";
+    switch(mStorage->Packed->Type)
+    {
+        case typeInteger: value.Integer = element.AsInteger(); break;
+        case typeReal: value.Real = element.AsReal(); break;
+        default: value.Boolean = element.AsBoolean(); break;
+    }
     
-    return str.str();
+    return value;
 }
 
-void dish::ArrayValue::Assign(std::shared_ptr< iAtomic > rhs)
+bool dish::ArrayValue::held(const std::size_t &adj_index) const
 {
-    if(Member("length")->AsInteger() == rhs->Member("length")->AsInteger())
+    const PackedT &packed(*mStorage->Packed);
+    
+    for(auto i(packed.Proxies.begin()), last_i(packed.Proxies.end()); i != last_i; ++i)
     {
-        IntegerT lhs_i(Member("start")->AsInteger());
-        const IntegerT lhs_last_i(Member("finish")->AsInteger());
+        std::shared_ptr< iAtomic > proxy(i->first.lock());
         
-        IntegerT rhs_i(rhs->Member("start")->AsInteger());
-
-        while(lhs_i <= lhs_last_i)
+        //  The proxy to be reused is held only by the array and here.
+        if((0 != proxy.get()) && (adj_index == *(i->second)) && ((proxy != mProxy) || (proxy.use_count() > 2)))
         {
-            Element(lhs_i++)->Assign(rhs->Element(rhs_i++));
+            return true;
         }
     }
-    else
-    {
-        throw MatrixDimensionErrorException("The matrix boundaries of the left- and right- sides of the assignment do not match.");
-    }
+    
+    return false;
 }
 
-std::shared_ptr< dish::iAtomic > dish::ArrayValue::Member(const std::string &member) const
+std::shared_ptr< dish::iAtomic > dish::ArrayValue::box(const std::size_t &adj_index, const bool &locked) const
 {
-    if(IsEqual("start", member, CASE_INSENSITIVE))
+    const PackedT &packed(*mStorage->Packed);
+    const PackedValueT &value(packed.Values[adj_index]);
+    
+    switch(packed.Type)
     {
-        if(0 == mStartV.get())
-        {
-            mStartV = IntegerValue::MakeValue(-mIndexOffset, LOCKED);
-        }
+        case typeInteger: return IntegerValue::MakeValue(value.Integer, locked);
+        case typeReal: return RealValue::MakeValue(value.Real, locked);
         
-        return mStartV;
+        default: break;
     }
     
-    else if(IsEqual("finish", member, CASE_INSENSITIVE))
+    return BooleanValue::MakeValue(value.Boolean, locked);
+}
+
+std::shared_ptr< dish::iAtomic > dish::ArrayValue::proxy(const std::size_t &adj_index) const
+{
+    PackedT &packed(*mStorage->Packed);
+    
+    if((0 != mProxy.get()) && (1 == mProxy.use_count()))
     {
-        if(0 == mFinishV.get())
-        {
-            mFinishV = IntegerValue::MakeValue(static_cast< IntegerT >(mValue.size()) - mIndexOffset - 1, LOCKED);
-        }
+        //  Nothing but this array refers to the proxy handed out last.
+        *mProxyIndex = adj_index;
         
-        return mFinishV;
+        return mProxy;
     }
     
-    else if(IsEqual("length", member, CASE_INSENSITIVE))
+    if(packed.Proxies.size() >= packed.PruneAt)
+    {
+        packed.Proxies.erase(
+            std::remove_if(
+                packed.Proxies.begin(), packed.Proxies.end(),
+                [](const std::pair< std::weak_ptr< iAtomic >, std::size_t * > &proxy)
+                {
+                    return proxy.first.expired();
+                }
+            ),
+            packed.Proxies.end()
+        );
+        
+        packed.PruneAt = std::max(static_cast< std::size_t >(16), 2 * packed.Proxies.size());
+    }
+    
+    switch(packed.Type)
+    {
+        case typeInteger:
+        {
+            std::shared_ptr< IntegerElementT > element(MakeShared< IntegerElementT >([&](void *memory) { ::new(memory) IntegerElementT(mStorage->Packed, adj_index, IsLocked()); }));
+            mProxyIndex = &element->Index();
+            mProxy = element;
+        } break;
+        
+        case typeReal:
+        {
+            std::shared_ptr< RealElementT > element(MakeShared< RealElementT >([&](void *memory) { ::new(memory) RealElementT(mStorage->Packed, adj_index, IsLocked()); }));
+            mProxyIndex = &element->Index();
+            mProxy = element;
+        } break;
+        
+        default:
+        {
+            std::shared_ptr< BooleanElementT > element(MakeShared< BooleanElementT >([&](void *memory) { ::new(memory) BooleanElementT(mStorage->Packed, adj_index, IsLocked()); }));
+            mProxyIndex = &element->Index();
+            mProxy = element;
+        } break;
+    }
+    
+    packed.Proxies.push_back(std::make_pair(std::weak_ptr< iAtomic >(mProxy), mProxyIndex));
+    
+    ++Proxies;
+    
+    return mProxy;
+}
+
+void dish::ArrayValue::unpack()
+{
+    if(packed())
+    {
+        const PackedT &packed(*mStorage->Packed);
+        
+        ArrayT &elements(this->elements());
+        
+        elements.clear();
+        elements.reserve(packed.Values.size());
+        
+        for(std::size_t i(0), last_i(packed.Values.size()); i != last_i; ++i)
+        {
+            elements.push_back(box(i, UNLOCKED));
+        }
+        
+        for(auto i(packed.Proxies.begin()), last_i(packed.Proxies.end()); i != last_i; ++i)
+        {
+            std::shared_ptr< iAtomic > proxy(i->first.lock());
+            
+            if(0 != proxy.get())
+            {
+                elements[*(i->second)] = proxy;
+            }
+        }
+        
+        mStorage->Packed.reset();
+        
+        mProxy.reset();
+        mProxyIndex = 0;
+    }
+}
+
+std::size_t dish::ArrayValue::adjustIndex(const dish::IntegerT &index) const
+{
+    const std::size_t adj_index(static_cast< std::size_t >(index + mIndexOffset));
+    
+    if(adj_index < static_cast< std::size_t >(length()))
+    {
+        return adj_index;
+    }
+    
+    std::stringstream message;
+    message << "The specified index, ";
+    message << index;
+    message << ", does not fall within [";
+    message << -mIndexOffset;
+    message << ", ";
+    message << (length() - mIndexOffset - 1);
+    message << "].";
+    
+    throw IllegalIndexException(message.str());
+}
+
+void dish::ArrayValue::unshare() const
+{
+    if(mStorage.use_count() > 1)
+    {
+        std::shared_ptr< StorageT > storage(std::make_shared< StorageT >(this, false));
+        
+        ArrayT &shared(mStorage->Elements);
+        ArrayT &own(storage->Elements);
+        
+        if(this == mStorage->Owner)
+        {
+            storage->Exposed = mStorage->Exposed;
+            
+            //  References to our elements may exist, so we keep them and leave
+            //  clones to the arrays still sharing the storage.
+            own.swap(shared);
+            
+            shared.reserve(own.size());
+            std::for_each(
+                own.begin(), own.end(),
+                [&](const ArrayT::value_type &element)
+                {
+                    shared.push_back(element->Clone());
+                }
+            );
+            
+            if(packed())
+            {
+                storage->Packed = mStorage->Packed;
+                mStorage->Packed = std::make_shared< PackedT >(*storage->Packed);
+            }
+            
+            mStorage->Owner = 0;
+        }
+        else
+        {
+            own.reserve(shared.size());
+            std::for_each(
+                shared.begin(), shared.end(),
+                [&](const ArrayT::value_type &element)
+                {
+                    own.push_back(element->Clone());
+                }
+            );
+            
+            if(packed())
+            {
+                storage->Packed = std::make_shared< PackedT >(*mStorage->Packed);
+            }
+            
+            mProxy.reset();
+            mProxyIndex = 0;
+        }
+        
+        mStorage = storage;
+        
+        ++Unshares;
+    }
+    else
+    {
+        mStorage->Owner = this;
+    }
+}
+
+void dish::ArrayValue::Lock() throw()
+{
+    unshare();
+    
+    std::for_each(
+        elements().begin(), elements().end(),
+        [&](ArrayT::value_type &element)
+        {
+            element->Lock();
+        }
+    );
+    
+    if(packed())
+    {
+        const PackedT &packed(*mStorage->Packed);
+        
+        for(auto i(packed.Proxies.begin()), last_i(packed.Proxies.end()); i != last_i; ++i)
+        {
+            std::shared_ptr< iAtomic > proxy(i->first.lock());
+            
+            if(0 != proxy.get())
+            {
+                proxy->Lock();
+            }
+        }
+    }
+    
+    iAtomic::Lock();
+}
+ 
+dish::TypeAtomic::TypeT dish::ArrayValue::Type() const throw()
+{
+    return typeArray;
+}
+ 
+std::shared_ptr< dish::iAtomic > dish::ArrayValue::Copy() const
+{
+    if(!IsAliased())
+    {
+        //  The elements are cloned when either array first needs them.
+        return MakeShared< ArrayValue >([&](void *memory) { ::new(memory) ArrayValue(*this); });
+    }
+    
+    if(packed())
+    {
+        //  The values are copied now, before a reference to one of them
+        //  changes it.
+        std::shared_ptr< ArrayValue > value(MakeShared< ArrayValue >([&](void *memory) { ::new(memory) ArrayValue(*this); }));
+        value->unshare();
+        
+        return value;
+    }
+    
+    std::shared_ptr< ArrayValue > value(MakeShared< ArrayValue >([&](void *memory) { ::new(memory) ArrayValue(-mIndexOffset, elements().size()); }));
+    
+    ArrayT::const_iterator i(elements().begin());
+    
+    std::for_each(
+        value->elements().begin(), value->elements().end(),
+        [&](ArrayT::value_type &element)
+        {
+            element = (*i++)->Clone();
+        }
+    );
+    
+    return value;
+}
+
+std::shared_ptr< dish::iAtomic > dish::ArrayValue::Clone() const
+{
+    if(IsAliased())
+    {
+        return iAtomic::Clone();
+    }
+    
+    std::shared_ptr< ArrayValue > value(MakeShared< ArrayValue >([&](void *memory) { ::new(memory) ArrayValue(*this); }));
+    
+    //  The elements of a locked array are locked as well, so the clone can
+    //  go on sharing them.
+    if(IsLocked())
+    {
+        value->iAtomic::Lock();
+    }
+    
+    return value;
+}
+
+bool dish::ArrayValue::IsAliased() const
+{
+    if(mStorage->Exposed)
+    {
+        if(packed())
+        {
+            const PackedT &packed(*mStorage->Packed);
+            
+            for(auto i(packed.Proxies.begin()), last_i(packed.Proxies.end()); i != last_i; ++i)
+            {
+                std::shared_ptr< iAtomic > proxy(i->first.lock());
+                
+                //  Held here, by the array if it is the proxy to be reused,
+                //  and by whatever refers to it.
+                if((0 != proxy.get()) && !proxy->IsLocked() && (proxy.use_count() > ((proxy == mProxy) ? 2 : 1)))
+                {
+                    return true;
+                }
+            }
+        }
+        else
+        {
+            const ArrayT &elements(this->elements());
+            
+            for(ArrayT::const_iterator i(elements.begin()), last(elements.end()); i != last; ++i)
+            {
+                //  A locked element cannot be modified through a reference to it;
+                //  this includes the null value a new array is filled with.
+                if(((*i).use_count() > 1 && !(*i)->IsLocked()) || (*i)->IsAliased())
+                {
+                    return true;
+                }
+            }
+        }
+        
+        mStorage->Exposed = false;
+    }
+    
+    return false;
+}
+
+dish::StringT dish::ArrayValue::AsString() const
+{
+    std::stringstream str;
+    
+    str << "Array [";
+    str << -mIndexOffset;
+    str << ", ";
+    str << (length() - mIndexOffset - 1);
+    str << "]{ ";
+    
+    if(packed())
+    {
+        for(std::size_t i(0), last_i(static_cast< std::size_t >(length())); i != last_i; ++i)
+        {
+            str << box(i, UNLOCKED)->AsString();
+            str << ", ";
+        }
+    }
+    
+    std::for_each(
+        elements().begin(), elements().end(),
+        [&](const ArrayT::value_type &value)
+        {
+            str << value->AsString();
+            str << ", ";
+        }
+    );
+    
+    str << " }";
+    
+    return str.str();
+}
+
+void dish::ArrayValue::Assign(std::shared_ptr< iAtomic > rhs)
+{
+    if(Member("length")->AsInteger() == rhs->Member("length")->AsInteger())
+    {
+        IntegerT lhs_i(Member("start")->AsInteger());
+        const IntegerT lhs_last_i(Member("finish")->AsInteger());
+        
+        IntegerT rhs_i(rhs->Member("start")->AsInteger());
+
+        while(lhs_i <= lhs_last_i)
+        {
+            std::shared_ptr< iAtomic > element(Element(lhs_i++));
+            
+            element->Assign(rhs->InspectElement(rhs_i++));
+        }
+    }
+    else
+    {
+        throw MatrixDimensionErrorException("The matrix boundaries of the left- and right- sides of the assignment do not match.");
+    }
+}
+
+std::shared_ptr< dish::iAtomic > dish::ArrayValue::Member(const std::string &member) const
+{
+    if(IsEqual("start", member, CASE_INSENSITIVE))
+    {
+        if(0 == mStartV.get())
+        {
+            mStartV = IntegerValue::MakeValue(-mIndexOffset, LOCKED);
+        }
+        
+        return mStartV;
+    }
+    
+    else if(IsEqual("finish", member, CASE_INSENSITIVE))
+    {
+        if(0 == mFinishV.get())
+        {
+            mFinishV = IntegerValue::MakeValue(length() - mIndexOffset - 1, LOCKED);
+        }
+        
+        return mFinishV;
+    }
+    
+    else if(IsEqual("length", member, CASE_INSENSITIVE))
     {
         if(0 == mLengthV.get())
         {
-            mLengthV = IntegerValue::MakeValue(static_cast< IntegerT >(mValue.size()), LOCKED);
+            mLengthV = IntegerValue::MakeValue(length(), LOCKED);
         }
         
         return mLengthV;
@@ -2344,7 +2990,7 @@ std::shared_ptr< dish::iAtomic > dish::ArrayValue::Member(const std::string &mem
     
     else if(IsEqual("empty", member, CASE_INSENSITIVE))
     {
-        return BooleanValue::MakeLockedValue(mValue.empty());
+        return BooleanValue::MakeLockedValue(0 == length());
     }
 
     return iAtomic::Member(member);
@@ -2356,18 +3002,46 @@ dish::IntegerT dish::ArrayValue::Add(std::shared_ptr< dish::iAtomic > element)
     
     if(!IsLocked())
     {
+        unshare();
         invalidate();
         
         IntegerT ret(mIndexOffset);
         
+        if(packed() && (!packs(*element) || (!mInitialized && held(0))))
+        {
+            unpack();
+        }
+        
+        mStorage->Exposed = true;
+        
+        if(packed())
+        {
+            std::vector< PackedValueT > &values(mStorage->Packed->Values);
+            
+            if(mInitialized)
+            {
+                ret += static_cast< IntegerT >(values.size());
+                values.push_back(pack(*element));
+            }
+            else
+            {
+                values.front() = pack(*element);
+                mInitialized = true;
+            }
+            
+            return ret;
+        }
+        
+        ArrayT &elements(this->elements());
+        
         if(mInitialized)
         {
-            ret += static_cast< IntegerT >(mValue.size());
-            mValue.push_back(element);
+            ret += static_cast< IntegerT >(elements.size());
+            elements.push_back(element);
         }
         else
         {
-            mValue.front() = element;
+            elements.front() = element;
             mInitialized = true;
         }
         
@@ -2383,9 +3057,47 @@ dish::IntegerT dish::ArrayValue::Add(std::shared_ptr< dish::iAtomic > element, c
     
     if(!IsLocked())
     {
+        unshare();
         invalidate();
-    
-        const IntegerT array_size(static_cast< IntegerT >(mValue.size()));
+        
+        if(packed() && (!packs(*element) || (!mInitialized && held(0))))
+        {
+            unpack();
+        }
+        
+        const IntegerT array_size(length());
+        
+        mStorage->Exposed = true;
+        
+        if(packed())
+        {
+            PackedT &packed(*mStorage->Packed);
+            
+            if(mInitialized)
+            {
+                const std::size_t adj_index(static_cast< std::size_t >(std::min(std::max(index + mIndexOffset, static_cast< IntegerT >(0)), array_size)));
+                
+                packed.Values.insert(packed.Values.begin() + adj_index, pack(*element));
+                
+                //  The elements after it move up, and so do their proxies.
+                for(auto i(packed.Proxies.begin()), last_i(packed.Proxies.end()); i != last_i; ++i)
+                {
+                    if(!i->first.expired() && (*(i->second) >= adj_index))
+                    {
+                        ++*(i->second);
+                    }
+                }
+            }
+            else
+            {
+                packed.Values.front() = pack(*element);
+                mInitialized = true;
+            }
+            
+            return (array_size + mIndexOffset + 1);
+        }
+        
+        ArrayT &elements(this->elements());
         
         if(mInitialized)
         {
@@ -2393,22 +3105,22 @@ dish::IntegerT dish::ArrayValue::Add(std::shared_ptr< dish::iAtomic > element, c
             
             if(adj_index <= 0)
             {
-                mValue.insert(mValue.begin(), element);
+                elements.insert(elements.begin(), element);
             }
             
             else if(adj_index >= array_size)
             {
-                mValue.insert(mValue.end(), element);
+                elements.insert(elements.end(), element);
             }
             
             else
             {
-                mValue.insert(mValue.begin() + adj_index, element);
+                elements.insert(elements.begin() + adj_index, element);
             }
         }
         else
         {
-            mValue.front() = element;
+            elements.front() = element;
             mInitialized = true;
         }
         
@@ -2420,34 +3132,55 @@ dish::IntegerT dish::ArrayValue::Add(std::shared_ptr< dish::iAtomic > element, c
 
 std::shared_ptr< dish::iAtomic > dish::ArrayValue::Element(const dish::IntegerT &index) const
 {
-    const ArrayT::size_type adj_index(
-        static_cast< ArrayT::size_type >(index + mIndexOffset)
-    );
+    unshare();
+    mStorage->Exposed = true;
     
-    if(adj_index < mValue.size())
+    if(packed())
     {
-        return mValue[adj_index];
+        return proxy(adjustIndex(index));
     }
+    
+    return InspectElement(index);
+}
 
-    std::stringstream message;
-    message << "The specified index, ";
-    message << index;
-    message << ", does not fall within [";
-    message << -mIndexOffset;
-    message << ", ";
-    message << (static_cast< IntegerT >(mValue.size()) - mIndexOffset - 1);
-    message << "].";
+std::shared_ptr< dish::iAtomic > dish::ArrayValue::InspectElement(const dish::IntegerT &index) const
+{
+    if(packed())
+    {
+        return box(adjustIndex(index), IsLocked());
+    }
     
-    throw IllegalIndexException(message.str());
+    return elements()[adjustIndex(index)];
+}
+
+void dish::ArrayValue::InspectElement(const dish::IntegerT &index, dish::ValueHandle &value) const
+{
+    if(packed())
+    {
+        const PackedT &packed(*mStorage->Packed);
+        const PackedValueT &element(packed.Values[adjustIndex(index)]);
+        
+        switch(packed.Type)
+        {
+            case typeInteger: value.SetInteger(element.Integer); break;
+            case typeReal: value.SetReal(element.Real); break;
+            default: value.SetBoolean(element.Boolean); break;
+        }
+    }
+    else
+    {
+        value.Set(elements()[adjustIndex(index)]);
+    }
 }
 
 void dish::ArrayValue::Swap(const dish::IntegerT &a, const dish::IntegerT &b)
 {
     if(!IsLocked())
     {
+        unshare();
         invalidate();
-    
-        const ArrayT::size_type length(mValue.size());
+        
+        const ArrayT::size_type length(static_cast< ArrayT::size_type >(this->length()));
 
         const ArrayT::size_type aindex(
             static_cast< ArrayT::size_type >(a + mIndexOffset)
@@ -2461,7 +3194,35 @@ void dish::ArrayValue::Swap(const dish::IntegerT &a, const dish::IntegerT &b)
         {
             if(aindex != bindex)
             {
-                std::swap(mValue[aindex], mValue[bindex]);
+                if(packed())
+                {
+                    PackedT &packed(*mStorage->Packed);
+                    
+                    std::swap(packed.Values[aindex], packed.Values[bindex]);
+                    
+                    //  A reference to an element follows it.
+                    for(auto i(packed.Proxies.begin()), last_i(packed.Proxies.end()); i != last_i; ++i)
+                    {
+                        if(!i->first.expired())
+                        {
+                            std::size_t &index(*(i->second));
+                            
+                            if(aindex == index)
+                            {
+                                index = bindex;
+                            }
+                            
+                            else if(bindex == index)
+                            {
+                                index = aindex;
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    std::swap(elements()[aindex], elements()[bindex]);
+                }
             }
         }
         else
@@ -2472,7 +3233,7 @@ void dish::ArrayValue::Swap(const dish::IntegerT &a, const dish::IntegerT &b)
             message << ", does not fall within [";
             message << -mIndexOffset;
             message << ", ";
-            message << (static_cast< IntegerT >(mValue.size()) - mIndexOffset - 1);
+            message << (static_cast< IntegerT >(length) - mIndexOffset - 1);
             message << "].";
             
             throw IllegalIndexException(message.str());
@@ -2491,13 +3252,22 @@ void dish::ArrayValue::Print(std::ostream &out, const std::string::size_type &in
     out << "[";
     out << (-mIndexOffset);
     out << ", ";
-    out << (static_cast< IntegerT >(mValue.size()) + mIndexOffset - 1);
+    out << (length() + mIndexOffset - 1);
     out << "]: ";
     
     out << "{ ";
+    
+    if(packed())
+    {
+        for(std::size_t i(0), last_i(static_cast< std::size_t >(length())); i != last_i; ++i)
+        {
+            box(i, UNLOCKED)->Print(out, indent + 8);
+            out << ", ";
+        }
+    }
 
     std::for_each(
-        mValue.begin(), mValue.end(),
+        elements().begin(), elements().end(),
         [&](const ArrayT::value_type &element)
         {
             element->Print(out, indent + 8);
@@ -2516,9 +3286,7 @@ void dish::ArrayValue::Print(std::ostream &out, const std::string::size_type &in
 
 std::shared_ptr< dish::iAtomic > dish::DictionaryValue::ContainsMethod::Execute(dish::LanguageSymbolTable &symtab) const
 {
-    const auto &thisval(thisValue().mValue);
-
-    return BooleanValue::MakeLockedValue(thisval.end() != thisval.find(getParam(symtab, "str")->AsString()));
+    return BooleanValue::MakeLockedValue(0 != thisValue().find(getParam(symtab, "str")->AsString()));
 }
 
 /******************************************************************************
@@ -2555,6 +3323,11 @@ std::shared_ptr< dish::iAtomic > dish::DictionaryValue::ValueHolder::Clone() con
     return mHeldValue->Clone();
 }
 
+bool dish::DictionaryValue::ValueHolder::IsAliased() const
+{
+    return mHeldValue->IsAliased();
+}
+
 dish::BooleanT dish::DictionaryValue::ValueHolder::AsBoolean() const
 {
     return mHeldValue->AsBoolean();
@@ -2581,7 +3354,7 @@ void dish::DictionaryValue::ValueHolder::Assign(std::shared_ptr< dish::iAtomic >
     
     if(!IsLocked())
     {
-        mDictionary.invalidate();
+        invalidate();
     
         mHeldValue = rhs->Clone();
     }
@@ -2596,30 +3369,40 @@ std::shared_ptr< dish::iAtomic > dish::DictionaryValue::ValueHolder::Member(cons
     return mHeldValue->Member(member);
 }
 
+std::shared_ptr< dish::iAtomic > dish::DictionaryValue::ValueHolder::InspectMember(const std::string &member) const
+{
+    return mHeldValue->InspectMember(member);
+}
+
 dish::IntegerT dish::DictionaryValue::ValueHolder::Add(std::shared_ptr< dish::iAtomic > element)
 {
-    mDictionary.invalidate();
+    invalidate();
 
     return mHeldValue->Add(element);
 }
 
 dish::IntegerT dish::DictionaryValue::ValueHolder::Add(std::shared_ptr< dish::iAtomic > element, const dish::IntegerT &index)
 {
-    mDictionary.invalidate();
+    invalidate();
     
     return mHeldValue->Add(element, index);
 }
 
 std::shared_ptr< dish::iAtomic > dish::DictionaryValue::ValueHolder::Element(const dish::IntegerT &index) const
 {
-    mDictionary.invalidate();
+    invalidate();
     
     return mHeldValue->Element(index);
 }
 
+std::shared_ptr< dish::iAtomic > dish::DictionaryValue::ValueHolder::InspectElement(const dish::IntegerT &index) const
+{
+    return mHeldValue->InspectElement(index);
+}
+
 dish::IntegerT dish::DictionaryValue::ValueHolder::Add(std::shared_ptr< dish::iAtomic > key, std::shared_ptr< dish::iAtomic > value)
 {
-    mDictionary.invalidate();
+    invalidate();
     
     return mHeldValue->Add(key, value);
 }
@@ -2631,11 +3414,40 @@ std::shared_ptr< dish::iAtomic > dish::DictionaryValue::ValueHolder::Keys() cons
 
 std::shared_ptr< dish::iAtomic > dish::DictionaryValue::ValueHolder::Lookup(const dish::StringT &key) const
 {
-    mDictionary.invalidate();
+    invalidate();
+    
+    return mHeldValue->Lookup(key);
+}
+
+std::shared_ptr< dish::iAtomic > dish::DictionaryValue::ValueHolder::InspectLookup(const dish::StringT &key) const
+{
+    return mHeldValue->InspectLookup(key);
+}
+
+std::shared_ptr< const dish::iAtomic::KeyListT > dish::DictionaryValue::ValueHolder::SortedKeys() const
+{
+    return mHeldValue->SortedKeys();
+}
+
+std::shared_ptr< dish::iAtomic > dish::DictionaryValue::ValueHolder::Lookup(const dish::IntegerT &key) const
+{
+    invalidate();
     
     return mHeldValue->Lookup(key);
 }
 
+std::shared_ptr< dish::iAtomic > dish::DictionaryValue::ValueHolder::InspectLookup(const dish::IntegerT &key) const
+{
+    return mHeldValue->InspectLookup(key);
+}
+
+void dish::DictionaryValue::ValueHolder::CopyEntryValue(const dish::iAtomic::CursorT &cursor, std::shared_ptr< dish::iAtomic > &copy) const
+{
+    invalidate();
+    
+    mHeldValue->CopyEntryValue(cursor, copy);
+}
+
 std::shared_ptr< dish::iAtomic > dish::DictionaryValue::ValueHolder::Declare() const
 {
     return mHeldValue->Declare();
@@ -2663,14 +3475,281 @@ dish::IntegerT dish::DictionaryValue::ValueHolder::NumParameters() const
  ******************************************************************************/
  
 dish::IntegerT dish::DictionaryValue::Count(0);
+dish::IntegerT dish::DictionaryValue::Shares(0);
+dish::IntegerT dish::DictionaryValue::Unshares(0);
+dish::IntegerT dish::DictionaryValue::IntegerLookups(0);
+
+bool dish::DictionaryValue::isInteger(const dish::StringT &key, dish::IntegerT &value)
+{
+    const std::string::size_type length(key.length());
+    const std::string::size_type first(((length > 1) && ('-' == key[0])) ? 1 : 0);
+    
+    //  No leading zeros and no "-0", so that each integer has one spelling.
+    if((first == length) || (('0' == key[first]) && ((length - first) > 1 || (first > 0))))
+    {
+        return false;
+    }
+    
+    //  The magnitude of INTEGER_MIN is one more than INTEGER_MAX.
+    const std::uint64_t limit(static_cast< std::uint64_t >(INTEGER_MAX) + ((first > 0) ? 1 : 0));
+    
+    std::uint64_t magnitude(0);
+    
+    for(std::string::size_type i(first); i != length; ++i)
+    {
+        if((key[i] < '0') || (key[i] > '9'))
+        {
+            return false;
+        }
+        
+        const std::uint64_t digit(key[i] - '0');
+        
+        if(magnitude > ((limit - digit) / 10))
+        {
+            return false;
+        }
+        
+        magnitude = (magnitude * 10) + digit;
+    }
+    
+    value = (first > 0) ? (-static_cast< IntegerT >(magnitude - 1) - 1) : static_cast< IntegerT >(magnitude);
+    
+    return true;
+}
+
+std::size_t dish::DictionaryValue::hash(const dish::IntegerT &key)
+{
+    //  Spread neighbouring keys over the table, whose size is a power of two.
+    std::uint64_t h(static_cast< std::uint64_t >(key) * 0x9e3779b97f4a7c15ULL);
+    
+    return static_cast< std::size_t >(h ^ (h >> 32));
+}
+
+dish::DictionaryValue::EntryT *dish::DictionaryValue::find(const dish::StringT &key) const
+{
+    IntegerT value(0);
+    
+    if(isInteger(key, value))
+    {
+        return find(value);
+    }
+    
+    const std::vector< std::uint32_t > &slots(mStorage->Slots);
+    
+    if(!slots.empty())
+    {
+        EntryListT &elements(this->elements());
+        
+        const std::size_t mask(slots.size() - 1);
+        const std::size_t h(std::hash< StringT >()(key));
+        
+        for(std::size_t i(h & mask); 0 != slots[i]; i = (i + 1) & mask)
+        {
+            EntryT &entry(elements[slots[i] - 1]);
+            
+            if((h == entry.Hash) && !entry.IsInteger && (key == entry.Key))
+            {
+                return &entry;
+            }
+        }
+    }
+    
+    return 0;
+}
+
+dish::DictionaryValue::EntryT *dish::DictionaryValue::find(const dish::IntegerT &key) const
+{
+    const std::vector< std::uint32_t > &slots(mStorage->Slots);
+    
+    if(!slots.empty())
+    {
+        EntryListT &elements(this->elements());
+        
+        const std::size_t mask(slots.size() - 1);
+        
+        for(std::size_t i(hash(key) & mask); 0 != slots[i]; i = (i + 1) & mask)
+        {
+            EntryT &entry(elements[slots[i] - 1]);
+            
+            if(entry.IsInteger && (key == entry.Integer))
+            {
+                return &entry;
+            }
+        }
+    }
+    
+    return 0;
+}
+
+dish::DictionaryValue::EntryT &dish::DictionaryValue::insert(const dish::DictionaryValue::EntryT &entry) const
+{
+    EntryListT &elements(this->elements());
+    
+    //  The table is kept at most half full.
+    if((2 * (elements.size() + 1)) > mStorage->Slots.size())
+    {
+        rehash(std::max(static_cast< std::size_t >(16), 2 * mStorage->Slots.size()));
+    }
+    
+    std::vector< std::uint32_t > &slots(mStorage->Slots);
+    const std::size_t mask(slots.size() - 1);
+    
+    std::size_t i(entry.Hash & mask);
+    while(0 != slots[i])
+    {
+        i = (i + 1) & mask;
+    }
+    
+    elements.push_back(entry);
+    slots[i] = static_cast< std::uint32_t >(elements.size());
+    
+    mStorage->Sorted.reset();
+    
+    return elements.back();
+}
+
+void dish::DictionaryValue::rehash(const std::size_t &nslots) const
+{
+    std::vector< std::uint32_t > &slots(mStorage->Slots);
+    const EntryListT &elements(this->elements());
+    
+    slots.assign(nslots, 0);
+    
+    const std::size_t mask(nslots - 1);
+    
+    for(std::size_t n(0), last_n(elements.size()); n != last_n; ++n)
+    {
+        std::size_t i(elements[n].Hash & mask);
+        while(0 != slots[i])
+        {
+            i = (i + 1) & mask;
+        }
+        
+        slots[i] = static_cast< std::uint32_t >(n + 1);
+    }
+}
+
+dish::DictionaryValue::EntryT dish::DictionaryValue::makeEntry(const dish::StringT &key, std::shared_ptr< dish::iAtomic > value) const
+{
+    EntryT entry;
+    
+    entry.Key = key;
+    entry.Integer = 0;
+    entry.IsInteger = isInteger(key, entry.Integer);
+    entry.Hash = entry.IsInteger ? hash(entry.Integer) : std::hash< StringT >()(key);
+    entry.Holder = ValueHolder::MakeValue(this, value);
+    
+    return entry;
+}
+
+dish::DictionaryValue::EntryT dish::DictionaryValue::makeEntry(const dish::IntegerT &key, std::shared_ptr< dish::iAtomic > value) const
+{
+    std::stringstream str;
+    str << key;
+    
+    EntryT entry;
+    
+    entry.Key = str.str();
+    entry.Integer = key;
+    entry.IsInteger = true;
+    entry.Hash = hash(key);
+    entry.Holder = ValueHolder::MakeValue(this, value);
+    
+    return entry;
+}
+
+dish::DictionaryValue::~DictionaryValue()
+{
+    if(this == mStorage->Owner)
+    {
+        //  The holders may outlive us in the dictionaries still sharing the
+        //  storage.
+        std::for_each(
+            elements().begin(), elements().end(),
+            [](EntryListT::value_type &entry)
+            {
+                static_cast< ValueHolder & >(*(entry.Holder)).mDictionary = 0;
+            }
+        );
+        
+        mStorage->Owner = 0;
+    }
+}
+
+void dish::DictionaryValue::unshare() const
+{
+    if(mStorage.use_count() > 1)
+    {
+        std::shared_ptr< StorageT > storage(std::make_shared< StorageT >(this, false));
+        
+        EntryListT &shared(mStorage->Elements);
+        EntryListT &own(storage->Elements);
+        
+        //  The entries are copied in order, so the table of their positions
+        //  holds for both.
+        storage->Slots = mStorage->Slots;
+        storage->Sorted = mStorage->Sorted;
+        
+        if(this == mStorage->Owner)
+        {
+            storage->Exposed = mStorage->Exposed;
+            
+            //  References to our holders may exist, so we keep them and leave
+            //  copies to the dictionaries still sharing the storage.
+            own.swap(shared);
+            
+            shared.reserve(own.size());
+            std::for_each(
+                own.begin(), own.end(),
+                [&](const EntryListT::value_type &entry)
+                {
+                    shared.push_back(entry);
+                    shared.back().Holder = ValueHolder::MakeValue(0, entry.Holder->Copy());
+                }
+            );
+            
+            mStorage->Owner = 0;
+        }
+        else
+        {
+            own.reserve(shared.size());
+            std::for_each(
+                shared.begin(), shared.end(),
+                [&](const EntryListT::value_type &entry)
+                {
+                    own.push_back(entry);
+                    own.back().Holder = ValueHolder::MakeValue(this, entry.Holder->Copy());
+                }
+            );
+        }
+        
+        mStorage = storage;
+        
+        ++Unshares;
+    }
+    else if(this != mStorage->Owner)
+    {
+        std::for_each(
+            elements().begin(), elements().end(),
+            [&](EntryListT::value_type &entry)
+            {
+                static_cast< ValueHolder & >(*(entry.Holder)).mDictionary = this;
+            }
+        );
+        
+        mStorage->Owner = this;
+    }
+}
 
 void dish::DictionaryValue::Lock() throw()
 {
+    unshare();
+    
     std::for_each(
-        mValue.begin(), mValue.end(),
-        [](DictionaryT::value_type &value)
+        elements().begin(), elements().end(),
+        [](EntryListT::value_type &entry)
         {
-            value.second->Lock();
+            entry.Holder->Lock();
         }
     );
     
@@ -2684,19 +3763,45 @@ dish::iAtomic::TypeT dish::DictionaryValue::Type() const throw()
 
 std::shared_ptr< dish::iAtomic > dish::DictionaryValue::Copy() const
 {
-    std::shared_ptr< DictionaryValue > dictionary(new DictionaryValue());
+    if(!IsAliased())
+    {
+        //  The values are copied when either dictionary first needs them.
+        return MakeShared< DictionaryValue >([&](void *memory) { ::new(memory) DictionaryValue(*this); });
+    }
+    
+    std::shared_ptr< DictionaryValue > dictionary(MakeShared< DictionaryValue >([&](void *memory) { ::new(memory) DictionaryValue(); }));
     
     std::for_each(
-        mValue.begin(), mValue.end(),
-        [&](const DictionaryT::value_type &value)
+        elements().begin(), elements().end(),
+        [&](const EntryListT::value_type &entry)
         {
-            dictionary->Add(StringValue::MakeValue(value.first), value.second->Copy());
+            dictionary->Add(StringValue::MakeValue(entry.Key), entry.Holder->Copy());
         }
     );
     
     return dictionary;
 }
 
+bool dish::DictionaryValue::IsAliased() const
+{
+    if(mStorage->Exposed)
+    {
+        const EntryListT &elements(this->elements());
+        
+        for(EntryListT::const_iterator i(elements.begin()), last(elements.end()); i != last; ++i)
+        {
+            if((i->Holder.use_count() > 1 && !i->Holder->IsLocked()) || i->Holder->IsAliased())
+            {
+                return true;
+            }
+        }
+        
+        mStorage->Exposed = false;
+    }
+    
+    return false;
+}
+
 dish::StringT dish::DictionaryValue::AsString() const
 {
     std::stringstream out;
@@ -2704,18 +3809,28 @@ dish::StringT dish::DictionaryValue::AsString() const
     
     out << "Dictionary { ";
     
+    //  In the order of the keys, as they are iterated over.
+    const std::shared_ptr< const KeyListT > keys(SortedKeys());
+    
     std::for_each(
-        mValue.begin(), mValue.end(),
-        [&](const DictionaryT::value_type &value)
+        keys->begin(), keys->end(),
+        [&](const KeyListT::value_type &key)
         {
+            const EntryT * const entry(find(key));
+            
+            if(0 == entry)
+            {
+                return;
+            }
+            
             if(!first)
             {
                 out << ", ";
             }
         
-            out << value.first;
+            out << key;
             out << " : ";
-            out << value.second->AsString();
+            out << entry->Holder->AsString();
             
             first = false;
         }
@@ -2732,16 +3847,15 @@ void dish::DictionaryValue::Assign(std::shared_ptr< dish::iAtomic > rhs)
     {
         if(typeDictionary == rhs->Type())
         {
-            std::shared_ptr< iAtomic > keys(rhs->Keys());
+            std::shared_ptr< const KeyListT > keys(rhs->SortedKeys());
         
+            unshare();
             invalidate();
-            mValue.clear();
+            clear();
             
-            for(IntegerT i(keys->Member("start")->AsInteger()), last_i(keys->Member("finish")->AsInteger()); i <= last_i; ++i)
+            for(KeyListT::const_iterator i(keys->begin()), last_i(keys->end()); i != last_i; ++i)
             {
-                std::shared_ptr< iAtomic > key(keys->Element(i));
-            
-                Add(key, rhs->Lookup(key->AsString())->Clone());
+                Add(StringValue::MakeValue(*i, LOCKED), rhs->InspectLookup(*i)->Clone());
             }
         }
         else
@@ -2771,91 +3885,182 @@ std::shared_ptr< dish::iAtomic > dish::DictionaryValue::Member(const std::string
     {
         if(0 == mCountV.get())
         {
-            mCountV = IntegerValue::MakeValue(mValue.size(), LOCKED);
+            mCountV = IntegerValue::MakeValue(elements().size(), LOCKED);
         }
         
         return mCountV;
     }
     
-    else if(IsEqual("empty", member, CASE_INSENSITIVE))
-    {
-        if(0 == mEmptyV.get())
+    else if(IsEqual("empty", member, CASE_INSENSITIVE))
+    {
+        if(0 == mEmptyV.get())
+        {
+            mEmptyV = BooleanValue::MakeLockedValue(elements().empty());
+        }
+        
+        return mEmptyV;
+    }
+    
+    else if(IsEqual("keys", member, CASE_INSENSITIVE))
+    {
+        if(0 == mKeysV.get())
+        {
+            mKeysV = Keys();
+            mKeysV->Lock();
+        }
+        
+        return mKeysV;
+    }
+
+    return iAtomic::Member(member);
+}
+
+dish::IntegerT dish::DictionaryValue::Add(std::shared_ptr< dish::iAtomic > key, std::shared_ptr< dish::iAtomic > value)
+{
+    assert(value);
+
+    unshare();
+    invalidate();
+    
+    mStorage->Exposed = true;
+    
+    if(typeInteger == key->Type())
+    {
+        const IntegerT ikey(key->AsInteger());
+        
+        EntryT * const entry(find(ikey));
+        
+        if(0 != entry)
+        {
+            entry->Holder->Assign(value);
+        }
+        else
+        {
+            insert(makeEntry(ikey, value));
+        }
+    }
+    else
+    {
+        const StringT skey(key->AsString());
+        
+        EntryT * const entry(find(skey));
+        
+        if(0 != entry)
+        {
+            entry->Holder->Assign(value);
+        }
+        else
+        {
+            insert(makeEntry(skey, value));
+        }
+    }
+    
+    return static_cast< IntegerT >(elements().size());
+}
+
+std::shared_ptr< dish::iAtomic > dish::DictionaryValue::Keys() const
+{
+    std::shared_ptr< ArrayValue > keys(ArrayValue::MakeValue(0));
+    
+    const std::shared_ptr< const KeyListT > sorted(SortedKeys());
+    
+    std::for_each(
+        sorted->begin(), sorted->end(),
+        [&](const KeyListT::value_type &key)
         {
-            mEmptyV = BooleanValue::MakeLockedValue(mValue.empty());
+            keys->Add(StringValue::MakeValue(key, LOCKED));
         }
-        
-        return mEmptyV;
-    }
+    );
     
-    else if(IsEqual("keys", member, CASE_INSENSITIVE))
+    return keys;
+}
+
+std::shared_ptr< const dish::iAtomic::KeyListT > dish::DictionaryValue::SortedKeys() const
+{
+    if(0 == mStorage->Sorted.get())
     {
-        if(0 == mKeysV.get())
-        {
-            mKeysV = Keys();
-            mKeysV->Lock();
-        }
+        std::shared_ptr< KeyListT > sorted(std::make_shared< KeyListT >());
         
-        return mKeysV;
+        sorted->reserve(elements().size());
+        std::for_each(
+            elements().begin(), elements().end(),
+            [&](const EntryListT::value_type &entry)
+            {
+                sorted->push_back(entry.Key);
+            }
+        );
+        
+        std::sort(sorted->begin(), sorted->end());
+        
+        mStorage->Sorted = sorted;
     }
-
-    return iAtomic::Member(member);
+    
+    return mStorage->Sorted;
 }
 
-dish::IntegerT dish::DictionaryValue::Add(std::shared_ptr< dish::iAtomic > key, std::shared_ptr< dish::iAtomic > value)
+std::shared_ptr< dish::iAtomic > dish::DictionaryValue::Lookup(const dish::StringT &key) const
 {
-    assert(value);
-
-    invalidate();
-
-    const auto element(
-        mValue.insert(
-            std::make_pair(
-                key->AsString(), 
-                ValueHolder::MakeValue(*this, value)
-            )
-        )
-    );
+    unshare();
+    mStorage->Exposed = true;
+    
+    const EntryT * const entry(find(key));
+    
+    if(0 != entry)
+    {
+        return entry->Holder;
+    }
     
-    if(!element.second)
+    else if(!IsLocked())
+    {
+        invalidate();
+    
+        return insert(makeEntry(key, NullValue::MakeValue())).Holder;
+    }
+    
+    else
     {
-        element.first->second->Assign(value);
+        //  Empty
     }
     
-    return static_cast< IntegerT >(mValue.size());
+    throw ValueLockedException("Cannot modify a locked value.");
 }
 
-std::shared_ptr< dish::iAtomic > dish::DictionaryValue::Keys() const
+std::shared_ptr< dish::iAtomic > dish::DictionaryValue::InspectLookup(const dish::StringT &key) const
 {
-    std::shared_ptr< ArrayValue > keys(ArrayValue::MakeValue(0));
-    
-    std::for_each(
-        mValue.begin(), mValue.end(),
-        [&](const DictionaryT::value_type &value)
+    //  Only the owner's holders are handed out, and a missing entry is still
+    //  inserted by Lookup().
+    if(this == mStorage->Owner)
+    {
+        const EntryT * const entry(find(key));
+        
+        if(0 != entry)
         {
-            keys->Add(StringValue::MakeValue(value.first, LOCKED));
+            return entry->Holder;
         }
-    );
+    }
     
-    return keys;
+    return Lookup(key);
 }
 
-std::shared_ptr< dish::iAtomic > dish::DictionaryValue::Lookup(const dish::StringT &key) const
+std::shared_ptr< dish::iAtomic > dish::DictionaryValue::Lookup(const dish::IntegerT &key) const
 {
-    const auto element(mValue.find(key));
+    unshare();
+    mStorage->Exposed = true;
+    
+    ++IntegerLookups;
     
-    if(mValue.end() != element)
+    const EntryT * const entry(find(key));
+    
+    if(0 != entry)
     {
-        return element->second;
+        return entry->Holder;
     }
     
     else if(!IsLocked())
     {
         invalidate();
     
-        std::shared_ptr< iAtomic > value(ValueHolder::MakeValue(*this, NullValue::MakeValue()));
-        mValue[key] = value;
-    
-        return value;
+        return insert(makeEntry(key, NullValue::MakeValue())).Holder;
     }
     
     else
@@ -2866,19 +4071,67 @@ std::shared_ptr< dish::iAtomic > dish::DictionaryValue::Lookup(const dish::Strin
     throw ValueLockedException("Cannot modify a locked value.");
 }
 
+std::shared_ptr< dish::iAtomic > dish::DictionaryValue::InspectLookup(const dish::IntegerT &key) const
+{
+    if(this == mStorage->Owner)
+    {
+        const EntryT * const entry(find(key));
+        
+        if(0 != entry)
+        {
+            ++IntegerLookups;
+            
+            return entry->Holder;
+        }
+    }
+    
+    return Lookup(key);
+}
+
+void dish::DictionaryValue::CopyEntryValue(const dish::iAtomic::CursorT &cursor, std::shared_ptr< dish::iAtomic > &copy) const
+{
+    const std::shared_ptr< iAtomic > holder(Lookup(cursor.Key()));
+    const std::shared_ptr< iAtomic > &value(static_cast< const ValueHolder & >(*holder).mHeldValue);
+    
+    const iAtomic &held(*value);
+    
+    //  Only a primitive of the very same class is assigned in place; a ranged
+    //  integer, say, would check the value against its own range.
+    if((0 != copy.get()) && !copy->IsLocked() && !held.IsLocked() && (typeid(*copy) == typeid(held)))
+    {
+        if((typeid(IntegerValue) == typeid(held)) || (typeid(RealValue) == typeid(held)) || (typeid(BooleanValue) == typeid(held)) || (typeid(StringValue) == typeid(held)))
+        {
+            copy->Assign(value);
+            
+            return;
+        }
+    }
+    
+    copy = value->Clone();
+}
+
 void dish::DictionaryValue::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
     out << "dictionary" << std::endl;
     
+    const std::shared_ptr< const KeyListT > keys(SortedKeys());
+    
     std::for_each(
-        mValue.begin(), mValue.end(),
-        [&](const DictionaryT::value_type &value)
+        keys->begin(), keys->end(),
+        [&](const KeyListT::value_type &key)
         {
+            const EntryT * const entry(find(key));
+            
+            if(0 == entry)
+            {
+                return;
+            }
+            
             printIndent(out, indent + INDENT);
-            out << value.first;
+            out << key;
             out << ": ";
-            value.second->Print(out, 0);
+            entry->Holder->Print(out, 0);
             out << std::endl;
         }
     );
@@ -2894,6 +4147,8 @@ void dish::DictionaryValue::Print(std::ostream &out, const std::string::size_typ
  ******************************************************************************/
  
 dish::IntegerT dish::StructureValue::Count(0);
+dish::IntegerT dish::StructureValue::Shares(0);
+dish::IntegerT dish::StructureValue::Unshares(0);
  
 void dish::StructureValue::generateStructureMemberExistsError(const std::string &id)
 {
@@ -2905,13 +4160,103 @@ void dish::StructureValue::generateStructureMemberExistsError(const std::string
     throw DuplicateSymbolException(message.str());
 }
 
+dish::StructureValue::~StructureValue()
+{
+    if(this == mStorage->Owner)
+    {
+        mStorage->Owner = 0;
+    }
+}
+
+void dish::StructureValue::unshare() const
+{
+    if(mStorage.use_count() > 1)
+    {
+        std::shared_ptr< StorageT > storage(std::make_shared< StorageT >(shape(), this, false));
+        
+        MemberSetT &shared(mStorage->Members);
+        MemberSetT &own(storage->Members);
+        
+        if(this == mStorage->Owner)
+        {
+            storage->Exposed = mStorage->Exposed;
+            
+            //  References to our members may exist, so we keep them and leave
+            //  clones to the structures still sharing the storage.
+            own.swap(shared);
+            
+            shared.reserve(own.size());
+            std::for_each(
+                own.begin(), own.end(),
+                [&](const MemberSetT::value_type &member)
+                {
+                    shared.push_back(member->Clone());
+                }
+            );
+            
+            mStorage->Owner = 0;
+        }
+        else
+        {
+            own.reserve(shared.size());
+            std::for_each(
+                shared.begin(), shared.end(),
+                [&](const MemberSetT::value_type &member)
+                {
+                    own.push_back(member->Clone());
+                }
+            );
+        }
+        
+        mStorage = storage;
+        
+        ++Unshares;
+    }
+    else
+    {
+        mStorage->Owner = this;
+    }
+}
+
+void dish::StructureValue::Add(const std::string &id, std::shared_ptr< dish::iAtomic > value)
+{
+    assert(0 != value.get());
+    
+    unshare();
+    mStorage->Exposed = true;
+    
+    if(StructureShape::NOT_FOUND != shape().Find(id))
+    {
+        generateStructureMemberExistsError(id);
+    }
+    
+    mStorage->Shape = &shape().With(id);
+    
+    members().insert(members().begin() + shape().Find(id), value);
+}
+
+void dish::StructureValue::Bind(const std::string &id, std::shared_ptr< dish::iAtomic > value)
+{
+    assert(0 != value.get());
+    
+    unshare();
+    mStorage->Exposed = true;
+    
+    const std::size_t offset(shape().Find(id));
+    assert(StructureShape::NOT_FOUND != offset);
+    
+    members()[offset] = std::move(value);
+}
+
 void dish::StructureValue::Lock() throw()
 {
+    unshare();
+    
     std::for_each(
-        mMemberSet.begin(), mMemberSet.end(),
+        members().begin(), members().end(),
         [&](MemberSetT::value_type &value)
         {
-            value.second->Lock();
+            value->Lock();
         }
     );
     
@@ -2925,64 +4270,135 @@ dish::iAtomic::TypeT dish::StructureValue::Type() const throw()
  
 std::shared_ptr< dish::iAtomic > dish::StructureValue::Copy() const
 {
-    std::shared_ptr< StructureValue > value(new StructureValue());
+    if(!IsAliased())
+    {
+        //  The members are cloned when either structure first needs them.
+        return MakeShared< StructureValue >([&](void *memory) { ::new(memory) StructureValue(*this); });
+    }
+    
+    std::shared_ptr< StructureValue > value(MakeShared< StructureValue >([&](void *memory) { ::new(memory) StructureValue(shape()); }));
+    
+    MemberSetT::const_iterator i(members().begin());
     
     std::for_each(
-        mMemberSet.begin(), mMemberSet.end(),
-        [&](const MemberSetT::value_type &element)
+        value->members().begin(), value->members().end(),
+        [&](MemberSetT::value_type &member)
         {
-            value->Add(element.first, element.second->Clone());
+            member = (*i++)->Clone();
         }
     );
     
     return value;
 }
 
-dish::StringT dish::StructureValue::AsString() const
+std::shared_ptr< dish::iAtomic > dish::StructureValue::Clone() const
 {
-    std::stringstream out;
-    bool first(true);
+    if(IsAliased())
+    {
+        return iAtomic::Clone();
+    }
     
-    std::for_each(
-        mMemberSet.begin(), mMemberSet.end(),
-        [&](const MemberSetT::value_type &element)
+    std::shared_ptr< StructureValue > value(MakeShared< StructureValue >([&](void *memory) { ::new(memory) StructureValue(*this); }));
+    
+    //  The members of a locked structure are locked as well, so the clone can
+    //  go on sharing them.
+    if(IsLocked())
+    {
+        value->iAtomic::Lock();
+    }
+    
+    return value;
+}
+
+bool dish::StructureValue::IsAliased() const
+{
+    if(mStorage->Exposed)
+    {
+        const MemberSetT &members(this->members());
+        
+        for(MemberSetT::const_iterator i(members.begin()), last(members.end()); i != last; ++i)
         {
-            if(!first)
+            if(((*i).use_count() > 1 && !(*i)->IsLocked()) || (*i)->IsAliased())
             {
-                out << ", ";
+                return true;
             }
+        }
         
-            out << element.first;
-            out << ": ";
-            out << element.second->AsString();
-            
-            first = false;
+        mStorage->Exposed = false;
+    }
+    
+    return false;
+}
+
+dish::StringT dish::StructureValue::AsString() const
+{
+    std::stringstream out;
+    
+    const StructureShape::NameListT &names(shape().Names());
+    
+    for(std::size_t i(0), last_i(names.size()); i != last_i; ++i)
+    {
+        if(0 != i)
+        {
+            out << ", ";
         }
-    );
+        
+        out << names[i];
+        out << ": ";
+        out << members()[i]->AsString();
+    }
     
     return out.str();
 }
 
 dish::IntegerT dish::StructureValue::Members(dish::StructureValue::MemberNameSetT &members) const
 {
-    std::for_each(
-        mMemberSet.begin(), mMemberSet.end(),
-        [&](const dish::StructureValue::MemberSetT::value_type &member)
-        {
-            members.push_back(member.first);
-        }
-    );
+    const StructureShape::NameListT &names(shape().Names());
+    
+    members.insert(members.end(), names.begin(), names.end());
     
-    return static_cast< IntegerT >(mMemberSet.size());
+    return static_cast< IntegerT >(names.size());
 }
 
 std::shared_ptr< dish::iAtomic > dish::StructureValue::Member(const std::string &member) const
 {
-    const MemberSetT::const_iterator elem(mMemberSet.find(member));
+    unshare();
+    mStorage->Exposed = true;
+    
+    return InspectMember(member);
+}
+
+std::shared_ptr< dish::iAtomic > dish::StructureValue::InspectMember(const std::string &member) const
+{
+    const std::size_t offset(shape().Find(member));
     
-    if(mMemberSet.end() != elem)
+    if(StructureShape::NOT_FOUND != offset)
     {
-        return elem->second;
+        return members()[offset];
+    }
+    
+    return iAtomic::Member(member);
+}
+
+std::shared_ptr< dish::iAtomic > dish::StructureValue::Member(const std::string &member, dish::iAtomic::MemberCacheT &cache) const
+{
+    unshare();
+    mStorage->Exposed = true;
+    
+    return InspectMember(member, cache);
+}
+
+std::shared_ptr< dish::iAtomic > dish::StructureValue::InspectMember(const std::string &member, dish::iAtomic::MemberCacheT &cache) const
+{
+    if(&shape() != cache.Shape)
+    {
+        cache.Shape = &shape();
+        cache.Offset = shape().Find(member);
+    }
+    
+    if(StructureShape::NOT_FOUND != cache.Offset)
+    {
+        return members()[cache.Offset];
     }
     
     return iAtomic::Member(member);
@@ -2993,19 +4409,92 @@ void dish::StructureValue::Print(std::ostream &out, const std::string::size_type
     printIndent(out, indent);
     out << "structure" << std::endl;
     
-    std::for_each(
-        mMemberSet.begin(), mMemberSet.end(),
-        [&](const MemberSetT::value_type &value)
-        {
-            printIndent(out, indent + INDENT);
-            out << value.first;
-            out << ": ";
-            value.second->Print(out, 0);
-            out << std::endl;
-        }
-    );
+    const StructureShape::NameListT &names(shape().Names());
+    
+    for(std::size_t i(0), last_i(names.size()); i != last_i; ++i)
+    {
+        printIndent(out, indent + INDENT);
+        out << names[i];
+        out << ": ";
+        members()[i]->Print(out, 0);
+        out << std::endl;
+    }
     
     printIndent(out, indent);
     out << "end";
 }
 
+/******************************************************************************
+
+    dish::ValueHandle class definitions
+
+ ******************************************************************************/
+
+dish::IntegerT dish::ValueHandle::Boxes(0);
+
+void dish::ValueHandle::AssignTo(dish::iAtomic &target) const
+{
+    if(IsBoxed())
+    {
+        target.Assign(mValue);
+    }
+    else
+    {
+        switch(mType)
+        {
+            case iAtomic::typeBoolean:
+            {
+                target.Assign(mBoolean);
+            } break;
+            
+            case iAtomic::typeInteger:
+            {
+                target.Assign(mInteger);
+            } break;
+            
+            case iAtomic::typeReal:
+            {
+                target.Assign(mReal);
+            } break;
+            
+            default:
+            {
+                assert(false);
+            } break;
+        }
+    }
+}
+
+std::shared_ptr< dish::iAtomic > dish::ValueHandle::Box()
+{
+    if(!IsBoxed())
+    {
+        switch(mType)
+        {
+            case iAtomic::typeBoolean:
+            {
+                mValue = BooleanValue::MakeLockedValue(mBoolean);
+            } break;
+            
+            case iAtomic::typeInteger:
+            {
+                mValue = IntegerValue::MakeValue(mInteger);
+                ++Boxes;
+            } break;
+            
+            case iAtomic::typeReal:
+            {
+                mValue = RealValue::MakeValue(mReal);
+                ++Boxes;
+            } break;
+            
+            default:
+            {
+                mValue = NullValue::MakeValue();
+            } break;
+        }
+    }
+    
+    return mValue;
+}
+
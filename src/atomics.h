@@ -25,6 +25,8 @@
 
 #include "dishconfig.h"
 
+#include <cstdint>
+
 #ifndef LANG_FORMAL_PARAM_LIST_TYPE_VECTOR
 #include <list>
 #endif
@@ -49,6 +51,8 @@ namespace dish
     
     class iAtomic;
     class iSymbolTable;
+    class StructureShape;
+    class ValueHandle;
 
     ////////////////////////////////////////////////////////////////////////////
     
@@ -87,11 +91,30 @@ namespace dish
         public:
         
             using MemberNameSetT = std::vector< std::string >;
+            
+            //  Kept by a member access for the shape of the structure it last
+            //  read, and where the member is found in it.
+            struct MemberCacheT
+            {
+                const StructureShape *Shape;
+                std::size_t Offset;
+                
+                INLINE MemberCacheT() : Shape(0), Offset(0) {};
+            };
         
             virtual ~iStructureAtomic() {};
             
             virtual IntegerT Members(MemberNameSetT &members) const = 0;
             virtual std::shared_ptr< iAtomic > Member(const std::string &member) const = 0;
+            
+            //  As Member(), for reading only: the value returned may still be
+            //  shared with copies of the structure and must not be modified.
+            virtual std::shared_ptr< iAtomic > InspectMember(const std::string &member) const = 0;
+            
+            //  As Member() and InspectMember(), a structure of the shape in
+            //  cache finding member without looking up its name.
+            virtual std::shared_ptr< iAtomic > Member(const std::string &member, MemberCacheT &cache) const = 0;
+            virtual std::shared_ptr< iAtomic > InspectMember(const std::string &member, MemberCacheT &cache) const = 0;
     
     };
     
@@ -105,19 +128,66 @@ namespace dish
             
             virtual std::shared_ptr< iAtomic > Element(const IntegerT &index) const = 0;
             virtual void Swap(const IntegerT &a, const IntegerT &b) = 0;
+            
+            //  As Element(), for reading only: the value returned may still be
+            //  shared with copies of the array and must not be modified.
+            virtual std::shared_ptr< iAtomic > InspectElement(const IntegerT &index) const = 0;
+            
+            //  As InspectElement(), into a handle; an array of integers, reals
+            //  or booleans sets the element's value without boxing it.
+            virtual void InspectElement(const IntegerT &index, ValueHandle &value) const = 0;
         
     };
     
     class iDictionaryAtomic
     {
         public:
+            
+            using KeyListT = std::vector< std::string >;
+            
             virtual ~iDictionaryAtomic() {};
             
             virtual IntegerT Add(std::shared_ptr< iAtomic > key, std::shared_ptr< iAtomic > value) = 0;
             
             virtual std::shared_ptr< iAtomic > Keys() const = 0;
             
+            //  The keys in order, for iterating over them; the list returned
+            //  does not change when the dictionary is modified afterwards.
+            virtual std::shared_ptr< const KeyListT > SortedKeys() const = 0;
+            
             virtual std::shared_ptr< iAtomic > Lookup(const StringT &key) const = 0;
+            
+            //  As Lookup(), for reading only: the value returned may still be
+            //  shared with copies of the dictionary and must not be modified.
+            virtual std::shared_ptr< iAtomic > InspectLookup(const StringT &key) const = 0;
+            
+            //  As Lookup() and InspectLookup() of the key written in decimal.
+            virtual std::shared_ptr< iAtomic > Lookup(const IntegerT &key) const = 0;
+            virtual std::shared_ptr< iAtomic > InspectLookup(const IntegerT &key) const = 0;
+            
+            //  A position among the entries of a dictionary, visited in the
+            //  order of their keys. The cursor holds the keys as they were when
+            //  it started, so the dictionary may be modified meanwhile.
+            using CursorT = struct Cursor
+            {
+                std::shared_ptr< const KeyListT > Keys;
+                KeyListT::size_type Position;
+                
+                INLINE const std::string &Key() const { return (*Keys)[Position]; };
+            };
+            
+            //  Move cursor to the first or the next entry; false if there is
+            //  none.
+            virtual bool FirstEntry(CursorT &cursor) const = 0;
+            virtual bool NextEntry(CursorT &cursor) const = 0;
+            
+            //  The value of the entry at cursor, as Lookup() of its key.
+            virtual std::shared_ptr< iAtomic > EntryValue(const CursorT &cursor) const = 0;
+            
+            //  Sets copy to a copy of the value of the entry at cursor. A copy
+            //  passed in, which the caller no longer shares, is assigned the
+            //  value in place if it is a primitive of the same class.
+            virtual void CopyEntryValue(const CursorT &cursor, std::shared_ptr< iAtomic > &copy) const = 0;
         
     };
     
@@ -239,6 +309,11 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Copy() const = 0;                //  A modifiable (non-locked) deep-copy of the object
             virtual std::shared_ptr< iAtomic > Clone() const;                   //  A deep copy of the object, including locked status
             
+            //  True if a modifiable part of the value, e.g. an element of an
+            //  array, may be referred to from elsewhere. Copies of such values
+            //  cannot share that part and are made eagerly.
+            virtual bool IsAliased() const;
+            
             //  From iValueAtomic
             
             virtual const bool &IsLocked() const throw();
@@ -260,6 +335,9 @@ namespace dish
             
             virtual IntegerT Members(MemberNameSetT &members) const;
             virtual std::shared_ptr< iAtomic > Member(const std::string &member) const;
+            virtual std::shared_ptr< iAtomic > InspectMember(const std::string &member) const;
+            virtual std::shared_ptr< iAtomic > Member(const std::string &member, MemberCacheT &cache) const;
+            virtual std::shared_ptr< iAtomic > InspectMember(const std::string &member, MemberCacheT &cache) const;
             
             //  From iArrayAtomic
             
@@ -267,12 +345,22 @@ namespace dish
             virtual IntegerT Add(std::shared_ptr< iAtomic > element, const IntegerT &index);
             virtual std::shared_ptr< iAtomic > Element(const IntegerT &index) const;
             virtual void Swap(const IntegerT &a, const IntegerT &b);
+            virtual std::shared_ptr< iAtomic > InspectElement(const IntegerT &index) const;
+            virtual void InspectElement(const IntegerT &index, ValueHandle &value) const;
             
             //  From iDictionary
             
             virtual IntegerT Add(std::shared_ptr< iAtomic > key, std::shared_ptr< iAtomic > value);
             virtual std::shared_ptr< iAtomic > Keys() const;
+            virtual std::shared_ptr< const KeyListT > SortedKeys() const;
             virtual std::shared_ptr< iAtomic > Lookup(const StringT &key) const;
+            virtual std::shared_ptr< iAtomic > InspectLookup(const StringT &key) const;
+            virtual std::shared_ptr< iAtomic > Lookup(const IntegerT &key) const;
+            virtual std::shared_ptr< iAtomic > InspectLookup(const IntegerT &key) const;
+            virtual bool FirstEntry(CursorT &cursor) const;
+            virtual bool NextEntry(CursorT &cursor) const;
+            virtual std::shared_ptr< iAtomic > EntryValue(const CursorT &cursor) const;
+            virtual void CopyEntryValue(const CursorT &cursor, std::shared_ptr< iAtomic > &copy) const;
             
             //  From iTypeAtomic
             
@@ -307,6 +395,10 @@ namespace dish
     
     class TypeAtomic : public iAtomic
     {
+        //  An array of integers, reals or booleans counts the elements it
+        //  declares without declaring each as a value of its own.
+        friend class ArrayValue;
+        
         private:
             mutable IntegerT mNumInstances;
             
@@ -314,6 +406,7 @@ namespace dish
             INLINE TypeAtomic() : iAtomic(LOCKED), mNumInstances(0) {};
         
             INLINE void declare() const throw() { ++mNumInstances; };
+            INLINE void declare(const IntegerT &count) const throw() { mNumInstances += count; };
     
         public:
             
@@ -341,7 +434,7 @@ namespace dish
         
             static INLINE IntegerT NumInstances() throw() { return Count; };
             
-            static INLINE std::shared_ptr< BooleanTypeAtomic > MakeValue(const BooleanT &value = false) { return std::shared_ptr< BooleanTypeAtomic >(new BooleanTypeAtomic(value)); };
+            static INLINE std::shared_ptr< BooleanTypeAtomic > MakeValue(const BooleanT &value = false) { return MakeShared< BooleanTypeAtomic >([&](void *memory) { ::new(memory) BooleanTypeAtomic(value); }); };
             
             //  From iAtomic
             
@@ -369,7 +462,7 @@ namespace dish
         
             static INLINE IntegerT NumInstances() throw() { return Count; };
             
-            static INLINE std::shared_ptr< IntegerTypeAtomic > MakeValue(const IntegerT &value = 0) { return std::shared_ptr< IntegerTypeAtomic >(new IntegerTypeAtomic(value)); };
+            static INLINE std::shared_ptr< IntegerTypeAtomic > MakeValue(const IntegerT &value = 0) { return MakeShared< IntegerTypeAtomic >([&](void *memory) { ::new(memory) IntegerTypeAtomic(value); }); };
             
             //  From iAtomic
             
@@ -399,7 +492,7 @@ namespace dish
         
             static INLINE IntegerT NumInstances() throw() { return Count; };
             
-            static INLINE std::shared_ptr< RangedIntegerTypeAtomic > MakeValue(const IntegerT &min, const IntegerT &max, const RangeBoundsT &bounds, const IntegerT &value = 0) { return std::shared_ptr< RangedIntegerTypeAtomic >(new RangedIntegerTypeAtomic(min, max, bounds, value)); };
+            static INLINE std::shared_ptr< RangedIntegerTypeAtomic > MakeValue(const IntegerT &min, const IntegerT &max, const RangeBoundsT &bounds, const IntegerT &value = 0) { return MakeShared< RangedIntegerTypeAtomic >([&](void *memory) { ::new(memory) RangedIntegerTypeAtomic(min, max, bounds, value); }); };
             
             //  From iAtomic
             
@@ -427,7 +520,7 @@ namespace dish
         
             static INLINE IntegerT NumInstances() throw() { return Count; };
             
-            static INLINE std::shared_ptr< RealTypeAtomic > MakeValue(const RealT &value = 0.0) { return std::shared_ptr< RealTypeAtomic >(new RealTypeAtomic(value)); };
+            static INLINE std::shared_ptr< RealTypeAtomic > MakeValue(const RealT &value = 0.0) { return MakeShared< RealTypeAtomic >([&](void *memory) { ::new(memory) RealTypeAtomic(value); }); };
             
             //  From iAtomic
             
@@ -457,7 +550,7 @@ namespace dish
         
             static INLINE IntegerT NumInstances() throw() { return Count; };
             
-            static INLINE std::shared_ptr< RangedRealTypeAtomic > MakeValue(const RealT &min, const RealT &max, const RangeBoundsT &bounds, const RealT &value = 0) { return std::shared_ptr< RangedRealTypeAtomic >(new RangedRealTypeAtomic(min, max, bounds, value)); };
+            static INLINE std::shared_ptr< RangedRealTypeAtomic > MakeValue(const RealT &min, const RealT &max, const RangeBoundsT &bounds, const RealT &value = 0) { return MakeShared< RangedRealTypeAtomic >([&](void *memory) { ::new(memory) RangedRealTypeAtomic(min, max, bounds, value); }); };
             
             //  From iAtomic
             
@@ -485,7 +578,7 @@ namespace dish
         
             static INLINE IntegerT NumInstances() throw() { return Count; };
             
-            static INLINE std::shared_ptr< StringTypeAtomic > MakeValue(const StringT &value = "") { return std::shared_ptr< StringTypeAtomic >(new StringTypeAtomic(value)); };
+            static INLINE std::shared_ptr< StringTypeAtomic > MakeValue(const StringT &value = "") { return MakeShared< StringTypeAtomic >([&](void *memory) { ::new(memory) StringTypeAtomic(value); }); };
             
             //  From iAtomic
             
@@ -515,8 +608,8 @@ namespace dish
         
             static INLINE IntegerT NumInstances() throw() { return Count; };
             
-            static INLINE std::shared_ptr< ArrayTypeAtomic > MakeValue(const IntegerT &min) { return std::shared_ptr< ArrayTypeAtomic >(new ArrayTypeAtomic(min)); };
-            static INLINE std::shared_ptr< ArrayTypeAtomic > MakeValue(const IntegerT &min, const IntegerT &max, std::shared_ptr< iAtomic > type) { return std::shared_ptr< ArrayTypeAtomic >(new ArrayTypeAtomic(min, max, type)); };
+            static INLINE std::shared_ptr< ArrayTypeAtomic > MakeValue(const IntegerT &min) { return MakeShared< ArrayTypeAtomic >([&](void *memory) { ::new(memory) ArrayTypeAtomic(min); }); };
+            static INLINE std::shared_ptr< ArrayTypeAtomic > MakeValue(const IntegerT &min, const IntegerT &max, std::shared_ptr< iAtomic > type) { return MakeShared< ArrayTypeAtomic >([&](void *memory) { ::new(memory) ArrayTypeAtomic(min, max, type); }); };
             
             //  From iAtomic
             
@@ -539,7 +632,7 @@ namespace dish
         
             static INLINE IntegerT NumInstances() throw() { return Count; };
             
-            static INLINE std::shared_ptr< DictionaryTypeAtomic > MakeValue() { return std::shared_ptr< DictionaryTypeAtomic >(new DictionaryTypeAtomic()); };
+            static INLINE std::shared_ptr< DictionaryTypeAtomic > MakeValue() { return MakeShared< DictionaryTypeAtomic >([&](void *memory) { ::new(memory) DictionaryTypeAtomic(); }); };
             
             //  From iAtomic
             
@@ -551,6 +644,50 @@ namespace dish
         
     };
     
+    //  The layout shared by the structures with the same members: the names
+    //  of the members in order, and so the offset of each one's value. Adding
+    //  a member to a structure moves it to the shape with that member, which
+    //  is made once and then kept by the shape it was made from; shapes last
+    //  as long as the program does, and each set of members has one.
+    class StructureShape
+    {
+        public:
+        
+            using NameListT = std::vector< std::string >;
+            
+            static const std::size_t NOT_FOUND;
+        
+        private:
+            const NameListT mNames;
+            
+            mutable std::map< std::string, const StructureShape * > mTransitions;
+            
+            static IntegerT Count;
+            
+            //  Every shape made, by its (sorted) member names, so that the same
+            //  members added in any order lead to the same shape.
+            static std::map< NameListT, std::unique_ptr< StructureShape > > &shapes();
+            
+            INLINE StructureShape(const NameListT &names) : mNames(names), mTransitions() { ++Count; };
+        
+        public:
+        
+            static INLINE IntegerT NumInstances() throw() { return Count; };
+            
+            //  The shape of a structure without members.
+            static const StructureShape &Empty();
+            
+            INLINE const NameListT &Names() const throw() { return mNames; };
+            INLINE std::size_t Size() const throw() { return mNames.size(); };
+            
+            //  The offset of the member named name, or NOT_FOUND.
+            std::size_t Find(const std::string &name) const;
+            
+            //  This shape with the member named name added.
+            const StructureShape &With(const std::string &name) const;
+        
+    };
+    
     class StructureTypeAtomic : public TypeAtomic
     {
         public:
@@ -566,8 +703,13 @@ namespace dish
         private:
             MemberListT mMemberList;
             
+            //  The shape of the structures declared, and the offset of each
+            //  member in mMemberList; found on the first Declare().
+            mutable const StructureShape *mShape;
+            mutable std::vector< std::size_t > mOffsets;
+            
         protected:
-            INLINE StructureTypeAtomic() : TypeAtomic(), mMemberList()
+            INLINE StructureTypeAtomic() : TypeAtomic(), mMemberList(), mShape(0), mOffsets()
             { 
                 ++Count;
             
@@ -580,7 +722,7 @@ namespace dish
         
             static INLINE IntegerT NumInstances() throw() { return Count; };
             
-            static INLINE std::shared_ptr< StructureTypeAtomic > MakeValue() { return std::shared_ptr< StructureTypeAtomic >(new StructureTypeAtomic()); };
+            static INLINE std::shared_ptr< StructureTypeAtomic > MakeValue() { return MakeShared< StructureTypeAtomic >([&](void *memory) { ::new(memory) StructureTypeAtomic(); }); };
             
             void Add(const std::string &id, std::shared_ptr< iAtomic > type);
             
@@ -685,7 +827,7 @@ namespace dish
         
             static INLINE IntegerT NumInstances() throw() { return Count; };
             
-            static INLINE std::shared_ptr< ReferenceValue > MakeValue(std::shared_ptr< iAtomic > value) { return std::shared_ptr< ReferenceValue >(new ReferenceValue(value)); };
+            static INLINE std::shared_ptr< ReferenceValue > MakeValue(std::shared_ptr< iAtomic > value) { return MakeShared< ReferenceValue >([&](void *memory) { ::new(memory) ReferenceValue(value); }); };
             
             //  From iAtomic
             
@@ -696,6 +838,8 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Copy() const;
             virtual std::shared_ptr< iAtomic > Clone() const;
             
+            virtual bool IsAliased() const;
+            
             virtual BooleanT AsBoolean() const;
             virtual IntegerT AsInteger() const;
             virtual RealT AsReal() const;
@@ -709,14 +853,24 @@ namespace dish
             virtual void Assign(const StringT &rhs);
             
             virtual std::shared_ptr< iAtomic > Member(const std::string &member) const;
+            virtual std::shared_ptr< iAtomic > InspectMember(const std::string &member) const;
+            virtual std::shared_ptr< iAtomic > Member(const std::string &member, MemberCacheT &cache) const;
+            virtual std::shared_ptr< iAtomic > InspectMember(const std::string &member, MemberCacheT &cache) const;
             
             virtual IntegerT Add(std::shared_ptr< iAtomic > element);
             virtual IntegerT Add(std::shared_ptr< iAtomic > element, const IntegerT &index);
             virtual std::shared_ptr< iAtomic > Element(const IntegerT &index) const;
+            virtual std::shared_ptr< iAtomic > InspectElement(const IntegerT &index) const;
+            virtual void InspectElement(const IntegerT &index, ValueHandle &value) const;
             
             virtual IntegerT Add(std::shared_ptr< iAtomic > key, std::shared_ptr< iAtomic > value);
             virtual std::shared_ptr< iAtomic > Keys() const;
+            virtual std::shared_ptr< const KeyListT > SortedKeys() const;
             virtual std::shared_ptr< iAtomic > Lookup(const StringT &key) const;
+            virtual std::shared_ptr< iAtomic > InspectLookup(const StringT &key) const;
+            virtual std::shared_ptr< iAtomic > Lookup(const IntegerT &key) const;
+            virtual std::shared_ptr< iAtomic > InspectLookup(const IntegerT &key) const;
+            virtual void CopyEntryValue(const CursorT &cursor, std::shared_ptr< iAtomic > &copy) const;
             
             virtual std::shared_ptr< iAtomic > Declare() const;
             
@@ -790,9 +944,18 @@ namespace dish
         public:
                 
             static INLINE std::shared_ptr< BooleanValue > MakeLockedValue(const BooleanT &value) { return Values[static_cast< int >(value)]; };
+            
+            //  A recycled primitive comes from the operator new of its class,
+            //  which MakeShared() does not call.
+#ifdef RECYCLE_PRIMITIVES
             static INLINE std::shared_ptr< BooleanValue > MakeUnlockedValue(const BooleanT &value) { return std::shared_ptr< BooleanValue >(new BooleanValue(value, UNLOCKED)); };
             
             static INLINE std::shared_ptr< BooleanValue > MakeValue() { return std::shared_ptr< BooleanValue >(new BooleanValue()); };
+#else
+            static INLINE std::shared_ptr< BooleanValue > MakeUnlockedValue(const BooleanT &value) { return MakeShared< BooleanValue >([&](void *memory) { ::new(memory) BooleanValue(value, UNLOCKED); }); };
+            
+            static INLINE std::shared_ptr< BooleanValue > MakeValue() { return MakeShared< BooleanValue >([&](void *memory) { ::new(memory) BooleanValue(); }); };
+#endif
             static INLINE std::shared_ptr< BooleanValue > MakeValue(const BooleanT &value, const bool &locked = false) { return (locked ? MakeLockedValue(value) : MakeUnlockedValue(value)); };
             
 #ifdef RECYCLE_PRIMITIVES
@@ -917,7 +1080,7 @@ namespace dish
     
         public:
             
-            static INLINE std::shared_ptr< RangedIntegerValue > MakeValue(const IntegerT &min, const IntegerT &max, const RangeBoundsT &bound, const IntegerT &value, const bool &locked = UNLOCKED) { return std::shared_ptr< RangedIntegerValue >(new RangedIntegerValue(min, max, bound, value, locked)); };
+            static INLINE std::shared_ptr< RangedIntegerValue > MakeValue(const IntegerT &min, const IntegerT &max, const RangeBoundsT &bound, const IntegerT &value, const bool &locked = UNLOCKED) { return MakeShared< RangedIntegerValue >([&](void *memory) { ::new(memory) RangedIntegerValue(min, max, bound, value, locked); }); };
             
             //  From iAtomic
             
@@ -992,8 +1155,13 @@ namespace dish
     
         public:
             
+#ifdef RECYCLE_PRIMITIVES
             static INLINE std::shared_ptr< RealValue > MakeValue() { return std::shared_ptr< RealValue >(new RealValue()); };
             static INLINE std::shared_ptr< RealValue > MakeValue(const RealT &value, const bool &locked = false) { return std::shared_ptr< RealValue >(new RealValue(value, locked)); };
+#else
+            static INLINE std::shared_ptr< RealValue > MakeValue() { return MakeShared< RealValue >([&](void *memory) { ::new(memory) RealValue(); }); };
+            static INLINE std::shared_ptr< RealValue > MakeValue(const RealT &value, const bool &locked = false) { return MakeShared< RealValue >([&](void *memory) { ::new(memory) RealValue(value, locked); }); };
+#endif
             
 #ifdef RECYCLE_PRIMITIVES
             static void *operator new(const std::size_t size);
@@ -1029,7 +1197,7 @@ namespace dish
     
         public:
             
-            static INLINE std::shared_ptr< RangedRealValue > MakeValue(const IntegerT &min, const IntegerT &max, const RangeBoundsT &bound, const IntegerT &value, const bool &locked = UNLOCKED) { return std::shared_ptr< RangedRealValue >(new RangedRealValue(min, max, bound, value, locked)); };
+            static INLINE std::shared_ptr< RangedRealValue > MakeValue(const IntegerT &min, const IntegerT &max, const RangeBoundsT &bound, const IntegerT &value, const bool &locked = UNLOCKED) { return MakeShared< RangedRealValue >([&](void *memory) { ::new(memory) RangedRealValue(min, max, bound, value, locked); }); };
             
             //  From iAtomic
             
@@ -1108,8 +1276,13 @@ namespace dish
     
         public:
             
+#ifdef RECYCLE_PRIMITIVES
             static INLINE std::shared_ptr< StringValue > MakeValue() { return std::shared_ptr< StringValue >(new StringValue()); };
             static INLINE std::shared_ptr< StringValue > MakeValue(const StringT &value, const bool &locked = false) { return std::shared_ptr< StringValue >(new StringValue(value, locked)); };
+#else
+            static INLINE std::shared_ptr< StringValue > MakeValue() { return MakeShared< StringValue >([&](void *memory) { ::new(memory) StringValue(); }); };
+            static INLINE std::shared_ptr< StringValue > MakeValue(const StringT &value, const bool &locked = false) { return MakeShared< StringValue >([&](void *memory) { ::new(memory) StringValue(value, locked); }); };
+#endif
             
 #ifdef RECYCLE_PRIMITIVES
             static void *operator new(const std::size_t size);
@@ -1124,6 +1297,35 @@ namespace dish
         
     };
     
+    //  The key of the entry a foreach loop over a dictionary is visiting. The
+    //  loop binds it to each key in turn, reusing its buffer, rather than
+    //  making a string for each entry.
+    class EntryKeyValue : public StringValueBase
+    {
+        private:
+            StringT mValue;
+        
+        protected:
+            INLINE EntryKeyValue(const bool &locked) : StringValueBase(locked), mValue() {};
+        
+            //  From StringValueBase
+        
+            virtual const StringT &value() const { return mValue; };
+            virtual StringT &value() { return mValue; };
+    
+        public:
+            
+            static INLINE std::shared_ptr< EntryKeyValue > MakeValue(const bool &locked = false) { return MakeShared< EntryKeyValue >([&](void *memory) { ::new(memory) EntryKeyValue(locked); }); };
+            
+            //  Binds the value to key, locked or not.
+            INLINE void Bind(const StringT &key) { mValue = key; invalidate(); };
+            
+            //  From iAtomic
+            
+            virtual std::shared_ptr< iAtomic > Copy() const;
+        
+    };
+    
     ////
     
     class ArrayValue : public iAtomic
@@ -1131,15 +1333,99 @@ namespace dish
         //  This friend is needed to efficiantly add elements to literal arrays
         //  in ptnode.cpp.
         friend class LiteralArrayParseTreeNode;
-    
-        public:
         
+        public:
+            
             using ArrayT = std::vector< std::shared_ptr< iAtomic > >;
-        
+            
             static IntegerT Count;
-    
+            static IntegerT Shares;
+            static IntegerT Unshares;
+        
         private:
-            ArrayT mValue;
+            
+            //  An element of an array of integers, reals or booleans, which is
+            //  stored unboxed.
+            union PackedValueT
+            {
+                BooleanT Boolean;
+                IntegerT Integer;
+                RealT Real;
+            };
+            
+            //  The elements of an array declared of integers, reals or booleans
+            //  are kept in place, 8 bytes each, rather than as values of their
+            //  own. An element handed out is a proxy for its slot; the proxies
+            //  still held are recorded so that they follow their elements when
+            //  these are swapped, as boxed elements would.
+            struct PackedT
+            {
+                const TypeT Type;
+                
+                std::vector< PackedValueT > Values;
+                
+                std::vector< std::pair< std::weak_ptr< iAtomic >, std::size_t * > > Proxies;
+                std::size_t PruneAt;
+                
+                INLINE PackedT(const TypeT &type) : Type(type), Values(), Proxies(), PruneAt(16) {};
+                INLINE PackedT(const PackedT &packed) : Type(packed.Type), Values(packed.Values), Proxies(), PruneAt(16) {};
+            };
+            
+            //  A proxy for an element of an array of integers, reals or
+            //  booleans; it keeps the elements alive, so a reference to it
+            //  stays valid after the array is gone. Copies of it are plain
+            //  values.
+            template< typename BaseT, typename ValueT, ValueT PackedValueT::*MEMBER, typename PlainT > class ElementProxy : public BaseT
+            {
+                private:
+                    const std::shared_ptr< PackedT > mPacked;
+                    std::size_t mIndex;
+                
+                protected:
+                
+                    //  From BaseT
+                    
+                    virtual const ValueT &value() const { return mPacked->Values[mIndex].*MEMBER; };
+                    virtual ValueT &value() { return mPacked->Values[mIndex].*MEMBER; };
+                
+                public:
+                    INLINE ElementProxy(std::shared_ptr< PackedT > packed, const std::size_t &index, const bool &locked) : BaseT(locked), mPacked(packed), mIndex(index) {};
+                    
+                    INLINE std::size_t &Index() throw() { return mIndex; };
+                    
+                    //  From iAtomic
+                    
+                    virtual std::shared_ptr< iAtomic > Copy() const { return PlainT::MakeValue(value(), UNLOCKED); };
+                    virtual std::shared_ptr< iAtomic > Clone() const { return PlainT::MakeValue(value(), this->IsLocked()); };
+            
+            };
+            
+            using IntegerElementT = ElementProxy< IntegerValueBase, IntegerT, &PackedValueT::Integer, IntegerValue >;
+            using RealElementT = ElementProxy< RealValueBase, RealT, &PackedValueT::Real, RealValue >;
+            using BooleanElementT = ElementProxy< BooleanValueBase, BooleanT, &PackedValueT::Boolean, BooleanValue >;
+            
+            //  The elements of the array. Copies of an array share its storage
+            //  until one of them hands out or modifies an element; see
+            //  unshare().
+            struct StorageT
+            {
+                ArrayT Elements;
+                
+                //  Set instead of Elements if the array is packed.
+                std::shared_ptr< PackedT > Packed;
+                
+                //  The array whose elements these are; references to them
+                //  must stay valid, so the owner never gives them up.
+                const ArrayValue *Owner;
+                
+                //  Set when an element is handed out or added; see
+                //  IsAliased().
+                bool Exposed;
+                
+                INLINE StorageT(const ArrayValue *owner, const bool &exposed) : Elements(), Packed(), Owner(owner), Exposed(exposed) {};
+            };
+            
+            mutable std::shared_ptr< StorageT > mStorage;
             
             const IntegerT mIndexOffset;
             
@@ -1149,26 +1435,76 @@ namespace dish
             mutable std::shared_ptr< iAtomic > mLengthV;
             mutable std::shared_ptr< iAtomic > mStartV;
             
+            //  The proxy handed out last by a packed array, and its index; it
+            //  is reused once nothing else holds it.
+            mutable std::shared_ptr< iAtomic > mProxy;
+            mutable std::size_t *mProxyIndex;
+            
+            static IntegerT Packs;
+            static IntegerT Proxies;
+            
+            INLINE bool packed() const throw() { return (0 != mStorage->Packed.get()); };
+            
+            //  Whether element can be stored in this packed array as a value.
+            bool packs(const iAtomic &element) const;
+            PackedValueT pack(const iAtomic &element) const;
+            
+            //  Whether a proxy for the element at adj_index is held outside of
+            //  the array.
+            bool held(const std::size_t &adj_index) const;
+            
+            //  The number of elements, packed or not.
+            INLINE IntegerT length() const throw() { return static_cast< IntegerT >(packed() ? mStorage->Packed->Values.size() : elements().size()); };
+            
+            //  The element at adj_index of a packed array as a value of its
+            //  own, or as a proxy for it.
+            std::shared_ptr< iAtomic > box(const std::size_t &adj_index, const bool &locked) const;
+            std::shared_ptr< iAtomic > proxy(const std::size_t &adj_index) const;
+            
+            //  Turns a packed array into one of boxed elements; the proxies
+            //  still held become the elements they stand for.
+            void unpack();
+            
+            //  The position of the element at index, or an IllegalIndexException.
+            std::size_t adjustIndex(const IntegerT &index) const;
+        
         protected:
-            INLINE ArrayValue(const IntegerT &mini) : dish::iAtomic(), mValue(), mIndexOffset(-mini), mInitialized(false), mFinishV(), mLengthV(), mStartV()
-                { mValue.push_back(NullValue::MakeValue()); ++Count; };
-                
-            INLINE ArrayValue(const IntegerT &mini, const IntegerT &nelem) : dish::iAtomic(), mValue(), mIndexOffset(-mini), mInitialized(false), mFinishV(), mLengthV(), mStartV()
-                { mValue.assign(nelem, NullValue::MakeValue()); ++Count; };
-                
+            INLINE ArrayValue(const IntegerT &mini) : dish::iAtomic(), mStorage(std::make_shared< StorageT >(this, false)), mIndexOffset(-mini), mInitialized(false), mFinishV(), mLengthV(), mStartV(), mProxy(), mProxyIndex(0)
+                { elements().push_back(NullValue::MakeValue()); ++Count; };
+            
+            INLINE ArrayValue(const IntegerT &mini, const IntegerT &nelem) : dish::iAtomic(), mStorage(std::make_shared< StorageT >(this, false)), mIndexOffset(-mini), mInitialized(false), mFinishV(), mLengthV(), mStartV(), mProxy(), mProxyIndex(0)
+                { elements().assign(nelem, NullValue::MakeValue()); ++Count; };
+            
+            //  The array is packed if type declares plain integers, reals or
+            //  booleans.
             ArrayValue(const IntegerT &mini, const IntegerT &nelem, std::shared_ptr< iAtomic > type);
             
+            INLINE ArrayValue(const ArrayValue &array) : dish::iAtomic(), mStorage(array.mStorage), mIndexOffset(array.mIndexOffset), mInitialized(false), mFinishV(), mLengthV(), mStartV(), mProxy(), mProxyIndex(0)
+                { ++Count; ++Shares; };
+            
+            INLINE ArrayT &elements() const { return mStorage->Elements; };
+            
+            //  Gives this array storage of its own before an element is handed
+            //  out or the array is modified.
+            void unshare() const;
+            
             INLINE void invalidate() const { mFinishV.reset(); mLengthV.reset(); mStartV.reset(); };
             
-            INLINE void clear() { mValue.clear(); invalidate(); };
+            INLINE void clear() { unshare(); unpack(); elements().clear(); invalidate(); };
         
         public:
-        
+            
             static INLINE IntegerT NumInstances() throw() { return Count; };
+            static INLINE IntegerT NumShares() throw() { return Shares; };
+            static INLINE IntegerT NumUnshares() throw() { return Unshares; };
+            static INLINE IntegerT NumPacks() throw() { return Packs; };
+            static INLINE IntegerT NumProxies() throw() { return Proxies; };
             
-            static INLINE std::shared_ptr< ArrayValue > MakeValue(const IntegerT &mini) { return std::shared_ptr< ArrayValue >(new ArrayValue(mini)); };
-            static INLINE std::shared_ptr< ArrayValue > MakeValue(const IntegerT &mini, const IntegerT &nelem) { return std::shared_ptr< ArrayValue >(new ArrayValue(mini, nelem)); };
-            static INLINE std::shared_ptr< ArrayValue > MakeValue(const IntegerT &mini, const IntegerT &nelem, std::shared_ptr< iAtomic > type) { return std::shared_ptr< ArrayValue >(new ArrayValue(mini, nelem, type)); };
+            static INLINE std::shared_ptr< ArrayValue > MakeValue(const IntegerT &mini) { return MakeShared< ArrayValue >([&](void *memory) { ::new(memory) ArrayValue(mini); }); };
+            static INLINE std::shared_ptr< ArrayValue > MakeValue(const IntegerT &mini, const IntegerT &nelem) { return MakeShared< ArrayValue >([&](void *memory) { ::new(memory) ArrayValue(mini, nelem); }); };
+            static INLINE std::shared_ptr< ArrayValue > MakeValue(const IntegerT &mini, const IntegerT &nelem, std::shared_ptr< iAtomic > type) { return MakeShared< ArrayValue >([&](void *memory) { ::new(memory) ArrayValue(mini, nelem, type); }); };
+            
+            virtual ~ArrayValue();
             
             //  From iAtomic
             
@@ -1177,6 +1513,9 @@ namespace dish
             virtual TypeT Type() const throw();
             
             virtual std::shared_ptr< iAtomic > Copy() const;
+            virtual std::shared_ptr< iAtomic > Clone() const;
+            
+            virtual bool IsAliased() const;
             
             virtual StringT AsString() const;
             
@@ -1188,9 +1527,11 @@ namespace dish
             virtual IntegerT Add(std::shared_ptr< iAtomic > element, const IntegerT &index);
             virtual std::shared_ptr< iAtomic > Element(const IntegerT &index) const;
             virtual void Swap(const IntegerT &a, const IntegerT &b);
+            virtual std::shared_ptr< iAtomic > InspectElement(const IntegerT &index) const;
+            virtual void InspectElement(const IntegerT &index, ValueHandle &value) const;
             
             virtual void Print(std::ostream &out, const std::string::size_type &indent = 0) const;
-        
+    
     };
     
     ////
@@ -1198,14 +1539,14 @@ namespace dish
     class DictionaryValue : public iAtomic
     {
         public:
-        
+            
             ////
             
             class ContainsMethod : public ExecutableAtomic
             {
                 private:
                     const DictionaryValue &mThis;
-                    
+                
                 protected:
                     INLINE ContainsMethod(const DictionaryValue &this_ref) : ExecutableAtomic(), mThis(this_ref) { addParam("str", dish::REFERENCE_PARAMETER); };
                     
@@ -1213,30 +1554,38 @@ namespace dish
                 
                 public:
                     
-                    static INLINE std::shared_ptr< ContainsMethod > MakeValue(const DictionaryValue &this_ref) { return std::shared_ptr< ContainsMethod >(new ContainsMethod(this_ref)); };
+                    static INLINE std::shared_ptr< ContainsMethod > MakeValue(const DictionaryValue &this_ref) { return MakeShared< ContainsMethod >([&](void *memory) { ::new(memory) ContainsMethod(this_ref); }); };
                     
                     //  From iAtomic
                     
                     virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab) const;
-                
+            
             };
-        
+            
             ////
-        
+            
             class ValueHolder : public iAtomic
             {
+                //  The dictionary re-binds its holders when it takes over
+                //  storage from another dictionary.
+                friend class DictionaryValue;
+                
                 private:
-                    const DictionaryValue &mDictionary;
+                    //  0 while the holder is only shared by copies of a
+                    //  dictionary that no longer exists.
+                    const DictionaryValue *mDictionary;
                     
                     std::shared_ptr< iAtomic > mHeldValue;
-                    
+                
                 protected:
-                    INLINE ValueHolder(const DictionaryValue &dict, std::shared_ptr< iAtomic > value) : iAtomic(), mDictionary(dict), mHeldValue(value) {};
+                    INLINE ValueHolder(const DictionaryValue *dict, std::shared_ptr< iAtomic > value) : iAtomic(), mDictionary(dict), mHeldValue(value) {};
+                    
+                    INLINE void invalidate() const { if(0 != mDictionary) { mDictionary->invalidate(); } };
                 
                 public:
                     
-                    static INLINE std::shared_ptr< ValueHolder > MakeValue(const DictionaryValue &dict, std::shared_ptr< iAtomic > value) { return std::shared_ptr< ValueHolder >(new ValueHolder(dict, value)); };
-            
+                    static INLINE std::shared_ptr< ValueHolder > MakeValue(const DictionaryValue *dict, std::shared_ptr< iAtomic > value) { return MakeShared< ValueHolder >([&](void *memory) { ::new(memory) ValueHolder(dict, value); }); };
+                    
                     //  From iAtomic
                     
                     virtual void Lock() throw();
@@ -1246,6 +1595,8 @@ namespace dish
                     virtual std::shared_ptr< iAtomic > Copy() const;
                     virtual std::shared_ptr< iAtomic > Clone() const;
                     
+                    virtual bool IsAliased() const;
+                    
                     virtual BooleanT AsBoolean() const;
                     virtual IntegerT AsInteger() const;
                     virtual RealT AsReal() const;
@@ -1254,53 +1605,134 @@ namespace dish
                     virtual void Assign(std::shared_ptr< iAtomic > rhs);
                     
                     virtual std::shared_ptr< iAtomic > Member(const std::string &member) const;
+                    virtual std::shared_ptr< iAtomic > InspectMember(const std::string &member) const;
                     
                     virtual IntegerT Add(std::shared_ptr< iAtomic > element);
                     virtual IntegerT Add(std::shared_ptr< iAtomic > element, const IntegerT &index);
                     virtual std::shared_ptr< iAtomic > Element(const IntegerT &index) const;
-            
+                    virtual std::shared_ptr< iAtomic > InspectElement(const IntegerT &index) const;
+                    
                     virtual IntegerT Add(std::shared_ptr< iAtomic > key, std::shared_ptr< iAtomic > value);
                     virtual std::shared_ptr< iAtomic > Keys() const;
+                    virtual std::shared_ptr< const KeyListT > SortedKeys() const;
                     virtual std::shared_ptr< iAtomic > Lookup(const StringT &key) const;
+                    virtual std::shared_ptr< iAtomic > InspectLookup(const StringT &key) const;
+                    virtual std::shared_ptr< iAtomic > Lookup(const IntegerT &key) const;
+                    virtual std::shared_ptr< iAtomic > InspectLookup(const IntegerT &key) const;
+                    virtual void CopyEntryValue(const CursorT &cursor, std::shared_ptr< iAtomic > &copy) const;
                     
                     virtual std::shared_ptr< iAtomic > Declare() const;
                     
                     virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab) const;
                     virtual const ParamListT &ParameterList() const;
                     virtual IntegerT NumParameters() const;
-                
+            
             };
-        
+            
             ////
             
-            using DictionaryT = std::map< std::string, std::shared_ptr< iAtomic > >;
-        
+            //  An entry of the dictionary. A key written as a decimal integer
+            //  is hashed and compared as that integer, so that an integer key
+            //  finds its entry without being written out.
+            struct EntryT
+            {
+                std::string Key;
+                std::size_t Hash;
+                IntegerT Integer;
+                bool IsInteger;
+                
+                //  The ValueHolder of the entry's value.
+                std::shared_ptr< iAtomic > Holder;
+            };
+            
+            using EntryListT = std::vector< EntryT >;
+            
             ////
-        
+            
             static IntegerT Count;
-    
-        private:
+            static IntegerT Shares;
+            static IntegerT Unshares;
+            static IntegerT IntegerLookups;
         
-            //  Must be mutable to allow the Element(const StringT &) to insert 
-            //  an item into the dictionary on first reference to the new
-            //  element.
-            mutable DictionaryT mValue;
+        private:
+            
+            //  The entries of the dictionary, in the order they were added,
+            //  and an open-addressed table of their positions plus one (0 for
+            //  a free slot), probed linearly from the hash of a key. Copies of
+            //  a dictionary share its storage until one of them hands out or
+            //  modifies an entry; see unshare().
+            struct StorageT
+            {
+                EntryListT Elements;
+                std::vector< std::uint32_t > Slots;
+                
+                //  The keys in order; made when first asked for after the
+                //  keys change, and shared with whoever is iterating over them.
+                std::shared_ptr< const KeyListT > Sorted;
+                
+                //  The dictionary whose holders these are; references to them
+                //  must stay valid, so the owner never gives them up.
+                const DictionaryValue *Owner;
+                
+                //  Set when an entry is handed out or added; see IsAliased().
+                bool Exposed;
+                
+                INLINE StorageT(const DictionaryValue *owner, const bool &exposed) : Elements(), Slots(), Sorted(), Owner(owner), Exposed(exposed) {};
+            };
+            
+            //  Must be mutable to allow Lookup() to insert an item into the
+            //  dictionary on first reference to the new element.
+            mutable std::shared_ptr< StorageT > mStorage;
             
             mutable std::shared_ptr< iAtomic > mContainsF;
             mutable std::shared_ptr< iAtomic > mCountV;
             mutable std::shared_ptr< iAtomic > mEmptyV;
             mutable std::shared_ptr< iAtomic > mKeysV;
             
+            //  Whether key is an integer as it would be written, and which.
+            static bool isInteger(const StringT &key, IntegerT &value);
+            
+            static std::size_t hash(const IntegerT &key);
+            
+            //  The entry with key, or 0.
+            EntryT *find(const StringT &key) const;
+            EntryT *find(const IntegerT &key) const;
+            
+            //  Adds entry, whose key is not in the dictionary yet.
+            EntryT &insert(const EntryT &entry) const;
+            
+            void rehash(const std::size_t &nslots) const;
+            
+            //  A new entry holding value for key.
+            EntryT makeEntry(const StringT &key, std::shared_ptr< iAtomic > value) const;
+            EntryT makeEntry(const IntegerT &key, std::shared_ptr< iAtomic > value) const;
+        
         protected:
-            INLINE DictionaryValue() : iAtomic(), mValue(), mContainsF(), mCountV(), mEmptyV(), mKeysV() { ++Count; };
+            INLINE DictionaryValue() : iAtomic(), mStorage(std::make_shared< StorageT >(this, false)), mContainsF(), mCountV(), mEmptyV(), mKeysV() { ++Count; };
+            
+            INLINE DictionaryValue(const DictionaryValue &dict) : iAtomic(), mStorage(dict.mStorage), mContainsF(), mCountV(), mEmptyV(), mKeysV() { ++Count; ++Shares; };
+            
+            INLINE EntryListT &elements() const { return mStorage->Elements; };
+            
+            //  Gives this dictionary storage of its own before an entry is
+            //  handed out or the dictionary is modified.
+            void unshare() const;
             
             INLINE void invalidate() const { mCountV.reset(); mEmptyV.reset(); mKeysV.reset(); };
+            
+            INLINE void clear() { elements().clear(); mStorage->Slots.clear(); mStorage->Sorted.reset(); };
         
         public:
-        
+            
             static INLINE IntegerT NumInstances() throw() { return Count; };
+            static INLINE IntegerT NumShares() throw() { return Shares; };
+            static INLINE IntegerT NumUnshares() throw() { return Unshares; };
+            
+            static INLINE IntegerT NumIntegerLookups() throw() { return IntegerLookups; };
             
-            static INLINE std::shared_ptr< DictionaryValue > MakeValue() { return std::shared_ptr< DictionaryValue >(new DictionaryValue()); };
+            static INLINE std::shared_ptr< DictionaryValue > MakeValue() { return MakeShared< DictionaryValue >([&](void *memory) { ::new(memory) DictionaryValue(); }); };
+            
+            virtual ~DictionaryValue();
             
             //  From iAtomic
             
@@ -1310,6 +1742,8 @@ namespace dish
             
             virtual std::shared_ptr< iAtomic > Copy() const;
             
+            virtual bool IsAliased() const;
+            
             virtual StringT AsString() const;
             
             virtual void Assign(std::shared_ptr< iAtomic > rhs);
@@ -1318,38 +1752,89 @@ namespace dish
             
             virtual IntegerT Add(std::shared_ptr< iAtomic > key, std::shared_ptr< iAtomic > value);
             virtual std::shared_ptr< iAtomic > Keys() const;
+            virtual std::shared_ptr< const KeyListT > SortedKeys() const;
             virtual std::shared_ptr< iAtomic > Lookup(const StringT &key) const;
+            virtual std::shared_ptr< iAtomic > InspectLookup(const StringT &key) const;
+            virtual std::shared_ptr< iAtomic > Lookup(const IntegerT &key) const;
+            virtual std::shared_ptr< iAtomic > InspectLookup(const IntegerT &key) const;
+            virtual void CopyEntryValue(const CursorT &cursor, std::shared_ptr< iAtomic > &copy) const;
             
             virtual void Print(std::ostream &out, const std::string::size_type &indent = 0) const;
-        
+    
     };
     
     ////
     
     class StructureValue : public iAtomic
     {
+        //  This friend fills in the members of the structures it declares
+        //  without adding them one at a time.
+        friend class StructureTypeAtomic;
+        
         public:
             
-            typedef std::map< std::string, std::shared_ptr< iAtomic > > MemberSetT;
-        
+            //  The values of the members, in the order of the names of the
+            //  structure's shape.
+            using MemberSetT = std::vector< std::shared_ptr< iAtomic > >;
+            
             static IntegerT Count;
+            static IntegerT Shares;
+            static IntegerT Unshares;
         
         private:
-            MemberSetT mMemberSet;
             
+            //  The members of the structure. Copies of a structure share its
+            //  storage until one of them hands out or modifies a member; see
+            //  unshare().
+            struct StorageT
+            {
+                MemberSetT Members;
+                
+                const StructureShape *Shape;
+                
+                //  The structure whose members these are; references to them
+                //  must stay valid, so the owner never gives them up.
+                const StructureValue *Owner;
+                
+                //  Set when a member is handed out or added; see IsAliased().
+                bool Exposed;
+                
+                INLINE StorageT(const StructureShape &shape, const StructureValue *owner, const bool &exposed) : Members(), Shape(&shape), Owner(owner), Exposed(exposed) {};
+            };
+            
+            mutable std::shared_ptr< StorageT > mStorage;
+        
         protected:
             static void generateStructureMemberExistsError(const std::string &id);
             
-            INLINE StructureValue() : iAtomic(), mMemberSet() { ++Count; };
+            INLINE StructureValue() : iAtomic(), mStorage(std::make_shared< StorageT >(StructureShape::Empty(), this, false)) { ++Count; };
+            
+            //  The members are left empty, to be filled in.
+            INLINE StructureValue(const StructureShape &shape) : iAtomic(), mStorage(std::make_shared< StorageT >(shape, this, false)) { mStorage->Members.resize(shape.Size()); ++Count; };
+            
+            INLINE StructureValue(const StructureValue &structure) : iAtomic(), mStorage(structure.mStorage) { ++Count; ++Shares; };
+            
+            INLINE MemberSetT &members() const { return mStorage->Members; };
+            INLINE const StructureShape &shape() const { return *mStorage->Shape; };
+            
+            //  Gives this structure storage of its own before a member is
+            //  handed out or the structure is modified.
+            void unshare() const;
         
         public:
-        
+            
             static INLINE IntegerT NumInstances() throw() { return Count; };
-        
-            static INLINE std::shared_ptr< StructureValue > MakeValue() { return std::shared_ptr< StructureValue >(new StructureValue()); };
+            static INLINE IntegerT NumShares() throw() { return Shares; };
+            static INLINE IntegerT NumUnshares() throw() { return Unshares; };
+            
+            static INLINE std::shared_ptr< StructureValue > MakeValue() { return MakeShared< StructureValue >([&](void *memory) { ::new(memory) StructureValue(); }); };
+            
+            virtual ~StructureValue();
             
-            INLINE void Add(const std::string &id, std::shared_ptr< iAtomic > value)
-                { assert(0 != value.get()); if(!mMemberSet.insert(std::make_pair(id, value)).second) { generateStructureMemberExistsError(id); } };
+            void Add(const std::string &id, std::shared_ptr< iAtomic > value);
+            
+            //  Replaces the value of the member id, which must exist.
+            void Bind(const std::string &id, std::shared_ptr< iAtomic > value);
             
             //  From iAtomic
             
@@ -1358,13 +1843,94 @@ namespace dish
             virtual TypeT Type() const throw();
             
             virtual std::shared_ptr< iAtomic > Copy() const;
+            virtual std::shared_ptr< iAtomic > Clone() const;
+            
+            virtual bool IsAliased() const;
             
             virtual StringT AsString() const;
             
             virtual IntegerT Members(iAtomic::MemberNameSetT &members) const;
             virtual std::shared_ptr< iAtomic > Member(const std::string &member) const;
+            virtual std::shared_ptr< iAtomic > InspectMember(const std::string &member) const;
+            virtual std::shared_ptr< iAtomic > Member(const std::string &member, MemberCacheT &cache) const;
+            virtual std::shared_ptr< iAtomic > InspectMember(const std::string &member, MemberCacheT &cache) const;
             
             virtual void Print(std::ostream &out, const std::string::size_type &indent = 0) const;
+    
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    
+    //  A value as it is passed around by the evaluator. Booleans, integers and
+    //  reals produced by an operator are stored inline; any other value, or a
+    //  primitive that already lives on the heap (a variable, say), is held by
+    //  its box. An inline value is boxed only when Box() is called, i.e. when
+    //  it escapes into a variable, container or function.
+    class ValueHandle
+    {
+        private:
+            iAtomic::TypeT mType;
+            
+            union
+            {
+                BooleanT mBoolean;
+                IntegerT mInteger;
+                RealT mReal;
+            };
+            
+            std::shared_ptr< iAtomic > mValue;
+            
+            static IntegerT Boxes;
+        
+        public:
+            INLINE ValueHandle() : mType(iAtomic::typeNull), mInteger(0), mValue() {};
+            explicit INLINE ValueHandle(std::shared_ptr< iAtomic > value) : mType(value->Type()), mInteger(0), mValue(value) {};
+            
+            static INLINE IntegerT NumBoxes() throw() { return Boxes; };
+            
+            INLINE const iAtomic::TypeT &Type() const throw() { return mType; };
+            
+            INLINE bool IsBoxed() const throw() { return (0 != mValue.get()); };
+            
+            INLINE bool IsBoolean() const throw() { return (iAtomic::typeBoolean == mType); };
+            INLINE bool IsInteger() const throw() { return (iAtomic::typeInteger == mType); };
+            INLINE bool IsReal() const throw() { return (iAtomic::typeReal == mType); };
+            INLINE bool IsNumeric() const throw() { return (IsInteger() || IsReal()); };
+            INLINE bool IsPrimitive() const throw() { return (IsBoolean() || IsNumeric()); };
+            
+            //  The value of a boxed handle is read when it is asked for, not
+            //  when the handle is set, as the box may be a variable which is
+            //  modified in between.
+            INLINE BooleanT AsBoolean() const
+            {
+                if(IsBoxed())
+                {
+                    return mValue->AsBoolean();
+                }
+                
+                switch(mType)
+                {
+                    case iAtomic::typeInteger: return (0 != mInteger);
+                    case iAtomic::typeReal: return (0.0 != mReal);
+                    default: break;
+                }
+                
+                return mBoolean;
+            };
+            
+            INLINE IntegerT AsInteger() const { return IsBoxed() ? mValue->AsInteger() : (IsReal() ? static_cast< IntegerT >(mReal) : mInteger); };
+            INLINE RealT AsReal() const { return IsBoxed() ? mValue->AsReal() : (IsReal() ? mReal : static_cast< RealT >(mInteger)); };
+            
+            INLINE void Set(std::shared_ptr< iAtomic > value) { mType = value->Type(); mValue = value; };
+            
+            INLINE void SetBoolean(const BooleanT &value) { mType = iAtomic::typeBoolean; mBoolean = value; mValue.reset(); };
+            INLINE void SetInteger(const IntegerT &value) { mType = iAtomic::typeInteger; mInteger = value; mValue.reset(); };
+            INLINE void SetReal(const RealT &value) { mType = iAtomic::typeReal; mReal = value; mValue.reset(); };
+            
+            //  Assigns the value to the atomic target without boxing it.
+            void AssignTo(iAtomic &target) const;
+            
+            std::shared_ptr< iAtomic > Box();
         
     };
 
@@ -1376,6 +1942,9 @@ namespace dish
     typedef std::shared_ptr< dish::iAtomic > (*TwoArgOpF)(const dish::iAtomic &arg1, const dish::iAtomic &arg);
     typedef bool (*TwoArgBoolOpF)(const dish::iAtomic &arg1, const dish::iAtomic &arg);
     
+    typedef void (*OneArgHandleOpF)(dish::ValueHandle &arg);
+    typedef void (*TwoArgHandleOpF)(dish::ValueHandle &arg1, dish::ValueHandle &arg2);
+    
     extern const OneArgOpF OpNeg_FuncTable[iAtomic::typeNUM];
     extern const TwoArgOpF OpAdd_FuncTable[iAtomic::typeNUM][iAtomic::typeNUM];
     extern const TwoArgOpF OpSub_FuncTable[iAtomic::typeNUM][iAtomic::typeNUM];
@@ -1447,6 +2016,31 @@ namespace dish
     
     INLINEC bool OpGreaterThan(const iAtomic &arg1, const iAtomic &arg2) { return OpGreaterThan_FuncTable[arg1.Type()][arg2.Type()](arg1, arg2); };
     INLINEC std::shared_ptr< iAtomic > OpGreaterThan(std::shared_ptr< iAtomic > arg1, std::shared_ptr< iAtomic > arg2) { return dish::BooleanValue::MakeLockedValue(OpGreaterThan(*arg1, *arg2)); };
+    
+    ////////////////////////////////////////////////////////////////////////////
+    
+    //  Operators on value handles. The result replaces the first operand.
+    //  Integer and real operands (and booleans for the logical operators) are
+    //  combined inline; anything else is boxed and dispatched through the
+    //  function tables above, with identical results.
+    
+    extern void OpNeg(ValueHandle &arg);
+    extern void OpAdd(ValueHandle &arg1, ValueHandle &arg2);
+    extern void OpSub(ValueHandle &arg1, ValueHandle &arg2);
+    extern void OpMul(ValueHandle &arg1, ValueHandle &arg2);
+    extern void OpDiv(ValueHandle &arg1, ValueHandle &arg2);
+    extern void OpMod(ValueHandle &arg1, ValueHandle &arg2);
+    
+    extern void OpNot(ValueHandle &arg);
+    extern void OpAnd(ValueHandle &arg1, ValueHandle &arg2);
+    extern void OpOr(ValueHandle &arg1, ValueHandle &arg2);
+    extern void OpXor(ValueHandle &arg1, ValueHandle &arg2);
+    extern void OpLessThan(ValueHandle &arg1, ValueHandle &arg2);
+    extern void OpLessThanOrEqual(ValueHandle &arg1, ValueHandle &arg2);
+    extern void OpEqual(ValueHandle &arg1, ValueHandle &arg2);
+    extern void OpNotEqual(ValueHandle &arg1, ValueHandle &arg2);
+    extern void OpGreaterThanOrEqual(ValueHandle &arg1, ValueHandle &arg2);
+    extern void OpGreaterThan(ValueHandle &arg1, ValueHandle &arg2);
 
     ////////////////////////////////////////////////////////////////////////////
 
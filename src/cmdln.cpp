@@ -261,6 +261,7 @@ const std::string dish::DishCommandLine::PROGRAM_ARGS("Arguments");
 const std::string dish::DishCommandLine::SYMTAB_STAT_MODE("SymbolTableStatsMode");
 const std::string dish::DishCommandLine::PRINT_SYMTAB_MODE("PrintSymbolTableMode");
 const std::string dish::DishCommandLine::SHUFFLE_SYMTAB("SuffleSymbolTable");
+const std::string dish::DishCommandLine::EAGER_LIBRARIES("EagerLibraries");
 
 const std::string dish::DishCommandLine::PRINT_RNG_STATS("PrintRandomNumberGeneratorStats");
 const std::string dish::DishCommandLine::PRINT_ATOMIC_STATS("PrintAtomicStats");
@@ -289,6 +290,16 @@ const std::string dish::DishCommandLine::SUPPRESS_LOCATION("SuppressLocation");
 
 const std::string dish::DishCommandLine::STACK_SIZE("StackSize");
 
+const std::string dish::DishCommandLine::TAIL_CALLS("TailCalls");
+
+const std::string dish::DishCommandLine::OPTIMIZE("Optimize");
+const std::string dish::DishCommandLine::INLINE_FUNCTIONS("InlineFunctions");
+const std::string dish::DishCommandLine::INLINE_SIZE("InlineSize");
+const std::string dish::DishCommandLine::INLINE_AFTER("InlineAfter");
+
+const std::string dish::DishCommandLine::PARSE_TREE_CACHE("ParseTreeCache");
+const std::string dish::DishCommandLine::PARSE_TREE_CACHE_DIR("ParseTreeCacheDirectory");
+
 dish::DishCommandLine::DishCommandLine() : dish::CommandLine()
 {
     add(EXECUTE, true);
@@ -298,6 +309,7 @@ dish::DishCommandLine::DishCommandLine() : dish::CommandLine()
     add(SYMTAB_STAT_MODE, false);
     add(PRINT_SYMTAB_MODE, false);
     add(SHUFFLE_SYMTAB, false);
+    add(EAGER_LIBRARIES, false);
     add(PRINT_USAGE_INFO, false);
     add(PRINT_RNG_STATS, false);
     add(PRINT_ATOMIC_STATS, false);
@@ -314,6 +326,13 @@ dish::DishCommandLine::DishCommandLine() : dish::CommandLine()
     add(RNG_SEED, static_cast< int >(-1));
     add(SUPPRESS_LOCATION, true);
     add(STACK_SIZE, static_cast< int >(8 * 1024 * 1024));
+    add(TAIL_CALLS, true);
+    add(OPTIMIZE, false);
+    add(INLINE_FUNCTIONS, true);
+    add(INLINE_SIZE, static_cast< int >(16));
+    add(INLINE_AFTER, static_cast< int >(2));
+    add(PARSE_TREE_CACHE, false);
+    add(PARSE_TREE_CACHE_DIR, std::string());
 }
 
 dish::DishCommandLine &dish::DishCommandLine::Instance()
@@ -430,6 +449,55 @@ void dish::DishCommandLine::Process(const int argc, const char * const * const a
             add(QUIET_MODE, true);
         }
     
+        //  Tested before -I, which matches any argument beginning with -i.
+        else if(arg == "-inlinesize")
+        {
+            if(++i < argc)
+            {
+                std::stringstream input(argv[i]);
+                
+                int inlinesize;
+                input >> inlinesize;
+            
+                add(INLINE_SIZE, inlinesize);
+            }
+            else
+            {
+                add(EXECUTE, false);
+                add(PRINT_USAGE_INFO, true);
+                
+                std::cerr << std::endl;
+                std::cerr << "ERROR: The -inlinesize command-line option requires an argument." << std::endl;
+                std::cerr << std::endl;
+                
+                done = true;
+            }
+        }
+        
+        else if(arg == "-inlineafter")
+        {
+            if(++i < argc)
+            {
+                std::stringstream input(argv[i]);
+                
+                int inlineafter;
+                input >> inlineafter;
+            
+                add(INLINE_AFTER, inlineafter);
+            }
+            else
+            {
+                add(EXECUTE, false);
+                add(PRINT_USAGE_INFO, true);
+                
+                std::cerr << std::endl;
+                std::cerr << "ERROR: The -inlineafter command-line option requires an argument." << std::endl;
+                std::cerr << std::endl;
+                
+                done = true;
+            }
+        }
+        
         else if(BeginsWith(arg, "-I"))
         {
             std::string path(arg.substr(2));
@@ -457,6 +525,36 @@ void dish::DishCommandLine::Process(const int argc, const char * const * const a
             add(SHUFFLE_SYMTAB, true);
         }
         
+        else if(arg == "-eagerlib")
+        {
+            add(EAGER_LIBRARIES, true);
+        }
+        
+        else if(arg == "-parsecache")
+        {
+            add(PARSE_TREE_CACHE, true);
+        }
+        
+        else if(arg == "-cachedir")
+        {
+            if(++i < argc)
+            {
+                add(PARSE_TREE_CACHE, true);
+                add(PARSE_TREE_CACHE_DIR, std::string(argv[i]));
+            }
+            else
+            {
+                add(EXECUTE, false);
+                add(PRINT_USAGE_INFO, true);
+                
+                std::cerr << std::endl;
+                std::cerr << "ERROR: The -cachedir command-line option requires an argument." << std::endl;
+                std::cerr << std::endl;
+                
+                done = true;
+            }
+        }
+        
         else if(arg == "-rngstats")
         {
             add(PRINT_RNG_STATS, true);
@@ -683,6 +781,26 @@ void dish::DishCommandLine::Process(const int argc, const char * const * const a
             add(SUPPRESS_LOCATION, false);
         }
         
+        else if(arg == "-tailcalls")
+        {
+            add(TAIL_CALLS, true);
+        }
+        
+        else if(arg == "-notailcalls")
+        {
+            add(TAIL_CALLS, false);
+        }
+        
+        else if(arg == "-optimize")
+        {
+            add(OPTIMIZE, true);
+        }
+        
+        else if(arg == "-noinline")
+        {
+            add(INLINE_FUNCTIONS, false);
+        }
+        
         else
         {
             add(INPUT, arg);
@@ -708,6 +826,9 @@ void dish::DishCommandLine::PrintUsage(std::ostream &out) const
     out << "    -symtabstats       : Display symbol-table statistics." << std::endl;
     out << "    -printsymtab       : Print the symbol tables." << std::endl;
     out << "    -shufflesymtab     : Shuffle the insertion order of the runtime into the symbol table." << std::endl;
+    out << "    -eagerlib          : Load the whole runtime library at start-up rather than on first use." << std::endl;
+    out << "    -parsecache        : Keep the parse-trees of imported files in a cache file next to each." << std::endl;
+    out << "    -cachedir <dir>    : Keep the parse-trees of imported files in cache files in <dir>." << std::endl;
     out << "    -rngstats          : Display random-number-generator statistics." << std::endl;
     out << "    -atomicstats       : Display atomic type instance counts." << std::endl;
     out << "    -conststats        : Display constant-value statistics." << std::endl;
@@ -731,6 +852,12 @@ void dish::DishCommandLine::PrintUsage(std::ostream &out) const
     out << "    -stack <int>       : Set the maximum stack depth." << std::endl;
     out << "    -printparsetree    : Print the parse-tree of the specified input." << std::endl;
     out << "    -addlocation       : Add location information to the parse-tree." << std::endl;
+    out << "    -tailcalls         : Eliminate calls in tail position which cannot change scope (default)." << std::endl;
+    out << "    -notailcalls       : Make every call in tail position from within its caller." << std::endl;
+    out << "    -optimize          : Parse and optimize the whole program before executing it." << std::endl;
+    out << "    -noinline          : Don't inline functions when optimizing (for debugging)." << std::endl;
+    out << "    -inlinesize <int>  : Set the most parse-tree nodes of a function to inline (default 16)." << std::endl;
+    out << "    -inlineafter <int> : Set the number of calls made before a call is inlined (default 2)." << std::endl;
     out << "    -version           : Display the version of the interpreter and language." << std::endl;
     out << "    -sysstack <int>    : Set the stack size for the interpreter (default 8MB)." << std::endl;
     out << "    -? or -help        : Display this usage information." << std::endl;
@@ -218,6 +218,7 @@ namespace dish
             static const std::string SYMTAB_STAT_MODE;
             static const std::string PRINT_SYMTAB_MODE;
             static const std::string SHUFFLE_SYMTAB;
+            static const std::string EAGER_LIBRARIES;
             
             static const std::string PRINT_RNG_STATS;
             static const std::string PRINT_ATOMIC_STATS;
@@ -246,6 +247,16 @@ namespace dish
             
             static const std::string STACK_SIZE;
             
+            static const std::string TAIL_CALLS;
+            
+            static const std::string OPTIMIZE;
+            static const std::string INLINE_FUNCTIONS;
+            static const std::string INLINE_SIZE;
+            static const std::string INLINE_AFTER;
+            
+            static const std::string PARSE_TREE_CACHE;
+            static const std::string PARSE_TREE_CACHE_DIR;
+            
         protected:
             DishCommandLine();
             
@@ -264,6 +275,7 @@ namespace dish
             INLINE bool SymbolTablestatMode() const { return (*this)[SYMTAB_STAT_MODE]->AsBoolean(); };
             INLINE bool PrintSymbolTableMode() const { return (*this)[PRINT_SYMTAB_MODE]->AsBoolean(); };
             INLINE bool ShuffleSymbolTable() const { return (*this)[SHUFFLE_SYMTAB]->AsBoolean(); };
+            INLINE bool EagerLibraries() const { return (*this)[EAGER_LIBRARIES]->AsBoolean(); };
             
             INLINE bool PrintRngStats() const { return (*this)[PRINT_RNG_STATS]->AsBoolean(); };
             INLINE bool PrintAtomicStats() const { return (*this)[PRINT_ATOMIC_STATS]->AsBoolean(); };
@@ -291,6 +303,16 @@ namespace dish
             INLINE bool SuppressLocation() const { return (*this)[SUPPRESS_LOCATION]->AsBoolean(); };
             
             INLINE int StackSize() const { return (*this)[STACK_SIZE]->AsInteger(); };
+            
+            INLINE bool EliminateTailCalls() const { return (*this)[TAIL_CALLS]->AsBoolean(); };
+            
+            INLINE bool Optimize() const { return (*this)[OPTIMIZE]->AsBoolean(); };
+            INLINE bool InlineFunctions() const { return (*this)[INLINE_FUNCTIONS]->AsBoolean(); };
+            INLINE int InlineSize() const { return (*this)[INLINE_SIZE]->AsInteger(); };
+            INLINE int InlineAfter() const { return (*this)[INLINE_AFTER]->AsInteger(); };
+            
+            INLINE bool ParseTreeCache() const { return (*this)[PARSE_TREE_CACHE]->AsBoolean(); };
+            INLINE std::string ParseTreeCacheDirectory() const { return (*this)[PARSE_TREE_CACHE_DIR]->AsString(); };
         
             /////
             
@@ -4,14 +4,6 @@
 #ifndef DISH_CONFIG_H
 #define DISH_CONFIG_H
 
-    #ifndef SYMTAB_HASH_FUNC_PARTIAL_ID
-        #define SYMTAB_HASH_FUNC_PARTIAL_ID
-    #endif
-
-    #ifndef SYMTAB_HASH_FUNC_PARTIAL_ID_SPREAD
-        #define SYMTAB_HASH_FUNC_PARTIAL_ID_SPREAD
-    #endif
-
     #ifndef LANG_TABLE_HASHED
         #define LANG_TABLE_HASHED
     #endif
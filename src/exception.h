@@ -129,6 +129,17 @@ namespace dish
             INLINE SyntaxErrorException(const std::string &loc, const std::string &msg) : ParserException(loc, msg) {};
             
     };
+    
+    //  A parse-tree cache file that is stale, damaged or cannot be written; the
+    //  parser falls back to parsing the source.
+    class ParseTreeCacheException : public ParserException
+    {
+        public:
+            INLINE ParseTreeCacheException() : ParserException() {};
+            INLINE ParseTreeCacheException(const std::string &msg) : ParserException(msg) {};
+            INLINE ParseTreeCacheException(const std::string &loc, const std::string &msg) : ParserException(loc, msg) {};
+            
+    };
 
     ////////////////////////////////////////////////////////////////////////////
     
@@ -19,10 +19,18 @@
     FOR A PARTICULAR PURPOSE.
 */
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
+#include <iterator>
 #include <sstream>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
 #include "input.h"
 
 /******************************************************************************
@@ -36,25 +44,87 @@ const bool dish::FILE_INPUT(true);
 
 /******************************************************************************
 
-    dish::iInputStream class definitions
+    dish::SourceLocationTable class definitions
 
  ******************************************************************************/
 
-const int dish::iInputStream::END_OF_INPUT(EOF);
+const dish::SourceLocationT dish::SourceLocationTable::NO_LOCATION(0);
+
+std::vector< std::string > dish::SourceLocationTable::Sources;
+std::map< std::string, std::uint32_t > dish::SourceLocationTable::SourceIds;
+std::vector< dish::SourceLocationTable::LocationT > dish::SourceLocationTable::Locations(1, LocationT());
+
+dish::SourceLocationT dish::SourceLocationTable::Intern(const std::string &source, const int &line, const int &column)
+{
+    std::uint32_t source_id(0);
+    
+    if(Sources.empty() || (Sources.back() != source))
+    {
+        const std::map< std::string, std::uint32_t >::const_iterator i(SourceIds.find(source));
+        
+        if(SourceIds.end() != i)
+        {
+            source_id = i->second;
+        }
+        else
+        {
+            source_id = static_cast< std::uint32_t >(Sources.size());
+            
+            Sources.push_back(source);
+            SourceIds[source] = source_id;
+        }
+    }
+    else
+    {
+        source_id = static_cast< std::uint32_t >(Sources.size() - 1);
+    }
+    
+    const LocationT &last(Locations.back());
+    
+    if((Locations.size() > 1) && (last.Source == source_id) && (last.Line == line) && (last.Column == column))
+    {
+        return static_cast< SourceLocationT >(Locations.size() - 1);
+    }
+    
+    const LocationT location = { source_id, line, column };
+    Locations.push_back(location);
+    
+    return static_cast< SourceLocationT >(Locations.size() - 1);
+}
 
-std::string dish::iInputStream::LocationString() const
+std::string dish::SourceLocationTable::Format(const dish::SourceLocationT &location)
+{
+    if((NO_LOCATION == location) || (location >= Locations.size()))
+    {
+        return std::string();
+    }
+    
+    const LocationT &entry(Locations[location]);
+    
+    return Format(Sources[entry.Source], entry.Line, entry.Column);
+}
+
+std::string dish::SourceLocationTable::Format(const std::string &source, const int &line, const int &column)
 {
     std::stringstream locstr;
-    locstr << Source();
+    locstr << source;
     locstr << " (Ln ";
-    locstr << Line();
+    locstr << line;
     locstr << "; Col ";
-    locstr << Column();
+    locstr << column;
     locstr << ")";
     
     return locstr.str();
 }
 
+/******************************************************************************
+
+    dish::iInputStream class definitions
+
+ ******************************************************************************/
+
+const int dish::iInputStream::END_OF_INPUT(EOF);
+
 /******************************************************************************
 
     dish::InputStream class definitions
@@ -84,47 +154,18 @@ void dish::InputStream::Print(std::ostream &out)
 
 /******************************************************************************
 
-    dish::FileInputStream class definitions
+    dish::MemoryInputStream class definitions
 
  ******************************************************************************/
- 
-dish::FileInputStream::FileInputStream(const std::string &fname) : InputStream(), 
-    mFileName(fname),
-    
-    mLine(1),
-    mColumn(1),
-    mLastColumn(-1),
-    
-    mInput(fname)
-{
-    if(!mInput)
-    {
-        std::stringstream message;
-        message << "Unable to import ";
-        message << fname;
-        message << ".";
-    
-        throw UnableToImportFileException(message.str());
-    }
-}
 
-bool dish::FileInputStream::Empty()
+bool dish::MemoryInputStream::Empty()
 {
-    const int byte(Get());
-    
-    if(END_OF_INPUT != byte)
-    {
-        Unget(byte);
-        
-        return false;
-    }
-    
-    return true;
+    return (empty() && (mNext == mEnd));
 }
 
-int dish::FileInputStream::Get()
+int dish::MemoryInputStream::Get()
 {
-    const int byte(empty() ? mInput.get() : InputStream::Get());
+    const int byte(empty() ? ((mNext != mEnd) ? static_cast< unsigned char >(*mNext++) : END_OF_INPUT) : InputStream::Get());
     
     if('\n' == byte)
     {
@@ -137,7 +178,7 @@ int dish::FileInputStream::Get()
     return byte;
 }
 
-void dish::FileInputStream::Unget(const int byte)
+void dish::MemoryInputStream::Unget(const int byte)
 {
     if('\n' == byte)
     {
@@ -145,85 +186,135 @@ void dish::FileInputStream::Unget(const int byte)
         --mLine;
     }
     
-    InputStream::Unget(byte);
+    if(empty() && (mNext != mBegin) && (static_cast< unsigned char >(mNext[-1]) == byte))
+    {
+        --mNext;
+    }
+    else
+    {
+        InputStream::Unget(byte);
+    }
 }
 
-const std::string &dish::FileInputStream::Source() const
+bool dish::MemoryInputStream::Buffered(const char *&next, const char *&end)
 {
-    return mFileName;
+    if(empty() && (mNext != mEnd))
+    {
+        next = mNext;
+        end = mEnd;
+        
+        return true;
+    }
+    
+    return false;
+}
+
+void dish::MemoryInputStream::Advance(const std::size_t &nbytes)
+{
+    assert(empty());
+    assert(nbytes <= static_cast< std::size_t >(mEnd - mNext));
+    
+    const char * const next(mNext + nbytes);
+    const int nlines(static_cast< int >(std::count(mNext, next, '\n')));
+    
+    if(0 != nlines)
+    {
+        mLine += nlines;
+        
+        mLastColumn = mColumn;
+        mColumn = 1;
+    }
+    
+    mNext = next;
 }
 
-const int &dish::FileInputStream::Line() const
+const int &dish::MemoryInputStream::Line() const
 {
     return mLine;
 }
 
-const int &dish::FileInputStream::Column() const
+const int &dish::MemoryInputStream::Column() const
 {
     return mColumn;
 }
 
 /******************************************************************************
 
-    dish::StringInputStream class definitions
+    dish::FileInputStream class definitions
 
  ******************************************************************************/
-
-bool dish::StringInputStream::Empty()
-{
-    const int byte(Get());
-
-    if(END_OF_INPUT != byte)
-    {
-        Unget(byte);
+ 
+dish::FileInputStream::FileInputStream(const std::string &fname) : MemoryInputStream(), 
+    mFileName(fname),
     
-        return false;
-    }
+    mMapping(MAP_FAILED),
+    mMappingSize(0),
     
-    return true;
-}
-
-int dish::StringInputStream::Get()
+    mContents()
 {
-    const int byte(empty() ? mInput.get() : InputStream::Get());
+    const int fd(open(fname.c_str(), O_RDONLY));
     
-    if('\n' == byte)
+    if(-1 != fd)
     {
-        ++mLine;
+        struct stat status;
         
-        mLastColumn = mColumn;
-        mColumn = 1;
+        if((0 == fstat(fd, &status)) && S_ISREG(status.st_mode) && (0 < status.st_size))
+        {
+            mMappingSize = static_cast< std::size_t >(status.st_size);
+            mMapping = mmap(0, mMappingSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+        
+        close(fd);
     }
     
-    return byte;
+    if(MAP_FAILED != mMapping)
+    {
+        assign(static_cast< const char * >(mMapping), mMappingSize);
+    }
+    else
+    {
+        std::ifstream input(fname);
+        
+        if(!input)
+        {
+            std::stringstream message;
+            message << "Unable to import ";
+            message << fname;
+            message << ".";
+        
+            throw UnableToImportFileException(message.str());
+        }
+        
+        mContents.assign(std::istreambuf_iterator< char >(input), std::istreambuf_iterator< char >());
+        
+        assign(mContents.data(), mContents.size());
+    }
 }
 
-void dish::StringInputStream::Unget(const int byte)
+dish::FileInputStream::~FileInputStream()
 {
-    if('\n' == byte)
+    if(MAP_FAILED != mMapping)
     {
-        mColumn = mLastColumn;
-        --mLine;
+        munmap(mMapping, mMappingSize);
     }
-    
-    InputStream::Unget(byte);
 }
 
-const std::string &dish::StringInputStream::Source() const
+const std::string &dish::FileInputStream::Source() const
 {
-    static const std::string SourceName("< string >");
-
-    return SourceName;
+    return mFileName;
 }
 
-const int &dish::StringInputStream::Line() const
-{
-    return mLine;
-}
+/******************************************************************************
 
-const int &dish::StringInputStream::Column() const
+    dish::StringInputStream class definitions
+
+ ******************************************************************************/
+
+const std::string &dish::StringInputStream::Source() const
 {
-    return mColumn;
+    static const std::string SourceName("< string >");
+
+    return SourceName;
 }
 
 /******************************************************************************
@@ -351,20 +442,14 @@ void dish::StackedInputStream::Load(const std::string &fname)
 
 bool dish::StackedInputStream::Empty()
 {
-    while((!mInputStack.empty()) && mInputStack.front().second->Empty())
-    {
-        mInputStack.pop_front();
-    }
+    popEmpty();
     
     return (mInputStack.empty() && InputStream::Empty());
 }
 
 int dish::StackedInputStream::Get()
 {
-    while((!mInputStack.empty()) && mInputStack.front().second->Empty())
-    {
-        mInputStack.pop_front();
-    }
+    popEmpty();
     
     if(!mInputStack.empty())
     {
@@ -386,6 +471,25 @@ void dish::StackedInputStream::Unget(const int byte)
     }
 }
 
+bool dish::StackedInputStream::Buffered(const char *&next, const char *&end)
+{
+    popEmpty();
+    
+    return ((!mInputStack.empty()) && mInputStack.front().second->Buffered(next, end));
+}
+
+void dish::StackedInputStream::Advance(const std::size_t &nbytes)
+{
+    if(!mInputStack.empty())
+    {
+        mInputStack.front().second->Advance(nbytes);
+    }
+    else
+    {
+        InputStream::Advance(nbytes);
+    }
+}
+
 void dish::StackedInputStream::Print(std::ostream &out)
 {
     while(!mInputStack.empty())
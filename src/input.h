@@ -24,13 +24,18 @@
 
 #include "dishconfig.h"
 
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <map>
 #include <memory>
 #include <set>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "inline.h"
 #include "utility.h"
@@ -43,6 +48,49 @@ namespace dish
     extern const bool STRING_INPUT;
     extern const bool FILE_INPUT;
 
+    ////////////////////////////////////////////////////////////////////////////
+    
+    //  A location in a source file, as an index into the SourceLocationTable.
+    using SourceLocationT = std::uint32_t;
+    
+    //  The locations of the parse-tree nodes, each held once so that a node
+    //  keeps only a 32-bit index of its location. The source, line and column
+    //  are formatted only when the location is reported.
+    class SourceLocationTable
+    {
+        public:
+            static const SourceLocationT NO_LOCATION;
+        
+        private:
+            using LocationT = struct Location
+            {
+                std::uint32_t Source;
+                int Line;
+                int Column;
+            };
+            
+            static std::vector< std::string > Sources;
+            static std::map< std::string, std::uint32_t > SourceIds;
+            static std::vector< LocationT > Locations;
+        
+        public:
+            //  The location of line and column in source; consecutive calls
+            //  for the same location share one entry.
+            static SourceLocationT Intern(const std::string &source, const int &line, const int &column);
+            
+            //  The text reported for a location; empty for NO_LOCATION.
+            static std::string Format(const SourceLocationT &location);
+            static std::string Format(const std::string &source, const int &line, const int &column);
+            
+            //  The parts of a location other than NO_LOCATION.
+            static INLINE const std::string &Source(const SourceLocationT &location) { assert((NO_LOCATION != location) && (location < Locations.size())); return Sources[Locations[location].Source]; };
+            static INLINE const int &Line(const SourceLocationT &location) { assert((NO_LOCATION != location) && (location < Locations.size())); return Locations[location].Line; };
+            static INLINE const int &Column(const SourceLocationT &location) { assert((NO_LOCATION != location) && (location < Locations.size())); return Locations[location].Column; };
+            
+            static INLINE IntegerT NumLocations() { return static_cast< IntegerT >(Locations.size()); };
+        
+    };
+
     ////////////////////////////////////////////////////////////////////////////
 
     class iInputStream
@@ -53,13 +101,21 @@ namespace dish
         
             virtual ~iInputStream() {};
             
-            std::string LocationString() const;
+            INLINE SourceLocationT Location() const { return SourceLocationTable::Intern(Source(), Line(), Column()); };
+            INLINE std::string LocationString() const { return SourceLocationTable::Format(Source(), Line(), Column()); };
             
             virtual bool Empty() = 0;
             
             virtual int Get() = 0;
             virtual void Unget(const int byte) = 0;
             
+            //  The bytes which follow in the input, from next up to end, if
+            //  they are held in memory and can be scanned in place rather than
+            //  read one at a time; false if none are. Advance() consumes the
+            //  first nbytes of them, just as that many calls of Get() would.
+            virtual bool Buffered(const char *&next, const char *&end) = 0;
+            virtual void Advance(const std::size_t &nbytes) = 0;
+            
             virtual const std::string &Source() const = 0;
             virtual const int &Line() const = 0;
             virtual const int &Column() const = 0;
@@ -87,25 +143,34 @@ namespace dish
             virtual int Get() { return (!empty() ? (mNextByteAvailable = false, mNextByte) : END_OF_INPUT); };
             virtual void Unget(const int byte) { mNextByte = byte; mNextByteAvailable = true; };
             
+            virtual bool Buffered(const char *&next, const char *&end) { return false; };
+            virtual void Advance(const std::size_t &nbytes) { assert(0 == nbytes); };
+            
             virtual void Print(std::ostream &out = std::cout);
         
     };
 
     ////////////////////////////////////////////////////////////////////////////
     
-    class FileInputStream : public InputStream
+    //  An input whose contents are held in memory as a whole; Get() reads the
+    //  next byte from there, and Unget() of the byte just read steps back over
+    //  it.
+    class MemoryInputStream : public InputStream
     {
         private:
-            const std::string mFileName;
+            const char *mBegin;
+            const char *mNext;
+            const char *mEnd;
+            
             int mLine;
             int mColumn;
             int mLastColumn;
             
-            std::ifstream mInput;
+        protected:
+            INLINE void assign(const char *data, const std::size_t &nbytes) { mBegin = mNext = data; mEnd = data + nbytes; };
         
         public:
-            FileInputStream(const std::string &fname);
-            INLINE ~FileInputStream() { mInput.close(); };
+            INLINE MemoryInputStream() : InputStream(), mBegin(0), mNext(0), mEnd(0), mLine(1), mColumn(1), mLastColumn(-1) {};
             
             //  From iInputStream
             
@@ -114,34 +179,47 @@ namespace dish
             virtual int Get();
             virtual void Unget(const int byte);
             
-            virtual const std::string &Source() const;
+            virtual bool Buffered(const char *&next, const char *&end);
+            virtual void Advance(const std::size_t &nbytes);
+            
             virtual const int &Line() const;
             virtual const int &Column() const;
         
     };
     
-    class StringInputStream : public InputStream
+    //  A file, memory-mapped if it can be; a file which cannot, such as a pipe
+    //  or an empty file, is read into memory instead.
+    class FileInputStream : public MemoryInputStream
     {
         private:
-            int mLine;
-            int mColumn;
-            int mLastColumn;
+            const std::string mFileName;
             
-            std::stringstream mInput;
+            void *mMapping;
+            std::size_t mMappingSize;
+            
+            std::string mContents;
         
         public:
-            INLINE StringInputStream(const std::string &str) : InputStream(), mLine(1), mColumn(1), mLastColumn(-1), mInput(str) {};
+            FileInputStream(const std::string &fname);
+            ~FileInputStream();
             
             //  From iInputStream
             
-            virtual bool Empty();
+            virtual const std::string &Source() const;
+        
+    };
+    
+    class StringInputStream : public MemoryInputStream
+    {
+        private:
+            const std::string mContents;
+        
+        public:
+            INLINE StringInputStream(const std::string &str) : MemoryInputStream(), mContents(str) { assign(mContents.data(), mContents.size()); };
             
-            virtual int Get();
-            virtual void Unget(const int byte);
+            //  From iInputStream
             
             virtual const std::string &Source() const;
-            virtual const int &Line() const;
-            virtual const int &Column() const;
         
     };
 
@@ -168,6 +246,9 @@ namespace dish
         protected:
             void buildPathList();
             
+            //  Pops the inputs on the top of the stack which are exhausted.
+            INLINE void popEmpty() { while((!mInputStack.empty()) && mInputStack.front().second->Empty()) { mInputStack.pop_front(); } };
+            
             INLINE void updateInEntryPoint() { mInEntryPoint = (1 >= mInputStack.size()); };
             
         public:
@@ -177,6 +258,12 @@ namespace dish
             INLINE void Push(const std::string &source, const bool finput) { if(finput) { PushFile(source); } else { PushString(source); } };
             void PushFile(const std::string &fname);
             void PushString(const std::string &str);
+            
+            //  Whether fname was pushed before, or was marked as loaded since
+            //  its contents were obtained otherwise; it is not pushed again.
+            INLINE bool IsLoaded(const std::string &fname) const { return (mLoadedFileSet.end() != mLoadedFileSet.find(fname)); };
+            INLINE void SetLoaded(const std::string &fname) { mLoadedFileSet.insert(fname); };
+            
             INLINE void Pop() { if(!mInputStack.empty()) { mInputStack.pop_front(); } updateInEntryPoint(); };
             
             void Load(const std::string &fname);
@@ -187,6 +274,10 @@ namespace dish
             //  processed).
             INLINE bool IsEntryPoint() const { return mInEntryPoint; };
             
+            //  The number of inputs on the stack; it rises while an imported
+            //  file is being read.
+            INLINE int Depth() const { return static_cast< int >(mInputStack.size()); };
+            
             //  From iInputStream
             
             virtual bool Empty();
@@ -194,6 +285,9 @@ namespace dish
             virtual int Get();
             virtual void Unget(const int byte);
             
+            virtual bool Buffered(const char *&next, const char *&end);
+            virtual void Advance(const std::size_t &nbytes);
+            
             virtual void Print(std::ostream &out = std::cout);
             
             virtual const std::string &Source() const;
@@ -72,6 +72,20 @@ namespace dish
             virtual void Insert(const std::string &key, std::shared_ptr< iAtomic > value) = 0;
             virtual std::shared_ptr< iAtomic > Lookup(const std::string &key) const = 0;
             
+            //  Returns the value stored in the given slot of a table whose 
+            //  slots are stable, provided the slot is bound to key; a null
+            //  pointer is returned otherwise.
+            virtual std::shared_ptr< iAtomic > LookupSlot(const int &slot, const std::string &key) const = 0;
+            
+            //  Looks up key given the id it was interned under, which spares
+            //  a table keyed by id from hashing the key again.
+            virtual std::shared_ptr< iAtomic > LookupInterned(const int &id, const std::string &key) const = 0;
+            
+            //  Set if the table may bind a key of the form name_N, which is
+            //  how executables are named; pushing or popping such a table can
+            //  change which function a call resolves to.
+            virtual bool BindsExecutable() const = 0;
+            
             virtual void Load(iSymbolTable &symtab, const CloneT &type = cloneMinimal) const = 0;
             
             virtual void Clear() = 0;
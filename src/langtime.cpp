@@ -143,7 +143,7 @@ std::shared_ptr< dish::iAtomic > dish::NowFunction::Execute(dish::LanguageSymbol
     struct timeval tv;
     gettimeofday(&tv, NULL);
     
-    return IntegerValue::MakeValue(static_cast< IntegerT >(1000000 + tv.tv_usec));
+    return IntegerValue::MakeValue((static_cast< IntegerT >(tv.tv_sec) * 1000000) + static_cast< IntegerT >(tv.tv_usec));
 }
 
 /******************************************************************************
@@ -22,7 +22,9 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <cctype>
+#include <cstring>
 #include <map>
 #include <sstream>
 #include <vector>
@@ -121,12 +123,49 @@ namespace
 
     ////////////////////////////////////////////////////////////////////////////
     
-    INLINEC std::shared_ptr< dish::IntegerValue > CreateLockedInteger(const dish::IntegerT &value)
+    INLINEC std::shared_ptr< dish::iAtomic > CreateLockedBoolean(const dish::BooleanT &value)
+    {
+        return dish::BooleanValue::MakeLockedValue(value);
+    }
+    
+    INLINEC std::shared_ptr< dish::iAtomic > CreateLockedInteger(const dish::IntegerT &value)
     {
         return dish::IntegerValue::MakeValue(value, dish::LOCKED);
     }
     
-    INLINEC std::shared_ptr< dish::IntegerValue > CreateGraphColor(const int &red, const int &green, const int &blue)
+    INLINEC std::shared_ptr< dish::iAtomic > CreateLockedReal(const dish::RealT &value)
+    {
+        return dish::RealValue::MakeValue(value, dish::LOCKED);
+    }
+    
+    INLINEC std::shared_ptr< dish::iAtomic > CreateLockedString(const dish::StringT &value)
+    {
+        return dish::StringValue::MakeValue(value, dish::LOCKED);
+    }
+    
+    /*
+        Dynamically build the strings containing digit-, lower-case-, upper-
+        case-, printable-, punctuation-, and whitespace-characters for two
+        reasons: (1) we will be certain to capture all of the character in each
+        class (at least according to the C/C++ run-time library), and (b) ensure 
+        the characters in the string are in increasing order by ASCII value
+        (allowing the strings to be searched efficiantly).
+    */
+    std::shared_ptr< dish::iAtomic > CreateCharacterClass(int (*isclass)(int))
+    {
+        std::string str;
+        for(int ch(0); ch < 256; ++ch)
+        {
+            if(isclass(ch))
+            {
+                str.append(1, static_cast< char >(ch));
+            }
+        }
+        
+        return CreateLockedString(str);
+    }
+    
+    INLINEC std::shared_ptr< dish::iAtomic > CreateGraphColor(const int &red, const int &green, const int &blue)
     {
 #ifdef LANG_LIB_GRAPH
         return CreateLockedInteger(
@@ -144,1878 +183,1974 @@ namespace
     }
     
     ////////////////////////////////////////////////////////////////////////////
-
-}
-
-/******************************************************************************
-
-    dish::LanguageSymbolTable class definitions
-
- ******************************************************************************/
- 
-void dish::LanguageSymbolTable::insert(const std::string &key, std::shared_ptr< dish::iAtomic > value) const
-{
-    if(dish::iAtomic::typeExecutable != value->Type())
-    {
-        mBase->Insert(key, value);
-    }
-    else
-    {
-        std::stringstream mangled_key;
-        mangled_key << key;
-        mangled_key << "_";
-        mangled_key << value->NumParameters();
-        
-        mBase->Insert(mangled_key.str(), value);
-    }
-}
-
-dish::LanguageSymbolTable::LanguageSymbolTable(const bool &profile, const int &maxdepth) : dish::iSymbolTable(),
-
-    mBase(MakeSystemSymbolTable()),
     
-    mStack(maxdepth),
-    
-    mProfile()
-
-{
-    assert(0 != mBase.get());
-    
-    if(profile)
+    template< class T > std::shared_ptr< dish::iAtomic > MakeBuiltin()
     {
-        mProfile.reset(new ExecutionProfile());
+        return T::MakeValue();
     }
     
-    ///////////////
-    
-    insert(DISH_LANGID_InterpreterVersion, CreateVersionStructure(MAJOR_VERSION, MINOR_VERSION, REVISION_VERSION, LOCKED));
-    insert(DISH_LANGID_LanguageVersion, CreateVersionStructure(LANG_MAJOR_VERSION, LANG_MINOR_VERSION, LANG_REVISION_VERSION, LOCKED));
-    insert(DISH_LANGID_LibraryVersion, CreateVersionStructure(LIBRARY_MAJOR_VERSION, LIBRARY_MINOR_VERSION, LIBRARY_REVISION_VERSION, LOCKED));
-    
-#ifdef LANG_LIB_CORE
-
-    insert(DISH_LANGID_IS_LIB_CORE, BooleanValue::MakeLockedValue(true));
-    
-    ///////////////
-    
-    insert(DISH_LANGID_NULL, NullValue::MakeValue());
-    
-    insert(DISH_LANGID_NOINDENT, CreateLockedInteger(-1));
-    
-    insert(DISH_LANGID_IsEntryPoint, IsEntryPointFunction::MakeValue());
-    insert(DISH_LANGID_ReleaseCachedParseTreeNodes, ReleaseCachedParseTreeNodesFunction::MakeValue());
-    
-    insert(DISH_LANGID_VersionT, CreateVersionStructureType());
-    insert(DISH_LANGID_MakeVersion, MakeVersionFunction::MakeValue());
-    insert(DISH_LANGID_VersionLessThan, VersionLessThanFunction::MakeValue());
-    insert(DISH_LANGID_VersionEqual, VersionEqualFunction::MakeValue());
-    insert(DISH_LANGID_VersionAsString, VersionAsStringFunction::MakeValue());
-    
-    insert(DISH_LANGID_GetEnvironmentVariable, GetEnvironmentVariableFunction::MakeValue());
-
-    insert(DISH_LANGID_Terminate, TerminateFunction::MakeValue());
-    insert(DISH_LANGID_Sleep, SleepFunction::MakeValue());
-    
-    insert(DISH_LANGID_System, SystemFunction::MakeValue());
-    insert(DISH_LANGID_Execute, ExecuteFunction::MakeValue());
-    
-    insert(DISH_LANGID_Copy, CopyFunction::MakeValue());
-    insert(DISH_LANGID_Clone, CloneFunction::MakeValue());
-    
-    insert(DISH_LANGID_AsBoolean, AsBooleanFunction::MakeValue());
-    insert(DISH_LANGID_AsInteger, AsIntegerFunction::MakeValue());
-    insert(DISH_LANGID_AsReal, AsRealFunction::MakeValue());
-    insert(DISH_LANGID_AsString, AsStringFunction::MakeValue());
-    
-    insert(DISH_LANGID_Append, AppendFunction::MakeValue());
-    insert(DISH_LANGID_Insert, InsertFunction::MakeValue());
-    
-    insert(DISH_LANGID_Sort, SortFunction::MakeValue());
-    insert(DISH_LANGID_Find, FindFunction::MakeValue());
-    insert(DISH_LANGID_FindSorted, FindSortedFunction::MakeValue());
-    insert(DISH_LANGID_Swap, SwapFunction::MakeValue());
-    
-    //  Add as a function and as a reference that can be passed without name-
-    //  mangling.
+    //  A function of the run-time library, created the first time a key with
+    //  its name is looked up rather than when the symbol-table is constructed.
+    //  Overloads share a name; each is inserted under its own mangled key.
+    struct BuiltinT
     {
-        std::shared_ptr< iAtomic > lessthan(CompareLessThanFunction::MakeValue());
+        const char *Name;
+        std::shared_ptr< dish::iAtomic > (*Make)();
+    };
     
-        insert(DISH_LANGID_CompareLessThan, lessthan);
-        mBase->Insert(DISH_LANGID_SORT_ASCENDING, CompareLessThanFunction::MakeValue());
-    }
-    
-    //  Add as a function and as a reference that can be passed without name-
-    //  mangling.
+    const BuiltinT Builtins[] =
     {
-        std::shared_ptr< iAtomic > greaterthan(CompareGreaterThanFunction::MakeValue());
+#ifdef LANG_LIB_CORE
+        { DISH_LANGID_IsEntryPoint, MakeBuiltin< dish::IsEntryPointFunction > },
+        { DISH_LANGID_ReleaseCachedParseTreeNodes, MakeBuiltin< dish::ReleaseCachedParseTreeNodesFunction > },
+        
+        { DISH_LANGID_MakeVersion, MakeBuiltin< dish::MakeVersionFunction > },
+        { DISH_LANGID_VersionLessThan, MakeBuiltin< dish::VersionLessThanFunction > },
+        { DISH_LANGID_VersionEqual, MakeBuiltin< dish::VersionEqualFunction > },
+        { DISH_LANGID_VersionAsString, MakeBuiltin< dish::VersionAsStringFunction > },
+        
+        { DISH_LANGID_GetEnvironmentVariable, MakeBuiltin< dish::GetEnvironmentVariableFunction > },
+        
+        { DISH_LANGID_Terminate, MakeBuiltin< dish::TerminateFunction > },
+        { DISH_LANGID_Sleep, MakeBuiltin< dish::SleepFunction > },
+        
+        { DISH_LANGID_System, MakeBuiltin< dish::SystemFunction > },
+        { DISH_LANGID_Execute, MakeBuiltin< dish::ExecuteFunction > },
+        
+        { DISH_LANGID_Copy, MakeBuiltin< dish::CopyFunction > },
+        { DISH_LANGID_Clone, MakeBuiltin< dish::CloneFunction > },
+        
+        { DISH_LANGID_AsBoolean, MakeBuiltin< dish::AsBooleanFunction > },
+        { DISH_LANGID_AsInteger, MakeBuiltin< dish::AsIntegerFunction > },
+        { DISH_LANGID_AsReal, MakeBuiltin< dish::AsRealFunction > },
+        { DISH_LANGID_AsString, MakeBuiltin< dish::AsStringFunction > },
+        
+        { DISH_LANGID_Append, MakeBuiltin< dish::AppendFunction > },
+        { DISH_LANGID_Insert, MakeBuiltin< dish::InsertFunction > },
+        
+        { DISH_LANGID_Sort, MakeBuiltin< dish::SortFunction > },
+        { DISH_LANGID_Find, MakeBuiltin< dish::FindFunction > },
+        { DISH_LANGID_FindSorted, MakeBuiltin< dish::FindSortedFunction > },
+        { DISH_LANGID_Swap, MakeBuiltin< dish::SwapFunction > },
+        
+        { DISH_LANGID_IsLocked, MakeBuiltin< dish::IsLockedFunction > },
+        
+        { DISH_LANGID_IsNull, MakeBuiltin< dish::IsNullFunction > },
+        { DISH_LANGID_IsType, MakeBuiltin< dish::IsTypeFunction > },
+        { DISH_LANGID_IsBoolean, MakeBuiltin< dish::IsBooleanFunction > },
+        { DISH_LANGID_IsInteger, MakeBuiltin< dish::IsIntegerFunction > },
+        { DISH_LANGID_IsReal, MakeBuiltin< dish::IsRealFunction > },
+        { DISH_LANGID_IsString, MakeBuiltin< dish::IsStringFunction > },
+        { DISH_LANGID_IsArray, MakeBuiltin< dish::IsArrayFunction > },
+        { DISH_LANGID_IsDictionary, MakeBuiltin< dish::IsDictionaryFunction > },
+        { DISH_LANGID_IsStructure, MakeBuiltin< dish::IsStructureFunction > },
+        { DISH_LANGID_IsFunction, MakeBuiltin< dish::IsFunctionFunction > },
+        
+        { DISH_LANGID_StringAsNumeric, MakeBuiltin< dish::StringAsNumericFunction > },
+        
+        { DISH_LANGID_TypeOf, MakeBuiltin< dish::TypeOfFunction > },
+        
+        { DISH_LANGID_TypeId, MakeBuiltin< dish::TypeIdFunction > },
+        
+        { DISH_LANGID_MinimumFunction, MakeBuiltin< dish::MinimumFunction > },
+        { DISH_LANGID_MinimumFunction, MakeBuiltin< dish::Minimum2Function > },
+        { DISH_LANGID_MinimumFunction, MakeBuiltin< dish::Minimum3Function > },
+        { DISH_LANGID_MaximumFunction, MakeBuiltin< dish::MaximumFunction > },
+        { DISH_LANGID_MaximumFunction, MakeBuiltin< dish::Maximum2Function > },
+        { DISH_LANGID_MaximumFunction, MakeBuiltin< dish::Maximum3Function > },
+        
+        { DISH_LANGID_IncFunction, MakeBuiltin< dish::IncFunction > },
+        { DISH_LANGID_IncFunction, MakeBuiltin< dish::Inc2Function > },
+        { DISH_LANGID_DecFunction, MakeBuiltin< dish::DecFunction > },
+        { DISH_LANGID_DecFunction, MakeBuiltin< dish::Dec2Function > },
+        
+        { DISH_LANGID_OnErrorPush, MakeBuiltin< dish::OnErrorPushFunction > },
+        { DISH_LANGID_OnErrorInvoke, MakeBuiltin< dish::OnErrorInvokeFunction > },
+        { DISH_LANGID_OnErrorPop, MakeBuiltin< dish::OnErrorPopFunction > },
+        
+        { DISH_LANGID_Print, MakeBuiltin< dish::PrintFunction > },
+        { DISH_LANGID_Println, MakeBuiltin< dish::Println0Function > },
+        { DISH_LANGID_Println, MakeBuiltin< dish::PrintlnFunction > },
+        { DISH_LANGID_Newln, MakeBuiltin< dish::NewlnFunction > },
+        
+        { DISH_LANGID_KeyPressed, MakeBuiltin< dish::KeyPressedFunction > },
+        { DISH_LANGID_Read, MakeBuiltin< dish::ReadFunction > },
+        { DISH_LANGID_ReadCh, MakeBuiltin< dish::ReadChFunction > },
+        { DISH_LANGID_ReadInteger, MakeBuiltin< dish::ReadIntegerFunction > },
+        { DISH_LANGID_ReadReal, MakeBuiltin< dish::ReadRealFunction > },
+        { DISH_LANGID_Readln, MakeBuiltin< dish::ReadlnFunction > },
+        
+        { DISH_LANGID_SymbolOfFunctionFunction, MakeBuiltin< dish::SymbolOfFunctionFunction > },
+        { DISH_LANGID_SymbolExistsFunction, MakeBuiltin< dish::SymbolExistsFunction > },
+        
+        { DISH_LANGID_IsExactlyEqual, MakeBuiltin< dish::IsExactlyEqualFunction > },
+#endif
+        
+#ifdef LANG_LIB_FILEIO
+        { DISH_LANGID_FileOpen, MakeBuiltin< dish::FileOpenFunction > },
+        { DISH_LANGID_FileNumOpen, MakeBuiltin< dish::FileNumOpenFunction > },
+        { DISH_LANGID_FileWrite, MakeBuiltin< dish::FileWriteFunction > },
+        { DISH_LANGID_FileWriteln, MakeBuiltin< dish::FileWritelnFunction > },
+        { DISH_LANGID_FileReadText, MakeBuiltin< dish::FileReadTextFunction > },
+        { DISH_LANGID_FileReadBoolean, MakeBuiltin< dish::FileReadBooleanFunction > },
+        { DISH_LANGID_FileReadInteger, MakeBuiltin< dish::FileReadIntegerFunction > },
+        { DISH_LANGID_FileReadReal, MakeBuiltin< dish::FileReadRealFunction > },
+        { DISH_LANGID_FileReadln, MakeBuiltin< dish::FileReadlnFunction > },
+        { DISH_LANGID_FileEndOfFile, MakeBuiltin< dish::FileEndOfFileFunction > },
+        { DISH_LANGID_FileFlush, MakeBuiltin< dish::FileFlushFunction > },
+        { DISH_LANGID_FileClose, MakeBuiltin< dish::FileCloseFunction > },
+#endif
+        
+#ifdef LANG_LIB_STRING
+        { DISH_LANGID_Ord, MakeBuiltin< dish::OrdFunction > },
+        { DISH_LANGID_Ord, MakeBuiltin< dish::Ord2Function > },
+        { DISH_LANGID_Chr, MakeBuiltin< dish::ChrFunction > },
+        { DISH_LANGID_Chr, MakeBuiltin< dish::Chr2Function > },
+        
+        { DISH_LANGID_IntegerToBaseString, MakeBuiltin< dish::IntegerToBaseStringFunction > },
+        { DISH_LANGID_BaseStringToInteger, MakeBuiltin< dish::BaseStringToIntegerFunction > },
+        
+        { DISH_LANGID_ToUpperCase, MakeBuiltin< dish::ToUpperCaseFunction > },
+        { DISH_LANGID_ToLowerCase, MakeBuiltin< dish::ToLowerCaseFunction > },
+        
+        { DISH_LANGID_IsUpperCase, MakeBuiltin< dish::IsUpperCaseFunction > },
+        { DISH_LANGID_IsLowerCase, MakeBuiltin< dish::IsLowerCaseFunction > },
+        { DISH_LANGID_IsControl, MakeBuiltin< dish::IsControlFunction > },
+        { DISH_LANGID_IsPrintable, MakeBuiltin< dish::IsPrintableFunction > },
+        { DISH_LANGID_IsWhitespace, MakeBuiltin< dish::IsWhitespaceFunction > },
+        { DISH_LANGID_IsPunctuation, MakeBuiltin< dish::IsPunctuationFunction > },
+        { DISH_LANGID_IsLetter, MakeBuiltin< dish::IsLetterFunction > },
+        { DISH_LANGID_IsDigit, MakeBuiltin< dish::IsDigitFunction > },
+        { DISH_LANGID_IsHexDigit, MakeBuiltin< dish::IsHexDigitFunction > },
+        
+        { DISH_LANGID_LeftJustify, MakeBuiltin< dish::LeftJustifyFunction > },
+        { DISH_LANGID_RightJustify, MakeBuiltin< dish::RightJustifyFunction > },
+        { DISH_LANGID_CenterJustify, MakeBuiltin< dish::CenterJustifyFunction > },
+        
+        { DISH_LANGID_StrLeft, MakeBuiltin< dish::LeftStringFunction > },
+        { DISH_LANGID_StrRight, MakeBuiltin< dish::RightStringFunction > },
+        { DISH_LANGID_StrMiddle, MakeBuiltin< dish::MiddleStringFunction > },
+        
+        { DISH_LANGID_StrBeginsWith, MakeBuiltin< dish::StringBeginsWith2Function > },
+        { DISH_LANGID_StrBeginsWith, MakeBuiltin< dish::StringBeginsWith3Function > },
+        { DISH_LANGID_StrEndsWith, MakeBuiltin< dish::StringEndsWith2Function > },
+        { DISH_LANGID_StrEndsWith, MakeBuiltin< dish::StringEndsWith3Function > },
+        
+        { DISH_LANGID_StrFind, MakeBuiltin< dish::StringFindFunction > },
+        { DISH_LANGID_StrFindNextOf, MakeBuiltin< dish::StringFindNextOfFunction > },
+        { DISH_LANGID_StrFindNextNotOf, MakeBuiltin< dish::StringFindNextNotOfFunction > },
+        { DISH_LANGID_StrFindLastOf, MakeBuiltin< dish::StringFindLastOfFunction > },
+        { DISH_LANGID_StrFindLastNotOf, MakeBuiltin< dish::StringFindLastNotOfFunction > },
+        
+        { DISH_LANGID_StrTrimLeading, MakeBuiltin< dish::StringTrimLeadingFunction > },
+        { DISH_LANGID_StrTrimTrailing, MakeBuiltin< dish::StringTrimTrailingFunction > },
+        { DISH_LANGID_StrRemoveAllOf, MakeBuiltin< dish::StringRemoveAllOfFunction > },
+        { DISH_LANGID_StrRemoveAllNotOf, MakeBuiltin< dish::StringRemoveAllNotOfFunction > },
+        
+        { DISH_LANGID_StrReplaceAll, MakeBuiltin< dish::StringReplaceAllFunction > },
+        { DISH_LANGID_StrReplaceAll, MakeBuiltin< dish::StringReplaceAllWithPosFunction > },
+        { DISH_LANGID_StrReplaceFirst, MakeBuiltin< dish::StringReplaceFirstFunction > },
+        { DISH_LANGID_StrReplaceFirst, MakeBuiltin< dish::StringReplaceFirstWithPosFunction > },
+        
+        { DISH_LANGID_StrReplicate, MakeBuiltin< dish::StringReplicateFunction > },
+        
+        { DISH_LANGID_StrReverse, MakeBuiltin< dish::StringReverseFunction > },
+#endif
+        
+#ifdef LANG_LIB_DATETIME
+        { DISH_LANGID_DateTime, MakeBuiltin< dish::DateTimeFunction > },
+        { DISH_LANGID_DecomposeDateTimeValue, MakeBuiltin< dish::DecomposeDateTimeValueFunction > },
+        { DISH_LANGID_DecomposeUtcDateTimeValue, MakeBuiltin< dish::DecomposeUtcDateTimeValueFunction > },
+        { DISH_LANGID_ComposeDateTimeValue, MakeBuiltin< dish::ComposeDateTimeValueFunction > },
+        
+        { DISH_LANGID_TimeZoneT, MakeBuiltin< dish::TimeZoneInfoFunction > },
+        { DISH_LANGID_TimeZoneInfo, MakeBuiltin< dish::TimeZoneInfoFunction > },
+        { DISH_LANGID_TimeZoneInfo, MakeBuiltin< dish::TimeZoneInfo1Function > },
+        
+        { DISH_LANGID_Now, MakeBuiltin< dish::NowFunction > },
+        { DISH_LANGID_ElapsedSeconds, MakeBuiltin< dish::ElapsedSecondsFunction > },
+#endif
+        
+#ifdef LANG_LIB_MATH_CORE
+        { DISH_LANGID_IsFiniteNumberFunction, MakeBuiltin< dish::IsFiniteNumberFunction > },
+        { DISH_LANGID_IsInfiniteNumberFunction, MakeBuiltin< dish::IsInfiniteNumberFunction > },
+        { DISH_LANGID_IsNotANumberFunction, MakeBuiltin< dish::IsNotANumberFunction > },
+        { DISH_LANGID_IsNormalNumberFunction, MakeBuiltin< dish::IsNormalNumberFunction > },
+        
+        { DISH_LANGID_IsOddFunction, MakeBuiltin< dish::IsOddFunction > },
+        { DISH_LANGID_IsEvenFunction, MakeBuiltin< dish::IsEvenFunction > },
+        
+        { DISH_LANGID_AbsFunction, MakeBuiltin< dish::AbsFunction > },
+        { DISH_LANGID_WholeFunction, MakeBuiltin< dish::WholeFunction > },
+        { DISH_LANGID_FractionFunction, MakeBuiltin< dish::FractionFunction > },
+        { DISH_LANGID_SignOfFunction, MakeBuiltin< dish::SignOfFunction > },
+        
+        { DISH_LANGID_SqrFunction, MakeBuiltin< dish::SqrFunction > },
+        { DISH_LANGID_SqrtFunction, MakeBuiltin< dish::SqrtFunction > },
+        { DISH_LANGID_CubeFunction, MakeBuiltin< dish::CubeFunction > },
+        { DISH_LANGID_CbrtFunction, MakeBuiltin< dish::CbrtFunction > },
+        
+        { DISH_LANGID_LnFunction, MakeBuiltin< dish::LnFunction > },
+        { DISH_LANGID_LogFunction, MakeBuiltin< dish::LogFunction > },
+        { DISH_LANGID_LogFunction, MakeBuiltin< dish::Log2Function > },
+        { DISH_LANGID_ExpFunction, MakeBuiltin< dish::ExpFunction > },
+        
+        { DISH_LANGID_RoundFunction, MakeBuiltin< dish::RoundFunction > },
+        { DISH_LANGID_FloorFunction, MakeBuiltin< dish::FloorFunction > },
+        { DISH_LANGID_CeilFunction, MakeBuiltin< dish::CeilFunction > },
+#endif
+        
+#ifdef LANG_LIB_MATH_TRIG
+        { DISH_LANGID_DegToRadFunction, MakeBuiltin< dish::DegToRadFunction > },
+        { DISH_LANGID_RadToDegFunction, MakeBuiltin< dish::RadToDegFunction > },
+        
+        { DISH_LANGID_SinFunction, MakeBuiltin< dish::SinFunction > },
+        { DISH_LANGID_CosFunction, MakeBuiltin< dish::CosFunction > },
+        { DISH_LANGID_TanFunction, MakeBuiltin< dish::TanFunction > },
+        
+        { DISH_LANGID_ArcSinFunction, MakeBuiltin< dish::ArcSinFunction > },
+        { DISH_LANGID_ArcCosFunction, MakeBuiltin< dish::ArcCosFunction > },
+        { DISH_LANGID_ArcTanFunction, MakeBuiltin< dish::ArcTanFunction > },
+        
+        { DISH_LANGID_CotFunction, MakeBuiltin< dish::CotFunction > },
+        { DISH_LANGID_SecFunction, MakeBuiltin< dish::SecFunction > },
+        { DISH_LANGID_CscFunction, MakeBuiltin< dish::CscFunction > },
+        
+        { DISH_LANGID_ArcCotFunction, MakeBuiltin< dish::ArcCotFunction > },
+        { DISH_LANGID_ArcSecFunction, MakeBuiltin< dish::ArcSecFunction > },
+        { DISH_LANGID_ArcCscFunction, MakeBuiltin< dish::ArcCscFunction > },
+#endif
+        
+#ifdef LANG_LIB_MATH_HYPERBOLIC
+        { DISH_LANGID_SinhFunction, MakeBuiltin< dish::SinhFunction > },
+        { DISH_LANGID_CoshFunction, MakeBuiltin< dish::CoshFunction > },
+        { DISH_LANGID_TanhFunction, MakeBuiltin< dish::TanhFunction > },
+        
+        { DISH_LANGID_ArcSinhFunction, MakeBuiltin< dish::ArcSinhFunction > },
+        { DISH_LANGID_ArcCoshFunction, MakeBuiltin< dish::ArcCoshFunction > },
+        { DISH_LANGID_ArcTanhFunction, MakeBuiltin< dish::ArcTanhFunction > },
+        
+        { DISH_LANGID_SechFunction, MakeBuiltin< dish::SechFunction > },
+        { DISH_LANGID_CschFunction, MakeBuiltin< dish::CschFunction > },
+        { DISH_LANGID_CothFunction, MakeBuiltin< dish::CothFunction > },
+        
+        { DISH_LANGID_ArcSechFunction, MakeBuiltin< dish::ArcSechFunction > },
+        { DISH_LANGID_ArcCschFunction, MakeBuiltin< dish::ArcCschFunction > },
+        { DISH_LANGID_ArcCothFunction, MakeBuiltin< dish::ArcCothFunction > },
+#endif
+        
+#ifdef LANG_LIB_MATH_COMPLEX
+        { DISH_LANGID_ComplexCreateFunction, MakeBuiltin< dish::ImaginaryCreate1Function > },
+        { DISH_LANGID_ComplexCreateFunction, MakeBuiltin< dish::ImaginaryCreate2Function > },
+        
+        { DISH_LANGID_ComplexToStringFunction, MakeBuiltin< dish::ImaginaryToStringFunction > },
+        
+        { DISH_LANGID_ComplexIsEqualFunction, MakeBuiltin< dish::ImaginaryIsEqualFunction > },
+        { DISH_LANGID_ComplexIsNotEqualFunction, MakeBuiltin< dish::ImaginaryIsNotEqualFunction > },
+        
+        { DISH_LANGID_ComplexAddFunction, MakeBuiltin< dish::ImaginaryAddFunction > },
+        { DISH_LANGID_ComplexSubtractFunction, MakeBuiltin< dish::ImaginarySubtractFunction > },
+        { DISH_LANGID_ComplexMultiplyFunction, MakeBuiltin< dish::ImaginaryMultiplyFunction > },
+        { DISH_LANGID_ComplexDivideFunction, MakeBuiltin< dish::ImaginaryDivideFunction > },
+        
+        { DISH_LANGID_ComplexSqrFunction, MakeBuiltin< dish::ImaginarySqrFunction > },
+        { DISH_LANGID_ComplexSqrtFunction, MakeBuiltin< dish::ImaginarySqrtFunction > },
+        
+        { DISH_LANGID_ComplexReciprocalFunction, MakeBuiltin< dish::ImaginaryReciprocalFunction > },
+        { DISH_LANGID_ComplexConjugateFunction, MakeBuiltin< dish::ImaginaryConjugateFunction > },
+#endif
+        
+#ifdef LANG_LIB_MATH_RANDOM
+        { DISH_LANGID_RandomSeedFunction, MakeBuiltin< dish::RandomSeedFunction > },
+        
+        { DISH_LANGID_RandomBooleanFunction, MakeBuiltin< dish::RandomBooleanFunction > },
+        
+        { DISH_LANGID_RandomIntegerFunction, MakeBuiltin< dish::RandomIntegerFunction > },
+        { DISH_LANGID_RandomIntegerFunction, MakeBuiltin< dish::RandomInteger1Function > },
+        { DISH_LANGID_RandomIntegerFunction, MakeBuiltin< dish::RandomInteger2Function > },
+        
+        { DISH_LANGID_RandomRealFunction, MakeBuiltin< dish::RandomRealFunction > },
+        { DISH_LANGID_RandomRealFunction, MakeBuiltin< dish::RandomReal1Function > },
+        { DISH_LANGID_RandomRealFunction, MakeBuiltin< dish::RandomReal2Function > },
+        
+        { DISH_LANGID_RandomMaxFunction, MakeBuiltin< dish::RandomMaxFunction > },
+        
+        { DISH_LANGID_RandomBitIntegerFunction, MakeBuiltin< dish::RandomBitIntegerFunction > },
+#endif
+        
+#ifdef LANG_LIB_MATH_MATRIX
+        { DISH_LANGID_CreateMatrixTFunction, MakeBuiltin< dish::CreateMatrixTFunction > },
+        { DISH_LANGID_CreateMatrixFunction, MakeBuiltin< dish::CreateMatrixFunction > },
+        { DISH_LANGID_MatrixValidateFunction, MakeBuiltin< dish::MatrixValidateFunction > },
+        { DISH_LANGID_MatrixNumRowsFunction, MakeBuiltin< dish::MatrixNumRowsFunction > },
+        { DISH_LANGID_MatrixNumColumnsFunction, MakeBuiltin< dish::MatrixNumColumnsFunction > },
+        { DISH_LANGID_MatrixIsSquareFunction, MakeBuiltin< dish::MatrixIsSquareFunction > },
+        { DISH_LANGID_MatrixInitializeFunction, MakeBuiltin< dish::MatrixInitialize1Function > },
+        { DISH_LANGID_MatrixInitializeFunction, MakeBuiltin< dish::MatrixInitialize2Function > },
+        { DISH_LANGID_MatrixRowSliceFunction, MakeBuiltin< dish::MatrixRowSliceFunction > },
+        { DISH_LANGID_MatrixColumnSliceFunction, MakeBuiltin< dish::MatrixColumnSliceFunction > },
+        { DISH_LANGID_MatrixTransposeFunction, MakeBuiltin< dish::MatrixTransposeFunction > },
+        { DISH_LANGID_MatrixDeterminantFunction, MakeBuiltin< dish::MatrixDeterminantFunction > },
+        { DISH_LANGID_MatrixInvertFunction, MakeBuiltin< dish::MatrixInvertFunction > },
+        { DISH_LANGID_MatrixAddFunction, MakeBuiltin< dish::MatrixAddFunction > },
+        { DISH_LANGID_MatrixSubtractFunction, MakeBuiltin< dish::MatrixSubtractFunction > },
+        { DISH_LANGID_MatrixMultiplyFunction, MakeBuiltin< dish::MatrixMultiplyFunction > },
+        { DISH_LANGID_MatrixEqualFunction, MakeBuiltin< dish::MatrixEqualFunction > },
+        { DISH_LANGID_MatrixAddRowFunction, MakeBuiltin< dish::MatrixAddRowFunction > },
+        { DISH_LANGID_MatrixAddColumnFunction, MakeBuiltin< dish::MatrixAddColumnFunction > },
+        { DISH_LANGID_MatrixToStringFunction, MakeBuiltin< dish::MatrixToStringFunction > },
+#endif
+        
+#ifdef LANG_LIB_MATH_INTEGER
+        { DISH_LANGID_FactorialFunction, MakeBuiltin< dish::FactorialFunction > },
+        { DISH_LANGID_BinomialCoefficientFunction, MakeBuiltin< dish::BinomialCoefficientFunction > },
+        { DISH_LANGID_GreatestCommonDenomonatorFunction, MakeBuiltin< dish::GreatestCommonDenomonatorFunction > },
+        { DISH_LANGID_FibonacciFunction, MakeBuiltin< dish::FibonacciFunction > },
+#endif
+        
+#ifdef LANG_LIB_TEXTIO
+        { DISH_LANGID_TEXTIO_Start, MakeBuiltin< dish::TEXTIO_StartFunction > },
+        { DISH_LANGID_TEXTIO_IsStarted, MakeBuiltin< dish::TEXTIO_IsStartedFunction > },
+        { DISH_LANGID_TEXTIO_Refresh, MakeBuiltin< dish::TEXTIO_RefreshFunction > },
+        { DISH_LANGID_TEXTIO_Clear, MakeBuiltin< dish::TEXTIO_ClearFunction > },
+        { DISH_LANGID_TEXTIO_End, MakeBuiltin< dish::TEXTIO_EndFunction > },
+        
+        { DISH_LANGID_TEXTIO_GetXSize, MakeBuiltin< dish::TEXTIO_GetXSizeFunction > },
+        { DISH_LANGID_TEXTIO_GetYSize, MakeBuiltin< dish::TEXTIO_GetYSizeFunction > },
+        { DISH_LANGID_TEXTIO_MoveTo, MakeBuiltin< dish::TEXTIO_MoveToFunction > },
+        
+        { DISH_LANGID_TEXTIO_AttrNormal, MakeBuiltin< dish::TEXTIO_AttrNormalFunction > },
+        { DISH_LANGID_TEXTIO_AttrGet, MakeBuiltin< dish::TEXTIO_AttrGetFunction > },
+        { DISH_LANGID_TEXTIO_AttrSet, MakeBuiltin< dish::TEXTIO_AttrSetFunction > },
+        { DISH_LANGID_TEXTIO_AttrOn, MakeBuiltin< dish::TEXTIO_AttrOnFunction > },
+        { DISH_LANGID_TEXTIO_AttrOff, MakeBuiltin< dish::TEXTIO_AttrOffFunction > },
+        { DISH_LANGID_TEXTIO_SetForegroundColor, MakeBuiltin< dish::TEXTIO_SetForegroundColorFunction > },
+        { DISH_LANGID_TEXTIO_GetForegroundColor, MakeBuiltin< dish::TEXTIO_GetForegroundColorFunction > },
+        { DISH_LANGID_TEXTIO_SetBackgroundColor, MakeBuiltin< dish::TEXTIO_SetBackgroundColorFunction > },
+        { DISH_LANGID_TEXTIO_GetBackgroundColor, MakeBuiltin< dish::TEXTIO_GetBackgroundColorFunction > },
+        { DISH_LANGID_TEXTIO_SetColor, MakeBuiltin< dish::TEXTIO_SetColorFunction > },
+        
+        { DISH_LANGID_TEXTIO_SetCursor, MakeBuiltin< dish::TEXTIO_SetCursorFunction > },
+#endif
+        
+#ifdef LANG_LIB_NETWORK
+        { DISH_LANGID_NetworkOpenClientSocket, MakeBuiltin< dish::NetworkOpenClientSocketFunction > },
+        { DISH_LANGID_NetworkOpenClientSocket, MakeBuiltin< dish::NetworkOpenClientSocket2Function > },
+        { DISH_LANGID_NetworkOpenClientSocket, MakeBuiltin< dish::NetworkOpenClientSocket3Function > },
+        
+        { DISH_LANGID_NetworkOpenServerSocket, MakeBuiltin< dish::NetworkOpenServerSocketFunction > },
+        
+        { DISH_LANGID_NetworkNumOpenSockets, MakeBuiltin< dish::NetworkNumOpenSocketsFunction > },
+        { DISH_LANGID_NetworkNumOpenClientSockets, MakeBuiltin< dish::NetworkNumOpenClientSocketsFunction > },
+        { DISH_LANGID_NetworkNumOpenServerSockets, MakeBuiltin< dish::NetworkNumOpenServerSocketsFunction > },
+        
+        { DISH_LANGID_NetworkReadSocket, MakeBuiltin< dish::NetworkReadSocketFunction > },
+        { DISH_LANGID_NetworkWriteSocket, MakeBuiltin< dish::NetworkWriteSocketFunction > },
+        
+        { DISH_LANGID_NetworkCloseSocket, MakeBuiltin< dish::NetworkCloseSocketFunction > },
+        { DISH_LANGID_NetworkCloseSocket, MakeBuiltin< dish::NetworkCloseSocket1Function > },
+#endif
+        
+#ifdef LANG_LIB_FILESYS
+        { DISH_LANGID_FILESYS_FileExistsFunction, MakeBuiltin< dish::FILESYS_FileExistsFunction > },
+        { DISH_LANGID_FILESYS_ReadLocation, MakeBuiltin< dish::FILESYS_ReadLocationFunction > },
+        { DISH_LANGID_FILESYS_ReadFiles, MakeBuiltin< dish::FILESYS_ReadFilesFunction > },
+        { DISH_LANGID_FILESYS_ReadDirectories, MakeBuiltin< dish::FILESYS_ReadDirectoriesFunction > },
+        { DISH_LANGID_FILESYS_GetFileInfo, MakeBuiltin< dish::FILESYS_GetFileInfoFunction > },
+        { DISH_LANGID_FILESYS_PrintPathTree, MakeBuiltin< dish::FILESYS_PrintPathTree1Function > },
+        { DISH_LANGID_FILESYS_PrintPathTree, MakeBuiltin< dish::FILESYS_PrintPathTreeFunction > },
+#endif
+        
+#ifdef LANG_LIB_DATABASE
+        { DISH_LANGID_DB_MakeDefaultConnectionParameters, MakeBuiltin< dish::DbMakeDefaultConnectionParametersFunction > },
+        { DISH_LANGID_DB_MakeDefaultConnectionParameters, MakeBuiltin< dish::DbMakeDefaultConnectionParameters2Function > },
+        
+        { DISH_LANGID_DB_OpenConnection, MakeBuiltin< dish::DbOpenConnectionFunction > },
+        { DISH_LANGID_DB_CloseConnection, MakeBuiltin< dish::DbCloseConnectionFunction > },
+        { DISH_LANGID_DB_CloseAllConnections, MakeBuiltin< dish::DbCloseAllConnectionsFunction > },
+        
+        { DISH_LANGID_DB_IsOpen, MakeBuiltin< dish::DbNumOpenConnectionsFunction > },
+        { DISH_LANGID_DB_NumOpenConnections, MakeBuiltin< dish::DbNumOpenConnectionsFunction > },
+        { DISH_LANGID_DB_NumOpenConnections, MakeBuiltin< dish::DbNumOpenConnections1Function > },
+        
+        { DISH_LANGID_DB_ServerVersion, MakeBuiltin< dish::DbServerVersionFunction > },
+        
+        { DISH_LANGID_DB_IssueQuery, MakeBuiltin< dish::DbIssueQueryFunction > },
+#endif
+        
+#ifdef LANG_LIB_REGULAR_EXPRESSION
+        { DISH_LANGID_REGEX_CreateFunction, MakeBuiltin< dish::CreateRegularExpressionFunction > },
+        { DISH_LANGID_REGEX_NumCreatedFunction, MakeBuiltin< dish::NumCreatedRegularExpressionFunction > },
+        { DISH_LANGID_REGEX_IsCreatedFunction, MakeBuiltin< dish::IsCreatedRegularExpressionFunction > },
+        { DISH_LANGID_REGEX_DestroyFunction, MakeBuiltin< dish::DestroyRegularExpressionFunction > },
+        { DISH_LANGID_REGEX_DestroyAllFunction, MakeBuiltin< dish::DestroyAllRegularExpressionFunction > },
+        
+        { DISH_LANGID_REGEX_MatchFunction, MakeBuiltin< dish::MatchRegularExpressionFunction > },
+        { DISH_LANGID_REGEX_ReplaceNextFunction, MakeBuiltin< dish::ReplaceNextRegularExpressionFunction > },
+        { DISH_LANGID_REGEX_ReplaceAllFunction, MakeBuiltin< dish::ReplaceAllRegularExpressionFunction > },
+#endif
+        
+#ifdef LANG_LIB_RS232
+        { DISH_LANGID_RS232_BaudRateSupported, MakeBuiltin< dish::Rs232BaudRateSupportedFunction > },
+        
+        { DISH_LANGID_RS232_DataBitsSupported, MakeBuiltin< dish::Rs232DataBitsSupportedFunction > },
+        
+        { DISH_LANGID_RS232_ParitySupported, MakeBuiltin< dish::Rs232ParitySupportedFunction > },
+        
+        { DISH_LANGID_RS232_StopBitsSupported, MakeBuiltin< dish::Rs232StopBitsSupportedFunction > },
+        
+        { DISH_LANGID_RS232_FlowControlSupported, MakeBuiltin< dish::Rs232FlowControlSupportedFunction > },
+        
+        { DISH_LANGID_RS232_DefaultConfiguration, MakeBuiltin< dish::Rs232DefaultConfigurationFunction > },
+        
+        { DISH_LANGID_RS232_MakeConfiguration, MakeBuiltin< dish::Rs232MakeConfiguration1Function > },
+        { DISH_LANGID_RS232_MakeConfiguration, MakeBuiltin< dish::Rs232MakeConfiguration4Function > },
+        { DISH_LANGID_RS232_MakeConfiguration, MakeBuiltin< dish::Rs232MakeConfiguration5Function > },
+        { DISH_LANGID_RS232_MakeConfiguration, MakeBuiltin< dish::Rs232MakeConfiguration6Function > },
+        
+        { DISH_LANGID_RS232_Open, MakeBuiltin< dish::Rs232OpenFunction > },
+        { DISH_LANGID_RS232_NumOpen, MakeBuiltin< dish::Rs232NumOpenFunction > },
+        { DISH_LANGID_RS232_IsOpen, MakeBuiltin< dish::Rs232IsOpenFunction > },
+        { DISH_LANGID_RS232_Send, MakeBuiltin< dish::Rs232SendFunction > },
+        { DISH_LANGID_RS232_SendXON, MakeBuiltin< dish::Rs232SendXOnFunction > },
+        { DISH_LANGID_RS232_SendXOFF, MakeBuiltin< dish::Rs232SendXOffFunction > },
+        { DISH_LANGID_RS232_NumCharactersAvailable, MakeBuiltin< dish::Rs232NumCharactersAvailableFunction > },
+        { DISH_LANGID_RS232_Receive, MakeBuiltin< dish::Rs232ReceiveFunction > },
+        { DISH_LANGID_RS232_ReceiveTimeout, MakeBuiltin< dish::Rs232ReceiveTimeoutFunction > },
+        { DISH_LANGID_RS232_ReceiveNumCharacters, MakeBuiltin< dish::Rs232ReceiveNumCharacters2Function > },
+        { DISH_LANGID_RS232_ReceiveNumCharacters, MakeBuiltin< dish::Rs232ReceiveNumCharacters3Function > },
+        { DISH_LANGID_RS232_ReceiveSentinel, MakeBuiltin< dish::Rs232ReceiveSentinel2Function > },
+        { DISH_LANGID_RS232_ReceiveSentinel, MakeBuiltin< dish::Rs232ReceiveSentinel3Function > },
+        { DISH_LANGID_RS232_ReceiveSentinel, MakeBuiltin< dish::Rs232ReceiveSentinel4Function > },
+        { DISH_LANGID_RS232_Close, MakeBuiltin< dish::Rs232CloseFunction > },
+        { DISH_LANGID_RS232_CloseAll, MakeBuiltin< dish::Rs232CloseAllFunction > },
+#endif
+        
+#ifdef LANG_LIB_DEBUG
+        { DISH_LANGID_DEBUG_PrintSymbolTable, MakeBuiltin< dish::DebugPrintSymbolTableFunction > },
+        { DISH_LANGID_DEBUG_PrintSymbolTable, MakeBuiltin< dish::DebugPrintSymbolTable1Function > },
+        
+        { DISH_LANGID_DEBUG_PrintSymbolTableStats, MakeBuiltin< dish::DebugPrintSymbolTableStatsFunction > },
+        { DISH_LANGID_DEBUG_PrintSymbolTableStats, MakeBuiltin< dish::DebugPrintSymbolTableStats1Function > },
+        
+        { DISH_LANGID_DEBUG_PrintParseTree, MakeBuiltin< dish::DebugPrintParseTreeFunction > },
+        { DISH_LANGID_DEBUG_PrintParseTree, MakeBuiltin< dish::DebugPrintParseTree2Function > },
+        
+        { DISH_LANGID_DEBUG_PrintParseTreeNodeStats, MakeBuiltin< dish::DebugPrintParseTreeNodeStatsFunction > },
+        { DISH_LANGID_DEBUG_PrintParseTreeNodeStats, MakeBuiltin< dish::DebugPrintParseTreeNodeStats1Function > },
+        
+        { DISH_LANGID_DEBUG_StackDepthFunction, MakeBuiltin< dish::DebugCurrentStackDepthFunction > },
+        
+        { DISH_LANGID_DEBUG_Log, MakeBuiltin< dish::DebugLogFunction > },
+#endif
+        
+#ifdef LANG_LIB_GRAPH
+        { DISH_LANGID_GRAPH_CreateContext, MakeBuiltin< dish::GRAPH_CreateContext2Function > },
+        { DISH_LANGID_GRAPH_CreateContext, MakeBuiltin< dish::GRAPH_CreateContext3Function > },
+        { DISH_LANGID_GRAPH_CreateContext, MakeBuiltin< dish::GRAPH_CreateContext7Function > },
+        
+        { DISH_LANGID_GRAPH_CreatePoint, MakeBuiltin< dish::GRAPH_CreatePointFunction > },
+        
+        { DISH_LANGID_GRAPH_CreateLine, MakeBuiltin< dish::GRAPH_CreateLine2Function > },
+        { DISH_LANGID_GRAPH_CreateLine, MakeBuiltin< dish::GRAPH_CreateLine4Function > },
+        
+        { DISH_LANGID_GRAPH_Start, MakeBuiltin< dish::GRAPH_StartFunction > },
+        { DISH_LANGID_GRAPH_IsStarted, MakeBuiltin< dish::GRAPH_IsStartedFunction > },
+        { DISH_LANGID_GRAPH_End, MakeBuiltin< dish::GRAPH_EndFunction > },
+        
+        { DISH_LANGID_GRAPH_ProcessEvent, MakeBuiltin< dish::GRAPH_ProcessEventFunction > },
+        { DISH_LANGID_GRAPH_ProcessEvent, MakeBuiltin< dish::GRAPH_ProcessEvent1Function > },
+        
+        { DISH_LANGID_GRAPH_EventLoop, MakeBuiltin< dish::GRAPH_EventLoopFunction > },
+        { DISH_LANGID_GRAPH_EventLoop, MakeBuiltin< dish::GRAPH_EventLoop1Function > },
+        
+        { DISH_LANGID_GRAPH_PushEventProcessor, MakeBuiltin< dish::GRAPH_PushEventProcessorFunction > },
+        { DISH_LANGID_GRAPH_PopEventProcessor, MakeBuiltin< dish::GRAPH_PopEventProcessorFunction > },
+        
+        { DISH_LANGID_GRAPH_Refresh, MakeBuiltin< dish::GRAPH_RefreshFunction > },
+        
+        { DISH_LANGID_GRAPH_ApplyContext, MakeBuiltin< dish::GRAPH_ApplyContextFunction > },
+        
+        { DISH_LANGID_GRAPH_MakeColor, MakeBuiltin< dish::GRAPH_MakeColorFunction > },
+        
+        { DISH_LANGID_GRAPH_Clear, MakeBuiltin< dish::GRAPH_Clear1Function > },
+        { DISH_LANGID_GRAPH_Clear, MakeBuiltin< dish::GRAPH_Clear2Function > },
+        
+        { DISH_LANGID_GRAPH_DrawPixel, MakeBuiltin< dish::GRAPH_DrawPixel2Function > },
+        { DISH_LANGID_GRAPH_DrawPixel, MakeBuiltin< dish::GRAPH_DrawPixel3Function > },
+        
+        { DISH_LANGID_GRAPH_DrawLine, MakeBuiltin< dish::GRAPH_DrawLine2Function > },
+        { DISH_LANGID_GRAPH_DrawLine, MakeBuiltin< dish::GRAPH_DrawLine3Function > },
+        { DISH_LANGID_GRAPH_DrawLine, MakeBuiltin< dish::GRAPH_DrawLine5Function > },
+        
+        { DISH_LANGID_GRAPH_DrawLines, MakeBuiltin< dish::GRAPH_DrawLinesFunction > },
+        
+        { DISH_LANGID_GRAPH_DrawBox, MakeBuiltin< dish::GRAPH_DrawBox3Function > },
+        { DISH_LANGID_GRAPH_DrawBox, MakeBuiltin< dish::GRAPH_DrawBox4Function > },
+        { DISH_LANGID_GRAPH_DrawBox, MakeBuiltin< dish::GRAPH_DrawBox5Function > },
+        { DISH_LANGID_GRAPH_DrawBox, MakeBuiltin< dish::GRAPH_DrawBox6Function > },
+        
+        { DISH_LANGID_GRAPH_DrawArc, MakeBuiltin< dish::GRAPH_DrawArc5Function > },
+        { DISH_LANGID_GRAPH_DrawArc, MakeBuiltin< dish::GRAPH_DrawArc6Function > },
+        { DISH_LANGID_GRAPH_DrawArc, MakeBuiltin< dish::GRAPH_DrawArc7Function > },
+        { DISH_LANGID_GRAPH_DrawArc, MakeBuiltin< dish::GRAPH_DrawArc8Function > },
+        
+        { DISH_LANGID_GRAPH_GetFontList, MakeBuiltin< dish::GRAPH_GetFontList0Function > },
+        { DISH_LANGID_GRAPH_GetTextDimensions, MakeBuiltin< dish::GRAPH_GetTextDimensions3Function > },
+        { DISH_LANGID_GRAPH_GetTextDimensions, MakeBuiltin< dish::GRAPH_GetTextDimensions4Function > },
+        
+        { DISH_LANGID_GRAPH_DrawText, MakeBuiltin< dish::GRAPH_DrawText2Function > },
+        { DISH_LANGID_GRAPH_DrawText, MakeBuiltin< dish::GRAPH_DrawText3Function > },
+        { DISH_LANGID_GRAPH_DrawText, MakeBuiltin< dish::GRAPH_DrawText4Function > },
+        
+        { DISH_LANGID_GRAPH_DrawPolygon, MakeBuiltin< dish::GRAPH_DrawPolygon2Function > },
+        { DISH_LANGID_GRAPH_DrawPolygon, MakeBuiltin< dish::GRAPH_DrawPolygon3Function > },
+        
+        { DISH_LANGID_GRAPH_MoveTo, MakeBuiltin< dish::GRAPH_MoveTo2Function > },
+        { DISH_LANGID_GRAPH_MoveTo, MakeBuiltin< dish::GRAPH_MoveTo3Function > },
+        
+        { DISH_LANGID_GRAPH_LineTo, MakeBuiltin< dish::GRAPH_LineTo2Function > },
+        { DISH_LANGID_GRAPH_LineTo, MakeBuiltin< dish::GRAPH_LineTo3Function > },
+#endif
+        
+#ifdef LANG_LIB_ZIP
+        { DISH_LANGID_Zip, MakeBuiltin< dish::Zip1Function > },
+        { DISH_LANGID_Zip, MakeBuiltin< dish::Zip2Function > },
+        { DISH_LANGID_Zip, MakeBuiltin< dish::Zip3Function > },
+        { DISH_LANGID_Zip, MakeBuiltin< dish::Zip4Function > },
+        { DISH_LANGID_Zip, MakeBuiltin< dish::Zip5Function > },
+        { DISH_LANGID_Zip, MakeBuiltin< dish::Zip6Function > },
+        { DISH_LANGID_Zip, MakeBuiltin< dish::Zip7Function > },
+        { DISH_LANGID_Zip, MakeBuiltin< dish::Zip8Function > },
+        { DISH_LANGID_Zip, MakeBuiltin< dish::Zip9Function > },
+        { DISH_LANGID_Zip, MakeBuiltin< dish::Zip10Function > },
+        
+        { DISH_LANGID_ZipTogether, MakeBuiltin< dish::ZipTogether1Function > },
+        { DISH_LANGID_ZipTogether, MakeBuiltin< dish::ZipTogether2Function > },
+        { DISH_LANGID_ZipTogether, MakeBuiltin< dish::ZipTogether3Function > },
+        { DISH_LANGID_ZipTogether, MakeBuiltin< dish::ZipTogether4Function > },
+        { DISH_LANGID_ZipTogether, MakeBuiltin< dish::ZipTogether5Function > },
+        { DISH_LANGID_ZipTogether, MakeBuiltin< dish::ZipTogether6Function > },
+        { DISH_LANGID_ZipTogether, MakeBuiltin< dish::ZipTogether7Function > },
+        { DISH_LANGID_ZipTogether, MakeBuiltin< dish::ZipTogether8Function > },
+        { DISH_LANGID_ZipTogether, MakeBuiltin< dish::ZipTogether9Function > },
+        { DISH_LANGID_ZipTogether, MakeBuiltin< dish::ZipTogether10Function > },
+        { DISH_LANGID_ZipTogether, MakeBuiltin< dish::ZipTogether11Function > },
+        
+        { DISH_LANGID_ZipValue, MakeBuiltin< dish::ZipValueFunction > },
+#endif
+        
+        //  Terminates the table, which is then never empty.
+        { 0, 0 }
+    };
     
-        insert(DISH_LANGID_CompareGreaterThan, greaterthan);
-        mBase->Insert(DISH_LANGID_SORT_DESCENDING, CompareGreaterThanFunction::MakeValue());
-    }
+    const int NUM_BUILTINS(static_cast< int >(sizeof(Builtins) / sizeof(Builtins[0])) - 1);
     
-    //  Add as a function and as a reference that can be passed without name-
-    //  mangling.
+    //  Indices into Builtins ordered by name, built on first use.
+    const std::vector< int > &BuiltinsByName()
     {
-        std::shared_ptr< iAtomic > equal(CompareEqualFunction::MakeValue());
-    
-        insert(DISH_LANGID_CompareEqual, equal);
-        mBase->Insert(DISH_LANGID_EQUAL, CompareEqualFunction::MakeValue());
+        static std::vector< int > index;
+        
+        if(index.empty())
+        {
+            index.reserve(NUM_BUILTINS);
+            for(int i(0); i < NUM_BUILTINS; ++i)
+            {
+                index.push_back(i);
+            }
+            
+            std::stable_sort(
+                index.begin(),
+                index.end(),
+                [](const int &lhs, const int &rhs) { return (std::strcmp(Builtins[lhs].Name, Builtins[rhs].Name) < 0); }
+            );
+        }
+        
+        return index;
     }
     
-    insert(DISH_LANGID_IsLocked, IsLockedFunction::MakeValue());
-    
-    insert(DISH_LANGID_IsNull, IsNullFunction::MakeValue());
-    insert(DISH_LANGID_IsType, IsTypeFunction::MakeValue());
-    insert(DISH_LANGID_IsBoolean, IsBooleanFunction::MakeValue());
-    insert(DISH_LANGID_IsInteger, IsIntegerFunction::MakeValue());
-    insert(DISH_LANGID_IsReal, IsRealFunction::MakeValue());
-    insert(DISH_LANGID_IsString, IsStringFunction::MakeValue());
-    insert(DISH_LANGID_IsArray, IsArrayFunction::MakeValue());
-    insert(DISH_LANGID_IsDictionary, IsDictionaryFunction::MakeValue());
-    insert(DISH_LANGID_IsStructure, IsStructureFunction::MakeValue());
-    insert(DISH_LANGID_IsFunction, IsFunctionFunction::MakeValue());
-    
-    insert(DISH_LANGID_StringAsNumeric, StringAsNumericFunction::MakeValue());
-    
-    insert(DISH_LANGID_TypeOf, TypeOfFunction::MakeValue());
-    
-    insert(DISH_LANGID_TypeId, TypeIdFunction::MakeValue());
+    ////////////////////////////////////////////////////////////////////////////
     
-    insert(DISH_LANGID_TYPEID_Null, CreateLockedInteger(static_cast< IntegerT >(iAtomic::typeNull)));
-    insert(DISH_LANGID_TYPEID_Type, CreateLockedInteger(static_cast< IntegerT >(iAtomic::typeType)));
-    insert(DISH_LANGID_TYPEID_Boolean, CreateLockedInteger(static_cast< IntegerT >(iAtomic::typeBoolean)));
-    insert(DISH_LANGID_TYPEID_Integer, CreateLockedInteger(static_cast< IntegerT >(iAtomic::typeInteger)));
-    insert(DISH_LANGID_TYPEID_Real, CreateLockedInteger(static_cast< IntegerT >(iAtomic::typeReal)));
-    insert(DISH_LANGID_TYPEID_String, CreateLockedInteger(static_cast< IntegerT >(iAtomic::typeString)));
-    insert(DISH_LANGID_TYPEID_Array, CreateLockedInteger(static_cast< IntegerT >(iAtomic::typeArray)));
-    insert(DISH_LANGID_TYPEID_Dictionary, CreateLockedInteger(static_cast< IntegerT >(iAtomic::typeDictionary)));
-    insert(DISH_LANGID_TYPEID_Structure, CreateLockedInteger(static_cast< IntegerT >(iAtomic::typeStructure)));
-    insert(DISH_LANGID_TYPEID_Executable, CreateLockedInteger(static_cast< IntegerT >(iAtomic::typeExecutable)));
+    template< class T, int N > constexpr int NumEntries(const T (&)[N])
+    {
+        return N;
+    }
     
-    insert(DISH_LANGID_RANGE_BOUNDARY_ERROR, CreateLockedInteger(static_cast< IntegerT >(iAtomic::rngbndError)));
-    insert(DISH_LANGID_RANGE_BOUNDARY_CAP, CreateLockedInteger(static_cast< IntegerT >(iAtomic::rngbndCap)));
-    insert(DISH_LANGID_RANGE_BOUNDARY_ROLLOVER, CreateLockedInteger(static_cast< IntegerT >(iAtomic::rngbndRollover)));
+    /*
+        The values (constants and types) of each library module. A module is
+        loaded as a whole the first time one of its values is looked up; a
+        module which is not compiled in binds only its IS_LIB_ flag, to false.
+    */
     
+#ifdef LANG_LIB_CORE
+
+    const BuiltinT CoreLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_CORE, [] { return CreateLockedBoolean(true); } },
+        
+        { DISH_LANGID_NULL, MakeBuiltin< dish::NullValue > },
+        
+        { DISH_LANGID_NOINDENT, [] { return CreateLockedInteger(-1); } },
+        
+        { DISH_LANGID_VersionT, dish::CreateVersionStructureType },
+        
+        { DISH_LANGID_TYPEID_Null, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::iAtomic::typeNull)); } },
+        { DISH_LANGID_TYPEID_Type, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::iAtomic::typeType)); } },
+        { DISH_LANGID_TYPEID_Boolean, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::iAtomic::typeBoolean)); } },
+        { DISH_LANGID_TYPEID_Integer, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::iAtomic::typeInteger)); } },
+        { DISH_LANGID_TYPEID_Real, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::iAtomic::typeReal)); } },
+        { DISH_LANGID_TYPEID_String, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::iAtomic::typeString)); } },
+        { DISH_LANGID_TYPEID_Array, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::iAtomic::typeArray)); } },
+        { DISH_LANGID_TYPEID_Dictionary, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::iAtomic::typeDictionary)); } },
+        { DISH_LANGID_TYPEID_Structure, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::iAtomic::typeStructure)); } },
+        { DISH_LANGID_TYPEID_Executable, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::iAtomic::typeExecutable)); } },
+        
+        { DISH_LANGID_RANGE_BOUNDARY_ERROR, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::iAtomic::rngbndError)); } },
+        { DISH_LANGID_RANGE_BOUNDARY_CAP, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::iAtomic::rngbndCap)); } },
+        { DISH_LANGID_RANGE_BOUNDARY_ROLLOVER, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::iAtomic::rngbndRollover)); } },
+        
     #ifdef DISH_32BIT_ATOMICS
-        insert(DISH_LANGID_USES_32BIT_ATOMICS, BooleanValue::MakeLockedValue(static_cast< BooleanT >(true)));
-        insert(DISH_LANGID_USES_64BIT_ATOMICS, BooleanValue::MakeLockedValue(static_cast< BooleanT >(false)));
+        { DISH_LANGID_USES_32BIT_ATOMICS, [] { return CreateLockedBoolean(static_cast< dish::BooleanT >(true)); } },
+        { DISH_LANGID_USES_64BIT_ATOMICS, [] { return CreateLockedBoolean(static_cast< dish::BooleanT >(false)); } },
     #endif
-    
+        
     #ifdef DISH_64BIT_ATOMICS
-        insert(DISH_LANGID_USES_32BIT_ATOMICS, BooleanValue::MakeLockedValue(static_cast< BooleanT >(false)));
-        insert(DISH_LANGID_USES_64BIT_ATOMICS, BooleanValue::MakeLockedValue(static_cast< BooleanT >(true)));
+        { DISH_LANGID_USES_32BIT_ATOMICS, [] { return CreateLockedBoolean(static_cast< dish::BooleanT >(false)); } },
+        { DISH_LANGID_USES_64BIT_ATOMICS, [] { return CreateLockedBoolean(static_cast< dish::BooleanT >(true)); } },
     #endif
-    
-    insert(DISH_LANGID_BOOLEAN_MIN, BooleanValue::MakeLockedValue(BOOLEAN_MIN));
-    insert(DISH_LANGID_BOOLEAN_MAX, BooleanValue::MakeLockedValue(BOOLEAN_MAX));
-    insert(DISH_LANGID_INTEGER_MIN, CreateLockedInteger(INTEGER_MIN));
-    insert(DISH_LANGID_INTEGER_MAX, CreateLockedInteger(INTEGER_MAX));
-    insert(DISH_LANGID_INTEGER_EPS, CreateLockedInteger(INTEGER_EPS));
-    insert(DISH_LANGID_REAL_MIN, RealValue::MakeValue(REAL_MIN, dish::LOCKED));
-    insert(DISH_LANGID_REAL_MAX, RealValue::MakeValue(REAL_MAX, dish::LOCKED));
-    insert(DISH_LANGID_REAL_EPS, RealValue::MakeValue(REAL_EPS, dish::LOCKED));
-    
-    insert(DISH_LANGID_MinimumFunction, MinimumFunction::MakeValue());
-    insert(DISH_LANGID_MinimumFunction, Minimum2Function::MakeValue());
-    insert(DISH_LANGID_MinimumFunction, Minimum3Function::MakeValue());
-    insert(DISH_LANGID_MaximumFunction, MaximumFunction::MakeValue());
-    insert(DISH_LANGID_MaximumFunction, Maximum2Function::MakeValue());
-    insert(DISH_LANGID_MaximumFunction, Maximum3Function::MakeValue());
-    
-    insert(DISH_LANGID_IncFunction, IncFunction::MakeValue());
-    insert(DISH_LANGID_IncFunction, Inc2Function::MakeValue());
-    insert(DISH_LANGID_DecFunction, DecFunction::MakeValue());
-    insert(DISH_LANGID_DecFunction, Dec2Function::MakeValue());
-    
-    insert(DISH_LANGID_ErrorT, CreateErrorStructureType());
-    
-    insert(DISH_LANGID_ERR_OK, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_Ok)));
-    insert(DISH_LANGID_ERR_TERMINATE, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_Terminate)));
-    insert(DISH_LANGID_ERR_ILLEGAL_CAST, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_IllegalCast)));
-    insert(DISH_LANGID_ERR_VALUE_LOCKED, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_ValueLocked)));
-    insert(DISH_LANGID_ERR_NO_SUCH_MEMBER, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_NoSuchMember)));
-    insert(DISH_LANGID_ERR_DUPLICATE_SYMBOL, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_DuplicateSymbol)));
-    insert(DISH_LANGID_ERR_NO_SUCH_SYMBOL, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_NoSuchSymbol)));
-    insert(DISH_LANGID_ERR_DIVIDE_BY_ZERO, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_DivideByZero)));
-    insert(DISH_LANGID_ERR_DOMAIN_ERROR, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_DomainError)));
-    insert(DISH_LANGID_ERR_RANGE_ERROR, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_RangeError)));
-    insert(DISH_LANGID_ERR_ILLEGAL_HANDLE, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_IllegalHandle)));
-    insert(DISH_LANGID_ERR_ILLEGAL_VALUE, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_IllegalValue)));
-    
-    insert(DISH_LANGID_ERR_STACK_OVERFLOW_ERROR, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_StackOverflowError)));
-    
+        
+        { DISH_LANGID_BOOLEAN_MIN, [] { return CreateLockedBoolean(dish::BOOLEAN_MIN); } },
+        { DISH_LANGID_BOOLEAN_MAX, [] { return CreateLockedBoolean(dish::BOOLEAN_MAX); } },
+        { DISH_LANGID_INTEGER_MIN, [] { return CreateLockedInteger(dish::INTEGER_MIN); } },
+        { DISH_LANGID_INTEGER_MAX, [] { return CreateLockedInteger(dish::INTEGER_MAX); } },
+        { DISH_LANGID_INTEGER_EPS, [] { return CreateLockedInteger(dish::INTEGER_EPS); } },
+        { DISH_LANGID_REAL_MIN, [] { return CreateLockedReal(dish::REAL_MIN); } },
+        { DISH_LANGID_REAL_MAX, [] { return CreateLockedReal(dish::REAL_MAX); } },
+        { DISH_LANGID_REAL_EPS, [] { return CreateLockedReal(dish::REAL_EPS); } },
+        
+        { DISH_LANGID_ErrorT, dish::CreateErrorStructureType },
+        
+        { DISH_LANGID_ERR_OK, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_Ok)); } },
+        { DISH_LANGID_ERR_TERMINATE, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_Terminate)); } },
+        { DISH_LANGID_ERR_ILLEGAL_CAST, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_IllegalCast)); } },
+        { DISH_LANGID_ERR_VALUE_LOCKED, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_ValueLocked)); } },
+        { DISH_LANGID_ERR_NO_SUCH_MEMBER, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_NoSuchMember)); } },
+        { DISH_LANGID_ERR_DUPLICATE_SYMBOL, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_DuplicateSymbol)); } },
+        { DISH_LANGID_ERR_NO_SUCH_SYMBOL, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_NoSuchSymbol)); } },
+        { DISH_LANGID_ERR_DIVIDE_BY_ZERO, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_DivideByZero)); } },
+        { DISH_LANGID_ERR_DOMAIN_ERROR, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_DomainError)); } },
+        { DISH_LANGID_ERR_RANGE_ERROR, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_RangeError)); } },
+        { DISH_LANGID_ERR_ILLEGAL_HANDLE, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_IllegalHandle)); } },
+        { DISH_LANGID_ERR_ILLEGAL_VALUE, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_IllegalValue)); } },
+        
+        { DISH_LANGID_ERR_STACK_OVERFLOW_ERROR, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_StackOverflowError)); } },
+        
     #ifdef LANG_LIB_FILEIO
-        insert(DISH_LANGID_ERR_TOO_MANY_OPEN_FILES, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_TooManyOpenFiles)));
-        insert(DISH_LANGID_ERR_UNABLE_TO_OPEN_FILE, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_UnableToOpenFile)));
-        insert(DISH_LANGID_ERR_FILE_NOT_OPEN, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_FileNotOpen)));
-        insert(DISH_LANGID_ERR_FILE_WRITE_ERROR, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_FileWriteError)));
-        insert(DISH_LANGID_ERR_FILE_READ_ERROR, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_FileReadError)));
-        insert(DISH_LANGID_ERR_FILE_READ_END_OF_FILE, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_FileReadEndOfFile)));
+        { DISH_LANGID_ERR_TOO_MANY_OPEN_FILES, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_TooManyOpenFiles)); } },
+        { DISH_LANGID_ERR_UNABLE_TO_OPEN_FILE, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_UnableToOpenFile)); } },
+        { DISH_LANGID_ERR_FILE_NOT_OPEN, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_FileNotOpen)); } },
+        { DISH_LANGID_ERR_FILE_WRITE_ERROR, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_FileWriteError)); } },
+        { DISH_LANGID_ERR_FILE_READ_ERROR, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_FileReadError)); } },
+        { DISH_LANGID_ERR_FILE_READ_END_OF_FILE, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_FileReadEndOfFile)); } },
     #endif
-    
+        
     #ifdef LANG_LIB_NETWORK
-        insert(DISH_LANGID_ERR_TOO_MANY_OPEN_SOCKETS, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_TooManyOpenSockets)));
-        insert(DISH_LANGID_ERR_UNABLE_TO_OPEN_SOCKET, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_UnableToOpenSocket)));
-        insert(DISH_LANGID_ERR_UNABLE_TO_CLOSE_SOCKET, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_UnableToCloseSocket)));
-        insert(DISH_LANGID_ERR_NETWORK_INVALID_ADDRESS, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_NetworkInvalidAddress)));
-        insert(DISH_LANGID_ERR_NETWORK_UNABLE_TO_CONNECT_TO_SERVER, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_NetworkUnableToConnectToServer)));
-        insert(DISH_LANGID_ERR_NETWORK_SOCKET_NOT_OPEN, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_NetworkSocketNotOpen)));
-        insert(DISH_LANGID_ERR_NETWORK_SOCKET_WRITE_ERROR, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_NetworkSocketWriteError)));
-        insert(DISH_LANGID_ERR_NETWORK_SOCKET_READ_ERROR, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_NetworkSocketReadError)));
+        { DISH_LANGID_ERR_TOO_MANY_OPEN_SOCKETS, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_TooManyOpenSockets)); } },
+        { DISH_LANGID_ERR_UNABLE_TO_OPEN_SOCKET, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_UnableToOpenSocket)); } },
+        { DISH_LANGID_ERR_UNABLE_TO_CLOSE_SOCKET, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_UnableToCloseSocket)); } },
+        { DISH_LANGID_ERR_NETWORK_INVALID_ADDRESS, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_NetworkInvalidAddress)); } },
+        { DISH_LANGID_ERR_NETWORK_UNABLE_TO_CONNECT_TO_SERVER, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_NetworkUnableToConnectToServer)); } },
+        { DISH_LANGID_ERR_NETWORK_SOCKET_NOT_OPEN, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_NetworkSocketNotOpen)); } },
+        { DISH_LANGID_ERR_NETWORK_SOCKET_WRITE_ERROR, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_NetworkSocketWriteError)); } },
+        { DISH_LANGID_ERR_NETWORK_SOCKET_READ_ERROR, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_NetworkSocketReadError)); } },
     #endif
-    
+        
     #ifdef LANG_LIB_MATH_MATRIX
-        insert(DISH_LANGID_ERR_MATRIX_NOT_VALID_ERROR, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_MatrixInvalidError)));
-        insert(DISH_LANGID_ERR_MATRIX_NOT_SQUARE_ERROR, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_MatrixNotSquareError)));
-        insert(DISH_LANGID_ERR_ZERO_DETERMINANT_ERROR, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_ZeroDeterminantError)));
-        insert(DISH_LANGID_ERR_MATRIX_DIMENSION_ERROR, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_MatrixDimensionError)));
+        { DISH_LANGID_ERR_MATRIX_NOT_VALID_ERROR, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_MatrixInvalidError)); } },
+        { DISH_LANGID_ERR_MATRIX_NOT_SQUARE_ERROR, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_MatrixNotSquareError)); } },
+        { DISH_LANGID_ERR_ZERO_DETERMINANT_ERROR, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_ZeroDeterminantError)); } },
+        { DISH_LANGID_ERR_MATRIX_DIMENSION_ERROR, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_MatrixDimensionError)); } },
     #endif
-    
+        
     #ifdef LANG_LIB_DATABASE
-        insert(DISH_LANGID_ERR_DB_INVALID_CONNECTION_TYPE, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_DB_InvalidConnectionType)));
-        insert(DISH_LANGID_ERR_DB_TOO_MANY_OPEN_CONNECTIONS, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_DB_TooManyOpenConnections)));
-        insert(DISH_LANGID_ERR_DB_UNABLE_TO_OPEN_CONNECTION, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_DB_UnableToOpenConnection)));
-        insert(DISH_LANGID_ERR_DB_CONNECTION_NOT_OPEN, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_DB_ConnectionNotOpen)));
-        insert(DISH_LANGID_ERR_DB_CONNECTION_DROPPED, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_DB_ConnectionDropped)));
-        insert(DISH_LANGID_ERR_DB_QUERY_ERROR, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_DB_QueryError)));
+        { DISH_LANGID_ERR_DB_INVALID_CONNECTION_TYPE, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_DB_InvalidConnectionType)); } },
+        { DISH_LANGID_ERR_DB_TOO_MANY_OPEN_CONNECTIONS, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_DB_TooManyOpenConnections)); } },
+        { DISH_LANGID_ERR_DB_UNABLE_TO_OPEN_CONNECTION, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_DB_UnableToOpenConnection)); } },
+        { DISH_LANGID_ERR_DB_CONNECTION_NOT_OPEN, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_DB_ConnectionNotOpen)); } },
+        { DISH_LANGID_ERR_DB_CONNECTION_DROPPED, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_DB_ConnectionDropped)); } },
+        { DISH_LANGID_ERR_DB_QUERY_ERROR, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_DB_QueryError)); } },
     #endif
-    
+        
     #ifdef LANG_LIB_RS232
-        insert(DISH_LANGID_ERR_RS232_CONFIGURATION_NOT_SUPPORTED, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_RS232_ConfigurationNotSupported)));
-        insert(DISH_LANGID_ERR_RS232_UNABLE_TO_OPEN_PORT, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_RS232_UnableToOpenPort)));
-        insert(DISH_LANGID_ERR_RS232_PORT_NOT_OPEN, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_RS232_PortNotOpen)));
-        insert(DISH_LANGID_ERR_RS232_WRITE_FAILURE, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_RS232_WriteFailure)));
-        insert(DISH_LANGID_ERR_RS232_READ_FAILURE, CreateLockedInteger(static_cast< IntegerT >(ErrorCallbacks::ERR_RS232_ReadFailure)));
+        { DISH_LANGID_ERR_RS232_CONFIGURATION_NOT_SUPPORTED, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_RS232_ConfigurationNotSupported)); } },
+        { DISH_LANGID_ERR_RS232_UNABLE_TO_OPEN_PORT, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_RS232_UnableToOpenPort)); } },
+        { DISH_LANGID_ERR_RS232_PORT_NOT_OPEN, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_RS232_PortNotOpen)); } },
+        { DISH_LANGID_ERR_RS232_WRITE_FAILURE, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_RS232_WriteFailure)); } },
+        { DISH_LANGID_ERR_RS232_READ_FAILURE, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::ErrorCallbacks::ERR_RS232_ReadFailure)); } },
     #endif
-    
-    insert(DISH_LANGID_OnErrorPush, OnErrorPushFunction::MakeValue());
-    insert(DISH_LANGID_OnErrorInvoke, OnErrorInvokeFunction::MakeValue());
-    insert(DISH_LANGID_OnErrorPop, OnErrorPopFunction::MakeValue());
+    };
 
-    insert(DISH_LANGID_Print, PrintFunction::MakeValue());
-    insert(DISH_LANGID_Println, Println0Function::MakeValue());
-    insert(DISH_LANGID_Println, PrintlnFunction::MakeValue());
-    insert(DISH_LANGID_Newln, NewlnFunction::MakeValue());
-    
-    insert(DISH_LANGID_KeyPressed, KeyPressedFunction::MakeValue());
-    insert(DISH_LANGID_Read, ReadFunction::MakeValue());
-    insert(DISH_LANGID_ReadCh, ReadChFunction::MakeValue());
-    insert(DISH_LANGID_ReadInteger, ReadIntegerFunction::MakeValue());
-    insert(DISH_LANGID_ReadReal, ReadRealFunction::MakeValue());
-    insert(DISH_LANGID_Readln, ReadlnFunction::MakeValue());
-    
-    insert(DISH_LANGID_SymbolOfFunctionFunction, SymbolOfFunctionFunction::MakeValue());
-    insert(DISH_LANGID_SymbolExistsFunction, SymbolExistsFunction::MakeValue());
-    
-    insert(DISH_LANGID_IsExactlyEqual, IsExactlyEqualFunction::MakeValue());
-    
 #else
 
-    insert(DISH_LANGID_IS_LIB_CORE, BooleanValue::MakeLockedValue(false));
-    
+    const BuiltinT CoreLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_CORE, [] { return CreateLockedBoolean(false); } },
+    };
+
 #endif
     
-    ///////////////
-    
 #ifdef LANG_LIB_FILEIO
 
-    insert(DISH_LANGID_IS_LIB_FILEIO, BooleanValue::MakeLockedValue(true));
-    
-    ///////////////
+    const BuiltinT FileIOLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_FILEIO, [] { return CreateLockedBoolean(true); } },
+        
+        { DISH_LANGID_FILE_READ, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::FileList::fmRead)); } },
+        { DISH_LANGID_FILE_WRITE, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::FileList::fmWrite)); } },
+        { DISH_LANGID_FILE_WRITE_EX, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::FileList::fmExWrite)); } },
+        { DISH_LANGID_FILE_APPEND, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::FileList::fmAppend)); } },
+        
+        { DISH_LANGID_MAX_OPEN_FILES, [] { return CreateLockedInteger(dish::FileList::MAX_OPEN_FILES); } },
+    };
 
-    insert(DISH_LANGID_FILE_READ, CreateLockedInteger(static_cast< IntegerT >(FileList::fmRead)));
-    insert(DISH_LANGID_FILE_WRITE, CreateLockedInteger(static_cast< IntegerT >(FileList::fmWrite)));
-    insert(DISH_LANGID_FILE_WRITE_EX, CreateLockedInteger(static_cast< IntegerT >(FileList::fmExWrite)));
-    insert(DISH_LANGID_FILE_APPEND, CreateLockedInteger(static_cast< IntegerT >(FileList::fmAppend)));
-    
-    insert(DISH_LANGID_MAX_OPEN_FILES, CreateLockedInteger(FileList::MAX_OPEN_FILES));
-    
-    insert(DISH_LANGID_FileOpen, FileOpenFunction::MakeValue());
-    insert(DISH_LANGID_FileNumOpen, FileNumOpenFunction::MakeValue());
-    insert(DISH_LANGID_FileWrite, FileWriteFunction::MakeValue());
-    insert(DISH_LANGID_FileWriteln, FileWritelnFunction::MakeValue());
-    insert(DISH_LANGID_FileReadText, FileReadTextFunction::MakeValue());
-    insert(DISH_LANGID_FileReadBoolean, FileReadBooleanFunction::MakeValue());
-    insert(DISH_LANGID_FileReadInteger, FileReadIntegerFunction::MakeValue());
-    insert(DISH_LANGID_FileReadReal, FileReadRealFunction::MakeValue());
-    insert(DISH_LANGID_FileReadln, FileReadlnFunction::MakeValue());
-    insert(DISH_LANGID_FileEndOfFile, FileEndOfFileFunction::MakeValue());
-    insert(DISH_LANGID_FileFlush, FileFlushFunction::MakeValue());
-    insert(DISH_LANGID_FileClose, FileCloseFunction::MakeValue());
-    
 #else
 
-    insert(DISH_LANGID_IS_LIB_FILEIO, BooleanValue::MakeLockedValue(false));
-    
+    const BuiltinT FileIOLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_FILEIO, [] { return CreateLockedBoolean(false); } },
+    };
+
 #endif
     
-    ///////////////
-    
 #ifdef LANG_LIB_STRING
 
-    insert(DISH_LANGID_IS_LIB_STRING, BooleanValue::MakeLockedValue(true));
-    
-    ///////////////
-
-    insert(DISH_LANGID_CASE_SENSITIVE, BooleanValue::MakeLockedValue(true));
-    insert(DISH_LANGID_CASE_INSENSITIVE, BooleanValue::MakeLockedValue(false));
-    
-    insert(DISH_LANGID_STRINVALID, CreateLockedInteger(STRINVALID));
-    
-    /*
-        Dynamically build the strings containing digit-, lower-case-, upper-
-        case-, printable-, punctuation-, and whitespace-characters for two
-        reasons: (1) we will be certain to capture all of the character in each
-        class (at least according to the C/C++ run-time library), and (b) ensure 
-        the characters in the string are in increasing order by ASCII value
-        (allowing the strings to be searched efficiantly).
-    */
+    const BuiltinT StringLibrary[] =
     {
-        std::string strcntrl;
-        std::string strdigit;
-        std::string strlower;
-        std::string strupper;
-        std::string strprint;
-        std::string strpunct;
-        std::string strspace;
-    
-        for(int ch(0); ch < 256; ++ch)
-        {
-            const char character(static_cast< char >(ch));
-            
-            if(std::iscntrl(ch))
-            {
-                strcntrl.append(1, character);
-            }
-            
-            if(std::isdigit(ch))
-            {
-                strdigit.append(1, character);
-            }
-            
-            if(std::islower(ch))
-            {
-                strlower.append(1, character);
-            }
-            
-            if(std::isupper(ch))
-            {
-                strupper.append(1, character);
-            }
-            
-            if(std::isprint(ch))
-            {
-                strprint.append(1, character);
-            }
-            
-            if(std::ispunct(ch))
-            {
-                strpunct.append(1, character);
-            }
+        { DISH_LANGID_IS_LIB_STRING, [] { return CreateLockedBoolean(true); } },
         
-            if(std::isspace(ch))
-            {
-                strspace.append(1, character);
-            }
-        }
+        { DISH_LANGID_CASE_SENSITIVE, [] { return CreateLockedBoolean(true); } },
+        { DISH_LANGID_CASE_INSENSITIVE, [] { return CreateLockedBoolean(false); } },
         
-        insert(DISH_LANGID_STRCONTROLCHARS, StringValue::MakeValue(strcntrl, LOCKED));
-        insert(DISH_LANGID_STRDIGITCHARS, StringValue::MakeValue(strdigit, LOCKED));
-        insert(DISH_LANGID_STRLOWERCASECHARS, StringValue::MakeValue(strlower, LOCKED));
-        insert(DISH_LANGID_STRUPPERCASECHARS, StringValue::MakeValue(strupper, LOCKED));
-        insert(DISH_LANGID_STRPRINTABLECHARS, StringValue::MakeValue(strprint, LOCKED));
-        insert(DISH_LANGID_STRPUNCTUATIONCHARS, StringValue::MakeValue(strpunct, LOCKED));
-        insert(DISH_LANGID_STRWHITESPACECHARS, StringValue::MakeValue(strspace, LOCKED));
-    }
-    insert(DISH_LANGID_STREOLNCHARS, StringValue::MakeValue(EOLN_CHARACTERS, LOCKED));
-    
-    insert(DISH_LANGID_STRSINGLEQUOTE, StringValue::MakeValue("'", LOCKED));
-    insert(DISH_LANGID_STRDOUBLEQUOTE, StringValue::MakeValue("\"", LOCKED));
-    insert(DISH_LANGID_STRBACKSLASH, StringValue::MakeValue("\\", LOCKED));
-    insert(DISH_LANGID_STRNEWLINE, StringValue::MakeValue("\n", LOCKED));
-    
-    insert(DISH_LANGID_STRSINGLE, BooleanValue::MakeValue(STRSINGLE, LOCKED));
-    insert(DISH_LANGID_STRMULTIPLE, BooleanValue::MakeValue(STRMULTIPLE, LOCKED));
-    insert(DISH_LANGID_Ord, OrdFunction::MakeValue());
-    insert(DISH_LANGID_Ord, Ord2Function::MakeValue());
-    insert(DISH_LANGID_Chr, ChrFunction::MakeValue());
-    insert(DISH_LANGID_Chr, Chr2Function::MakeValue());
-    
-    insert(DISH_LANGID_BASE_2_DIGITS, StringValue::MakeValue(STR_BINARY_DIGITS, LOCKED));
-    insert(DISH_LANGID_BASE_8_DIGITS, StringValue::MakeValue(STR_OCTAL_DIGITS, LOCKED));
-    insert(DISH_LANGID_BASE_10_DIGITS, StringValue::MakeValue(STR_DECIMAL_DIGITS, LOCKED));
-    insert(DISH_LANGID_BASE_16_DIGITS, StringValue::MakeValue(STR_HEXADECIMAL_DIGITS, LOCKED));
-    insert(DISH_LANGID_IntegerToBaseString, IntegerToBaseStringFunction::MakeValue());
-    insert(DISH_LANGID_BaseStringToInteger, BaseStringToIntegerFunction::MakeValue());
-    
-    insert(DISH_LANGID_ToUpperCase, ToUpperCaseFunction::MakeValue());
-    insert(DISH_LANGID_ToLowerCase, ToLowerCaseFunction::MakeValue());
-    
-    insert(DISH_LANGID_IsUpperCase, IsUpperCaseFunction::MakeValue());
-    insert(DISH_LANGID_IsLowerCase, IsLowerCaseFunction::MakeValue());
-    insert(DISH_LANGID_IsControl, IsControlFunction::MakeValue());
-    insert(DISH_LANGID_IsPrintable, IsPrintableFunction::MakeValue());
-    insert(DISH_LANGID_IsWhitespace, IsWhitespaceFunction::MakeValue());
-    insert(DISH_LANGID_IsPunctuation, IsPunctuationFunction::MakeValue());
-    insert(DISH_LANGID_IsLetter, IsLetterFunction::MakeValue());
-    insert(DISH_LANGID_IsDigit, IsDigitFunction::MakeValue());
-    insert(DISH_LANGID_IsHexDigit, IsHexDigitFunction::MakeValue());
-    
-    insert(DISH_LANGID_LeftJustify, LeftJustifyFunction::MakeValue());
-    insert(DISH_LANGID_RightJustify, RightJustifyFunction::MakeValue());
-    insert(DISH_LANGID_CenterJustify, CenterJustifyFunction::MakeValue());
-    
-    insert(DISH_LANGID_StrLeft, LeftStringFunction::MakeValue());
-    insert(DISH_LANGID_StrRight, RightStringFunction::MakeValue());
-    insert(DISH_LANGID_StrMiddle, MiddleStringFunction::MakeValue());
-    
-    insert(DISH_LANGID_StrBeginsWith, StringBeginsWith2Function::MakeValue());
-    insert(DISH_LANGID_StrBeginsWith, StringBeginsWith3Function::MakeValue());
-    insert(DISH_LANGID_StrEndsWith, StringEndsWith2Function::MakeValue());
-    insert(DISH_LANGID_StrEndsWith, StringEndsWith3Function::MakeValue());
-    
-    insert(DISH_LANGID_StrFind, StringFindFunction::MakeValue());
-    insert(DISH_LANGID_StrFindNextOf, StringFindNextOfFunction::MakeValue());
-    insert(DISH_LANGID_StrFindNextNotOf, StringFindNextNotOfFunction::MakeValue());
-    insert(DISH_LANGID_StrFindLastOf, StringFindLastOfFunction::MakeValue());
-    insert(DISH_LANGID_StrFindLastNotOf, StringFindLastNotOfFunction::MakeValue());
-    
-    insert(DISH_LANGID_StrTrimLeading, StringTrimLeadingFunction::MakeValue());
-    insert(DISH_LANGID_StrTrimTrailing, StringTrimTrailingFunction::MakeValue());
-    insert(DISH_LANGID_StrRemoveAllOf, StringRemoveAllOfFunction::MakeValue());
-    insert(DISH_LANGID_StrRemoveAllNotOf, StringRemoveAllNotOfFunction::MakeValue());
-    
-    insert(DISH_LANGID_StrReplaceAll, StringReplaceAllFunction::MakeValue());
-    insert(DISH_LANGID_StrReplaceAll, StringReplaceAllWithPosFunction::MakeValue());
-    insert(DISH_LANGID_StrReplaceFirst, StringReplaceFirstFunction::MakeValue());
-    insert(DISH_LANGID_StrReplaceFirst, StringReplaceFirstWithPosFunction::MakeValue());
-    
-    insert(DISH_LANGID_StrReplicate, StringReplicateFunction::MakeValue());
-    
-    insert(DISH_LANGID_StrReverse, StringReverseFunction::MakeValue());
-    
+        { DISH_LANGID_STRINVALID, [] { return CreateLockedInteger(dish::STRINVALID); } },
+        
+        { DISH_LANGID_STRCONTROLCHARS, [] { return CreateCharacterClass(std::iscntrl); } },
+        { DISH_LANGID_STRDIGITCHARS, [] { return CreateCharacterClass(std::isdigit); } },
+        { DISH_LANGID_STRLOWERCASECHARS, [] { return CreateCharacterClass(std::islower); } },
+        { DISH_LANGID_STRUPPERCASECHARS, [] { return CreateCharacterClass(std::isupper); } },
+        { DISH_LANGID_STRPRINTABLECHARS, [] { return CreateCharacterClass(std::isprint); } },
+        { DISH_LANGID_STRPUNCTUATIONCHARS, [] { return CreateCharacterClass(std::ispunct); } },
+        { DISH_LANGID_STRWHITESPACECHARS, [] { return CreateCharacterClass(std::isspace); } },
+        { DISH_LANGID_STREOLNCHARS, [] { return CreateLockedString(dish::EOLN_CHARACTERS); } },
+        
+        { DISH_LANGID_STRSINGLEQUOTE, [] { return CreateLockedString("'"); } },
+        { DISH_LANGID_STRDOUBLEQUOTE, [] { return CreateLockedString("\""); } },
+        { DISH_LANGID_STRBACKSLASH, [] { return CreateLockedString("\\"); } },
+        { DISH_LANGID_STRNEWLINE, [] { return CreateLockedString("\n"); } },
+        
+        { DISH_LANGID_STRSINGLE, [] { return CreateLockedBoolean(dish::STRSINGLE); } },
+        { DISH_LANGID_STRMULTIPLE, [] { return CreateLockedBoolean(dish::STRMULTIPLE); } },
+        
+        { DISH_LANGID_BASE_2_DIGITS, [] { return CreateLockedString(dish::STR_BINARY_DIGITS); } },
+        { DISH_LANGID_BASE_8_DIGITS, [] { return CreateLockedString(dish::STR_OCTAL_DIGITS); } },
+        { DISH_LANGID_BASE_10_DIGITS, [] { return CreateLockedString(dish::STR_DECIMAL_DIGITS); } },
+        { DISH_LANGID_BASE_16_DIGITS, [] { return CreateLockedString(dish::STR_HEXADECIMAL_DIGITS); } },
+    };
+
 #else
 
-    insert(DISH_LANGID_IS_LIB_STRING, BooleanValue::MakeLockedValue(false));
-    
+    const BuiltinT StringLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_STRING, [] { return CreateLockedBoolean(false); } },
+    };
+
 #endif
     
-    ///////////////
-    
 #ifdef LANG_LIB_DATETIME
 
-    insert(DISH_LANGID_IS_LIB_DATETIME, BooleanValue::MakeLockedValue(true));
-    
-    ///////////////
+    const BuiltinT DateTimeLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_DATETIME, [] { return CreateLockedBoolean(true); } },
+        
+        { DISH_LANGID_DateTimeT, dish::CreateDateTimeStructureType },
+        
+        { DISH_LANGID_DaysOfTheWeek, dish::CreateDaysOfTheWeekArray },
+        { DISH_LANGID_Sunday, [] { return CreateLockedInteger(1); } },
+        { DISH_LANGID_Monday, [] { return CreateLockedInteger(2); } },
+        { DISH_LANGID_Tuesday, [] { return CreateLockedInteger(3); } },
+        { DISH_LANGID_Wednesday, [] { return CreateLockedInteger(4); } },
+        { DISH_LANGID_Thursday, [] { return CreateLockedInteger(5); } },
+        { DISH_LANGID_Friday, [] { return CreateLockedInteger(6); } },
+        { DISH_LANGID_Saturday, [] { return CreateLockedInteger(7); } },
+        
+        { DISH_LANGID_MonthsOfTheYear, dish::CreateMonthsOfTheYearArray },
+        { DISH_LANGID_January, [] { return CreateLockedInteger(1); } },
+        { DISH_LANGID_February, [] { return CreateLockedInteger(2); } },
+        { DISH_LANGID_March, [] { return CreateLockedInteger(3); } },
+        { DISH_LANGID_April, [] { return CreateLockedInteger(4); } },
+        { DISH_LANGID_May, [] { return CreateLockedInteger(5); } },
+        { DISH_LANGID_June, [] { return CreateLockedInteger(6); } },
+        { DISH_LANGID_July, [] { return CreateLockedInteger(7); } },
+        { DISH_LANGID_August, [] { return CreateLockedInteger(8); } },
+        { DISH_LANGID_September, [] { return CreateLockedInteger(9); } },
+        { DISH_LANGID_October, [] { return CreateLockedInteger(10); } },
+        { DISH_LANGID_November, [] { return CreateLockedInteger(11); } },
+        { DISH_LANGID_December, [] { return CreateLockedInteger(12); } },
+    };
 
-    insert(DISH_LANGID_DateTimeT, CreateDateTimeStructureType());
-
-    insert(DISH_LANGID_DaysOfTheWeek, CreateDaysOfTheWeekArray());
-    insert(DISH_LANGID_Sunday, CreateLockedInteger(1));
-    insert(DISH_LANGID_Monday, CreateLockedInteger(2));
-    insert(DISH_LANGID_Tuesday, CreateLockedInteger(3));
-    insert(DISH_LANGID_Wednesday, CreateLockedInteger(4));
-    insert(DISH_LANGID_Thursday, CreateLockedInteger(5));
-    insert(DISH_LANGID_Friday, CreateLockedInteger(6));
-    insert(DISH_LANGID_Saturday, CreateLockedInteger(7));
-
-    insert(DISH_LANGID_MonthsOfTheYear, CreateMonthsOfTheYearArray());
-    insert(DISH_LANGID_January, CreateLockedInteger(1));
-    insert(DISH_LANGID_February, CreateLockedInteger(2));
-    insert(DISH_LANGID_March, CreateLockedInteger(3));
-    insert(DISH_LANGID_April, CreateLockedInteger(4));
-    insert(DISH_LANGID_May, CreateLockedInteger(5));
-    insert(DISH_LANGID_June, CreateLockedInteger(6));
-    insert(DISH_LANGID_July, CreateLockedInteger(7));
-    insert(DISH_LANGID_August, CreateLockedInteger(8));
-    insert(DISH_LANGID_September, CreateLockedInteger(9));
-    insert(DISH_LANGID_October, CreateLockedInteger(10));
-    insert(DISH_LANGID_November, CreateLockedInteger(11));
-    insert(DISH_LANGID_December, CreateLockedInteger(12));
-
-    insert(DISH_LANGID_DateTime, DateTimeFunction::MakeValue());
-    insert(DISH_LANGID_DecomposeDateTimeValue, DecomposeDateTimeValueFunction::MakeValue());
-    insert(DISH_LANGID_DecomposeUtcDateTimeValue, DecomposeUtcDateTimeValueFunction::MakeValue());
-    insert(DISH_LANGID_ComposeDateTimeValue, ComposeDateTimeValueFunction::MakeValue());
-    
-    insert(DISH_LANGID_TimeZoneT, TimeZoneInfoFunction::MakeValue());
-    insert(DISH_LANGID_TimeZoneInfo, TimeZoneInfoFunction::MakeValue());
-    insert(DISH_LANGID_TimeZoneInfo, TimeZoneInfo1Function::MakeValue());
-    
-    insert(DISH_LANGID_Now, NowFunction::MakeValue());
-    insert(DISH_LANGID_ElapsedSeconds, ElapsedSecondsFunction::MakeValue());
-    
 #else
 
-    insert(DISH_LANGID_IS_LIB_DATETIME, BooleanValue::MakeLockedValue(false));
-    
+    const BuiltinT DateTimeLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_DATETIME, [] { return CreateLockedBoolean(false); } },
+    };
+
 #endif
     
-    ///////////////
-    
 #ifdef LANG_LIB_MATH_CORE
 
-    insert(DISH_LANGID_IS_LIB_MATH_CORE, BooleanValue::MakeLockedValue(true));
-    
-    ///////////////
+    const BuiltinT MathCoreLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_MATH_CORE, [] { return CreateLockedBoolean(true); } },
+    };
 
-    insert(DISH_LANGID_IsFiniteNumberFunction, IsFiniteNumberFunction::MakeValue());
-    insert(DISH_LANGID_IsInfiniteNumberFunction, IsInfiniteNumberFunction::MakeValue());
-    insert(DISH_LANGID_IsNotANumberFunction, IsNotANumberFunction::MakeValue());
-    insert(DISH_LANGID_IsNormalNumberFunction, IsNormalNumberFunction::MakeValue());
-    
-    insert(DISH_LANGID_IsOddFunction, IsOddFunction::MakeValue());
-    insert(DISH_LANGID_IsEvenFunction, IsEvenFunction::MakeValue());
-    
-    insert(DISH_LANGID_AbsFunction, AbsFunction::MakeValue());
-    insert(DISH_LANGID_WholeFunction, WholeFunction::MakeValue());
-    insert(DISH_LANGID_FractionFunction, FractionFunction::MakeValue());
-    insert(DISH_LANGID_SignOfFunction, SignOfFunction::MakeValue());
-    
-    insert(DISH_LANGID_SqrFunction, SqrFunction::MakeValue());
-    insert(DISH_LANGID_SqrtFunction, SqrtFunction::MakeValue());
-    insert(DISH_LANGID_CubeFunction, CubeFunction::MakeValue());
-    insert(DISH_LANGID_CbrtFunction, CbrtFunction::MakeValue());
-    
-    insert(DISH_LANGID_LnFunction, LnFunction::MakeValue());
-    insert(DISH_LANGID_LogFunction, LogFunction::MakeValue());
-    insert(DISH_LANGID_LogFunction, Log2Function::MakeValue());
-    insert(DISH_LANGID_ExpFunction, ExpFunction::MakeValue());
-    
-    insert(DISH_LANGID_RoundFunction, RoundFunction::MakeValue());
-    insert(DISH_LANGID_FloorFunction, FloorFunction::MakeValue());
-    insert(DISH_LANGID_CeilFunction, CeilFunction::MakeValue());
-    
 #else
 
-    insert(DISH_LANGID_IS_LIB_MATH_CORE, BooleanValue::MakeLockedValue(false));
-    
+    const BuiltinT MathCoreLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_MATH_CORE, [] { return CreateLockedBoolean(false); } },
+    };
+
 #endif
     
-    ///////////////
-    
 #ifdef LANG_LIB_MATH_TRIG
 
-    insert(DISH_LANGID_IS_LIB_MATH_TRIG, BooleanValue::MakeLockedValue(true));
-    
-    ///////////////
+    const BuiltinT MathTrigLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_MATH_TRIG, [] { return CreateLockedBoolean(true); } },
+        
+        { DISH_LANGID_PI, [] { return CreateLockedReal(dish::PI); } },
+    };
 
-    insert(DISH_LANGID_PI, RealValue::MakeValue(PI, LOCKED));
-    
-    insert(DISH_LANGID_DegToRadFunction, DegToRadFunction::MakeValue());
-    insert(DISH_LANGID_RadToDegFunction, RadToDegFunction::MakeValue());
-    
-    insert(DISH_LANGID_SinFunction, SinFunction::MakeValue());
-    insert(DISH_LANGID_CosFunction, CosFunction::MakeValue());
-    insert(DISH_LANGID_TanFunction, TanFunction::MakeValue());
-    
-    insert(DISH_LANGID_ArcSinFunction, ArcSinFunction::MakeValue());
-    insert(DISH_LANGID_ArcCosFunction, ArcCosFunction::MakeValue());
-    insert(DISH_LANGID_ArcTanFunction, ArcTanFunction::MakeValue());
-    
-    insert(DISH_LANGID_CotFunction, CotFunction::MakeValue());
-    insert(DISH_LANGID_SecFunction, SecFunction::MakeValue());
-    insert(DISH_LANGID_CscFunction, CscFunction::MakeValue());
-    
-    insert(DISH_LANGID_ArcCotFunction, ArcCotFunction::MakeValue());
-    insert(DISH_LANGID_ArcSecFunction, ArcSecFunction::MakeValue());
-    insert(DISH_LANGID_ArcCscFunction, ArcCscFunction::MakeValue());
-    
 #else
 
-    insert(DISH_LANGID_IS_LIB_MATH_TRIG, BooleanValue::MakeLockedValue(false));
-    
+    const BuiltinT MathTrigLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_MATH_TRIG, [] { return CreateLockedBoolean(false); } },
+    };
+
 #endif
     
-    ///////////////
-    
 #ifdef LANG_LIB_MATH_HYPERBOLIC
 
-    insert(DISH_LANGID_IS_LIB_MATH_HYPERBOLIC, BooleanValue::MakeLockedValue(true));
-    
-    insert(DISH_LANGID_SinhFunction, SinhFunction::MakeValue());
-    insert(DISH_LANGID_CoshFunction, CoshFunction::MakeValue());
-    insert(DISH_LANGID_TanhFunction, TanhFunction::MakeValue());
-    
-    insert(DISH_LANGID_ArcSinhFunction, ArcSinhFunction::MakeValue());
-    insert(DISH_LANGID_ArcCoshFunction, ArcCoshFunction::MakeValue());
-    insert(DISH_LANGID_ArcTanhFunction, ArcTanhFunction::MakeValue());
-    
-    insert(DISH_LANGID_SechFunction, SechFunction::MakeValue());
-    insert(DISH_LANGID_CschFunction, CschFunction::MakeValue());
-    insert(DISH_LANGID_CothFunction, CothFunction::MakeValue());
-    
-    insert(DISH_LANGID_ArcSechFunction, ArcSechFunction::MakeValue());
-    insert(DISH_LANGID_ArcCschFunction, ArcCschFunction::MakeValue());
-    insert(DISH_LANGID_ArcCothFunction, ArcCothFunction::MakeValue());
-    
+    const BuiltinT MathHyperbolicLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_MATH_HYPERBOLIC, [] { return CreateLockedBoolean(true); } },
+    };
+
 #else
 
-    insert(DISH_LANGID_IS_LIB_MATH_HYPERBOLIC, BooleanValue::MakeLockedValue(false));
-    
+    const BuiltinT MathHyperbolicLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_MATH_HYPERBOLIC, [] { return CreateLockedBoolean(false); } },
+    };
+
 #endif
     
-    ///////////////
-    
 #ifdef LANG_LIB_MATH_COMPLEX
 
-    insert(DISH_LANGID_IS_LIB_MATH_COMPLEX, BooleanValue::MakeLockedValue(true));
-    
-    ///////////////
+    const BuiltinT MathComplexLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_MATH_COMPLEX, [] { return CreateLockedBoolean(true); } },
+        
+        { DISH_LANGID_ComplexT, dish::CreateVersionStructureType },
+    };
 
-    insert(DISH_LANGID_ComplexT, CreateVersionStructureType());
-    
-    insert(DISH_LANGID_ComplexCreateFunction, ImaginaryCreate1Function::MakeValue());
-    insert(DISH_LANGID_ComplexCreateFunction, ImaginaryCreate2Function::MakeValue());
-    
-    insert(DISH_LANGID_ComplexToStringFunction, ImaginaryToStringFunction::MakeValue());
-    
-    insert(DISH_LANGID_ComplexIsEqualFunction, ImaginaryIsEqualFunction::MakeValue());
-    insert(DISH_LANGID_ComplexIsNotEqualFunction, ImaginaryIsNotEqualFunction::MakeValue());
-    
-    insert(DISH_LANGID_ComplexAddFunction, ImaginaryAddFunction::MakeValue());
-    insert(DISH_LANGID_ComplexSubtractFunction, ImaginarySubtractFunction::MakeValue());
-    insert(DISH_LANGID_ComplexMultiplyFunction, ImaginaryMultiplyFunction::MakeValue());
-    insert(DISH_LANGID_ComplexDivideFunction, ImaginaryDivideFunction::MakeValue());
-    
-    insert(DISH_LANGID_ComplexSqrFunction, ImaginarySqrFunction::MakeValue());
-    insert(DISH_LANGID_ComplexSqrtFunction, ImaginarySqrtFunction::MakeValue());
-    
-    insert(DISH_LANGID_ComplexReciprocalFunction, ImaginaryReciprocalFunction::MakeValue());
-    insert(DISH_LANGID_ComplexConjugateFunction, ImaginaryConjugateFunction::MakeValue());
-    
 #else
 
-    insert(DISH_LANGID_IS_LIB_MATH_COMPLEX, BooleanValue::MakeLockedValue(false));
-    
+    const BuiltinT MathComplexLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_MATH_COMPLEX, [] { return CreateLockedBoolean(false); } },
+    };
+
 #endif
     
-    ///////////////
-    
 #ifdef LANG_LIB_MATH_RANDOM
 
-    insert(DISH_LANGID_IS_LIB_MATH_RANDOM, BooleanValue::MakeLockedValue(true));
-    
-    ///////////////
+    const BuiltinT MathRandomLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_MATH_RANDOM, [] { return CreateLockedBoolean(true); } },
+    };
 
-    insert(DISH_LANGID_RandomSeedFunction, RandomSeedFunction::MakeValue());
-    
-    insert(DISH_LANGID_RandomBooleanFunction, RandomBooleanFunction::MakeValue());
-    
-    insert(DISH_LANGID_RandomIntegerFunction, RandomIntegerFunction::MakeValue());
-    insert(DISH_LANGID_RandomIntegerFunction, RandomInteger1Function::MakeValue());
-    insert(DISH_LANGID_RandomIntegerFunction, RandomInteger2Function::MakeValue());
-    
-    insert(DISH_LANGID_RandomRealFunction, RandomRealFunction::MakeValue());
-    insert(DISH_LANGID_RandomRealFunction, RandomReal1Function::MakeValue());
-    insert(DISH_LANGID_RandomRealFunction, RandomReal2Function::MakeValue());
-    
-    insert(DISH_LANGID_RandomMaxFunction, RandomMaxFunction::MakeValue());
-    
-    insert(DISH_LANGID_RandomBitIntegerFunction, RandomBitIntegerFunction::MakeValue());
-    
 #else
 
-    insert(DISH_LANGID_IS_LIB_MATH_RANDOM, BooleanValue::MakeLockedValue(false));
-    
+    const BuiltinT MathRandomLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_MATH_RANDOM, [] { return CreateLockedBoolean(false); } },
+    };
+
 #endif
     
-    ///////////////
-    
 #ifdef LANG_LIB_MATH_MATRIX
 
-    insert(DISH_LANGID_IS_LIB_MATH_MATRIX, BooleanValue::MakeLockedValue(true));
-    
-    ///////////////
+    const BuiltinT MathMatrixLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_MATH_MATRIX, [] { return CreateLockedBoolean(true); } },
+    };
 
-    insert(DISH_LANGID_CreateMatrixTFunction, CreateMatrixTFunction::MakeValue());
-    insert(DISH_LANGID_CreateMatrixFunction, CreateMatrixFunction::MakeValue());
-    insert(DISH_LANGID_MatrixValidateFunction, MatrixValidateFunction::MakeValue());
-    insert(DISH_LANGID_MatrixNumRowsFunction, MatrixNumRowsFunction::MakeValue());
-    insert(DISH_LANGID_MatrixNumColumnsFunction, MatrixNumColumnsFunction::MakeValue());
-    insert(DISH_LANGID_MatrixIsSquareFunction, MatrixIsSquareFunction::MakeValue());
-    insert(DISH_LANGID_MatrixInitializeFunction, MatrixInitialize1Function::MakeValue());
-    insert(DISH_LANGID_MatrixInitializeFunction, MatrixInitialize2Function::MakeValue());
-    insert(DISH_LANGID_MatrixRowSliceFunction, MatrixRowSliceFunction::MakeValue());
-    insert(DISH_LANGID_MatrixColumnSliceFunction, MatrixColumnSliceFunction::MakeValue());
-    insert(DISH_LANGID_MatrixTransposeFunction, MatrixTransposeFunction::MakeValue());
-    insert(DISH_LANGID_MatrixDeterminantFunction, MatrixDeterminantFunction::MakeValue());
-    insert(DISH_LANGID_MatrixInvertFunction, MatrixInvertFunction::MakeValue());
-    insert(DISH_LANGID_MatrixAddFunction, MatrixAddFunction::MakeValue());
-    insert(DISH_LANGID_MatrixSubtractFunction, MatrixSubtractFunction::MakeValue());
-    insert(DISH_LANGID_MatrixMultiplyFunction, MatrixMultiplyFunction::MakeValue());
-    insert(DISH_LANGID_MatrixEqualFunction, MatrixEqualFunction::MakeValue());
-    insert(DISH_LANGID_MatrixAddRowFunction, MatrixAddRowFunction::MakeValue());
-    insert(DISH_LANGID_MatrixAddColumnFunction, MatrixAddColumnFunction::MakeValue());
-    insert(DISH_LANGID_MatrixToStringFunction, MatrixToStringFunction::MakeValue());
-    
 #else
 
-    insert(DISH_LANGID_IS_LIB_MATH_MATRIX, BooleanValue::MakeLockedValue(false));
-    
+    const BuiltinT MathMatrixLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_MATH_MATRIX, [] { return CreateLockedBoolean(false); } },
+    };
+
 #endif
     
-    ///////////////
-
 #ifdef LANG_LIB_MATH_INTEGER
 
-    insert(DISH_LANGID_IS_LIB_MATH_INTEGER, BooleanValue::MakeLockedValue(true));
-    
-    insert(DISH_LANGID_FactorialFunction, FactorialFunction::MakeValue());
-    insert(DISH_LANGID_BinomialCoefficientFunction, BinomialCoefficientFunction::MakeValue());
-    insert(DISH_LANGID_GreatestCommonDenomonatorFunction, GreatestCommonDenomonatorFunction::MakeValue());
-    insert(DISH_LANGID_FibonacciFunction, FibonacciFunction::MakeValue());
+    const BuiltinT MathIntegerLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_MATH_INTEGER, [] { return CreateLockedBoolean(true); } },
+    };
 
 #else
 
-    insert(DISH_LANGID_IS_LIB_MATH_INTEGER, BooleanValue::MakeLockedValue(false));
+    const BuiltinT MathIntegerLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_MATH_INTEGER, [] { return CreateLockedBoolean(false); } },
+    };
 
 #endif
     
-    ///////////////
-    
 #ifdef LANG_LIB_TEXTIO
 
-    insert(DISH_LANGID_IS_LIB_TEXTIO, BooleanValue::MakeLockedValue(true));
-    
-    ///////////////
+    const BuiltinT TextIOLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_TEXTIO, [] { return CreateLockedBoolean(true); } },
+        
+        { DISH_LANGID_TEXTIO_COLOR_BLACK, [] { return CreateLockedInteger(COLOR_BLACK); } },
+        { DISH_LANGID_TEXTIO_COLOR_RED, [] { return CreateLockedInteger(COLOR_RED); } },
+        { DISH_LANGID_TEXTIO_COLOR_GREEN, [] { return CreateLockedInteger(COLOR_GREEN); } },
+        { DISH_LANGID_TEXTIO_COLOR_YELLOW, [] { return CreateLockedInteger(COLOR_YELLOW); } },
+        { DISH_LANGID_TEXTIO_COLOR_BLUE, [] { return CreateLockedInteger(COLOR_BLUE); } },
+        { DISH_LANGID_TEXTIO_COLOR_MAGENTA, [] { return CreateLockedInteger(COLOR_MAGENTA); } },
+        { DISH_LANGID_TEXTIO_COLOR_CYAN, [] { return CreateLockedInteger(COLOR_CYAN); } },
+        { DISH_LANGID_TEXTIO_COLOR_WHITE, [] { return CreateLockedInteger(COLOR_WHITE); } },
+        
+        { DISH_LANGID_TEXTIO_ATTR_NORMAL, [] { return CreateLockedInteger(A_NORMAL); } },
+        { DISH_LANGID_TEXTIO_ATTR_CHARTEXT, [] { return CreateLockedInteger(A_CHARTEXT); } },
+        { DISH_LANGID_TEXTIO_ATTR_COLOR, [] { return CreateLockedInteger(A_COLOR); } },
+        { DISH_LANGID_TEXTIO_ATTR_STANDOUT, [] { return CreateLockedInteger(A_STANDOUT); } },
+        { DISH_LANGID_TEXTIO_ATTR_UNDERLINE, [] { return CreateLockedInteger(A_UNDERLINE); } },
+        { DISH_LANGID_TEXTIO_ATTR_REVERSE, [] { return CreateLockedInteger(A_REVERSE); } },
+        { DISH_LANGID_TEXTIO_ATTR_BLINK, [] { return CreateLockedInteger(A_BLINK); } },
+        { DISH_LANGID_TEXTIO_ATTR_DIM, [] { return CreateLockedInteger(A_DIM); } },
+        { DISH_LANGID_TEXTIO_ATTR_BOLD, [] { return CreateLockedInteger(A_BOLD); } },
+        { DISH_LANGID_TEXTIO_ATTR_ALTCHARSET, [] { return CreateLockedInteger(A_ALTCHARSET); } },
+        { DISH_LANGID_TEXTIO_ATTR_INVIS, [] { return CreateLockedInteger(A_INVIS); } },
+        { DISH_LANGID_TEXTIO_ATTR_PROTECT, [] { return CreateLockedInteger(A_PROTECT); } },
+        { DISH_LANGID_TEXTIO_ATTR_HORIZONTAL, [] { return CreateLockedInteger(A_HORIZONTAL); } },
+        { DISH_LANGID_TEXTIO_ATTR_LEFT, [] { return CreateLockedInteger(A_LEFT); } },
+        { DISH_LANGID_TEXTIO_ATTR_LOW, [] { return CreateLockedInteger(A_LOW); } },
+        { DISH_LANGID_TEXTIO_ATTR_RIGHT, [] { return CreateLockedInteger(A_RIGHT); } },
+        { DISH_LANGID_TEXTIO_ATTR_TOP, [] { return CreateLockedInteger(A_TOP); } },
+        { DISH_LANGID_TEXTIO_ATTR_VERTICAL, [] { return CreateLockedInteger(A_VERTICAL); } },
+        
+        { DISH_LANGID_TEXTIO_KEY_CTRL_A, [] { return CreateLockedInteger(1); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_B, [] { return CreateLockedInteger(2); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_C, [] { return CreateLockedInteger(3); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_D, [] { return CreateLockedInteger(4); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_E, [] { return CreateLockedInteger(5); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_F, [] { return CreateLockedInteger(6); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_G, [] { return CreateLockedInteger(7); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_H, [] { return CreateLockedInteger(8); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_I, [] { return CreateLockedInteger(9); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_J, [] { return CreateLockedInteger(10); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_K, [] { return CreateLockedInteger(11); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_L, [] { return CreateLockedInteger(12); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_M, [] { return CreateLockedInteger(13); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_N, [] { return CreateLockedInteger(14); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_O, [] { return CreateLockedInteger(15); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_P, [] { return CreateLockedInteger(16); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_Q, [] { return CreateLockedInteger(17); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_R, [] { return CreateLockedInteger(18); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_S, [] { return CreateLockedInteger(19); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_T, [] { return CreateLockedInteger(20); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_U, [] { return CreateLockedInteger(21); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_V, [] { return CreateLockedInteger(22); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_W, [] { return CreateLockedInteger(23); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_X, [] { return CreateLockedInteger(24); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_Y, [] { return CreateLockedInteger(25); } },
+        { DISH_LANGID_TEXTIO_KEY_CTRL_Z, [] { return CreateLockedInteger(26); } },
+        { DISH_LANGID_TEXTIO_KEY_ESC, [] { return CreateLockedInteger(27); } },
+        { DISH_LANGID_TEXTIO_KEY_DOWN, [] { return CreateLockedInteger(KEY_DOWN); } },
+        { DISH_LANGID_TEXTIO_KEY_UP, [] { return CreateLockedInteger(KEY_UP); } },
+        { DISH_LANGID_TEXTIO_KEY_LEFT, [] { return CreateLockedInteger(KEY_LEFT); } },
+        { DISH_LANGID_TEXTIO_KEY_RIGHT, [] { return CreateLockedInteger(KEY_RIGHT); } },
+        { DISH_LANGID_TEXTIO_KEY_HOME, [] { return CreateLockedInteger(KEY_HOME); } },
+        { DISH_LANGID_TEXTIO_KEY_BACKSPACE, [] { return CreateLockedInteger(KEY_BACKSPACE); } },
+        { DISH_LANGID_TEXTIO_KEY_F1, [] { return CreateLockedInteger(KEY_F(1)); } },
+        { DISH_LANGID_TEXTIO_KEY_F2, [] { return CreateLockedInteger(KEY_F(2)); } },
+        { DISH_LANGID_TEXTIO_KEY_F3, [] { return CreateLockedInteger(KEY_F(3)); } },
+        { DISH_LANGID_TEXTIO_KEY_F4, [] { return CreateLockedInteger(KEY_F(4)); } },
+        { DISH_LANGID_TEXTIO_KEY_F5, [] { return CreateLockedInteger(KEY_F(5)); } },
+        { DISH_LANGID_TEXTIO_KEY_F6, [] { return CreateLockedInteger(KEY_F(6)); } },
+        { DISH_LANGID_TEXTIO_KEY_F7, [] { return CreateLockedInteger(KEY_F(7)); } },
+        { DISH_LANGID_TEXTIO_KEY_F8, [] { return CreateLockedInteger(KEY_F(8)); } },
+        { DISH_LANGID_TEXTIO_KEY_F9, [] { return CreateLockedInteger(KEY_F(9)); } },
+        { DISH_LANGID_TEXTIO_KEY_F10, [] { return CreateLockedInteger(KEY_F(10)); } },
+        { DISH_LANGID_TEXTIO_KEY_F11, [] { return CreateLockedInteger(KEY_F(11)); } },
+        { DISH_LANGID_TEXTIO_KEY_F12, [] { return CreateLockedInteger(KEY_F(12)); } },
+        { DISH_LANGID_TEXTIO_KEY_DELETE_LINE, [] { return CreateLockedInteger(KEY_DL); } },
+        { DISH_LANGID_TEXTIO_KEY_INSERT_LINE, [] { return CreateLockedInteger(KEY_IL); } },
+        { DISH_LANGID_TEXTIO_KEY_DELETE_CHAR, [] { return CreateLockedInteger(KEY_DC); } },
+        { DISH_LANGID_TEXTIO_KEY_INSERT_CHAR, [] { return CreateLockedInteger(KEY_IC); } },
+        
+        { DISH_LANGID_TEXTIO_VISIBLE, [] { return CreateLockedBoolean(true); } },
+        { DISH_LANGID_TEXTIO_INVISIBLE, [] { return CreateLockedBoolean(false); } },
+    };
 
-    insert(DISH_LANGID_TEXTIO_COLOR_BLACK, CreateLockedInteger(COLOR_BLACK));
-    insert(DISH_LANGID_TEXTIO_COLOR_RED, CreateLockedInteger(COLOR_RED));
-    insert(DISH_LANGID_TEXTIO_COLOR_GREEN, CreateLockedInteger(COLOR_GREEN));
-    insert(DISH_LANGID_TEXTIO_COLOR_YELLOW, CreateLockedInteger(COLOR_YELLOW));
-    insert(DISH_LANGID_TEXTIO_COLOR_BLUE, CreateLockedInteger(COLOR_BLUE));
-    insert(DISH_LANGID_TEXTIO_COLOR_MAGENTA, CreateLockedInteger(COLOR_MAGENTA));
-    insert(DISH_LANGID_TEXTIO_COLOR_CYAN, CreateLockedInteger(COLOR_CYAN));
-    insert(DISH_LANGID_TEXTIO_COLOR_WHITE, CreateLockedInteger(COLOR_WHITE));
-    
-    insert(DISH_LANGID_TEXTIO_ATTR_NORMAL, CreateLockedInteger(A_NORMAL));
-    insert(DISH_LANGID_TEXTIO_ATTR_CHARTEXT, CreateLockedInteger(A_CHARTEXT));
-    insert(DISH_LANGID_TEXTIO_ATTR_COLOR, CreateLockedInteger(A_COLOR));
-    insert(DISH_LANGID_TEXTIO_ATTR_STANDOUT, CreateLockedInteger(A_STANDOUT));
-    insert(DISH_LANGID_TEXTIO_ATTR_UNDERLINE, CreateLockedInteger(A_UNDERLINE));
-    insert(DISH_LANGID_TEXTIO_ATTR_REVERSE, CreateLockedInteger(A_REVERSE));
-    insert(DISH_LANGID_TEXTIO_ATTR_BLINK, CreateLockedInteger(A_BLINK));
-    insert(DISH_LANGID_TEXTIO_ATTR_DIM, CreateLockedInteger(A_DIM));
-    insert(DISH_LANGID_TEXTIO_ATTR_BOLD, CreateLockedInteger(A_BOLD));
-    insert(DISH_LANGID_TEXTIO_ATTR_ALTCHARSET, CreateLockedInteger(A_ALTCHARSET));
-    insert(DISH_LANGID_TEXTIO_ATTR_INVIS, CreateLockedInteger(A_INVIS));
-    insert(DISH_LANGID_TEXTIO_ATTR_PROTECT, CreateLockedInteger(A_PROTECT));
-    insert(DISH_LANGID_TEXTIO_ATTR_HORIZONTAL, CreateLockedInteger(A_HORIZONTAL));
-    insert(DISH_LANGID_TEXTIO_ATTR_LEFT, CreateLockedInteger(A_LEFT));
-    insert(DISH_LANGID_TEXTIO_ATTR_LOW, CreateLockedInteger(A_LOW));
-    insert(DISH_LANGID_TEXTIO_ATTR_RIGHT, CreateLockedInteger(A_RIGHT));
-    insert(DISH_LANGID_TEXTIO_ATTR_TOP, CreateLockedInteger(A_TOP));
-    insert(DISH_LANGID_TEXTIO_ATTR_VERTICAL, CreateLockedInteger(A_VERTICAL));
-    
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_A, CreateLockedInteger(1));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_B, CreateLockedInteger(2));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_C, CreateLockedInteger(3));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_D, CreateLockedInteger(4));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_E, CreateLockedInteger(5));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_F, CreateLockedInteger(6));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_G, CreateLockedInteger(7));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_H, CreateLockedInteger(8));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_I, CreateLockedInteger(9));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_J, CreateLockedInteger(10));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_K, CreateLockedInteger(11));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_L, CreateLockedInteger(12));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_M, CreateLockedInteger(13));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_N, CreateLockedInteger(14));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_O, CreateLockedInteger(15));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_P, CreateLockedInteger(16));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_Q, CreateLockedInteger(17));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_R, CreateLockedInteger(18));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_S, CreateLockedInteger(19));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_T, CreateLockedInteger(20));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_U, CreateLockedInteger(21));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_V, CreateLockedInteger(22));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_W, CreateLockedInteger(23));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_X, CreateLockedInteger(24));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_Y, CreateLockedInteger(25));
-    insert(DISH_LANGID_TEXTIO_KEY_CTRL_Z, CreateLockedInteger(26));
-    insert(DISH_LANGID_TEXTIO_KEY_ESC, CreateLockedInteger(27));
-    insert(DISH_LANGID_TEXTIO_KEY_DOWN, CreateLockedInteger(KEY_DOWN));
-    insert(DISH_LANGID_TEXTIO_KEY_UP, CreateLockedInteger(KEY_UP));
-    insert(DISH_LANGID_TEXTIO_KEY_LEFT, CreateLockedInteger(KEY_LEFT));
-    insert(DISH_LANGID_TEXTIO_KEY_RIGHT, CreateLockedInteger(KEY_RIGHT));
-    insert(DISH_LANGID_TEXTIO_KEY_HOME, CreateLockedInteger(KEY_HOME));
-    insert(DISH_LANGID_TEXTIO_KEY_BACKSPACE, CreateLockedInteger(KEY_BACKSPACE));
-    insert(DISH_LANGID_TEXTIO_KEY_F1, CreateLockedInteger(KEY_F(1)));
-    insert(DISH_LANGID_TEXTIO_KEY_F2, CreateLockedInteger(KEY_F(2)));
-    insert(DISH_LANGID_TEXTIO_KEY_F3, CreateLockedInteger(KEY_F(3)));
-    insert(DISH_LANGID_TEXTIO_KEY_F4, CreateLockedInteger(KEY_F(4)));
-    insert(DISH_LANGID_TEXTIO_KEY_F5, CreateLockedInteger(KEY_F(5)));
-    insert(DISH_LANGID_TEXTIO_KEY_F6, CreateLockedInteger(KEY_F(6)));
-    insert(DISH_LANGID_TEXTIO_KEY_F7, CreateLockedInteger(KEY_F(7)));
-    insert(DISH_LANGID_TEXTIO_KEY_F8, CreateLockedInteger(KEY_F(8)));
-    insert(DISH_LANGID_TEXTIO_KEY_F9, CreateLockedInteger(KEY_F(9)));
-    insert(DISH_LANGID_TEXTIO_KEY_F10, CreateLockedInteger(KEY_F(10)));
-    insert(DISH_LANGID_TEXTIO_KEY_F11, CreateLockedInteger(KEY_F(11)));
-    insert(DISH_LANGID_TEXTIO_KEY_F12, CreateLockedInteger(KEY_F(12)));
-    insert(DISH_LANGID_TEXTIO_KEY_DELETE_LINE, CreateLockedInteger(KEY_DL));
-    insert(DISH_LANGID_TEXTIO_KEY_INSERT_LINE, CreateLockedInteger(KEY_IL));
-    insert(DISH_LANGID_TEXTIO_KEY_DELETE_CHAR, CreateLockedInteger(KEY_DC));
-    insert(DISH_LANGID_TEXTIO_KEY_INSERT_CHAR, CreateLockedInteger(KEY_IC));
-    
-    insert(DISH_LANGID_TEXTIO_Start, TEXTIO_StartFunction::MakeValue());
-    insert(DISH_LANGID_TEXTIO_IsStarted, TEXTIO_IsStartedFunction::MakeValue());
-    insert(DISH_LANGID_TEXTIO_Refresh, TEXTIO_RefreshFunction::MakeValue());
-    insert(DISH_LANGID_TEXTIO_Clear, TEXTIO_ClearFunction::MakeValue());
-    insert(DISH_LANGID_TEXTIO_End, TEXTIO_EndFunction::MakeValue());
-    
-    insert(DISH_LANGID_TEXTIO_GetXSize, TEXTIO_GetXSizeFunction::MakeValue());
-    insert(DISH_LANGID_TEXTIO_GetYSize, TEXTIO_GetYSizeFunction::MakeValue());
-    insert(DISH_LANGID_TEXTIO_MoveTo, TEXTIO_MoveToFunction::MakeValue());
-    
-    insert(DISH_LANGID_TEXTIO_AttrNormal, TEXTIO_AttrNormalFunction::MakeValue());
-    insert(DISH_LANGID_TEXTIO_AttrGet, TEXTIO_AttrGetFunction::MakeValue());
-    insert(DISH_LANGID_TEXTIO_AttrSet, TEXTIO_AttrSetFunction::MakeValue());
-    insert(DISH_LANGID_TEXTIO_AttrOn, TEXTIO_AttrOnFunction::MakeValue());
-    insert(DISH_LANGID_TEXTIO_AttrOff, TEXTIO_AttrOffFunction::MakeValue());
-    insert(DISH_LANGID_TEXTIO_SetForegroundColor, TEXTIO_SetForegroundColorFunction::MakeValue());
-    insert(DISH_LANGID_TEXTIO_GetForegroundColor, TEXTIO_GetForegroundColorFunction::MakeValue());
-    insert(DISH_LANGID_TEXTIO_SetBackgroundColor, TEXTIO_SetBackgroundColorFunction::MakeValue());
-    insert(DISH_LANGID_TEXTIO_GetBackgroundColor, TEXTIO_GetBackgroundColorFunction::MakeValue());
-    insert(DISH_LANGID_TEXTIO_SetColor, TEXTIO_SetColorFunction::MakeValue());
-    
-    insert(DISH_LANGID_TEXTIO_VISIBLE, BooleanValue::MakeLockedValue(true));
-    insert(DISH_LANGID_TEXTIO_INVISIBLE, BooleanValue::MakeLockedValue(false));
-    insert(DISH_LANGID_TEXTIO_SetCursor, TEXTIO_SetCursorFunction::MakeValue());
-    
 #else
 
-    insert(DISH_LANGID_IS_LIB_TEXTIO, BooleanValue::MakeLockedValue(false));
-    
+    const BuiltinT TextIOLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_TEXTIO, [] { return CreateLockedBoolean(false); } },
+    };
+
 #endif
     
-    ///////////////
-    
 #ifdef LANG_LIB_NETWORK
 
-    insert(DISH_LANGID_IS_LIB_NETWORK, BooleanValue::MakeLockedValue(true));
-    
-    ///////////////
+    const BuiltinT NetworkLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_NETWORK, [] { return CreateLockedBoolean(true); } },
+        
+        { DISH_LANGID_MAX_OPEN_SOCKETS, [] { return CreateLockedInteger(dish::SocketList::MAX_OPEN_SOCKETS); } },
+        
+        { DISH_LANGID_NETWORK_IPV4, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::SocketList::ipv4)); } },
+        { DISH_LANGID_NETWORK_IPV6, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::SocketList::ipv6)); } },
+    };
 
-    insert(DISH_LANGID_MAX_OPEN_SOCKETS, CreateLockedInteger(SocketList::MAX_OPEN_SOCKETS));
-    
-    insert(DISH_LANGID_NETWORK_IPV4, CreateLockedInteger(static_cast< IntegerT >(SocketList::ipv4)));
-    insert(DISH_LANGID_NETWORK_IPV6, CreateLockedInteger(static_cast< IntegerT >(SocketList::ipv6)));
-    
-    insert(DISH_LANGID_NetworkOpenClientSocket, NetworkOpenClientSocketFunction::MakeValue());
-    insert(DISH_LANGID_NetworkOpenClientSocket, NetworkOpenClientSocket2Function::MakeValue());
-    insert(DISH_LANGID_NetworkOpenClientSocket, NetworkOpenClientSocket3Function::MakeValue());
-    
-    insert(DISH_LANGID_NetworkOpenServerSocket, NetworkOpenServerSocketFunction::MakeValue());
-    
-    insert(DISH_LANGID_NetworkNumOpenSockets, NetworkNumOpenSocketsFunction::MakeValue());
-    insert(DISH_LANGID_NetworkNumOpenClientSockets, NetworkNumOpenClientSocketsFunction::MakeValue());
-    insert(DISH_LANGID_NetworkNumOpenServerSockets, NetworkNumOpenServerSocketsFunction::MakeValue());
-    
-    insert(DISH_LANGID_NetworkReadSocket, NetworkReadSocketFunction::MakeValue());
-    insert(DISH_LANGID_NetworkWriteSocket, NetworkWriteSocketFunction::MakeValue());
-    
-    insert(DISH_LANGID_NetworkCloseSocket, NetworkCloseSocketFunction::MakeValue());
-    insert(DISH_LANGID_NetworkCloseSocket, NetworkCloseSocket1Function::MakeValue());
-    
 #else
 
-    insert(DISH_LANGID_IS_LIB_NETWORK, BooleanValue::MakeLockedValue(false));
-    
+    const BuiltinT NetworkLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_NETWORK, [] { return CreateLockedBoolean(false); } },
+    };
+
 #endif
     
-    ///////////////
-    
 #ifdef LANG_LIB_FILESYS
 
-    insert(DISH_LANGID_IS_LIB_FILESYS, BooleanValue::MakeLockedValue(true));
-    
-    ///////////////
-    
-    insert(DISH_LANGID_FileSysFileT, CreateFileSysFileT());
-    insert(DISH_LANGID_FileSysDirT, CreateFileSysDirT());
-    insert(DISH_LANGID_FileInfoT, CreateFileInfoT());
-    
-    insert(DISH_LANGID_FILESYS_NORECURSE, BooleanValue::MakeLockedValue(false));
-    insert(DISH_LANGID_FILESYS_RECURSE, BooleanValue::MakeLockedValue(true));
-    
-    insert(DISH_LANGID_FILESYS_FileExistsFunction, FILESYS_FileExistsFunction::MakeValue());
-    insert(DISH_LANGID_FILESYS_ReadLocation, FILESYS_ReadLocationFunction::MakeValue());
-    insert(DISH_LANGID_FILESYS_ReadFiles, FILESYS_ReadFilesFunction::MakeValue());
-    insert(DISH_LANGID_FILESYS_ReadDirectories, FILESYS_ReadDirectoriesFunction::MakeValue());
-    insert(DISH_LANGID_FILESYS_GetFileInfo, FILESYS_GetFileInfoFunction::MakeValue());
-    insert(DISH_LANGID_FILESYS_PrintPathTree, FILESYS_PrintPathTree1Function::MakeValue());
-    insert(DISH_LANGID_FILESYS_PrintPathTree, FILESYS_PrintPathTreeFunction::MakeValue());
-    
+    const BuiltinT FileSysLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_FILESYS, [] { return CreateLockedBoolean(true); } },
+        
+        { DISH_LANGID_FileSysFileT, dish::CreateFileSysFileT },
+        { DISH_LANGID_FileSysDirT, dish::CreateFileSysDirT },
+        { DISH_LANGID_FileInfoT, dish::CreateFileInfoT },
+        
+        { DISH_LANGID_FILESYS_NORECURSE, [] { return CreateLockedBoolean(false); } },
+        { DISH_LANGID_FILESYS_RECURSE, [] { return CreateLockedBoolean(true); } },
+    };
+
 #else
 
-    insert(DISH_LANGID_IS_LIB_FILESYS, BooleanValue::MakeLockedValue(false));
-    
+    const BuiltinT FileSysLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_FILESYS, [] { return CreateLockedBoolean(false); } },
+    };
+
 #endif
     
-    ///////////////
-    
 #ifdef LANG_LIB_DATABASE
 
-    insert(DISH_LANGID_IS_LIB_DATABASE, BooleanValue::MakeLockedValue(true));
-    
-    insert(
-        DISH_LANGID_IS_LIB_DATABASE_MYSQL,
-        BooleanValue::MakeLockedValue(
+    const BuiltinT DatabaseLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_DATABASE, [] { return CreateLockedBoolean(true); } },
+        
 #ifdef MYSQLDB
-            true
-#else
-            false
-#endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_IS_LIB_DATABASE_POSTGRESQL,
-        BooleanValue::MakeLockedValue(
+        { DISH_LANGID_IS_LIB_DATABASE_MYSQL, [] { return CreateLockedBoolean(true); } },
+#else
+        { DISH_LANGID_IS_LIB_DATABASE_MYSQL, [] { return CreateLockedBoolean(false); } },
+#endif
+        
 #ifdef POSTGRESQLDB
-            true
+        { DISH_LANGID_IS_LIB_DATABASE_POSTGRESQL, [] { return CreateLockedBoolean(true); } },
 #else
-            false
+        { DISH_LANGID_IS_LIB_DATABASE_POSTGRESQL, [] { return CreateLockedBoolean(false); } },
 #endif
-        )
-    );
-    
-    insert(DISH_LANGID_DB_ConnectionParametersT, CreateDbConnectionParametersType());
-    
-    insert(DISH_LANGID_DB_TYPE_MYSQL, CreateLockedInteger(DbConnectionFactory::DB_CONNECTION_TYPE_MYSQL));
-    insert(DISH_LANGID_DB_TYPE_POSTGRESQL, CreateLockedInteger(DbConnectionFactory::DB_CONNECTION_TYPE_POSTGRESQL));
-    
-    insert(DISH_LANGID_DB_MAX_CONNECTIONS, CreateLockedInteger(DbConnectionFactory::DB_MAX_CONNECTIONS));
-    
-    insert(DISH_LANGID_DB_VALIDATE, BooleanValue::MakeLockedValue(true));
-    insert(DISH_LANGID_DB_NO_VALIDATE, BooleanValue::MakeLockedValue(false));
-    
-    insert(DISH_LANGID_DB_MakeDefaultConnectionParameters, DbMakeDefaultConnectionParametersFunction::MakeValue());
-    insert(DISH_LANGID_DB_MakeDefaultConnectionParameters, DbMakeDefaultConnectionParameters2Function::MakeValue());
-    
-    insert(DISH_LANGID_DB_OpenConnection, DbOpenConnectionFunction::MakeValue());
-    insert(DISH_LANGID_DB_CloseConnection, DbCloseConnectionFunction::MakeValue());
-    insert(DISH_LANGID_DB_CloseAllConnections, DbCloseAllConnectionsFunction::MakeValue());
-    
-    insert(DISH_LANGID_DB_IsOpen, DbNumOpenConnectionsFunction::MakeValue());
-    insert(DISH_LANGID_DB_NumOpenConnections, DbNumOpenConnectionsFunction::MakeValue());
-    insert(DISH_LANGID_DB_NumOpenConnections, DbNumOpenConnections1Function::MakeValue());
-    
-    insert(DISH_LANGID_DB_ServerVersion, DbServerVersionFunction::MakeValue());
-    
-    insert(DISH_LANGID_DB_IssueQuery, DbIssueQueryFunction::MakeValue());
-    
+        
+        { DISH_LANGID_DB_ConnectionParametersT, dish::CreateDbConnectionParametersType },
+        
+        { DISH_LANGID_DB_TYPE_MYSQL, [] { return CreateLockedInteger(dish::DbConnectionFactory::DB_CONNECTION_TYPE_MYSQL); } },
+        { DISH_LANGID_DB_TYPE_POSTGRESQL, [] { return CreateLockedInteger(dish::DbConnectionFactory::DB_CONNECTION_TYPE_POSTGRESQL); } },
+        
+        { DISH_LANGID_DB_MAX_CONNECTIONS, [] { return CreateLockedInteger(dish::DbConnectionFactory::DB_MAX_CONNECTIONS); } },
+        
+        { DISH_LANGID_DB_VALIDATE, [] { return CreateLockedBoolean(true); } },
+        { DISH_LANGID_DB_NO_VALIDATE, [] { return CreateLockedBoolean(false); } },
+    };
+
 #else
 
-    insert(DISH_LANGID_IS_LIB_DATABASE, BooleanValue::MakeLockedValue(false));
-    
-    insert(DISH_LANGID_IS_LIB_DATABASE_MYSQL, BooleanValue::MakeLockedValue(false));
-    insert(DISH_LANGID_IS_LIB_DATABASE_POSTGRESQL, BooleanValue::MakeLockedValue(false));
-    
+    const BuiltinT DatabaseLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_DATABASE, [] { return CreateLockedBoolean(false); } },
+        
+        { DISH_LANGID_IS_LIB_DATABASE_MYSQL, [] { return CreateLockedBoolean(false); } },
+        { DISH_LANGID_IS_LIB_DATABASE_POSTGRESQL, [] { return CreateLockedBoolean(false); } },
+    };
+
 #endif
     
-    ///////////////
-    
 #ifdef LANG_LIB_REGULAR_EXPRESSION
 
-    insert(DISH_LANGID_IS_LIB_IS_REGEX, BooleanValue::MakeLockedValue(true));
-    
-    insert(DISH_LANGID_REGEX_MAX_REGEX, CreateLockedInteger(REGEX_MAX_NUM_HANDLES));
-    
-    insert(DISH_LANGID_REGEX_CreateFunction, CreateRegularExpressionFunction::MakeValue());
-    insert(DISH_LANGID_REGEX_NumCreatedFunction, NumCreatedRegularExpressionFunction::MakeValue());
-    insert(DISH_LANGID_REGEX_IsCreatedFunction, IsCreatedRegularExpressionFunction::MakeValue());
-    insert(DISH_LANGID_REGEX_DestroyFunction, DestroyRegularExpressionFunction::MakeValue());
-    insert(DISH_LANGID_REGEX_DestroyAllFunction, DestroyAllRegularExpressionFunction::MakeValue());
-    
-    insert(DISH_LANGID_REGEX_MatchFunction, MatchRegularExpressionFunction::MakeValue());
-    insert(DISH_LANGID_REGEX_ReplaceNextFunction, ReplaceNextRegularExpressionFunction::MakeValue());
-    insert(DISH_LANGID_REGEX_ReplaceAllFunction, ReplaceAllRegularExpressionFunction::MakeValue());
-    
+    const BuiltinT RegularExpressionLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_IS_REGEX, [] { return CreateLockedBoolean(true); } },
+        
+        { DISH_LANGID_REGEX_MAX_REGEX, [] { return CreateLockedInteger(REGEX_MAX_NUM_HANDLES); } },
+    };
+
 #else
 
-    insert(DISH_LANGID_IS_LIB_IS_REGEX, BooleanValue::MakeLockedValue(false));
+    const BuiltinT RegularExpressionLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_IS_REGEX, [] { return CreateLockedBoolean(false); } },
+    };
 
 #endif
     
-    ///////////////
-    
 #ifdef LANG_LIB_RS232
 
-    insert(DISH_LANGID_IS_LIB_RS232, BooleanValue::MakeLockedValue(true));
-    
-    insert(DISH_LANGID_RS232_MAX_OPEN, CreateLockedInteger(RS232_MAX_NUM_HANDLES));
-    
-    ////
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_50, 
-        CreateLockedInteger(
+    const BuiltinT Rs232Library[] =
+    {
+        { DISH_LANGID_IS_LIB_RS232, [] { return CreateLockedBoolean(true); } },
+        
+        { DISH_LANGID_RS232_MAX_OPEN, [] { return CreateLockedInteger(RS232_MAX_NUM_HANDLES); } },
+        
     #ifdef RS232_BAUDRATE_50_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_50)
+        { DISH_LANGID_RS232_BAUD_50, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_50)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_50, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_75, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_75_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_75)
+        { DISH_LANGID_RS232_BAUD_75, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_75)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_75, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_110, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_110_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_110)
+        { DISH_LANGID_RS232_BAUD_110, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_110)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_110, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_134, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_134_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_134)
+        { DISH_LANGID_RS232_BAUD_134, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_134)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_134, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_150, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_150_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_150)
+        { DISH_LANGID_RS232_BAUD_150, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_150)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_150, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_200, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_200_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_200)
+        { DISH_LANGID_RS232_BAUD_200, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_200)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_200, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_300, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_300_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_300)
+        { DISH_LANGID_RS232_BAUD_300, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_300)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_300, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_600, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_600_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_600)
+        { DISH_LANGID_RS232_BAUD_600, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_600)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_600, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_1200, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_1200_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_1200)
+        { DISH_LANGID_RS232_BAUD_1200, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_1200)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_1200, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_1800, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_1800_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_1800)
+        { DISH_LANGID_RS232_BAUD_1800, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_1800)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_1800, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_2400, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_2400_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_2400)
+        { DISH_LANGID_RS232_BAUD_2400, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_2400)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_2400, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_9600, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_9600_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_9600)
+        { DISH_LANGID_RS232_BAUD_9600, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_9600)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_9600, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_19200, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_19200_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_19200)
+        { DISH_LANGID_RS232_BAUD_19200, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_19200)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_19200, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_38400, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_38400_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_38400)
+        { DISH_LANGID_RS232_BAUD_38400, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_38400)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_38400, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_57600, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_57600_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_57600)
+        { DISH_LANGID_RS232_BAUD_57600, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_57600)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_57600, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_115200, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_115200_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_115200)
+        { DISH_LANGID_RS232_BAUD_115200, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_115200)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_115200, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_230400, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_230400_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_230400)
+        { DISH_LANGID_RS232_BAUD_230400, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_230400)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_230400, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_460800, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_460800_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_460800)
+        { DISH_LANGID_RS232_BAUD_460800, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_460800)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_460800, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_500000, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_500000_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_500000)
+        { DISH_LANGID_RS232_BAUD_500000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_500000)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_500000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_576000, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_576000_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_576000)
+        { DISH_LANGID_RS232_BAUD_576000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_576000)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_576000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_921600, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_921600_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_921600)
+        { DISH_LANGID_RS232_BAUD_921600, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_921600)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_921600, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_1000000, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_1000000_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_1000000)
+        { DISH_LANGID_RS232_BAUD_1000000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_1000000)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_1000000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_1152000, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_1152000_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_1152000)
+        { DISH_LANGID_RS232_BAUD_1152000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_1152000)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_1152000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_1500000, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_1500000_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_1500000)
+        { DISH_LANGID_RS232_BAUD_1500000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_1500000)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_1500000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_2000000, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_2000000_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_2000000)
+        { DISH_LANGID_RS232_BAUD_2000000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_2000000)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_2000000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_2500000, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_2500000_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_2500000)
+        { DISH_LANGID_RS232_BAUD_2500000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_2500000)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_2500000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_3000000, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_3000000_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_3000000)
+        { DISH_LANGID_RS232_BAUD_3000000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_3000000)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_3000000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_3500000, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_3500000_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_3500000)
+        { DISH_LANGID_RS232_BAUD_3500000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_3500000)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_3500000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_BAUD_4000000, 
-        CreateLockedInteger(
+        
     #ifdef RS232_BAUDRATE_4000000_SUPPORTED
-            static_cast< IntegerT >(RS232_BAUD_RATE_4000000)
+        { DISH_LANGID_RS232_BAUD_4000000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_4000000)); } },
     #else
-            static_cast< IntegerT >(RS232_BAUD_RATE_NULL)
+        { DISH_LANGID_RS232_BAUD_4000000, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_BAUD_RATE_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(DISH_LANGID_RS232_BaudRateSupported, Rs232BaudRateSupportedFunction::MakeValue());
-    
-    ////
-    
-    insert(
-        DISH_LANGID_RS232_DATA_BITS_5, 
-        CreateLockedInteger(
+        
     #ifdef RS232_DATABITS_5_SUPPORTED
-            static_cast< IntegerT >(RS232_DATA_BITS_5)
+        { DISH_LANGID_RS232_DATA_BITS_5, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_DATA_BITS_5)); } },
     #else
-            static_cast< IntegerT >(RS232_DATA_BITS_NULL)
+        { DISH_LANGID_RS232_DATA_BITS_5, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_DATA_BITS_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_DATA_BITS_6, 
-        CreateLockedInteger(
+        
     #ifdef RS232_DATABITS_6_SUPPORTED
-            static_cast< IntegerT >(RS232_DATA_BITS_6)
+        { DISH_LANGID_RS232_DATA_BITS_6, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_DATA_BITS_6)); } },
     #else
-            static_cast< IntegerT >(RS232_DATA_BITS_NULL)
+        { DISH_LANGID_RS232_DATA_BITS_6, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_DATA_BITS_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_DATA_BITS_7, 
-        CreateLockedInteger(
+        
     #ifdef RS232_DATABITS_7_SUPPORTED
-            static_cast< IntegerT >(RS232_DATA_BITS_7)
+        { DISH_LANGID_RS232_DATA_BITS_7, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_DATA_BITS_7)); } },
     #else
-            static_cast< IntegerT >(RS232_DATA_BITS_NULL)
+        { DISH_LANGID_RS232_DATA_BITS_7, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_DATA_BITS_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_DATA_BITS_8, 
-        CreateLockedInteger(
+        
     #ifdef RS232_DATABITS_8_SUPPORTED
-            static_cast< IntegerT >(RS232_DATA_BITS_8)
+        { DISH_LANGID_RS232_DATA_BITS_8, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_DATA_BITS_8)); } },
     #else
-            static_cast< IntegerT >(RS232_DATA_BITS_NULL)
+        { DISH_LANGID_RS232_DATA_BITS_8, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_DATA_BITS_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(DISH_LANGID_RS232_DataBitsSupported, Rs232DataBitsSupportedFunction::MakeValue());
-    
-    ////
-    
-    insert(
-        DISH_LANGID_RS232_PARITY_NO, 
-        CreateLockedInteger(
-    #ifdef RS232_PARITY_NO_SUPPORTED
-            static_cast< IntegerT >(RS232_PARITY_NO)
+        
+    #ifdef dish::RS232_PARITY_NO_SUPPORTED
+        { DISH_LANGID_RS232_PARITY_NO, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_PARITY_NO)); } },
     #else
-            static_cast< IntegerT >(RS232_PARITY_NULL)
+        { DISH_LANGID_RS232_PARITY_NO, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_PARITY_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_PARITY_ODD, 
-        CreateLockedInteger(
-    #ifdef RS232_PARITY_ODD_SUPPORTED
-            static_cast< IntegerT >(RS232_PARITY_ODD)
+        
+    #ifdef dish::RS232_PARITY_ODD_SUPPORTED
+        { DISH_LANGID_RS232_PARITY_ODD, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_PARITY_ODD)); } },
     #else
-            static_cast< IntegerT >(RS232_PARITY_NULL)
+        { DISH_LANGID_RS232_PARITY_ODD, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_PARITY_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(
-        DISH_LANGID_RS232_PARITY_EVEN, 
-        CreateLockedInteger(
-    #ifdef RS232_PARITY_EVEN_SUPPORTED
-            static_cast< IntegerT >(RS232_PARITY_EVEN)
+        
+    #ifdef dish::RS232_PARITY_EVEN_SUPPORTED
+        { DISH_LANGID_RS232_PARITY_EVEN, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_PARITY_EVEN)); } },
     #else
-            static_cast< IntegerT >(RS232_PARITY_NULL)
+        { DISH_LANGID_RS232_PARITY_EVEN, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_PARITY_NULL)); } },
     #endif
-        )
-    );
-    
-    insert(DISH_LANGID_RS232_ParitySupported, Rs232ParitySupportedFunction::MakeValue());
+        
+    #ifdef RS232_STOPBITS_1_SUPPORTED
+        { DISH_LANGID_RS232_STOP_BITS_1, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_STOP_BITS_1)); } },
+    #else
+        { DISH_LANGID_RS232_STOP_BITS_1, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_STOP_BITS_NULL)); } },
+    #endif
+        
+    #ifdef RS232_STOPBITS_2_SUPPORTED
+        { DISH_LANGID_RS232_STOP_BITS_2, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_STOP_BITS_2)); } },
+    #else
+        { DISH_LANGID_RS232_STOP_BITS_2, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_STOP_BITS_NULL)); } },
+    #endif
+        
+    #ifdef RS232_FLOWCONTROL_NONE_SUPPORTED
+        { DISH_LANGID_RS232_FLOWCTRL_NONE, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_FLOWCTRL_NONE)); } },
+    #else
+        { DISH_LANGID_RS232_FLOWCTRL_NONE, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_FLOWCTRL_NULL)); } },
+    #endif
+        
+    #ifdef RS232_FLOWCONTROL_SOFTWARE_SUPPORTED
+        { DISH_LANGID_RS232_FLOWCTRL_SOFTWARE, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_FLOWCTRL_SOFTWARE)); } },
+    #else
+        { DISH_LANGID_RS232_FLOWCTRL_SOFTWARE, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_FLOWCTRL_NULL)); } },
+    #endif
+        
+    #ifdef RS232_FLOWCONTROL_HARDWARE_SUPPORTED
+        { DISH_LANGID_RS232_FLOWCTRL_HARDWARE, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_FLOWCTRL_HARDWARE)); } },
+    #else
+        { DISH_LANGID_RS232_FLOWCTRL_HARDWARE, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::RS232_FLOWCTRL_NULL)); } },
+    #endif
+        
+        { DISH_LANGID_RS232_ConfigurationT, dish::CreateRs232ConfigurationStructure },
+    };
+
+#else
+
+    const BuiltinT Rs232Library[] =
+    {
+        { DISH_LANGID_IS_LIB_RS232, [] { return CreateLockedBoolean(false); } },
+    };
+
+#endif
     
-    ////
+#ifdef LANG_LIB_DEBUG
+
+    const BuiltinT DebugLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_DEBUG, [] { return CreateLockedBoolean(true); } },
+        
+        { DISH_LANGID_DEBUG_INFINITE_STACK_DEPTH, [] { return CreateLockedInteger(dish::StackedSymbolTable::INFINITE_STACK_DEPTH); } },
+        
+        { DISH_LANGID_DEBUG_DEFAULT_LOGFILE, [] { return CreateLockedString("logfile.txt"); } },
+    };
+
+#else
+
+    const BuiltinT DebugLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_DEBUG, [] { return CreateLockedBoolean(false); } },
+    };
+
+#endif
     
-    insert(
-        DISH_LANGID_RS232_STOP_BITS_1, 
-        CreateLockedInteger(
-    #ifdef RS232_STOPBITS_1_SUPPORTED
-            static_cast< IntegerT >(RS232_STOP_BITS_1)
+#ifdef LANG_LIB_GRAPH
+
+    const BuiltinT GraphLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_GRAPH, [] { return CreateLockedBoolean(true); } },
+        
+        { DISH_LANGID_GRAPH_ContextT, dish::GRAPH_CreateGraphicsContextType },
+        
+        { DISH_LANGID_GRAPH_IntegerPointT, dish::GRAPH_CreateIntegerPointType },
+        { DISH_LANGID_GRAPH_RealPointT, dish::GRAPH_CreateRealPointType },
+        
+        { DISH_LANGID_GRAPH_IntegerLineT, dish::GRAPH_CreateIntegerLineType },
+        { DISH_LANGID_GRAPH_RealLineT, dish::GRAPH_CreateRealLineType },
+        
+        { DISH_LANGID_GRAPH_FILL_STYLE_SOLID, [] { return CreateLockedInteger(dish::GRAPH_FillStyle_SOLID); } },
+        { DISH_LANGID_GRAPH_FILL_STYLE_TILED, [] { return CreateLockedInteger(dish::GRAPH_FillStyle_TILED); } },
+        { DISH_LANGID_GRAPH_FILL_STYLE_OPAQUE_STIPPLED, [] { return CreateLockedInteger(dish::GRAPH_FillStyle_OPAQUE_STIPPLED); } },
+        { DISH_LANGID_GRAPH_FILL_STYLE_STIPPLED, [] { return CreateLockedInteger(dish::GRAPH_FillStyle_STIPPLED); } },
+        
+        { DISH_LANGID_GRAPH_LINE_STYLE_SOLID, [] { return CreateLockedInteger(dish::GRAPH_LineStyle_SOLID); } },
+        { DISH_LANGID_GRAPH_LINE_STYLE_DASHED, [] { return CreateLockedInteger(dish::GRAPH_LineStyle_DASHED); } },
+        { DISH_LANGID_GRAPH_LINE_STYLE_DOUBLE_DASHED, [] { return CreateLockedInteger(dish::GRAPH_LineStyle_DOUBLE_DASHED); } },
+        
+        { DISH_LANGID_GRAPH_LINE_CAP_NOT_LAST, [] { return CreateLockedInteger(dish::GRAPH_LineCap_NOT_LAST); } },
+        { DISH_LANGID_GRAPH_LINE_CAP_BUTT, [] { return CreateLockedInteger(dish::GRAPH_LineCap_BUTT); } },
+        { DISH_LANGID_GRAPH_LINE_CAP_ROUND, [] { return CreateLockedInteger(dish::GRAPH_LineCap_ROUND); } },
+        { DISH_LANGID_GRAPH_LINE_CAP_PROJECTING, [] { return CreateLockedInteger(dish::GRAPH_LineCap_PROJECTING); } },
+        
+        { DISH_LANGID_GRAPH_LINE_JOIN_MITRE, [] { return CreateLockedInteger(dish::GRAPH_LineJoin_MITRE); } },
+        { DISH_LANGID_GRAPH_LINE_JOIN_ROUND, [] { return CreateLockedInteger(dish::GRAPH_LineJoin_ROUND); } },
+        { DISH_LANGID_GRAPH_LINE_JOIN_BEVEL, [] { return CreateLockedInteger(dish::GRAPH_LineJoin_BEVEL); } },
+        
+        { DISH_LANGID_GRAPH_NOFILL, [] { return CreateLockedBoolean(false); } },
+        { DISH_LANGID_GRAPH_FILL, [] { return CreateLockedBoolean(true); } },
+        
+        { DISH_LANGID_GRAPH_COLOR_BLACK, [] { return CreateGraphColor(0,0,0); } },
+        { DISH_LANGID_GRAPH_COLOR_RED, [] { return CreateGraphColor(255,0,0); } },
+        { DISH_LANGID_GRAPH_COLOR_GREEN, [] { return CreateGraphColor(0,128,0); } },
+        { DISH_LANGID_GRAPH_COLOR_BLUE, [] { return CreateGraphColor(0,128,0); } },
+        { DISH_LANGID_GRAPH_COLOR_LIGHT_RED, [] { return CreateGraphColor(230,211,211); } },
+        { DISH_LANGID_GRAPH_COLOR_LIGHT_GREEN, [] { return CreateGraphColor(211,230,211); } },
+        { DISH_LANGID_GRAPH_COLOR_LIGHT_BLUE, [] { return CreateGraphColor(211,211,230); } },
+        { DISH_LANGID_GRAPH_COLOR_LIGHT_GRAY, [] { return CreateGraphColor(211,211,211); } },
+        { DISH_LANGID_GRAPH_COLOR_DARK_GRAY, [] { return CreateGraphColor(169,169,169); } },
+        { DISH_LANGID_GRAPH_COLOR_ORANGE, [] { return CreateGraphColor(255,165,0); } },
+        { DISH_LANGID_GRAPH_COLOR_BROWN, [] { return CreateGraphColor(165,42,42); } },
+        { DISH_LANGID_GRAPH_COLOR_YELLOW, [] { return CreateGraphColor(255,255,0); } },
+        { DISH_LANGID_GRAPH_COLOR_PURPLE, [] { return CreateGraphColor(128,0,128); } },
+        { DISH_LANGID_GRAPH_COLOR_CYAN, [] { return CreateGraphColor(0,255,255); } },
+        { DISH_LANGID_GRAPH_COLOR_VIOLET, [] { return CreateGraphColor(238,130,238); } },
+        { DISH_LANGID_GRAPH_COLOR_WHITE, [] { return CreateGraphColor(255,255,255); } },
+        
+    #ifdef LANG_LIB_GRAPH_ALL_COLORS
+        { DISH_LANGID_IS_LIB_GRAPH_ALL_COLORS, [] { return CreateLockedBoolean(true); } },
+        
+        { DISH_LANGID_GRAPH_COLOR_MAROON, [] { return CreateGraphColor(128,0,0); } },
+        { DISH_LANGID_GRAPH_COLOR_DARK_RED, [] { return CreateGraphColor(139,0,0); } },
+        { DISH_LANGID_GRAPH_COLOR_FIREBRICK, [] { return CreateGraphColor(178,34,34); } },
+        { DISH_LANGID_GRAPH_COLOR_CRIMSON, [] { return CreateGraphColor(220,20,60); } },
+        { DISH_LANGID_GRAPH_COLOR_TOMATO, [] { return CreateGraphColor(255,99,71); } },
+        { DISH_LANGID_GRAPH_COLOR_CORAL, [] { return CreateGraphColor(255,127,80); } },
+        { DISH_LANGID_GRAPH_COLOR_INDIAN_RED, [] { return CreateGraphColor(205,92,92); } },
+        { DISH_LANGID_GRAPH_COLOR_LIGHT_CORAL, [] { return CreateGraphColor(240,128,128); } },
+        { DISH_LANGID_GRAPH_COLOR_DARK_SALMON, [] { return CreateGraphColor(233,150,122); } },
+        { DISH_LANGID_GRAPH_COLOR_SALMON, [] { return CreateGraphColor(250,128,114); } },
+        { DISH_LANGID_GRAPH_COLOR_LIGHT_SALMON, [] { return CreateGraphColor(255,160,122); } },
+        { DISH_LANGID_GRAPH_COLOR_ORANGE_RED, [] { return CreateGraphColor(255,69,0); } },
+        { DISH_LANGID_GRAPH_COLOR_DARK_ORANGE, [] { return CreateGraphColor(255,140,0); } },
+        { DISH_LANGID_GRAPH_COLOR_GOLD, [] { return CreateGraphColor(255,215,0); } },
+        { DISH_LANGID_GRAPH_COLOR_DARK_GOLDEN_ROD, [] { return CreateGraphColor(184,134,11); } },
+        { DISH_LANGID_GRAPH_COLOR_GOLDEN_ROD, [] { return CreateGraphColor(218,165,32); } },
+        { DISH_LANGID_GRAPH_COLOR_PALE_GOLDEN_ROD, [] { return CreateGraphColor(238,232,170); } },
+        { DISH_LANGID_GRAPH_COLOR_DARK_KHAKI, [] { return CreateGraphColor(189,183,107); } },
+        { DISH_LANGID_GRAPH_COLOR_KHAKI, [] { return CreateGraphColor(240,230,140); } },
+        { DISH_LANGID_GRAPH_COLOR_OLIVE, [] { return CreateGraphColor(128,128,0); } },
+        { DISH_LANGID_GRAPH_COLOR_YELLOW_GREEN, [] { return CreateGraphColor(154,205,50); } },
+        { DISH_LANGID_GRAPH_COLOR_DARK_OLIVE_GREEN, [] { return CreateGraphColor(85,107,47); } },
+        { DISH_LANGID_GRAPH_COLOR_OLIVE_DRAB, [] { return CreateGraphColor(107,142,35); } },
+        { DISH_LANGID_GRAPH_COLOR_LAWN_GREEN, [] { return CreateGraphColor(124,252,0); } },
+        { DISH_LANGID_GRAPH_COLOR_CHART_REUSE, [] { return CreateGraphColor(127,255,0); } },
+        { DISH_LANGID_GRAPH_COLOR_GREEN_YELLOW, [] { return CreateGraphColor(173,255,47); } },
+        { DISH_LANGID_GRAPH_COLOR_DARK_GREEN, [] { return CreateGraphColor(0,100,0); } },
+        { DISH_LANGID_GRAPH_COLOR_FOREST_GREEN, [] { return CreateGraphColor(34,139,34); } },
+        { DISH_LANGID_GRAPH_COLOR_LIME, [] { return CreateGraphColor(0,255,0); } },
+        { DISH_LANGID_GRAPH_COLOR_LIME_GREEN, [] { return CreateGraphColor(50,205,50); } },
+        { DISH_LANGID_GRAPH_COLOR_PALE_GREEN, [] { return CreateGraphColor(152,251,152); } },
+        { DISH_LANGID_GRAPH_COLOR_DARK_SEA_GREEN, [] { return CreateGraphColor(143,188,143); } },
+        { DISH_LANGID_GRAPH_COLOR_MEDIUM_SPRING_GREEN, [] { return CreateGraphColor(0,250,154); } },
+        { DISH_LANGID_GRAPH_COLOR_SPRING_GREEN, [] { return CreateGraphColor(0,255,127); } },
+        { DISH_LANGID_GRAPH_COLOR_SEA_GREEN, [] { return CreateGraphColor(46,139,87); } },
+        { DISH_LANGID_GRAPH_COLOR_MEDIUM_AQUA_MARINE, [] { return CreateGraphColor(102,205,170); } },
+        { DISH_LANGID_GRAPH_COLOR_MEDIUM_SEA_GREEN, [] { return CreateGraphColor(60,179,113); } },
+        { DISH_LANGID_GRAPH_COLOR_LIGHT_SEA_GREEN, [] { return CreateGraphColor(32,178,170); } },
+        { DISH_LANGID_GRAPH_COLOR_DARK_SLATE_GRAY, [] { return CreateGraphColor(47,79,79); } },
+        { DISH_LANGID_GRAPH_COLOR_TEAL, [] { return CreateGraphColor(0,128,128); } },
+        { DISH_LANGID_GRAPH_COLOR_DARK_CYAN, [] { return CreateGraphColor(0,139,139); } },
+        { DISH_LANGID_GRAPH_COLOR_AQUA, [] { return CreateGraphColor(0,255,255); } },
+        { DISH_LANGID_GRAPH_COLOR_LIGHT_CYAN, [] { return CreateGraphColor(224,255,255); } },
+        { DISH_LANGID_GRAPH_COLOR_DARK_TURQUOISE, [] { return CreateGraphColor(0,206,209); } },
+        { DISH_LANGID_GRAPH_COLOR_TURQUOISE, [] { return CreateGraphColor(64,224,208); } },
+        { DISH_LANGID_GRAPH_COLOR_MEDIUM_TURQUOISE, [] { return CreateGraphColor(72,209,204); } },
+        { DISH_LANGID_GRAPH_COLOR_PALE_TURQUOISE, [] { return CreateGraphColor(175,238,238); } },
+        { DISH_LANGID_GRAPH_COLOR_AQUA_MARINE, [] { return CreateGraphColor(127,255,212); } },
+        { DISH_LANGID_GRAPH_COLOR_POWDER_BLUE, [] { return CreateGraphColor(176,224,230); } },
+        { DISH_LANGID_GRAPH_COLOR_CADET_BLUE, [] { return CreateGraphColor(95,158,160); } },
+        { DISH_LANGID_GRAPH_COLOR_STEEL_BLUE, [] { return CreateGraphColor(70,130,180); } },
+        { DISH_LANGID_GRAPH_COLOR_CORN_FLOWER_BLUE, [] { return CreateGraphColor(100,149,237); } },
+        { DISH_LANGID_GRAPH_COLOR_DEEP_SKY_BLUE, [] { return CreateGraphColor(0,191,255); } },
+        { DISH_LANGID_GRAPH_COLOR_DODGER_BLUE, [] { return CreateGraphColor(30,144,255); } },
+        { DISH_LANGID_GRAPH_COLOR_SKY_BLUE, [] { return CreateGraphColor(135,206,235); } },
+        { DISH_LANGID_GRAPH_COLOR_LIGHT_SKY_BLUE, [] { return CreateGraphColor(135,206,250); } },
+        { DISH_LANGID_GRAPH_COLOR_MIDNIGHT_BLUE, [] { return CreateGraphColor(25,25,112); } },
+        { DISH_LANGID_GRAPH_COLOR_NAVY, [] { return CreateGraphColor(0,0,128); } },
+        { DISH_LANGID_GRAPH_COLOR_DARK_BLUE, [] { return CreateGraphColor(0,0,139); } },
+        { DISH_LANGID_GRAPH_COLOR_MEDIUM_BLUE, [] { return CreateGraphColor(0,0,205); } },
+        { DISH_LANGID_GRAPH_COLOR_ROYAL_BLUE, [] { return CreateGraphColor(65,105,225); } },
+        { DISH_LANGID_GRAPH_COLOR_BLUE_VIOLET, [] { return CreateGraphColor(138,43,226); } },
+        { DISH_LANGID_GRAPH_COLOR_INDIGO, [] { return CreateGraphColor(75,0,130); } },
+        { DISH_LANGID_GRAPH_COLOR_DARK_SLATE_BLUE, [] { return CreateGraphColor(72,61,139); } },
+        { DISH_LANGID_GRAPH_COLOR_SLATE_BLUE, [] { return CreateGraphColor(106,90,205); } },
+        { DISH_LANGID_GRAPH_COLOR_MEDIUM_SLATE_BLUE, [] { return CreateGraphColor(123,104,238); } },
+        { DISH_LANGID_GRAPH_COLOR_MEDIUM_PURPLE, [] { return CreateGraphColor(147,112,219); } },
+        { DISH_LANGID_GRAPH_COLOR_DARK_MAGENTA, [] { return CreateGraphColor(139,0,139); } },
+        { DISH_LANGID_GRAPH_COLOR_DARK_VIOLET, [] { return CreateGraphColor(148,0,211); } },
+        { DISH_LANGID_GRAPH_COLOR_DARK_ORCHID, [] { return CreateGraphColor(153,50,204); } },
+        { DISH_LANGID_GRAPH_COLOR_MEDIUM_ORCHID, [] { return CreateGraphColor(186,85,211); } },
+        { DISH_LANGID_GRAPH_COLOR_THISTLE, [] { return CreateGraphColor(216,191,216); } },
+        { DISH_LANGID_GRAPH_COLOR_PLUM, [] { return CreateGraphColor(221,160,221); } },
+        { DISH_LANGID_GRAPH_COLOR_MAGENTA, [] { return CreateGraphColor(255,0,255); } },
+        { DISH_LANGID_GRAPH_COLOR_ORCHID, [] { return CreateGraphColor(218,112,214); } },
+        { DISH_LANGID_GRAPH_COLOR_MEDIUM_VIOLET_RED, [] { return CreateGraphColor(199,21,133); } },
+        { DISH_LANGID_GRAPH_COLOR_PALE_VIOLET_RED, [] { return CreateGraphColor(219,112,147); } },
+        { DISH_LANGID_GRAPH_COLOR_DEEP_PINK, [] { return CreateGraphColor(255,20,147); } },
+        { DISH_LANGID_GRAPH_COLOR_HOT_PINK, [] { return CreateGraphColor(255,105,180); } },
+        { DISH_LANGID_GRAPH_COLOR_LIGHT_PINK, [] { return CreateGraphColor(255,182,193); } },
+        { DISH_LANGID_GRAPH_COLOR_PINK, [] { return CreateGraphColor(255,192,203); } },
+        { DISH_LANGID_GRAPH_COLOR_ANTIQUE_WHITE, [] { return CreateGraphColor(250,235,215); } },
+        { DISH_LANGID_GRAPH_COLOR_BEIGE, [] { return CreateGraphColor(245,245,220); } },
+        { DISH_LANGID_GRAPH_COLOR_BISQUE, [] { return CreateGraphColor(255,228,196); } },
+        { DISH_LANGID_GRAPH_COLOR_BLANCHED_ALMOND, [] { return CreateGraphColor(255,235,205); } },
+        { DISH_LANGID_GRAPH_COLOR_WHEAT, [] { return CreateGraphColor(245,222,179); } },
+        { DISH_LANGID_GRAPH_COLOR_CORN_SILK, [] { return CreateGraphColor(255,248,220); } },
+        { DISH_LANGID_GRAPH_COLOR_LEMON_CHIFFON, [] { return CreateGraphColor(255,250,205); } },
+        { DISH_LANGID_GRAPH_COLOR_LIGHT_GOLDEN_ROD_YELLOW, [] { return CreateGraphColor(250,250,210); } },
+        { DISH_LANGID_GRAPH_COLOR_LIGHT_YELLOW, [] { return CreateGraphColor(255,255,224); } },
+        { DISH_LANGID_GRAPH_COLOR_SADDLE_BROWN, [] { return CreateGraphColor(139,69,19); } },
+        { DISH_LANGID_GRAPH_COLOR_SIENNA, [] { return CreateGraphColor(160,82,45); } },
+        { DISH_LANGID_GRAPH_COLOR_CHOCOLATE, [] { return CreateGraphColor(210,105,30); } },
+        { DISH_LANGID_GRAPH_COLOR_PERN, [] { return CreateGraphColor(205,133,63); } },
+        { DISH_LANGID_GRAPH_COLOR_SANDY_BROWN, [] { return CreateGraphColor(244,164,96); } },
+        { DISH_LANGID_GRAPH_COLOR_BURLY_WOOD, [] { return CreateGraphColor(222,184,135); } },
+        { DISH_LANGID_GRAPH_COLOR_TAN, [] { return CreateGraphColor(210,180,140); } },
+        { DISH_LANGID_GRAPH_COLOR_ROSY_BROWN, [] { return CreateGraphColor(188,143,143); } },
+        { DISH_LANGID_GRAPH_COLOR_MOCCASIN, [] { return CreateGraphColor(255,228,181); } },
+        { DISH_LANGID_GRAPH_COLOR_NAVAJO_WHITE, [] { return CreateGraphColor(255,222,173); } },
+        { DISH_LANGID_GRAPH_COLOR_PEACH_PUFF, [] { return CreateGraphColor(255,218,185); } },
+        { DISH_LANGID_GRAPH_COLOR_MISTY_ROSE, [] { return CreateGraphColor(255,228,225); } },
+        { DISH_LANGID_GRAPH_COLOR_LAVENDER_BLUSH, [] { return CreateGraphColor(255,240,245); } },
+        { DISH_LANGID_GRAPH_COLOR_LINEN, [] { return CreateGraphColor(250,240,230); } },
+        { DISH_LANGID_GRAPH_COLOR_OLD_LACE, [] { return CreateGraphColor(253,245,230); } },
+        { DISH_LANGID_GRAPH_COLOR_PAPAYA_WHIP, [] { return CreateGraphColor(255,239,213); } },
+        { DISH_LANGID_GRAPH_COLOR_SEA_SHELL, [] { return CreateGraphColor(255,245,238); } },
+        { DISH_LANGID_GRAPH_COLOR_MINT_CREAM, [] { return CreateGraphColor(245,255,250); } },
+        { DISH_LANGID_GRAPH_COLOR_SLATE_GRAY, [] { return CreateGraphColor(112,128,144); } },
+        { DISH_LANGID_GRAPH_COLOR_LIGHT_SLATE_GRAY, [] { return CreateGraphColor(119,136,153); } },
+        { DISH_LANGID_GRAPH_COLOR_LIGHT_SLATE_BLUE, [] { return CreateGraphColor(176,196,222); } },
+        { DISH_LANGID_GRAPH_COLOR_LAVENDER, [] { return CreateGraphColor(230,230,250); } },
+        { DISH_LANGID_GRAPH_COLOR_FLORAL_WHITE, [] { return CreateGraphColor(255,250,240); } },
+        { DISH_LANGID_GRAPH_COLOR_ALICE_BLUE, [] { return CreateGraphColor(240,248,255); } },
+        { DISH_LANGID_GRAPH_COLOR_GHOST_WHITE, [] { return CreateGraphColor(248,248,255); } },
+        { DISH_LANGID_GRAPH_COLOR_HONEYDEW, [] { return CreateGraphColor(240,255,240); } },
+        { DISH_LANGID_GRAPH_COLOR_IVORY, [] { return CreateGraphColor(255,255,240); } },
+        { DISH_LANGID_GRAPH_COLOR_AZURE, [] { return CreateGraphColor(240,255,255); } },
+        { DISH_LANGID_GRAPH_COLOR_SNOW, [] { return CreateGraphColor(255,250,250); } },
+        { DISH_LANGID_GRAPH_COLOR_DIM_GRAY, [] { return CreateGraphColor(105,105,105); } },
+        { DISH_LANGID_GRAPH_COLOR_GRAY, [] { return CreateGraphColor(128,128,128); } },
+        { DISH_LANGID_GRAPH_COLOR_SILVER, [] { return CreateGraphColor(192,192,192); } },
+        { DISH_LANGID_GRAPH_COLOR_GAINSBORO, [] { return CreateGraphColor(220,220,220); } },
+        { DISH_LANGID_GRAPH_COLOR_WHITE_SMOKE, [] { return CreateGraphColor(245,245,245); } },
     #else
-            static_cast< IntegerT >(RS232_STOP_BITS_NULL)
+        { DISH_LANGID_IS_LIB_GRAPH_ALL_COLORS, [] { return CreateLockedBoolean(false); } },
     #endif
-        )
-    );
+        
+        { DISH_LANGID_GRAPH_KEY_ESC, [] { return CreateLockedInteger(dish::GRAPH_CHAR_ESC); } },
+        { DISH_LANGID_GRAPH_KEY_DOWN, [] { return CreateLockedInteger(dish::GRAPH_CHAR_DOWN); } },
+        { DISH_LANGID_GRAPH_KEY_UP, [] { return CreateLockedInteger(dish::GRAPH_CHAR_UP); } },
+        { DISH_LANGID_GRAPH_KEY_LEFT, [] { return CreateLockedInteger(dish::GRAPH_CHAR_LEFT); } },
+        { DISH_LANGID_GRAPH_KEY_RIGHT, [] { return CreateLockedInteger(dish::GRAPH_CHAR_RIGHT); } },
+        { DISH_LANGID_GRAPH_KEY_HOME, [] { return CreateLockedInteger(dish::GRAPH_CHAR_HOME); } },
+        { DISH_LANGID_GRAPH_KEY_BACKSPACE, [] { return CreateLockedInteger(dish::GRAPH_CHAR_BACKSPACE); } },
+        { DISH_LANGID_GRAPH_KEY_F1, [] { return CreateLockedInteger(dish::GRAPH_CHAR_F1); } },
+        { DISH_LANGID_GRAPH_KEY_F2, [] { return CreateLockedInteger(dish::GRAPH_CHAR_F2); } },
+        { DISH_LANGID_GRAPH_KEY_F3, [] { return CreateLockedInteger(dish::GRAPH_CHAR_F3); } },
+        { DISH_LANGID_GRAPH_KEY_F4, [] { return CreateLockedInteger(dish::GRAPH_CHAR_F4); } },
+        { DISH_LANGID_GRAPH_KEY_F5, [] { return CreateLockedInteger(dish::GRAPH_CHAR_F5); } },
+        { DISH_LANGID_GRAPH_KEY_F6, [] { return CreateLockedInteger(dish::GRAPH_CHAR_F6); } },
+        { DISH_LANGID_GRAPH_KEY_F7, [] { return CreateLockedInteger(dish::GRAPH_CHAR_F7); } },
+        { DISH_LANGID_GRAPH_KEY_F8, [] { return CreateLockedInteger(dish::GRAPH_CHAR_F8); } },
+        { DISH_LANGID_GRAPH_KEY_F9, [] { return CreateLockedInteger(dish::GRAPH_CHAR_F9); } },
+        { DISH_LANGID_GRAPH_KEY_F10, [] { return CreateLockedInteger(dish::GRAPH_CHAR_F10); } },
+        { DISH_LANGID_GRAPH_KEY_F11, [] { return CreateLockedInteger(dish::GRAPH_CHAR_F11); } },
+        { DISH_LANGID_GRAPH_KEY_F12, [] { return CreateLockedInteger(dish::GRAPH_CHAR_F12); } },
+        { DISH_LANGID_GRAPH_KEY_DELETE, [] { return CreateLockedInteger(dish::GRAPH_CHAR_DELETE); } },
+        { DISH_LANGID_GRAPH_KEY_INSERT, [] { return CreateLockedInteger(dish::GRAPH_CHAR_INSERT); } },
+        
+        { DISH_LANGID_GRAPH_EVENT_IDLE, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::GraphicsCallbacks::eventNull)); } },
+        { DISH_LANGID_GRAPH_EVENT_REDRAW, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::GraphicsCallbacks::eventRedraw)); } },
+        { DISH_LANGID_GRAPH_EVENT_RESIZE, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::GraphicsCallbacks::eventResize)); } },
+        { DISH_LANGID_GRAPH_EVENT_KEY_PRESS, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::GraphicsCallbacks::eventKeyPress)); } },
+        { DISH_LANGID_GRAPH_EVENT_KEY_RELEASE, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::GraphicsCallbacks::eventKeyRelease)); } },
+        { DISH_LANGID_GRAPH_EVENT_BUTTON_PRESS, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::GraphicsCallbacks::eventButtonPress)); } },
+        { DISH_LANGID_GRAPH_EVENT_BUTTON_RELEASE, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(dish::GraphicsCallbacks::eventButtonRelease)); } },
+        
+        { DISH_LANGID_GRAPH_BUTTON_1, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(1)); } },
+        { DISH_LANGID_GRAPH_BUTTON_2, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(2)); } },
+        { DISH_LANGID_GRAPH_BUTTON_3, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(3)); } },
+        { DISH_LANGID_GRAPH_BUTTON_4, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(4)); } },
+        { DISH_LANGID_GRAPH_BUTTON_5, [] { return CreateLockedInteger(static_cast< dish::IntegerT >(5)); } },
+        
+        { DISH_LANGID_GRAPH_EVENT_CONTINUE, [] { return CreateLockedBoolean(dish::GRAPH_EventProcessor::EVENT_CONTINUE); } },
+        { DISH_LANGID_GRAPH_EVENT_TERMINATE, [] { return CreateLockedBoolean(dish::GRAPH_EventProcessor::EVENT_TERMINATE); } },
+        
+        { DISH_LANGID_GRAPH_IdleEventT, dish::GRAPH_CreateIdleEventInfoT },
+        { DISH_LANGID_GRAPH_RedrawEventT, dish::GRAPH_CreateRedrawEventInfoT },
+        { DISH_LANGID_GRAPH_ResizeEventT, dish::GRAPH_CreateResizeEventInfoT },
+        { DISH_LANGID_GRAPH_KeyPressEventT, dish::GRAPH_CreateKeyEventInfoT },
+        { DISH_LANGID_GRAPH_KeyReleaseEventT, dish::GRAPH_CreateKeyEventInfoT },
+        { DISH_LANGID_GRAPH_ButtonPressEventT, dish::GRAPH_CreateButtonEventInfoT },
+        { DISH_LANGID_GRAPH_ButtonReleaseEventT, dish::GRAPH_CreateButtonEventInfoT },
+    };
+
+#else
+
+    const BuiltinT GraphLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_GRAPH, [] { return CreateLockedBoolean(false); } },
+    };
+
+#endif
     
-    insert(
-        DISH_LANGID_RS232_STOP_BITS_2, 
-        CreateLockedInteger(
-    #ifdef RS232_STOPBITS_2_SUPPORTED
-            static_cast< IntegerT >(RS232_STOP_BITS_2)
-    #else
-            static_cast< IntegerT >(RS232_STOP_BITS_NULL)
-    #endif
-        )
-    );
+#ifdef LANG_LIB_ZIP
+
+    const BuiltinT ZipLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_ZIP, [] { return CreateLockedBoolean(true); } },
+    };
+
+#else
+
+    const BuiltinT ZipLibrary[] =
+    {
+        { DISH_LANGID_IS_LIB_ZIP, [] { return CreateLockedBoolean(false); } },
+    };
+
+#endif
     
-    insert(DISH_LANGID_RS232_StopBitsSupported, Rs232StopBitsSupportedFunction::MakeValue());
+    //  The library modules, in the order they were once loaded at start-up.
+    struct LibraryT
+    {
+        const BuiltinT *Values;
+        int NumValues;
+    };
     
-    ////
+    const LibraryT Libraries[] =
+    {
+        { CoreLibrary, NumEntries(CoreLibrary) },
+        { FileIOLibrary, NumEntries(FileIOLibrary) },
+        { StringLibrary, NumEntries(StringLibrary) },
+        { DateTimeLibrary, NumEntries(DateTimeLibrary) },
+        { MathCoreLibrary, NumEntries(MathCoreLibrary) },
+        { MathTrigLibrary, NumEntries(MathTrigLibrary) },
+        { MathHyperbolicLibrary, NumEntries(MathHyperbolicLibrary) },
+        { MathComplexLibrary, NumEntries(MathComplexLibrary) },
+        { MathRandomLibrary, NumEntries(MathRandomLibrary) },
+        { MathMatrixLibrary, NumEntries(MathMatrixLibrary) },
+        { MathIntegerLibrary, NumEntries(MathIntegerLibrary) },
+        { TextIOLibrary, NumEntries(TextIOLibrary) },
+        { NetworkLibrary, NumEntries(NetworkLibrary) },
+        { FileSysLibrary, NumEntries(FileSysLibrary) },
+        { DatabaseLibrary, NumEntries(DatabaseLibrary) },
+        { RegularExpressionLibrary, NumEntries(RegularExpressionLibrary) },
+        { Rs232Library, NumEntries(Rs232Library) },
+        { DebugLibrary, NumEntries(DebugLibrary) },
+        { GraphLibrary, NumEntries(GraphLibrary) },
+        { ZipLibrary, NumEntries(ZipLibrary) }
+    };
+    
+    const int NUM_LIBRARIES(NumEntries(Libraries));
+    
+    //  The library and index of each library value, ordered by name, built on
+    //  first use.
+    const std::vector< std::pair< int, int > > &LibraryValuesByName()
+    {
+        static std::vector< std::pair< int, int > > index;
+        
+        if(index.empty())
+        {
+            for(int lib(0); lib < NUM_LIBRARIES; ++lib)
+            {
+                for(int i(0); i < Libraries[lib].NumValues; ++i)
+                {
+                    index.push_back(std::make_pair(lib, i));
+                }
+            }
+            
+            std::sort(
+                index.begin(),
+                index.end(),
+                [](const std::pair< int, int > &lhs, const std::pair< int, int > &rhs) { return (std::strcmp(Libraries[lhs.first].Values[lhs.second].Name, Libraries[rhs.first].Values[rhs.second].Name) < 0); }
+            );
+        }
+        
+        return index;
+    }
     
-    insert(
-        DISH_LANGID_RS232_FLOWCTRL_NONE, 
-        CreateLockedInteger(
-    #ifdef RS232_FLOWCONTROL_NONE_SUPPORTED
-            static_cast< IntegerT >(RS232_FLOWCTRL_NONE)
-    #else
-            static_cast< IntegerT >(RS232_FLOWCTRL_NULL)
-    #endif
-        )
-    );
+    ////////////////////////////////////////////////////////////////////////////
+
+}
+
+/******************************************************************************
+
+    dish::LanguageSymbolTable class definitions
+
+ ******************************************************************************/
+ 
+dish::IntegerT dish::LanguageSymbolTable::Epoch(0);
+int dish::LanguageSymbolTable::MaterializedCount(0);
+int dish::LanguageSymbolTable::LoadedCount(0);
+
+void dish::LanguageSymbolTable::insert(const std::string &key, std::shared_ptr< dish::iAtomic > value) const
+{
+    if(dish::iAtomic::typeExecutable != value->Type())
+    {
+        mBase->Insert(key, value);
+    }
+    else
+    {
+        mBase->Insert(key + "_" + std::to_string(value->NumParameters()), value);
+    }
+}
+
+bool dish::LanguageSymbolTable::materialize(const std::string &key) const
+{
+    //  A library value is bound under its own name.
+    {
+        const std::vector< std::pair< int, int > > &index(LibraryValuesByName());
+        std::vector< std::pair< int, int > >::const_iterator i(
+            std::lower_bound(
+                index.begin(),
+                index.end(),
+                key,
+                [](const std::pair< int, int > &lhs, const std::string &rhs) { return (rhs.compare(Libraries[lhs.first].Values[lhs.second].Name) > 0); }
+            )
+        );
+        
+        if((index.end() != i) && (key == Libraries[i->first].Values[i->second].Name))
+        {
+            if((*mLoaded)[i->first])
+            {
+                return false;
+            }
+            
+            load(i->first);
+            ++LoadedCount;
+            
+            return true;
+        }
+    }
     
-    insert(
-        DISH_LANGID_RS232_FLOWCTRL_SOFTWARE, 
-        CreateLockedInteger(
-    #ifdef RS232_FLOWCONTROL_SOFTWARE_SUPPORTED
-            static_cast< IntegerT >(RS232_FLOWCTRL_SOFTWARE)
-    #else
-            static_cast< IntegerT >(RS232_FLOWCTRL_NULL)
-    #endif
-        )
-    );
+    //  Functions are only ever bound under an executable key.
+    if(!SymbolTable::IsExecutableKey(key))
+    {
+        return false;
+    }
     
-    insert(
-        DISH_LANGID_RS232_FLOWCTRL_HARDWARE, 
-        CreateLockedInteger(
-    #ifdef RS232_FLOWCONTROL_HARDWARE_SUPPORTED
-            static_cast< IntegerT >(RS232_FLOWCTRL_HARDWARE)
-    #else
-            static_cast< IntegerT >(RS232_FLOWCTRL_NULL)
-    #endif
+    const std::string name(key.substr(0, key.rfind('_')));
+    
+    const std::vector< int > &index(BuiltinsByName());
+    std::vector< int >::const_iterator i(
+        std::lower_bound(
+            index.begin(),
+            index.end(),
+            name,
+            [](const int &lhs, const std::string &rhs) { return (rhs.compare(Builtins[lhs].Name) > 0); }
         )
     );
     
-    insert(DISH_LANGID_RS232_FlowControlSupported, Rs232FlowControlSupportedFunction::MakeValue());
+    bool created(false);
+    for(; (index.end() != i) && (name == Builtins[*i].Name); ++i)
+    {
+        if(!(*mMaterialized)[*i])
+        {
+            (*mMaterialized)[*i] = true;
+            insert(Builtins[*i].Name, Builtins[*i].Make());
+            
+            ++MaterializedCount;
+            created = true;
+        }
+    }
     
-    ////
+    return created;
+}
+
+void dish::LanguageSymbolTable::materializeAll() const
+{
+    for(int i(0); i < NUM_BUILTINS; ++i)
+    {
+        if(!(*mMaterialized)[i])
+        {
+            (*mMaterialized)[i] = true;
+            insert(Builtins[i].Name, Builtins[i].Make());
+        }
+    }
     
-    insert(DISH_LANGID_RS232_ConfigurationT, CreateRs232ConfigurationStructure());
+    for(int lib(0); lib < NUM_LIBRARIES; ++lib)
+    {
+        if(!(*mLoaded)[lib])
+        {
+            load(lib);
+        }
+    }
+}
+
+void dish::LanguageSymbolTable::load(const int &library) const
+{
+    assert(!(*mLoaded)[library]);
     
-    insert(DISH_LANGID_RS232_DefaultConfiguration, Rs232DefaultConfigurationFunction::MakeValue());
+    (*mLoaded)[library] = true;
     
-    insert(DISH_LANGID_RS232_MakeConfiguration, Rs232MakeConfiguration1Function::MakeValue());
-    insert(DISH_LANGID_RS232_MakeConfiguration, Rs232MakeConfiguration4Function::MakeValue());
-    insert(DISH_LANGID_RS232_MakeConfiguration, Rs232MakeConfiguration5Function::MakeValue());
-    insert(DISH_LANGID_RS232_MakeConfiguration, Rs232MakeConfiguration6Function::MakeValue());
+    const LibraryT &lib(Libraries[library]);
+    for(int i(0); i < lib.NumValues; ++i)
+    {
+        insert(lib.Values[i].Name, lib.Values[i].Make());
+    }
+}
+
+std::shared_ptr< dish::iAtomic > dish::LanguageSymbolTable::lookupBase(const std::string &key) const
+{
+    std::shared_ptr< iAtomic > value(mBase->Lookup(key));
+    if((0 == value.get()) && materialize(key))
+    {
+        value = mBase->Lookup(key);
+    }
     
-    insert(DISH_LANGID_RS232_Open, Rs232OpenFunction::MakeValue());
-    insert(DISH_LANGID_RS232_NumOpen, Rs232NumOpenFunction::MakeValue());
-    insert(DISH_LANGID_RS232_IsOpen, Rs232IsOpenFunction::MakeValue());
-    insert(DISH_LANGID_RS232_Send, Rs232SendFunction::MakeValue());
-    insert(DISH_LANGID_RS232_SendXON, Rs232SendXOnFunction::MakeValue());
-    insert(DISH_LANGID_RS232_SendXOFF, Rs232SendXOffFunction::MakeValue());
-    insert(DISH_LANGID_RS232_NumCharactersAvailable, Rs232NumCharactersAvailableFunction::MakeValue());
-    insert(DISH_LANGID_RS232_Receive, Rs232ReceiveFunction::MakeValue());
-    insert(DISH_LANGID_RS232_ReceiveTimeout, Rs232ReceiveTimeoutFunction::MakeValue());
-    insert(DISH_LANGID_RS232_ReceiveNumCharacters, Rs232ReceiveNumCharacters2Function::MakeValue());
-    insert(DISH_LANGID_RS232_ReceiveNumCharacters, Rs232ReceiveNumCharacters3Function::MakeValue());
-    insert(DISH_LANGID_RS232_ReceiveSentinel, Rs232ReceiveSentinel2Function::MakeValue());
-    insert(DISH_LANGID_RS232_ReceiveSentinel, Rs232ReceiveSentinel3Function::MakeValue());
-    insert(DISH_LANGID_RS232_ReceiveSentinel, Rs232ReceiveSentinel4Function::MakeValue());
-    insert(DISH_LANGID_RS232_Close, Rs232CloseFunction::MakeValue());
-    insert(DISH_LANGID_RS232_CloseAll, Rs232CloseAllFunction::MakeValue());
+    return value;
+}
+
+std::shared_ptr< dish::iAtomic > dish::LanguageSymbolTable::lookupBase(const int &id, const std::string &key) const
+{
+    std::shared_ptr< iAtomic > value(mBase->LookupInterned(id, key));
+    if((0 == value.get()) && materialize(key))
+    {
+        value = mBase->LookupInterned(id, key);
+    }
     
-#else
+    return value;
+}
 
-    insert(DISH_LANGID_IS_LIB_RS232, BooleanValue::MakeLockedValue(false));
+int dish::LanguageSymbolTable::NumBuiltins()
+{
+    return NUM_BUILTINS;
+}
 
-#endif
-    
-    ///////////////
+int dish::LanguageSymbolTable::NumLibraries()
+{
+    return NUM_LIBRARIES;
+}
 
-#ifdef LANG_LIB_DEBUG
+dish::LanguageSymbolTable::LanguageSymbolTable(const bool &profile, const int &maxdepth) : dish::iSymbolTable(),
 
-    insert(DISH_LANGID_IS_LIB_DEBUG, BooleanValue::MakeLockedValue(true));
+    mBase(MakeSystemSymbolTable()),
     
-    insert(DISH_LANGID_DEBUG_PrintSymbolTable, DebugPrintSymbolTableFunction::MakeValue());
-    insert(DISH_LANGID_DEBUG_PrintSymbolTable, DebugPrintSymbolTable1Function::MakeValue());
+    mStack(maxdepth),
     
-    insert(DISH_LANGID_DEBUG_PrintSymbolTableStats, DebugPrintSymbolTableStatsFunction::MakeValue());
-    insert(DISH_LANGID_DEBUG_PrintSymbolTableStats, DebugPrintSymbolTableStats1Function::MakeValue());
+    mProfile(),
     
-    insert(DISH_LANGID_DEBUG_PrintParseTree, DebugPrintParseTreeFunction::MakeValue());
-    insert(DISH_LANGID_DEBUG_PrintParseTree, DebugPrintParseTree2Function::MakeValue());
+    mReturnValue(),
     
-    insert(DISH_LANGID_DEBUG_PrintParseTreeNodeStats, DebugPrintParseTreeNodeStatsFunction::MakeValue());
-    insert(DISH_LANGID_DEBUG_PrintParseTreeNodeStats, DebugPrintParseTreeNodeStats1Function::MakeValue());
+    mFunction(0),
+    mFunctionDepth(0),
+    mTailCalls(true),
     
-    insert(DISH_LANGID_DEBUG_INFINITE_STACK_DEPTH, CreateLockedInteger(StackedSymbolTable::INFINITE_STACK_DEPTH));
-    insert(DISH_LANGID_DEBUG_MAX_STACK_DEPTH, CreateLockedInteger(mStack.MaxDepth()));
-    insert(DISH_LANGID_DEBUG_StackDepthFunction, DebugCurrentStackDepthFunction::MakeValue());
+    mTailFunction(),
+    mTailFrame(),
     
-    insert(DISH_LANGID_DEBUG_DEFAULT_LOGFILE, StringValue::MakeValue("logfile.txt", LOCKED));
-    insert(DISH_LANGID_DEBUG_Log, DebugLogFunction::MakeValue());
+    mMaterialized(new std::vector< bool >(NUM_BUILTINS, false)),
+    mLoaded(new std::vector< bool >(NUM_LIBRARIES, false))
 
-#else
-
-    insert(DISH_LANGID_IS_LIB_DEBUG, BooleanValue::MakeLockedValue(false));
-
-#endif
+{
+    assert(0 != mBase.get());
+    
+    if(profile)
+    {
+        mProfile.reset(new ExecutionProfile());
+    }
     
     ///////////////
     
-#ifdef LANG_LIB_GRAPH
+    insert(DISH_LANGID_InterpreterVersion, CreateVersionStructure(MAJOR_VERSION, MINOR_VERSION, REVISION_VERSION, LOCKED));
+    insert(DISH_LANGID_LanguageVersion, CreateVersionStructure(LANG_MAJOR_VERSION, LANG_MINOR_VERSION, LANG_REVISION_VERSION, LOCKED));
+    insert(DISH_LANGID_LibraryVersion, CreateVersionStructure(LIBRARY_MAJOR_VERSION, LIBRARY_MINOR_VERSION, LIBRARY_REVISION_VERSION, LOCKED));
+    
+#ifdef LANG_LIB_CORE
 
-    insert(DISH_LANGID_IS_LIB_GRAPH, BooleanValue::MakeLockedValue(true));
-    
-    insert(DISH_LANGID_GRAPH_ContextT, GRAPH_CreateGraphicsContextType());
-    insert(DISH_LANGID_GRAPH_CreateContext, GRAPH_CreateContext2Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_CreateContext, GRAPH_CreateContext3Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_CreateContext, GRAPH_CreateContext7Function::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_IntegerPointT, GRAPH_CreateIntegerPointType());
-    insert(DISH_LANGID_GRAPH_RealPointT, GRAPH_CreateRealPointType());
-    insert(DISH_LANGID_GRAPH_CreatePoint, GRAPH_CreatePointFunction::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_IntegerLineT, GRAPH_CreateIntegerLineType());
-    insert(DISH_LANGID_GRAPH_RealLineT, GRAPH_CreateRealLineType());
-    insert(DISH_LANGID_GRAPH_CreateLine, GRAPH_CreateLine2Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_CreateLine, GRAPH_CreateLine4Function::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_FILL_STYLE_SOLID, CreateLockedInteger(GRAPH_FillStyle_SOLID));
-    insert(DISH_LANGID_GRAPH_FILL_STYLE_TILED, CreateLockedInteger(GRAPH_FillStyle_TILED));
-    insert(DISH_LANGID_GRAPH_FILL_STYLE_OPAQUE_STIPPLED, CreateLockedInteger(GRAPH_FillStyle_OPAQUE_STIPPLED));
-    insert(DISH_LANGID_GRAPH_FILL_STYLE_STIPPLED, CreateLockedInteger(GRAPH_FillStyle_STIPPLED));
-    
-    insert(DISH_LANGID_GRAPH_LINE_STYLE_SOLID, CreateLockedInteger(GRAPH_LineStyle_SOLID));
-    insert(DISH_LANGID_GRAPH_LINE_STYLE_DASHED, CreateLockedInteger(GRAPH_LineStyle_DASHED));
-    insert(DISH_LANGID_GRAPH_LINE_STYLE_DOUBLE_DASHED, CreateLockedInteger(GRAPH_LineStyle_DOUBLE_DASHED));
-    
-    insert(DISH_LANGID_GRAPH_LINE_CAP_NOT_LAST, CreateLockedInteger(GRAPH_LineCap_NOT_LAST));
-    insert(DISH_LANGID_GRAPH_LINE_CAP_BUTT, CreateLockedInteger(GRAPH_LineCap_BUTT));
-    insert(DISH_LANGID_GRAPH_LINE_CAP_ROUND, CreateLockedInteger(GRAPH_LineCap_ROUND));
-    insert(DISH_LANGID_GRAPH_LINE_CAP_PROJECTING, CreateLockedInteger(GRAPH_LineCap_PROJECTING));
-    
-    insert(DISH_LANGID_GRAPH_LINE_JOIN_MITRE, CreateLockedInteger(GRAPH_LineJoin_MITRE));
-    insert(DISH_LANGID_GRAPH_LINE_JOIN_ROUND, CreateLockedInteger(GRAPH_LineJoin_ROUND));
-    insert(DISH_LANGID_GRAPH_LINE_JOIN_BEVEL, CreateLockedInteger(GRAPH_LineJoin_BEVEL));
-
-    insert(DISH_LANGID_GRAPH_NOFILL, BooleanValue::MakeLockedValue(false));
-    insert(DISH_LANGID_GRAPH_FILL, BooleanValue::MakeLockedValue(true));
-        
-    insert(DISH_LANGID_GRAPH_COLOR_BLACK, CreateGraphColor(0,0,0));
-    insert(DISH_LANGID_GRAPH_COLOR_RED, CreateGraphColor(255,0,0));
-    insert(DISH_LANGID_GRAPH_COLOR_GREEN, CreateGraphColor(0,128,0));
-    insert(DISH_LANGID_GRAPH_COLOR_BLUE, CreateGraphColor(0,128,0));
-    insert(DISH_LANGID_GRAPH_COLOR_LIGHT_RED, CreateGraphColor(230,211,211));
-    insert(DISH_LANGID_GRAPH_COLOR_LIGHT_GREEN, CreateGraphColor(211,230,211));
-    insert(DISH_LANGID_GRAPH_COLOR_LIGHT_BLUE, CreateGraphColor(211,211,230));
-    insert(DISH_LANGID_GRAPH_COLOR_LIGHT_GRAY, CreateGraphColor(211,211,211));
-    insert(DISH_LANGID_GRAPH_COLOR_DARK_GRAY, CreateGraphColor(169,169,169));
-    insert(DISH_LANGID_GRAPH_COLOR_ORANGE, CreateGraphColor(255,165,0));
-    insert(DISH_LANGID_GRAPH_COLOR_BROWN, CreateGraphColor(165,42,42));
-    insert(DISH_LANGID_GRAPH_COLOR_YELLOW, CreateGraphColor(255,255,0));
-    insert(DISH_LANGID_GRAPH_COLOR_PURPLE, CreateGraphColor(128,0,128));
-    insert(DISH_LANGID_GRAPH_COLOR_CYAN, CreateGraphColor(0,255,255));
-    insert(DISH_LANGID_GRAPH_COLOR_VIOLET, CreateGraphColor(238,130,238));
-    insert(DISH_LANGID_GRAPH_COLOR_WHITE, CreateGraphColor(255,255,255));
+    //  Add as a function and as a reference that can be passed without name-
+    //  mangling.
+    {
+        std::shared_ptr< iAtomic > lessthan(CompareLessThanFunction::MakeValue());
     
-    #ifdef LANG_LIB_GRAPH_ALL_COLORS
+        insert(DISH_LANGID_CompareLessThan, lessthan);
+        mBase->Insert(DISH_LANGID_SORT_ASCENDING, CompareLessThanFunction::MakeValue());
+    }
     
-        insert(DISH_LANGID_IS_LIB_GRAPH_ALL_COLORS, BooleanValue::MakeLockedValue(true));
-    
-        insert(DISH_LANGID_GRAPH_COLOR_MAROON, CreateGraphColor(128,0,0));
-        insert(DISH_LANGID_GRAPH_COLOR_DARK_RED, CreateGraphColor(139,0,0));
-        insert(DISH_LANGID_GRAPH_COLOR_FIREBRICK, CreateGraphColor(178,34,34));
-        insert(DISH_LANGID_GRAPH_COLOR_CRIMSON, CreateGraphColor(220,20,60));
-        insert(DISH_LANGID_GRAPH_COLOR_TOMATO, CreateGraphColor(255,99,71));
-        insert(DISH_LANGID_GRAPH_COLOR_CORAL, CreateGraphColor(255,127,80));
-        insert(DISH_LANGID_GRAPH_COLOR_INDIAN_RED, CreateGraphColor(205,92,92));
-        insert(DISH_LANGID_GRAPH_COLOR_LIGHT_CORAL, CreateGraphColor(240,128,128));
-        insert(DISH_LANGID_GRAPH_COLOR_DARK_SALMON, CreateGraphColor(233,150,122));
-        insert(DISH_LANGID_GRAPH_COLOR_SALMON, CreateGraphColor(250,128,114));
-        insert(DISH_LANGID_GRAPH_COLOR_LIGHT_SALMON, CreateGraphColor(255,160,122));
-        insert(DISH_LANGID_GRAPH_COLOR_ORANGE_RED, CreateGraphColor(255,69,0));
-        insert(DISH_LANGID_GRAPH_COLOR_DARK_ORANGE, CreateGraphColor(255,140,0));
-        insert(DISH_LANGID_GRAPH_COLOR_GOLD, CreateGraphColor(255,215,0));
-        insert(DISH_LANGID_GRAPH_COLOR_DARK_GOLDEN_ROD, CreateGraphColor(184,134,11));
-        insert(DISH_LANGID_GRAPH_COLOR_GOLDEN_ROD, CreateGraphColor(218,165,32));
-        insert(DISH_LANGID_GRAPH_COLOR_PALE_GOLDEN_ROD, CreateGraphColor(238,232,170));
-        insert(DISH_LANGID_GRAPH_COLOR_DARK_KHAKI, CreateGraphColor(189,183,107));
-        insert(DISH_LANGID_GRAPH_COLOR_KHAKI, CreateGraphColor(240,230,140));
-        insert(DISH_LANGID_GRAPH_COLOR_OLIVE, CreateGraphColor(128,128,0));
-        insert(DISH_LANGID_GRAPH_COLOR_YELLOW_GREEN, CreateGraphColor(154,205,50));
-        insert(DISH_LANGID_GRAPH_COLOR_DARK_OLIVE_GREEN, CreateGraphColor(85,107,47));
-        insert(DISH_LANGID_GRAPH_COLOR_OLIVE_DRAB, CreateGraphColor(107,142,35));
-        insert(DISH_LANGID_GRAPH_COLOR_LAWN_GREEN, CreateGraphColor(124,252,0));
-        insert(DISH_LANGID_GRAPH_COLOR_CHART_REUSE, CreateGraphColor(127,255,0));
-        insert(DISH_LANGID_GRAPH_COLOR_GREEN_YELLOW, CreateGraphColor(173,255,47));
-        insert(DISH_LANGID_GRAPH_COLOR_DARK_GREEN, CreateGraphColor(0,100,0));
-        insert(DISH_LANGID_GRAPH_COLOR_FOREST_GREEN, CreateGraphColor(34,139,34));
-        insert(DISH_LANGID_GRAPH_COLOR_LIME, CreateGraphColor(0,255,0));
-        insert(DISH_LANGID_GRAPH_COLOR_LIME_GREEN, CreateGraphColor(50,205,50));
-        insert(DISH_LANGID_GRAPH_COLOR_PALE_GREEN, CreateGraphColor(152,251,152));
-        insert(DISH_LANGID_GRAPH_COLOR_DARK_SEA_GREEN, CreateGraphColor(143,188,143));
-        insert(DISH_LANGID_GRAPH_COLOR_MEDIUM_SPRING_GREEN, CreateGraphColor(0,250,154));
-        insert(DISH_LANGID_GRAPH_COLOR_SPRING_GREEN, CreateGraphColor(0,255,127));
-        insert(DISH_LANGID_GRAPH_COLOR_SEA_GREEN, CreateGraphColor(46,139,87));
-        insert(DISH_LANGID_GRAPH_COLOR_MEDIUM_AQUA_MARINE, CreateGraphColor(102,205,170));
-        insert(DISH_LANGID_GRAPH_COLOR_MEDIUM_SEA_GREEN, CreateGraphColor(60,179,113));
-        insert(DISH_LANGID_GRAPH_COLOR_LIGHT_SEA_GREEN, CreateGraphColor(32,178,170));
-        insert(DISH_LANGID_GRAPH_COLOR_DARK_SLATE_GRAY, CreateGraphColor(47,79,79));
-        insert(DISH_LANGID_GRAPH_COLOR_TEAL, CreateGraphColor(0,128,128));
-        insert(DISH_LANGID_GRAPH_COLOR_DARK_CYAN, CreateGraphColor(0,139,139));
-        insert(DISH_LANGID_GRAPH_COLOR_AQUA, CreateGraphColor(0,255,255));
-        insert(DISH_LANGID_GRAPH_COLOR_LIGHT_CYAN, CreateGraphColor(224,255,255));
-        insert(DISH_LANGID_GRAPH_COLOR_DARK_TURQUOISE, CreateGraphColor(0,206,209));
-        insert(DISH_LANGID_GRAPH_COLOR_TURQUOISE, CreateGraphColor(64,224,208));
-        insert(DISH_LANGID_GRAPH_COLOR_MEDIUM_TURQUOISE, CreateGraphColor(72,209,204));
-        insert(DISH_LANGID_GRAPH_COLOR_PALE_TURQUOISE, CreateGraphColor(175,238,238));
-        insert(DISH_LANGID_GRAPH_COLOR_AQUA_MARINE, CreateGraphColor(127,255,212));
-        insert(DISH_LANGID_GRAPH_COLOR_POWDER_BLUE, CreateGraphColor(176,224,230));
-        insert(DISH_LANGID_GRAPH_COLOR_CADET_BLUE, CreateGraphColor(95,158,160));
-        insert(DISH_LANGID_GRAPH_COLOR_STEEL_BLUE, CreateGraphColor(70,130,180));
-        insert(DISH_LANGID_GRAPH_COLOR_CORN_FLOWER_BLUE, CreateGraphColor(100,149,237));
-        insert(DISH_LANGID_GRAPH_COLOR_DEEP_SKY_BLUE, CreateGraphColor(0,191,255));
-        insert(DISH_LANGID_GRAPH_COLOR_DODGER_BLUE, CreateGraphColor(30,144,255));
-        insert(DISH_LANGID_GRAPH_COLOR_SKY_BLUE, CreateGraphColor(135,206,235));
-        insert(DISH_LANGID_GRAPH_COLOR_LIGHT_SKY_BLUE, CreateGraphColor(135,206,250));
-        insert(DISH_LANGID_GRAPH_COLOR_MIDNIGHT_BLUE, CreateGraphColor(25,25,112));
-        insert(DISH_LANGID_GRAPH_COLOR_NAVY, CreateGraphColor(0,0,128));
-        insert(DISH_LANGID_GRAPH_COLOR_DARK_BLUE, CreateGraphColor(0,0,139));
-        insert(DISH_LANGID_GRAPH_COLOR_MEDIUM_BLUE, CreateGraphColor(0,0,205));
-        insert(DISH_LANGID_GRAPH_COLOR_ROYAL_BLUE, CreateGraphColor(65,105,225));
-        insert(DISH_LANGID_GRAPH_COLOR_BLUE_VIOLET, CreateGraphColor(138,43,226));
-        insert(DISH_LANGID_GRAPH_COLOR_INDIGO, CreateGraphColor(75,0,130));
-        insert(DISH_LANGID_GRAPH_COLOR_DARK_SLATE_BLUE, CreateGraphColor(72,61,139));
-        insert(DISH_LANGID_GRAPH_COLOR_SLATE_BLUE, CreateGraphColor(106,90,205));
-        insert(DISH_LANGID_GRAPH_COLOR_MEDIUM_SLATE_BLUE, CreateGraphColor(123,104,238));
-        insert(DISH_LANGID_GRAPH_COLOR_MEDIUM_PURPLE, CreateGraphColor(147,112,219));
-        insert(DISH_LANGID_GRAPH_COLOR_DARK_MAGENTA, CreateGraphColor(139,0,139));
-        insert(DISH_LANGID_GRAPH_COLOR_DARK_VIOLET, CreateGraphColor(148,0,211));
-        insert(DISH_LANGID_GRAPH_COLOR_DARK_ORCHID, CreateGraphColor(153,50,204));
-        insert(DISH_LANGID_GRAPH_COLOR_MEDIUM_ORCHID, CreateGraphColor(186,85,211));
-        insert(DISH_LANGID_GRAPH_COLOR_THISTLE, CreateGraphColor(216,191,216));
-        insert(DISH_LANGID_GRAPH_COLOR_PLUM, CreateGraphColor(221,160,221));
-        insert(DISH_LANGID_GRAPH_COLOR_MAGENTA, CreateGraphColor(255,0,255));
-        insert(DISH_LANGID_GRAPH_COLOR_ORCHID, CreateGraphColor(218,112,214));
-        insert(DISH_LANGID_GRAPH_COLOR_MEDIUM_VIOLET_RED, CreateGraphColor(199,21,133));
-        insert(DISH_LANGID_GRAPH_COLOR_PALE_VIOLET_RED, CreateGraphColor(219,112,147));
-        insert(DISH_LANGID_GRAPH_COLOR_DEEP_PINK, CreateGraphColor(255,20,147));
-        insert(DISH_LANGID_GRAPH_COLOR_HOT_PINK, CreateGraphColor(255,105,180));
-        insert(DISH_LANGID_GRAPH_COLOR_LIGHT_PINK, CreateGraphColor(255,182,193));
-        insert(DISH_LANGID_GRAPH_COLOR_PINK, CreateGraphColor(255,192,203));
-        insert(DISH_LANGID_GRAPH_COLOR_ANTIQUE_WHITE, CreateGraphColor(250,235,215));
-        insert(DISH_LANGID_GRAPH_COLOR_BEIGE, CreateGraphColor(245,245,220));
-        insert(DISH_LANGID_GRAPH_COLOR_BISQUE, CreateGraphColor(255,228,196));
-        insert(DISH_LANGID_GRAPH_COLOR_BLANCHED_ALMOND, CreateGraphColor(255,235,205));
-        insert(DISH_LANGID_GRAPH_COLOR_WHEAT, CreateGraphColor(245,222,179));
-        insert(DISH_LANGID_GRAPH_COLOR_CORN_SILK, CreateGraphColor(255,248,220));
-        insert(DISH_LANGID_GRAPH_COLOR_LEMON_CHIFFON, CreateGraphColor(255,250,205));
-        insert(DISH_LANGID_GRAPH_COLOR_LIGHT_GOLDEN_ROD_YELLOW, CreateGraphColor(250,250,210));
-        insert(DISH_LANGID_GRAPH_COLOR_LIGHT_YELLOW, CreateGraphColor(255,255,224));
-        insert(DISH_LANGID_GRAPH_COLOR_SADDLE_BROWN, CreateGraphColor(139,69,19));
-        insert(DISH_LANGID_GRAPH_COLOR_SIENNA, CreateGraphColor(160,82,45));
-        insert(DISH_LANGID_GRAPH_COLOR_CHOCOLATE, CreateGraphColor(210,105,30));
-        insert(DISH_LANGID_GRAPH_COLOR_PERN, CreateGraphColor(205,133,63));
-        insert(DISH_LANGID_GRAPH_COLOR_SANDY_BROWN, CreateGraphColor(244,164,96));
-        insert(DISH_LANGID_GRAPH_COLOR_BURLY_WOOD, CreateGraphColor(222,184,135));
-        insert(DISH_LANGID_GRAPH_COLOR_TAN, CreateGraphColor(210,180,140));
-        insert(DISH_LANGID_GRAPH_COLOR_ROSY_BROWN, CreateGraphColor(188,143,143));
-        insert(DISH_LANGID_GRAPH_COLOR_MOCCASIN, CreateGraphColor(255,228,181));
-        insert(DISH_LANGID_GRAPH_COLOR_NAVAJO_WHITE, CreateGraphColor(255,222,173));
-        insert(DISH_LANGID_GRAPH_COLOR_PEACH_PUFF, CreateGraphColor(255,218,185));
-        insert(DISH_LANGID_GRAPH_COLOR_MISTY_ROSE, CreateGraphColor(255,228,225));
-        insert(DISH_LANGID_GRAPH_COLOR_LAVENDER_BLUSH, CreateGraphColor(255,240,245));
-        insert(DISH_LANGID_GRAPH_COLOR_LINEN, CreateGraphColor(250,240,230));
-        insert(DISH_LANGID_GRAPH_COLOR_OLD_LACE, CreateGraphColor(253,245,230));
-        insert(DISH_LANGID_GRAPH_COLOR_PAPAYA_WHIP, CreateGraphColor(255,239,213));
-        insert(DISH_LANGID_GRAPH_COLOR_SEA_SHELL, CreateGraphColor(255,245,238));
-        insert(DISH_LANGID_GRAPH_COLOR_MINT_CREAM, CreateGraphColor(245,255,250));
-        insert(DISH_LANGID_GRAPH_COLOR_SLATE_GRAY, CreateGraphColor(112,128,144));
-        insert(DISH_LANGID_GRAPH_COLOR_LIGHT_SLATE_GRAY, CreateGraphColor(119,136,153));
-        insert(DISH_LANGID_GRAPH_COLOR_LIGHT_SLATE_BLUE, CreateGraphColor(176,196,222));
-        insert(DISH_LANGID_GRAPH_COLOR_LAVENDER, CreateGraphColor(230,230,250));
-        insert(DISH_LANGID_GRAPH_COLOR_FLORAL_WHITE, CreateGraphColor(255,250,240));
-        insert(DISH_LANGID_GRAPH_COLOR_ALICE_BLUE, CreateGraphColor(240,248,255));
-        insert(DISH_LANGID_GRAPH_COLOR_GHOST_WHITE, CreateGraphColor(248,248,255));
-        insert(DISH_LANGID_GRAPH_COLOR_HONEYDEW, CreateGraphColor(240,255,240));
-        insert(DISH_LANGID_GRAPH_COLOR_IVORY, CreateGraphColor(255,255,240));
-        insert(DISH_LANGID_GRAPH_COLOR_AZURE, CreateGraphColor(240,255,255));
-        insert(DISH_LANGID_GRAPH_COLOR_SNOW, CreateGraphColor(255,250,250));
-        insert(DISH_LANGID_GRAPH_COLOR_DIM_GRAY, CreateGraphColor(105,105,105));
-        insert(DISH_LANGID_GRAPH_COLOR_GRAY, CreateGraphColor(128,128,128));
-        insert(DISH_LANGID_GRAPH_COLOR_SILVER, CreateGraphColor(192,192,192));
-        insert(DISH_LANGID_GRAPH_COLOR_GAINSBORO, CreateGraphColor(220,220,220));
-        insert(DISH_LANGID_GRAPH_COLOR_WHITE_SMOKE, CreateGraphColor(245,245,245));
-        
-    #else
+    //  Add as a function and as a reference that can be passed without name-
+    //  mangling.
+    {
+        std::shared_ptr< iAtomic > greaterthan(CompareGreaterThanFunction::MakeValue());
     
-        insert(DISH_LANGID_IS_LIB_GRAPH_ALL_COLORS, BooleanValue::MakeLockedValue(false));
-
-    #endif
+        insert(DISH_LANGID_CompareGreaterThan, greaterthan);
+        mBase->Insert(DISH_LANGID_SORT_DESCENDING, CompareGreaterThanFunction::MakeValue());
+    }
     
-    insert(DISH_LANGID_GRAPH_KEY_ESC, CreateLockedInteger(GRAPH_CHAR_ESC));
-    insert(DISH_LANGID_GRAPH_KEY_DOWN, CreateLockedInteger(GRAPH_CHAR_DOWN));
-    insert(DISH_LANGID_GRAPH_KEY_UP, CreateLockedInteger(GRAPH_CHAR_UP));
-    insert(DISH_LANGID_GRAPH_KEY_LEFT, CreateLockedInteger(GRAPH_CHAR_LEFT));
-    insert(DISH_LANGID_GRAPH_KEY_RIGHT, CreateLockedInteger(GRAPH_CHAR_RIGHT));
-    insert(DISH_LANGID_GRAPH_KEY_HOME, CreateLockedInteger(GRAPH_CHAR_HOME));
-    insert(DISH_LANGID_GRAPH_KEY_BACKSPACE, CreateLockedInteger(GRAPH_CHAR_BACKSPACE));
-    insert(DISH_LANGID_GRAPH_KEY_F1, CreateLockedInteger(GRAPH_CHAR_F1));
-    insert(DISH_LANGID_GRAPH_KEY_F2, CreateLockedInteger(GRAPH_CHAR_F2));
-    insert(DISH_LANGID_GRAPH_KEY_F3, CreateLockedInteger(GRAPH_CHAR_F3));
-    insert(DISH_LANGID_GRAPH_KEY_F4, CreateLockedInteger(GRAPH_CHAR_F4));
-    insert(DISH_LANGID_GRAPH_KEY_F5, CreateLockedInteger(GRAPH_CHAR_F5));
-    insert(DISH_LANGID_GRAPH_KEY_F6, CreateLockedInteger(GRAPH_CHAR_F6));
-    insert(DISH_LANGID_GRAPH_KEY_F7, CreateLockedInteger(GRAPH_CHAR_F7));
-    insert(DISH_LANGID_GRAPH_KEY_F8, CreateLockedInteger(GRAPH_CHAR_F8));
-    insert(DISH_LANGID_GRAPH_KEY_F9, CreateLockedInteger(GRAPH_CHAR_F9));
-    insert(DISH_LANGID_GRAPH_KEY_F10, CreateLockedInteger(GRAPH_CHAR_F10));
-    insert(DISH_LANGID_GRAPH_KEY_F11, CreateLockedInteger(GRAPH_CHAR_F11));
-    insert(DISH_LANGID_GRAPH_KEY_F12, CreateLockedInteger(GRAPH_CHAR_F12));
-    insert(DISH_LANGID_GRAPH_KEY_DELETE, CreateLockedInteger(GRAPH_CHAR_DELETE));
-    insert(DISH_LANGID_GRAPH_KEY_INSERT, CreateLockedInteger(GRAPH_CHAR_INSERT));
-    
-    insert(DISH_LANGID_GRAPH_EVENT_IDLE, CreateLockedInteger(static_cast< IntegerT >(GraphicsCallbacks::eventNull)));
-    insert(DISH_LANGID_GRAPH_EVENT_REDRAW, CreateLockedInteger(static_cast< IntegerT >(GraphicsCallbacks::eventRedraw)));
-    insert(DISH_LANGID_GRAPH_EVENT_RESIZE, CreateLockedInteger(static_cast< IntegerT >(GraphicsCallbacks::eventResize)));
-    insert(DISH_LANGID_GRAPH_EVENT_KEY_PRESS, CreateLockedInteger(static_cast< IntegerT >(GraphicsCallbacks::eventKeyPress)));
-    insert(DISH_LANGID_GRAPH_EVENT_KEY_RELEASE, CreateLockedInteger(static_cast< IntegerT >(GraphicsCallbacks::eventKeyRelease)));
-    insert(DISH_LANGID_GRAPH_EVENT_BUTTON_PRESS, CreateLockedInteger(static_cast< IntegerT >(GraphicsCallbacks::eventButtonPress)));
-    insert(DISH_LANGID_GRAPH_EVENT_BUTTON_RELEASE, CreateLockedInteger(static_cast< IntegerT >(GraphicsCallbacks::eventButtonRelease)));
-    
-    insert(DISH_LANGID_GRAPH_BUTTON_1, CreateLockedInteger(static_cast< IntegerT >(1)));
-    insert(DISH_LANGID_GRAPH_BUTTON_2, CreateLockedInteger(static_cast< IntegerT >(2)));
-    insert(DISH_LANGID_GRAPH_BUTTON_3, CreateLockedInteger(static_cast< IntegerT >(3)));
-    insert(DISH_LANGID_GRAPH_BUTTON_4, CreateLockedInteger(static_cast< IntegerT >(4)));
-    insert(DISH_LANGID_GRAPH_BUTTON_5, CreateLockedInteger(static_cast< IntegerT >(5)));
-    
-    insert(DISH_LANGID_GRAPH_EVENT_CONTINUE, BooleanValue::MakeLockedValue(GRAPH_EventProcessor::EVENT_CONTINUE));
-    insert(DISH_LANGID_GRAPH_EVENT_TERMINATE, BooleanValue::MakeLockedValue(GRAPH_EventProcessor::EVENT_TERMINATE));
-    
-    insert(DISH_LANGID_GRAPH_Start, GRAPH_StartFunction::MakeValue());
-    insert(DISH_LANGID_GRAPH_IsStarted, GRAPH_IsStartedFunction::MakeValue());
-    insert(DISH_LANGID_GRAPH_End, GRAPH_EndFunction::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_IdleEventT, GRAPH_CreateIdleEventInfoT());
-    insert(DISH_LANGID_GRAPH_RedrawEventT, GRAPH_CreateRedrawEventInfoT());
-    insert(DISH_LANGID_GRAPH_ResizeEventT, GRAPH_CreateResizeEventInfoT());
-    insert(DISH_LANGID_GRAPH_KeyPressEventT, GRAPH_CreateKeyEventInfoT());
-    insert(DISH_LANGID_GRAPH_KeyReleaseEventT, GRAPH_CreateKeyEventInfoT());
-    insert(DISH_LANGID_GRAPH_ButtonPressEventT, GRAPH_CreateButtonEventInfoT());
-    insert(DISH_LANGID_GRAPH_ButtonReleaseEventT, GRAPH_CreateButtonEventInfoT());
-    
-    insert(DISH_LANGID_GRAPH_ProcessEvent, GRAPH_ProcessEventFunction::MakeValue());
-    insert(DISH_LANGID_GRAPH_ProcessEvent, GRAPH_ProcessEvent1Function::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_EventLoop, GRAPH_EventLoopFunction::MakeValue());
-    insert(DISH_LANGID_GRAPH_EventLoop, GRAPH_EventLoop1Function::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_PushEventProcessor, GRAPH_PushEventProcessorFunction::MakeValue());
-    insert(DISH_LANGID_GRAPH_PopEventProcessor, GRAPH_PopEventProcessorFunction::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_Refresh, GRAPH_RefreshFunction::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_ApplyContext, GRAPH_ApplyContextFunction::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_MakeColor, GRAPH_MakeColorFunction::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_Clear, GRAPH_Clear1Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_Clear, GRAPH_Clear2Function::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_DrawPixel, GRAPH_DrawPixel2Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_DrawPixel, GRAPH_DrawPixel3Function::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_DrawLine, GRAPH_DrawLine2Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_DrawLine, GRAPH_DrawLine3Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_DrawLine, GRAPH_DrawLine5Function::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_DrawLines, GRAPH_DrawLinesFunction::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_DrawBox, GRAPH_DrawBox3Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_DrawBox, GRAPH_DrawBox4Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_DrawBox, GRAPH_DrawBox5Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_DrawBox, GRAPH_DrawBox6Function::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_DrawArc, GRAPH_DrawArc5Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_DrawArc, GRAPH_DrawArc6Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_DrawArc, GRAPH_DrawArc7Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_DrawArc, GRAPH_DrawArc8Function::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_GetFontList, GRAPH_GetFontList0Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_GetTextDimensions, GRAPH_GetTextDimensions3Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_GetTextDimensions, GRAPH_GetTextDimensions4Function::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_DrawText, GRAPH_DrawText2Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_DrawText, GRAPH_DrawText3Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_DrawText, GRAPH_DrawText4Function::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_DrawPolygon, GRAPH_DrawPolygon2Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_DrawPolygon, GRAPH_DrawPolygon3Function::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_MoveTo, GRAPH_MoveTo2Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_MoveTo, GRAPH_MoveTo3Function::MakeValue());
-    
-    insert(DISH_LANGID_GRAPH_LineTo, GRAPH_LineTo2Function::MakeValue());
-    insert(DISH_LANGID_GRAPH_LineTo, GRAPH_LineTo3Function::MakeValue());
+    //  Add as a function and as a reference that can be passed without name-
+    //  mangling.
+    {
+        std::shared_ptr< iAtomic > equal(CompareEqualFunction::MakeValue());
     
-#else
-
-    insert(DISH_LANGID_IS_LIB_GRAPH, BooleanValue::MakeLockedValue(false));
+        insert(DISH_LANGID_CompareEqual, equal);
+        mBase->Insert(DISH_LANGID_EQUAL, CompareEqualFunction::MakeValue());
+    }
 
 #endif
+    
+#ifdef LANG_LIB_DEBUG
 
-#ifdef LANG_LIB_ZIP
+    //  Depends upon this table, so cannot be deferred with the rest of the
+    //  debug library.
+    insert(DISH_LANGID_DEBUG_MAX_STACK_DEPTH, CreateLockedInteger(mStack.MaxDepth()));
 
-    insert(DISH_LANGID_IS_LIB_ZIP, BooleanValue::MakeLockedValue(true));
-    
-    insert(DISH_LANGID_Zip, Zip1Function::MakeValue());
-    insert(DISH_LANGID_Zip, Zip2Function::MakeValue());
-    insert(DISH_LANGID_Zip, Zip3Function::MakeValue());
-    insert(DISH_LANGID_Zip, Zip4Function::MakeValue());
-    insert(DISH_LANGID_Zip, Zip5Function::MakeValue());
-    insert(DISH_LANGID_Zip, Zip6Function::MakeValue());
-    insert(DISH_LANGID_Zip, Zip7Function::MakeValue());
-    insert(DISH_LANGID_Zip, Zip8Function::MakeValue());
-    insert(DISH_LANGID_Zip, Zip9Function::MakeValue());
-    insert(DISH_LANGID_Zip, Zip10Function::MakeValue());
-    
-    insert(DISH_LANGID_ZipTogether, ZipTogether1Function::MakeValue());
-    insert(DISH_LANGID_ZipTogether, ZipTogether2Function::MakeValue());
-    insert(DISH_LANGID_ZipTogether, ZipTogether3Function::MakeValue());
-    insert(DISH_LANGID_ZipTogether, ZipTogether4Function::MakeValue());
-    insert(DISH_LANGID_ZipTogether, ZipTogether5Function::MakeValue());
-    insert(DISH_LANGID_ZipTogether, ZipTogether6Function::MakeValue());
-    insert(DISH_LANGID_ZipTogether, ZipTogether7Function::MakeValue());
-    insert(DISH_LANGID_ZipTogether, ZipTogether8Function::MakeValue());
-    insert(DISH_LANGID_ZipTogether, ZipTogether9Function::MakeValue());
-    insert(DISH_LANGID_ZipTogether, ZipTogether10Function::MakeValue());
-    insert(DISH_LANGID_ZipTogether, ZipTogether11Function::MakeValue());
-    
-    insert(DISH_LANGID_ZipValue, ZipValueFunction::MakeValue());
+#endif
     
+#ifdef LANG_LIB_ZIP
+
     {
         std::shared_ptr< ZipIncrement0Function > increment_by_0(ZipIncrement0Function::MakeValue());
         insert(DISH_LANGID_ZipIncrement, increment_by_0);
@@ -2025,10 +2160,6 @@ dish::LanguageSymbolTable::LanguageSymbolTable(const bool &profile, const int &m
         insert(DISH_LANGID_ZipDecrement, ZipDecrement1Function::MakeValue());
     }
 
-#else
-
-    insert(DISH_LANGID_IS_LIB_ZIP, BooleanValue::MakeLockedValue(false));
-
 #endif
     
     /*
@@ -2040,14 +2171,30 @@ dish::LanguageSymbolTable::LanguageSymbolTable(const bool &profile, const int &m
     ///////////////
     
     assert(!mStack.IsEmpty());
+    
+    ++Epoch;
 }
 
 dish::LanguageSymbolTable::LanguageSymbolTable(const dish::LanguageSymbolTable &symtab, const dish::iSymbolTable::CloneT &type) : iSymbolTable(),
     mBase(),
     mStack(symtab.mStack.MaxDepth()),
     
-    mProfile(symtab.mProfile)
+    mProfile(symtab.mProfile),
+    
+    mReturnValue(),
+    
+    mFunction(0),
+    mFunctionDepth(0),
+    mTailCalls(symtab.mTailCalls),
+    
+    mTailFunction(),
+    mTailFrame(),
+    
+    mMaterialized(symtab.mMaterialized),
+    mLoaded(symtab.mLoaded)
 {
+    ++Epoch;
+    
     switch(type)
     {
         case cloneMinimal:
@@ -2068,7 +2215,10 @@ dish::LanguageSymbolTable::LanguageSymbolTable(const dish::LanguageSymbolTable &
         case cloneDeep:
         {
             //  Copy the base system symbol-table where the run-time library
-            //  resides.
+            //  resides, once all of it has been created; the flags shared
+            //  with the original are then never changed.
+            symtab.materializeAll();
+            
             mBase = MakeSystemSymbolTable();
             symtab.mBase->Load(*mBase, type);
             
@@ -2089,7 +2239,7 @@ dish::LanguageSymbolTable::LanguageSymbolTable(const dish::LanguageSymbolTable &
 
 std::shared_ptr< dish::iAtomic > dish::LanguageSymbolTable::LookupInBase(const std::string &key) const
 {
-    std::shared_ptr< iAtomic > value(mBase->Lookup(key));
+    std::shared_ptr< iAtomic > value(lookupBase(key));
     if(value)
     {
         return value;
@@ -2103,6 +2253,22 @@ std::shared_ptr< dish::iAtomic > dish::LanguageSymbolTable::LookupInBase(const s
     throw NoSuchSymbolException(message.str());
 }
 
+bool dish::LanguageSymbolTable::ScopesHoldOnlyParameters(const int &depth, const dish::iAtomic &function) const
+{
+    return mStack.HoldsOnly(depth, function.ParameterList());
+}
+
+void dish::LanguageSymbolTable::SetTailCall(std::shared_ptr< dish::iAtomic > function, std::shared_ptr< dish::iSymbolTable > frame)
+{
+    assert(function);
+
+    mTailFunction = function;
+    mTailFrame = frame;
+
+    //  Complete the executing function as a return statement would.
+    SetReturnValue(NullValue::MakeValue());
+}
+
 std::shared_ptr< dish::iSymbolTable > dish::LanguageSymbolTable::Clone(const dish::iSymbolTable::CloneT &type) const
 {
     return std::shared_ptr< iSymbolTable >(new LanguageSymbolTable(*this, type));
@@ -2110,6 +2276,8 @@ std::shared_ptr< dish::iSymbolTable > dish::LanguageSymbolTable::Clone(const dis
 
 void dish::LanguageSymbolTable::Shuffle()
 {
+    materializeAll();
+    
     mBase->Shuffle();
     mStack.Shuffle();
 }
@@ -2117,8 +2285,13 @@ void dish::LanguageSymbolTable::Shuffle()
 void dish::LanguageSymbolTable::Push(std::shared_ptr< dish::iSymbolTable > table)
 {
     assert(0 != table.get());
+    
+    if(table->BindsExecutable())
+    {
+        ++Epoch;
+    }
 
-    mStack.Push(table);
+    mStack.Push(std::move(table));
 }
 
 void dish::LanguageSymbolTable::Push()
@@ -2128,9 +2301,30 @@ void dish::LanguageSymbolTable::Push()
 
 void dish::LanguageSymbolTable::Pop()
 {
+    if(mStack.Top()->BindsExecutable())
+    {
+        ++Epoch;
+    }
+    
     mStack.Pop();
 }
 
+std::shared_ptr< dish::iAtomic > dish::LanguageSymbolTable::LookupInBase(const int &id, const std::string &key) const
+{
+    std::shared_ptr< iAtomic > value(lookupBase(id, key));
+    if(value)
+    {
+        return value;
+    }
+        
+    std::stringstream message;
+    message << "The symbol '";
+    message << key;
+    message << "' does not exist.";
+    
+    throw NoSuchSymbolException(message.str());
+}
+
 bool dish::LanguageSymbolTable::IsEmpty() const
 {
     return mStack.IsEmpty();
@@ -2138,7 +2332,18 @@ bool dish::LanguageSymbolTable::IsEmpty() const
 
 int dish::LanguageSymbolTable::Num() const
 {
-    return (mBase->Num() + mStack.Num());
+    //  Functions yet to be created, and values of modules yet to be loaded,
+    //  are counted as if they had been.
+    int pending(static_cast< int >(std::count(mMaterialized->begin(), mMaterialized->end(), false)));
+    for(int lib(0); lib < NUM_LIBRARIES; ++lib)
+    {
+        if(!(*mLoaded)[lib])
+        {
+            pending += Libraries[lib].NumValues;
+        }
+    }
+    
+    return (mBase->Num() + pending + mStack.Num());
 }
 
 bool dish::LanguageSymbolTable::Exists(const std::string &key) const
@@ -2150,14 +2355,20 @@ bool dish::LanguageSymbolTable::Exists(const std::string &key) const
             return true;
         }
         
-        return mBase->Exists(key);
+        return (mBase->Exists(key) || (materialize(key) && mBase->Exists(key)));
     }
     
-    return mBase->Exists(key.substr(1, std::string::npos));
+    const std::string basekey(key.substr(1, std::string::npos));
+    return (mBase->Exists(basekey) || (materialize(basekey) && mBase->Exists(basekey)));
 }
 
 void dish::LanguageSymbolTable::Insert(const std::string &key, std::shared_ptr< dish::iAtomic > value)
 {
+    if(SymbolTable::IsExecutableKey(key))
+    {
+        ++Epoch;
+    }
+    
     if(!BeginsWith(key, '`'))
     {
         if(!mStack.IsEmpty())
@@ -2166,12 +2377,18 @@ void dish::LanguageSymbolTable::Insert(const std::string &key, std::shared_ptr<
         }
         else
         {
+            materialize(key);
             mBase->Insert(key, value);
         }
     }
     else
     {
-        mBase->Insert(key.substr(1, std::string::npos), value);
+        //  Create any function of the run-time library already bound to the
+        //  key, so it is found to be a duplicate just as before.
+        const std::string basekey(key.substr(1, std::string::npos));
+        materialize(basekey);
+        
+        mBase->Insert(basekey, value);
     }
 }
 
@@ -2185,7 +2402,7 @@ std::shared_ptr< dish::iAtomic > dish::LanguageSymbolTable::Lookup(const std::st
             return value;
         }
         
-        value = mBase->Lookup(key);
+        value = lookupBase(key);
         if(0 != value.get())
         {
             return value;
@@ -2193,7 +2410,7 @@ std::shared_ptr< dish::iAtomic > dish::LanguageSymbolTable::Lookup(const std::st
     }
     else
     {
-        std::shared_ptr< iAtomic > value(mBase->Lookup(key.substr(1, std::string::npos)));
+        std::shared_ptr< iAtomic > value(lookupBase(key.substr(1, std::string::npos)));
         if(0 != value.get())
         {
             return value;
@@ -2208,16 +2425,63 @@ std::shared_ptr< dish::iAtomic > dish::LanguageSymbolTable::Lookup(const std::st
     throw NoSuchSymbolException(message.str());
 }
 
+std::shared_ptr< dish::iAtomic > dish::LanguageSymbolTable::LookupInterned(const int &id, const std::string &key) const
+{
+    //  The id is that of the key without a leading backtick, so a key with
+    //  one is looked up by name.
+    if(BeginsWith(key, '`'))
+    {
+        return Lookup(key);
+    }
+    
+    std::shared_ptr< iAtomic > value(mStack.LookupInterned(id, key));
+    if(0 != value.get())
+    {
+        return value;
+    }
+    
+    value = lookupBase(id, key);
+    if(0 != value.get())
+    {
+        return value;
+    }
+        
+    std::stringstream message;
+    message << "The symbol '";
+    message << key;
+    message << "' does not exist.";
+    
+    throw NoSuchSymbolException(message.str());
+}
+
+std::shared_ptr< dish::iAtomic > dish::LanguageSymbolTable::LookupSlot(const int &slot, const std::string &key) const
+{
+    return mStack.Lookup(0, slot, 0, key);
+}
+
+bool dish::LanguageSymbolTable::BindsExecutable() const
+{
+    return true;
+}
+
 void dish::LanguageSymbolTable::Load(dish::iSymbolTable &symtab, const dish::iSymbolTable::CloneT &type) const
 {
+    materializeAll();
+    
     mBase->Load(symtab, type);
     mStack.Load(symtab, type);
 }
 
 void dish::LanguageSymbolTable::Clear()
 {
+    ++Epoch;
+    
     mStack.Clear();
     mBase->Clear();
+    
+    //  Leave the run-time library cleared along with the rest of the table.
+    mMaterialized->assign(mMaterialized->size(), true);
+    mLoaded->assign(mLoaded->size(), true);
 }
 
 void dish::LanguageSymbolTable::Histogram(std::ostream &out) const
@@ -2246,6 +2510,8 @@ void dish::LanguageSymbolTable::Print(std::ostream &out, const std::string::size
     out << std::endl;
     out << std::endl;
     
+    materializeAll();
+    
     printIndent(out, indent);
     out << "System Table:" << std::endl;
     out << std::endl;
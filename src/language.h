@@ -29,6 +29,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "atomics.h"
 #include "inline.h"
@@ -47,14 +48,61 @@ namespace dish
             
             std::shared_ptr< ExecutionProfile > mProfile;
             
+            std::shared_ptr< iAtomic > mReturnValue;
+            
+            const iAtomic *mFunction;
+            int mFunctionDepth;
+            bool mTailCalls;
+            
+            std::shared_ptr< iAtomic > mTailFunction;
+            std::shared_ptr< iSymbolTable > mTailFrame;
+            
+            //  One flag for each function of the run-time library, and one for
+            //  each library module, set once it has been created or loaded into
+            //  the base table. Shared, like the base table, by minimal clones.
+            std::shared_ptr< std::vector< bool > > mMaterialized;
+            std::shared_ptr< std::vector< bool > > mLoaded;
+            
+            static IntegerT Epoch;
+            static int MaterializedCount;
+            static int LoadedCount;
+            
         protected:
             void insert(const std::string &key, std::shared_ptr< dish::iAtomic > value) const;
+            
+            //  Loads the library module binding the key as a value, or creates
+            //  the functions of the run-time library named by the executable
+            //  key (name_N), if not done already. Returns true if the base
+            //  table gained a symbol.
+            bool materialize(const std::string &key) const;
+            void materializeAll() const;
+            void load(const int &library) const;
+            
+            std::shared_ptr< iAtomic > lookupBase(const std::string &key) const;
+            std::shared_ptr< iAtomic > lookupBase(const int &id, const std::string &key) const;
         
         public:
             LanguageSymbolTable(const bool &profile, const int &maxdepth = dish::StackedSymbolTable::INFINITE_STACK_DEPTH);
             LanguageSymbolTable(const LanguageSymbolTable &symtab, const CloneT &type = cloneMinimal);
            
             std::shared_ptr< iAtomic > LookupInBase(const std::string &key) const;
+            std::shared_ptr< iAtomic > LookupInBase(const int &id, const std::string &key) const;
+            
+            //  Looks up a symbol the parser resolved to a slot in the frame
+            //  depth levels below the top of the stack. Falls back to a lookup
+            //  by name if the frame does not bind key to that slot, or if the
+            //  nearer frames hold other than the nearer symbols the parser saw
+            //  declared, e.g. one declared by a function called since.
+            INLINE std::shared_ptr< iAtomic > Lookup(const int &depth, const int &slot, const int &nearer, const std::string &key) const
+            {
+                std::shared_ptr< iAtomic > value(mStack.Lookup(depth, slot, nearer, key));
+                if(value)
+                {
+                    return value;
+                }
+                
+                return Lookup(key);
+            }
             
             static INLINE std::shared_ptr< iSymbolTable > MakeSystemSymbolTable()
             {
@@ -67,12 +115,64 @@ namespace dish
 #endif
             }
             
+            //  Returns an empty frame for the actual parameters of a call.
+            INLINE std::shared_ptr< FrameSymbolTable > NewFrame(const int &size = 0) { return mStack.NewFrame(size); };
+            
             INLINE int StackDepth() const { return mStack.Num(); };
+            INLINE int NumScopes() const throw() { return mStack.NumTables(); };
             INLINE int MaxStackDepthAttained() const throw() { return mStack.MaxDepthAttained(); };
             
             INLINE bool CollectExecutionProfile() const { return (0 != mProfile.get()); };
             INLINE ExecutionProfile &ProfileInformation() const { assert(CollectExecutionProfile()); return *mProfile; };
             
+            //  Completion status of a return statement. The value is set when
+            //  the statement executes and taken by the function (or program)
+            //  it returns from; statements which execute other statements stop
+            //  as soon as it is set.
+            INLINE bool IsReturning() const throw() { return (0 != mReturnValue.get()); };
+            INLINE void SetReturnValue(std::shared_ptr< iAtomic > value) { assert(value); mReturnValue = value; };
+            INLINE std::shared_ptr< iAtomic > TakeReturnValue() { std::shared_ptr< iAtomic > value; value.swap(mReturnValue); return value; };
+            
+            //  The user-defined function whose body is executing, if any, and
+            //  the number of scopes on the stack when it was entered.
+            INLINE const iAtomic *Function() const throw() { return mFunction; };
+            INLINE void SetFunction(const iAtomic *function) throw() { mFunction = function; };
+            INLINE const int &FunctionDepth() const throw() { return mFunctionDepth; };
+            INLINE void SetFunctionDepth(const int &depth) throw() { mFunctionDepth = depth; };
+            
+            //  True if every symbol of the scopes above the lowest depth is
+            //  bound under the name of a parameter of function.
+            bool ScopesHoldOnlyParameters(const int &depth, const iAtomic &function) const;
+            
+            //  Set if calls in tail position may be made in place of the
+            //  caller.
+            INLINE bool EliminateTailCalls() const throw() { return mTailCalls; };
+            INLINE void SetEliminateTailCalls(const bool &eliminate) { mTailCalls = eliminate; };
+            
+            //  A call in tail position completes the executing function like a
+            //  return statement; the function then executes the callee, with
+            //  its frame of actual parameters (if any), in place of itself.
+            INLINE bool IsTailCalling() const throw() { return (0 != mTailFunction.get()); };
+            void SetTailCall(std::shared_ptr< iAtomic > function, std::shared_ptr< iSymbolTable > frame);
+            INLINE std::shared_ptr< iAtomic > TakeTailCall(std::shared_ptr< iSymbolTable > &frame) { std::shared_ptr< iAtomic > function; function.swap(mTailFunction); frame.swap(mTailFrame); mTailFrame.reset(); mReturnValue.reset(); return function; };
+            
+            //  Advanced whenever a key under which an executable may be bound
+            //  is inserted, or a table binding one is pushed or popped; a
+            //  function resolved by name stays valid while it is unchanged.
+            static INLINE const IntegerT &CurrentEpoch() throw() { return Epoch; };
+            
+            //  The number of functions in the run-time library, and the number
+            //  created because a program looked one of them up; likewise for
+            //  the library modules.
+            static int NumBuiltins();
+            static INLINE int GetMaterializedCount() throw() { return MaterializedCount; };
+            static int NumLibraries();
+            static INLINE int GetLoadedCount() throw() { return LoadedCount; };
+            
+            //  Creates every function, and loads every module, of the run-time
+            //  library now rather than on first use.
+            INLINE void LoadLibraries() { materializeAll(); };
+            
             //  From iSymbolTable
             
             virtual std::shared_ptr< iSymbolTable > Clone(const CloneT &type = cloneMinimal) const;
@@ -89,6 +189,10 @@ namespace dish
             virtual bool Exists(const std::string &key) const;
             virtual void Insert(const std::string &key, std::shared_ptr< iAtomic > value);
             virtual std::shared_ptr< iAtomic > Lookup(const std::string &key) const;
+            virtual std::shared_ptr< iAtomic > LookupSlot(const int &slot, const std::string &key) const;
+            virtual std::shared_ptr< iAtomic > LookupInterned(const int &id, const std::string &key) const;
+            
+            virtual bool BindsExecutable() const;
             
             virtual void Load(iSymbolTable &symtab, const CloneT &type = cloneMinimal) const;
             
@@ -101,6 +205,23 @@ namespace dish
             virtual void Print(std::ostream &out, const std::string::size_type &indent = 0) const;
         
     };
+    
+    ////////////////////////////////////////////////////////////////////////////
+    
+    //  Records function as the one executing, entered with the stack as it is
+    //  now, for the lifetime of the object.
+    class ScopedFunction
+    {
+        private:
+            LanguageSymbolTable &mSymbolTable;
+            const iAtomic * const mPrevious;
+            const int mPreviousDepth;
+            
+        public:
+            INLINE ScopedFunction(LanguageSymbolTable &symtab, const iAtomic *function) : mSymbolTable(symtab), mPrevious(symtab.Function()), mPreviousDepth(symtab.FunctionDepth()) { mSymbolTable.SetFunction(function); mSymbolTable.SetFunctionDepth(mSymbolTable.NumScopes()); };
+            INLINE ~ScopedFunction() { mSymbolTable.SetFunction(mPrevious); mSymbolTable.SetFunctionDepth(mPreviousDepth); };
+            
+    };
 
 }
 
@@ -40,6 +40,7 @@
 #include "langtxtio.h"
 #include "language.h"
 #include "log.h"
+#include "optimizer.h"
 #include "parser.h"
 #include "ptnode.h"
 #include "textio.h"
@@ -218,6 +219,29 @@ int main(const int argc, const char * const * const argv)
                 parser->SymbolTable().Shuffle();
             }
             
+            //  Load the whole run-time library up front, if requested, rather
+            //  than each module on first use.
+            if(cmdln.EagerLibraries())
+            {
+                parser->SymbolTable().LoadLibraries();
+            }
+            
+            //  Calls in tail position, including those of a function to itself,
+            //  are only eliminated if requested.
+            parser->SymbolTable().SetEliminateTailCalls(cmdln.EliminateTailCalls());
+            
+            //  The program is parsed, and optimized, as a whole only if
+            //  requested; otherwise each statement is executed once parsed.
+            parser->SetWholeProgram(cmdln.Optimize());
+            parser->SetInlining(cmdln.InlineFunctions() ? cmdln.InlineSize() : 0, cmdln.InlineAfter());
+            
+            //  Imported files are loaded from a parse-tree cache, if requested,
+            //  rather than parsed on every run.
+            if(cmdln.ParseTreeCache())
+            {
+                parser->SetParseTreeCache(cmdln.ParseTreeCacheDirectory());
+            }
+            
             //  Pass the command-line arguments to the program.
             {
                 std::shared_ptr< dish::CommandLine::iValue > pargs(cmdln[dish::DishCommandLine::PROGRAM_ARGS]);
@@ -368,9 +392,19 @@ int main(const int argc, const char * const * const argv)
                         parser->SymbolTable().Histogram(std::cout);
                         std::cout << std::endl;
                         std::cout << "Hashed Table Lookups: " << dish::HashedSymbolTable::GetLookupCount() << std::endl;
+                        std::cout << " Hashed Table Probes: " << dish::HashedSymbolTable::GetProbeCount() << std::endl;
                         std::cout << " Basic Table Lookups: " << dish::BasicSymbolTable::GetLookupCount() << std::endl;
+                        std::cout << " Frame Table Lookups: " << dish::FrameSymbolTable::GetLookupCount() << std::endl;
+                        std::cout << "  Frame Slot Lookups: " << dish::FrameSymbolTable::GetSlotLookupCount() << std::endl;
+                        std::cout << "    Frames Allocated: " << dish::StackedSymbolTable::GetFrameAllocationCount() << std::endl;
+                        std::cout << "       Frames Reused: " << dish::StackedSymbolTable::GetFrameReuseCount() << std::endl;
                         std::cout << std::endl;
                         std::cout << " Maximum Table Depth: " << parser->SymbolTable().MaxStackDepthAttained() << std::endl;
+                        std::cout << "       Interned Keys: " << dish::InternedKeys::Num() << std::endl;
+                        std::cout << "  Builtins Available: " << dish::LanguageSymbolTable::NumBuiltins() << std::endl;
+                        std::cout << "    Builtins Created: " << dish::LanguageSymbolTable::GetMaterializedCount() << std::endl;
+                        std::cout << " Libraries Available: " << dish::LanguageSymbolTable::NumLibraries() << std::endl;
+                        std::cout << "    Libraries Loaded: " << dish::LanguageSymbolTable::GetLoadedCount() << std::endl;
                     }
                     
                     //  Print the symbol-table contents if specified on the
@@ -457,11 +491,36 @@ int main(const int argc, const char * const * const argv)
                         std::cout << std::endl;
                         std::cout << std::endl;
                         std::cout << "             # Cached ID Nodes: " << dish::IdentifierParseTreeNode::NumCachedNodes() << std::endl;
+                        std::cout << "           # Resolved ID Nodes: " << dish::IdentifierParseTreeNode::NumResolved() << std::endl;
                         std::cout << "# Cached Integer Literal Nodes: " << dish::LiteralParseTreeNode::NumCachedIntegerLiteralNodes() << std::endl;
                         std::cout << "   # Cached Real Literal Nodes: " << dish::LiteralParseTreeNode::NumCachedRealLiteralNodes() << std::endl;
                         std::cout << " # Cached String Literal Nodes: " << dish::LiteralParseTreeNode::NumCachedStringLiteralNodes() << std::endl;
                         std::cout << "          # Cached Expressions: " << parser->NumCachedExpressions() << std::endl;
                         std::cout << "         # Cached Declarations: " << parser->NumCachedDeclarations() << std::endl;
+                        std::cout << "          # Shared Expressions: " << parser->NumSharedExpressions() << std::endl;
+                        std::cout << "         # Shared Declarations: " << parser->NumSharedDeclarations() << std::endl;
+                        std::cout << "        # Call-site Cache Hits: " << dish::FunctionCallParseTreeNode::NumCacheHits() << std::endl;
+                        std::cout << "      # Call-site Cache Misses: " << dish::FunctionCallParseTreeNode::NumCacheMisses() << std::endl;
+                        std::cout << "          # Unboxed Operations: " << dish::ParseTreeNode::NumUnboxedOperations() << std::endl;
+                        std::cout << "  # Generic Operator Fallbacks: " << dish::ParseTreeNode::NumGenericFallbacks() << std::endl;
+                        std::cout << "         # Boxed Value Handles: " << dish::ValueHandle::NumBoxes() << std::endl;
+                        std::cout << " # Counted For-Loop Iterations: " << dish::ForLoopParseTreeNode::NumCountedIterations() << std::endl;
+                        std::cout << "     # Shared Aggregate Copies: " << (dish::ArrayValue::NumShares() + dish::DictionaryValue::NumShares() + dish::StructureValue::NumShares()) << std::endl;
+                        std::cout << "  # Aggregate Storage Unshares: " << (dish::ArrayValue::NumUnshares() + dish::DictionaryValue::NumUnshares() + dish::StructureValue::NumUnshares()) << std::endl;
+                        std::cout << "               # Packed Arrays: " << dish::ArrayValue::NumPacks() << std::endl;
+                        std::cout << "      # Packed Element Proxies: " << dish::ArrayValue::NumProxies() << std::endl;
+                        std::cout << "            # Structure Shapes: " << dish::StructureShape::NumInstances() << std::endl;
+                        std::cout << "         # Integer-Key Lookups: " << dish::DictionaryValue::NumIntegerLookups() << std::endl;
+                        std::cout << "         # Single-Block Values: " << dish::SharedHeap::NumAllocations() << std::endl;
+                        std::cout << "       # Tail Calls Eliminated: " << dish::FunctionParseTreeNode::NumTailCalls() << std::endl;
+                        std::cout << "    # Empty Statements Removed: " << dish::EmptyStatementPass::NumRemoved() << std::endl;
+                        std::cout << "     # Parse-Tree Nodes Folded: " << dish::ConstantFoldingPass::NumFolded() << std::endl;
+                        std::cout << "    # Constant Uses Propagated: " << dish::ConstantPropagationPass::NumPropagated() << std::endl;
+                        std::cout << "          # Call Sites Inlined: " << dish::FunctionInliningPass::NumInlined() << std::endl;
+                        std::cout << "          # Inlined Calls Made: " << dish::FunctionCallParseTreeNode::NumInlinedCalls() << std::endl;
+                        std::cout << "   # Cached Parse-Trees Loaded: " << dish::ParseTreeCache::NumLoaded() << std::endl;
+                        std::cout << "   # Cached Parse-Trees Stored: " << dish::ParseTreeCache::NumStored() << std::endl;
+                        std::cout << "     # Stale Parse-Tree Caches: " << dish::ParseTreeCache::NumRejected() << std::endl;
                         std::cout << std::endl;
                     }
                     
@@ -0,0 +1,617 @@
+/*
+    This file is part of the DISH programming language, Copyright 2014-2017 by 
+    Chris Buck.
+    
+    DISH is free software for non-commercial use; you can redistribute it and/or
+    modify it provided
+    
+        (1) The following Copyright notice is displayed at runtime and in any
+            accompanying documentation:
+    
+            DISH programming language copyright (c) 2014-2017 by Chris Buck.
+        
+        (2) All source files duplicate this copyright statement in full.
+        
+    Commercial licenses can be negotiated by contacting Chris Buck at
+    chrisbuck1220@hotmail.com.
+
+    DISH is distributed in the hope that it will be useful, but WITHOUT ANY 
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS 
+    FOR A PARTICULAR PURPOSE.
+*/
+
+#include "optimizer.h"
+
+#include <cassert>
+#include <set>
+#include <typeinfo>
+
+#include "exception.h"
+#include "langid.h"
+#include "log.h"
+
+/******************************************************************************
+
+    dish::RewritePass class definitions
+
+ ******************************************************************************/
+ 
+dish::IntegerT dish::RewritePass::Visited(0);
+
+void dish::RewritePass::rewrite(std::shared_ptr< dish::iParseTreeNode > &node)
+{
+    assert(node);
+    
+    iParseTreeNode::ChildListT children;
+    node->Children(children);
+    
+    bool replaced(false);
+    
+    for(iParseTreeNode::ChildListT::iterator i(children.begin()), last_i(children.end()); i != last_i; ++i)
+    {
+        const iParseTreeNode * const child((*i)->get());
+        
+        rewrite(**i);
+        
+        replaced = replaced || (child != (*i)->get());
+    }
+    
+    if(replaced)
+    {
+        node->ChildrenReplaced();
+    }
+    
+    ++Visited;
+    Optimize(node);
+}
+
+void dish::RewritePass::Run(std::shared_ptr< dish::iParseTreeNode > &program)
+{
+    rewrite(program);
+}
+
+/******************************************************************************
+
+    dish::EmptyStatementPass class definitions
+
+ ******************************************************************************/
+ 
+dish::IntegerT dish::EmptyStatementPass::Removed(0);
+
+const std::string &dish::EmptyStatementPass::Name() const
+{
+    static const std::string NameStr("empty statements");
+    
+    return NameStr;
+}
+
+void dish::EmptyStatementPass::Optimize(std::shared_ptr< dish::iParseTreeNode > &node)
+{
+    //  Only lists of statements can have statements removed from them.
+    const std::type_info &type(typeid(*node));
+    
+    if((typeid(StatementBlockParseTreeNode) == type) || (typeid(ModuleParseTreeNode) == type) || (typeid(RepeatUntilLoopParseTreeNode) == type))
+    {
+        iParseTreeNode::ChildListT statements;
+        node->Children(statements);
+        
+        IntegerT removed(0);
+        
+        for(iParseTreeNode::ChildListT::iterator i(statements.begin()), last_i(statements.end()); i != last_i; ++i)
+        {
+            if(typeid(NullParseTreeNode) == typeid(***i))
+            {
+                (*i)->reset();
+                ++removed;
+            }
+        }
+        
+        if(removed > 0)
+        {
+            node->ChildrenReplaced();
+            Removed += removed;
+        }
+    }
+}
+
+/******************************************************************************
+
+    dish::ConstantFoldingPass class definitions
+
+ ******************************************************************************/
+ 
+dish::IntegerT dish::ConstantFoldingPass::Folded(0);
+
+const std::string &dish::ConstantFoldingPass::Name() const
+{
+    static const std::string NameStr("constant folding");
+    
+    return NameStr;
+}
+
+bool dish::ConstantFoldingPass::isFoldable(const std::shared_ptr< dish::iParseTreeNode > &node)
+{
+    iParseTreeNode::ChildListT operands;
+    node->Children(operands);
+    
+    //  The operands are visited first, so one which is not a literal by now
+    //  could not be evaluated; neither can the operator.
+    for(iParseTreeNode::ChildListT::const_iterator i(operands.begin()), last_i(operands.end()); i != last_i; ++i)
+    {
+        if(typeid(LiteralParseTreeNode) != typeid(***i))
+        {
+            return false;
+        }
+    }
+    
+    if(typeid(PowOpParseTreeNode) == typeid(*node))
+    {
+        assert(2 == operands.size());
+        
+        const std::shared_ptr< iAtomic > base(static_cast< const LiteralParseTreeNode & >(**operands[0]).Value());
+        const std::shared_ptr< iAtomic > expon(static_cast< const LiteralParseTreeNode & >(**operands[1]).Value());
+        
+        if((iAtomic::typeInteger == base->Type()) && (iAtomic::typeInteger == expon->Type()) && (expon->AsInteger() < 0))
+        {
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+void dish::ConstantFoldingPass::Optimize(std::shared_ptr< dish::iParseTreeNode > &node)
+{
+    if((typeid(LiteralParseTreeNode) != typeid(*node)) && node->IsLiteral() && isFoldable(node))
+    {
+        std::shared_ptr< iAtomic > value;
+        
+        try
+        {
+            value = node->Execute();
+        }
+        
+        catch(DishException &)
+        {
+            return;
+        }
+        
+        node = (SourceLocationTable::NO_LOCATION == node->Location()) ? LiteralParseTreeNode::MakeValue(value) : LiteralParseTreeNode::MakeValue(node->Location(), value);
+        ++Folded;
+    }
+}
+
+/******************************************************************************
+
+    dish::ConstantPropagationPass class definitions
+
+ ******************************************************************************/
+ 
+dish::IntegerT dish::ConstantPropagationPass::Propagated(0);
+
+std::shared_ptr< dish::iAtomic > dish::ConstantPropagationPass::constant(const std::shared_ptr< dish::iParseTreeNode > &declaration, const std::shared_ptr< dish::iParseTreeNode > &lock) const
+{
+    //  The names the run-time binds for error and graphics callbacks.
+    static const std::string ErrName("err");
+    static const std::string InfoName("info");
+
+    if((typeid(AssignmentParseTreeNode) != typeid(*declaration)) || (typeid(LockParseTreeNode) != typeid(*lock)))
+    {
+        return std::shared_ptr< iAtomic >();
+    }
+    
+    const AssignmentParseTreeNode &assignment(static_cast< const AssignmentParseTreeNode & >(*declaration));
+    
+    if((typeid(DeclareParseTreeNode) != typeid(*assignment.LeftHandSide())) || (typeid(LiteralParseTreeNode) != typeid(*assignment.RightHandSide())))
+    {
+        return std::shared_ptr< iAtomic >();
+    }
+    
+    const DeclareParseTreeNode &declare(static_cast< const DeclareParseTreeNode & >(*assignment.LeftHandSide()));
+    const std::string &id(declare.Id());
+    
+    if((id != static_cast< const LockParseTreeNode & >(*lock).Id()) || (ErrName == id) || (InfoName == id))
+    {
+        return std::shared_ptr< iAtomic >();
+    }
+    
+    const DeclarationCountT::const_iterator count(mDeclarations.find(id));
+    
+    if((mDeclarations.end() == count) || (1 != count->second))
+    {
+        return std::shared_ptr< iAtomic >();
+    }
+    
+    //  The value the variable ends up with must be the literal itself, not a
+    //  conversion of it.
+    std::shared_ptr< iAtomic > value(static_cast< const LiteralParseTreeNode & >(*assignment.RightHandSide()).Value());
+    
+    const std::type_info &type(typeid(*declare.Type()));
+    
+    switch(value->Type())
+    {
+        case iAtomic::typeBoolean:
+            return (typeid(BooleanTypeParseTreeNode) == type) ? value : std::shared_ptr< iAtomic >();
+            
+        case iAtomic::typeInteger:
+            return (typeid(IntegerTypeParseTreeNode) == type) ? value : std::shared_ptr< iAtomic >();
+            
+        case iAtomic::typeReal:
+            return (typeid(RealTypeParseTreeNode) == type) ? value : std::shared_ptr< iAtomic >();
+            
+        case iAtomic::typeString:
+            return (typeid(StringTypeParseTreeNode) == type) ? value : std::shared_ptr< iAtomic >();
+        
+        default:
+            break;
+    
+    }
+    
+    return std::shared_ptr< iAtomic >();
+}
+
+void dish::ConstantPropagationPass::propagate(dish::iParseTreeNode &module)
+{
+    iParseTreeNode::ChildListT statements;
+    module.Children(statements);
+    
+    for(iParseTreeNode::ChildListT::size_type i(0); i != statements.size(); ++i)
+    {
+        std::shared_ptr< iParseTreeNode > &statement(*statements[i]);
+        
+        if(typeid(ModuleParseTreeNode) == typeid(*statement))
+        {
+            propagate(*statement);
+            continue;
+        }
+        
+        if(!mConstants.empty())
+        {
+            rewrite(statement);
+        }
+        
+        if((i + 1) != statements.size())
+        {
+            std::shared_ptr< iAtomic > value(constant(statement, *statements[i + 1]));
+            
+            if(value)
+            {
+                mConstants[static_cast< const LockParseTreeNode & >(**statements[i + 1]).Id()] = value;
+                ++i;
+            }
+        }
+    }
+}
+
+const std::string &dish::ConstantPropagationPass::Name() const
+{
+    static const std::string NameStr("constant propagation");
+    
+    return NameStr;
+}
+
+void dish::ConstantPropagationPass::Run(std::shared_ptr< dish::iParseTreeNode > &program)
+{
+    assert(program);
+    
+    mConstants.clear();
+    propagate(*program);
+}
+
+void dish::ConstantPropagationPass::Optimize(std::shared_ptr< dish::iParseTreeNode > &node)
+{
+    iParseTreeNode::ChildListT children;
+    node->Children(children);
+    
+    //  The operators make a new value of their own from a literal operand,
+    //  which can then be unboxed; anywhere else the constant must stay locked.
+    const iParseTreeNode * const parent(node.get());
+    const bool operand(
+        (0 != dynamic_cast< const OneOprParseTreeNode * >(parent)) ||
+        (0 != dynamic_cast< const TwoOprParseTreeNode * >(parent)) ||
+        (0 != dynamic_cast< const ChainedOprParseTreeNode * >(parent))
+    );
+    
+    bool replaced(false);
+    
+    for(iParseTreeNode::ChildListT::iterator i(children.begin()), last_i(children.end()); i != last_i; ++i)
+    {
+        std::shared_ptr< iParseTreeNode > &child(**i);
+        
+        if(typeid(IdentifierParseTreeNode) == typeid(*child))
+        {
+            const IdentifierParseTreeNode &identifier(static_cast< const IdentifierParseTreeNode & >(*child));
+            const ConstantMapT::const_iterator constant(identifier.IsBaseId() ? mConstants.end() : mConstants.find(identifier.Id()));
+            
+            if(mConstants.end() != constant)
+            {
+                std::shared_ptr< iAtomic > value(constant->second->Clone());
+                
+                if(!operand)
+                {
+                    value->Lock();
+                }
+                
+                child = (SourceLocationTable::NO_LOCATION == child->Location()) ? LiteralParseTreeNode::MakeValue(value) : LiteralParseTreeNode::MakeValue(child->Location(), value);
+                
+                replaced = true;
+                ++Propagated;
+            }
+        }
+    }
+    
+    if(replaced)
+    {
+        node->ChildrenReplaced();
+        mFolding.Optimize(node);
+    }
+}
+
+/******************************************************************************
+
+    dish::FunctionInliningPass class definitions
+
+ ******************************************************************************/
+ 
+dish::IntegerT dish::FunctionInliningPass::Inlined(0);
+
+bool dish::FunctionInliningPass::isPure(const std::string &id)
+{
+    //  Functions of the run-time which only compute their result from their
+    //  actual parameters. Others, such as SymbolExists() or
+    //  DEBUG_CurrentStackDepth(), inspect the symbol-table or the stack and
+    //  would see a difference once the call which they are made from is gone.
+    static const std::set< std::string > Pure(
+        {
+            DISH_LANGID_AsBoolean, DISH_LANGID_AsInteger, DISH_LANGID_AsReal, DISH_LANGID_AsString,
+            DISH_LANGID_IsNull, DISH_LANGID_IsBoolean, DISH_LANGID_IsInteger, DISH_LANGID_IsReal, DISH_LANGID_IsString,
+            DISH_LANGID_MinimumFunction, DISH_LANGID_MaximumFunction,
+            DISH_LANGID_IsOddFunction, DISH_LANGID_IsEvenFunction,
+            DISH_LANGID_AbsFunction, DISH_LANGID_WholeFunction, DISH_LANGID_FractionFunction, DISH_LANGID_SignOfFunction,
+            DISH_LANGID_SqrFunction, DISH_LANGID_SqrtFunction, DISH_LANGID_CubeFunction, DISH_LANGID_CbrtFunction,
+            DISH_LANGID_DegToRadFunction, DISH_LANGID_RadToDegFunction,
+            DISH_LANGID_SinFunction, DISH_LANGID_CosFunction, DISH_LANGID_TanFunction,
+            DISH_LANGID_ArcSinFunction, DISH_LANGID_ArcCosFunction, DISH_LANGID_ArcTanFunction,
+            DISH_LANGID_SinhFunction, DISH_LANGID_CoshFunction, DISH_LANGID_TanhFunction,
+            DISH_LANGID_LnFunction, DISH_LANGID_LogFunction, DISH_LANGID_ExpFunction,
+            DISH_LANGID_RoundFunction, DISH_LANGID_FloorFunction, DISH_LANGID_CeilFunction,
+            DISH_LANGID_Ord, DISH_LANGID_Chr, DISH_LANGID_ToUpperCase, DISH_LANGID_ToLowerCase,
+            DISH_LANGID_StrLeft, DISH_LANGID_StrRight, DISH_LANGID_StrMiddle,
+            DISH_LANGID_StrBeginsWith, DISH_LANGID_StrEndsWith, DISH_LANGID_StrFind,
+            DISH_LANGID_StrTrimLeading, DISH_LANGID_StrTrimTrailing, DISH_LANGID_StrReverse
+        }
+    );
+    
+    //  Calls are made by the name mangled with the number of parameters.
+    const std::string::size_type mangle(id.rfind('_'));
+    
+    return (Pure.end() != Pure.find((std::string::npos != mangle) ? id.substr(0, mangle) : id));
+}
+
+void dish::FunctionInliningPass::collect(dish::iParseTreeNode &node)
+{
+    if(typeid(DeclareFunctionParseTreeNode) == typeid(node))
+    {
+        const DeclareFunctionParseTreeNode &function(static_cast< const DeclareFunctionParseTreeNode & >(node));
+        std::shared_ptr< InlinedFunction > inlined(inlinable(function));
+        
+        if(inlined)
+        {
+            mFunctions[function.Id()] = inlined;
+        }
+    }
+    
+    iParseTreeNode::ChildListT children;
+    node.Children(children);
+    
+    for(iParseTreeNode::ChildListT::iterator i(children.begin()), last_i(children.end()); i != last_i; ++i)
+    {
+        collect(***i);
+    }
+}
+
+std::shared_ptr< dish::InlinedFunction > dish::FunctionInliningPass::inlinable(const dish::DeclareFunctionParseTreeNode &function) const
+{
+    //  Only a function declared once can be known to be the one called.
+    const DeclarationCountT::const_iterator count(mDeclarations.find(function.Id()));
+    
+    if((mDeclarations.end() == count) || (1 != count->second) || (static_cast< int >(function.FormalParameters().size()) > InlinedFunction::MAX_PARAMETERS))
+    {
+        return std::shared_ptr< InlinedFunction >();
+    }
+    
+    //  The body must be a return statement, on its own or in a block.
+    std::shared_ptr< iParseTreeNode > statement(function.Body());
+    
+    if(typeid(StatementBlockParseTreeNode) == typeid(*statement))
+    {
+        iParseTreeNode::ChildListT statements;
+        statement->Children(statements);
+        
+        if(1 != statements.size())
+        {
+            return std::shared_ptr< InlinedFunction >();
+        }
+        
+        statement = *statements.front();
+    }
+    
+    if(typeid(ReturnParseTreeNode) != typeid(*statement))
+    {
+        return std::shared_ptr< InlinedFunction >();
+    }
+    
+    std::shared_ptr< InlinedFunction > inlined(new InlinedFunction(function.Body(), function.FormalParameters()));
+    
+    int size(0);
+    std::shared_ptr< iParseTreeNode > expr(copy(static_cast< const ReturnParseTreeNode & >(*statement).Expression(), *inlined, size));
+    
+    if(!expr)
+    {
+        return std::shared_ptr< InlinedFunction >();
+    }
+    
+    inlined->SetExpression(expr);
+    
+    return inlined;
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::FunctionInliningPass::copy(const std::shared_ptr< dish::iParseTreeNode > &expr, const dish::InlinedFunction &function, int &size) const
+{
+    if(++size > mMaxSize)
+    {
+        return std::shared_ptr< iParseTreeNode >();
+    }
+    
+    const std::type_info &type(typeid(*expr));
+    
+    if(typeid(LiteralParseTreeNode) == type)
+    {
+        return expr;
+    }
+    
+    if(typeid(IdentifierParseTreeNode) == type)
+    {
+        const IdentifierParseTreeNode &identifier(static_cast< const IdentifierParseTreeNode & >(*expr));
+        
+        if(!identifier.IsBaseId())
+        {
+            const InlinedFunction::ParamListT &params(function.FormalParameters());
+            
+            for(InlinedFunction::ParamListT::size_type i(0); i != params.size(); ++i)
+            {
+                if(identifier.Id() == params[i].first)
+                {
+                    const int param(static_cast< int >(i));
+                    
+                    return (SourceLocationTable::NO_LOCATION == expr->Location()) ? InlinedParameterParseTreeNode::MakeValue(function, param) : InlinedParameterParseTreeNode::MakeValue(expr->Location(), function, param);
+                }
+            }
+        }
+        
+        return expr;
+    }
+    
+    if(typeid(FunctionCallParseTreeNode) == type)
+    {
+        //  Only the pure functions of the run-time may be called, looked up by
+        //  a name which the program never declares.
+        const std::shared_ptr< iParseTreeNode > &callee(static_cast< const FunctionCallParseTreeNode & >(*expr).Function());
+        
+        if((typeid(IdentifierParseTreeNode) != typeid(*callee)) || static_cast< const IdentifierParseTreeNode & >(*callee).IsResolved() || (mDeclarations.end() != mDeclarations.find(static_cast< const IdentifierParseTreeNode & >(*callee).Id())) || !isPure(static_cast< const IdentifierParseTreeNode & >(*callee).Id()))
+        {
+            return std::shared_ptr< iParseTreeNode >();
+        }
+    }
+    
+    //  Only nodes which can be copied, i.e., operators, indices, members and
+    //  calls, can be inlined.
+    std::shared_ptr< iParseTreeNode > node(expr->Copy());
+    
+    if(!node)
+    {
+        return node;
+    }
+    
+    iParseTreeNode::ChildListT children;
+    node->Children(children);
+    
+    for(iParseTreeNode::ChildListT::iterator i(children.begin()), last_i(children.end()); i != last_i; ++i)
+    {
+        **i = copy(**i, function, size);
+        
+        if(!**i)
+        {
+            return std::shared_ptr< iParseTreeNode >();
+        }
+    }
+    
+    node->ChildrenReplaced();
+    
+    return node;
+}
+
+const std::string &dish::FunctionInliningPass::Name() const
+{
+    static const std::string NameStr("function inlining");
+    
+    return NameStr;
+}
+
+void dish::FunctionInliningPass::Run(std::shared_ptr< dish::iParseTreeNode > &program)
+{
+    assert(program);
+    
+    mFunctions.clear();
+    collect(*program);
+    
+    if(!mFunctions.empty())
+    {
+        rewrite(program);
+    }
+}
+
+void dish::FunctionInliningPass::Optimize(std::shared_ptr< dish::iParseTreeNode > &node)
+{
+    //  A call in tail position is only reached through its return statement.
+    iParseTreeNode *call(node.get());
+    
+    if((typeid(ReturnParseTreeNode) == typeid(*call)) && static_cast< const ReturnParseTreeNode & >(*call).IsTailCall())
+    {
+        call = static_cast< const ReturnParseTreeNode & >(*call).Expression().get();
+    }
+    
+    if(typeid(FunctionCallParseTreeNode) != typeid(*call))
+    {
+        return;
+    }
+    
+    FunctionCallParseTreeNode &fcall(static_cast< FunctionCallParseTreeNode & >(*call));
+    const iParseTreeNode &callee(*fcall.Function());
+    
+    if((typeid(IdentifierParseTreeNode) != typeid(callee)) || static_cast< const IdentifierParseTreeNode & >(callee).IsResolved())
+    {
+        return;
+    }
+    
+    const FunctionMapT::const_iterator function(mFunctions.find(static_cast< const IdentifierParseTreeNode & >(callee).Id()));
+    
+    if((mFunctions.end() != function) && !fcall.IsInlined())
+    {
+        fcall.Inline(function->second, mInlineAfter);
+        ++Inlined;
+    }
+}
+
+/******************************************************************************
+
+    dish::Optimizer class definitions
+
+ ******************************************************************************/
+
+dish::Optimizer::Optimizer(const dish::iOptimizationPass::DeclarationCountT &declarations, const int &inlinesize, const dish::IntegerT &inlineafter) : mPasses()
+{
+    Add(std::shared_ptr< iOptimizationPass >(new EmptyStatementPass()));
+    Add(std::shared_ptr< iOptimizationPass >(new ConstantFoldingPass()));
+    Add(std::shared_ptr< iOptimizationPass >(new ConstantPropagationPass(declarations)));
+    
+    if(inlinesize > 0)
+    {
+        Add(std::shared_ptr< iOptimizationPass >(new FunctionInliningPass(declarations, inlinesize, inlineafter)));
+    }
+}
+
+void dish::Optimizer::Run(std::shared_ptr< dish::iParseTreeNode > &program)
+{
+    assert(program);
+    assert(typeid(ModuleParseTreeNode) == typeid(*program));
+    
+    for(PassListT::iterator i(mPasses.begin()), last_i(mPasses.end()); i != last_i; ++i)
+    {
+        dish::Log::Instance().Writeln(dish::Log::logInfo, std::string("Optimizing: ") + (*i)->Name() + "...");
+        
+        (*i)->Run(program);
+        
+        assert(typeid(ModuleParseTreeNode) == typeid(*program));
+    }
+}
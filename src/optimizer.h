@@ -0,0 +1,263 @@
+/*
+    This file is part of the DISH programming language, Copyright 2014-2017 by 
+    Chris Buck.
+    
+    DISH is free software for non-commercial use; you can redistribute it and/or
+    modify it provided
+    
+        (1) The following Copyright notice is displayed at runtime and in any
+            accompanying documentation:
+    
+            DISH programming language copyright (c) 2014-2017 by Chris Buck.
+        
+        (2) All source files duplicate this copyright statement in full.
+        
+    Commercial licenses can be negotiated by contacting Chris Buck at
+    chrisbuck1220@hotmail.com.
+
+    DISH is distributed in the hope that it will be useful, but WITHOUT ANY 
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS 
+    FOR A PARTICULAR PURPOSE.
+*/
+
+#ifndef DISH_OPTIMIZER_H
+#define DISH_OPTIMIZER_H
+
+#include "dishconfig.h"
+
+#include <cassert>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "atomics.h"
+#include "inline.h"
+#include "ptnode.h"
+#include "types.h"
+
+namespace dish
+{
+
+    //  A transformation of the parse-tree of a whole program, applied after it
+    //  is parsed and before any of it is executed.
+    class iOptimizationPass
+    {
+        public:
+        
+            //  The number of times each name is declared, as a variable, type,
+            //  function, reference or parameter, anywhere in the program.
+            using DeclarationCountT = std::map< std::string, IntegerT >;
+        
+            virtual ~iOptimizationPass() {};
+            
+            virtual const std::string &Name() const = 0;
+            
+            //  Transforms the program, a module; the root itself is never
+            //  replaced.
+            virtual void Run(std::shared_ptr< iParseTreeNode > &program) = 0;
+        
+    };
+    
+    //  A pass which rewrites the tree one node at a time.
+    class RewritePass : public iOptimizationPass
+    {
+        private:
+            static IntegerT Visited;
+        
+        protected:
+            //  Visits every node of the subtree in the position given, each
+            //  after its children.
+            void rewrite(std::shared_ptr< iParseTreeNode > &node);
+        
+        public:
+            static INLINE const IntegerT &NumVisited() throw() { return Visited; };
+            
+            //  Called for every node of the tree, after its children, with the
+            //  position holding it; the pass may replace the node there. A node
+            //  reached through more than one position is visited through each.
+            virtual void Optimize(std::shared_ptr< iParseTreeNode > &node) = 0;
+            
+            //  From iOptimizationPass
+            
+            virtual void Run(std::shared_ptr< iParseTreeNode > &program);
+        
+    };
+    
+    ////
+    
+    //  Removes the empty statements (stray semi-colons) from blocks, loop
+    //  bodies and modules.
+    class EmptyStatementPass : public RewritePass
+    {
+        private:
+            static IntegerT Removed;
+        
+        public:
+            static INLINE const IntegerT &NumRemoved() throw() { return Removed; };
+            
+            //  From iOptimizationPass
+            
+            virtual const std::string &Name() const;
+            
+            //  From RewritePass
+            
+            virtual void Optimize(std::shared_ptr< iParseTreeNode > &node);
+        
+    };
+    
+    //  Replaces every operator whose operands are all literals with the literal
+    //  it evaluates to. An operator which fails (e.g. divides by zero) is left
+    //  alone so that the error is still reported when, and if, it executes.
+    //  So is one whose evaluation would stop the interpreter on an assertion,
+    //  since it may never execute at all.
+    class ConstantFoldingPass : public RewritePass
+    {
+        private:
+            static IntegerT Folded;
+            
+            //  True unless an operand was left unfolded or the operator is an
+            //  integer raised to a negative integer power, which Pow() asserts
+            //  against rather than throws.
+            static bool isFoldable(const std::shared_ptr< iParseTreeNode > &node);
+        
+        public:
+            static INLINE const IntegerT &NumFolded() throw() { return Folded; };
+            
+            //  From iOptimizationPass
+            
+            virtual const std::string &Name() const;
+            
+            //  From RewritePass
+            
+            virtual void Optimize(std::shared_ptr< iParseTreeNode > &node);
+        
+    };
+    
+    //  Replaces the uses of constants with their values. Since dish is
+    //  dynamically scoped, a constant is only recognized from a top-level
+    //  statement of the form
+    //
+    //      declare integer as N = 100;
+    //      lock N;
+    //
+    //  where the name is declared nowhere else in the program, and only the
+    //  statements which follow its lock are rewritten. Operators whose operands
+    //  all become literals are then folded.
+    class ConstantPropagationPass : public RewritePass
+    {
+        public:
+        
+            using ConstantMapT = std::map< std::string, std::shared_ptr< iAtomic > >;
+        
+        private:
+            const DeclarationCountT &mDeclarations;
+            
+            ConstantMapT mConstants;
+            ConstantFoldingPass mFolding;
+            
+            static IntegerT Propagated;
+            
+            std::shared_ptr< iAtomic > constant(const std::shared_ptr< iParseTreeNode > &declaration, const std::shared_ptr< iParseTreeNode > &lock) const;
+            
+            void propagate(iParseTreeNode &module);
+        
+        public:
+            INLINE explicit ConstantPropagationPass(const DeclarationCountT &declarations) : RewritePass(), mDeclarations(declarations), mConstants(), mFolding() {};
+        
+            static INLINE const IntegerT &NumPropagated() throw() { return Propagated; };
+            
+            //  From iOptimizationPass
+            
+            virtual const std::string &Name() const;
+            
+            virtual void Run(std::shared_ptr< iParseTreeNode > &program);
+            
+            //  From RewritePass
+            
+            virtual void Optimize(std::shared_ptr< iParseTreeNode > &node);
+        
+    };
+    
+    //  Inlines the functions whose body only returns a small expression into
+    //  the calls made to them by name. The expression may only call the pure
+    //  functions of the run-time, such as Sqrt() or StrLeft(), and none declared
+    //  by the program. An inlined function is therefore never recursive, and
+    //  nothing it calls inspects the symbol-table or the depth of the stack.
+    class FunctionInliningPass : public RewritePass
+    {
+        public:
+        
+            using FunctionMapT = std::map< std::string, std::shared_ptr< InlinedFunction > >;
+        
+        private:
+            const DeclarationCountT &mDeclarations;
+            const int mMaxSize;
+            const IntegerT mInlineAfter;
+            
+            FunctionMapT mFunctions;
+            
+            static IntegerT Inlined;
+            
+            //  Finds the functions which can be inlined.
+            void collect(iParseTreeNode &node);
+            
+            std::shared_ptr< InlinedFunction > inlinable(const DeclareFunctionParseTreeNode &function) const;
+            
+            //  Set if id names a function of the run-time which only computes
+            //  its result from its actual parameters.
+            static bool isPure(const std::string &id);
+            
+            //  Copies the expression for function, counting the nodes copied in
+            //  size; empty if it cannot be inlined.
+            std::shared_ptr< iParseTreeNode > copy(const std::shared_ptr< iParseTreeNode > &expr, const InlinedFunction &function, int &size) const;
+        
+        public:
+            //  Functions of more than maxsize nodes are not inlined; a call is
+            //  made the usual way the first after times.
+            INLINE FunctionInliningPass(const DeclarationCountT &declarations, const int &maxsize, const IntegerT &after) : RewritePass(), mDeclarations(declarations), mMaxSize(maxsize), mInlineAfter(after), mFunctions() {};
+            
+            static INLINE const IntegerT &NumInlined() throw() { return Inlined; };
+            
+            //  From iOptimizationPass
+            
+            virtual const std::string &Name() const;
+            
+            virtual void Run(std::shared_ptr< iParseTreeNode > &program);
+            
+            //  From RewritePass
+            
+            virtual void Optimize(std::shared_ptr< iParseTreeNode > &node);
+        
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    
+    class Optimizer
+    {
+        public:
+        
+            using PassListT = std::vector< std::shared_ptr< iOptimizationPass > >;
+        
+        private:
+            PassListT mPasses;
+        
+        public:
+            //  Makes the default pipeline; the declarations are those counted
+            //  by the parser over the whole of the program. Functions are only
+            //  inlined if inlinesize, the most nodes inlined, is positive.
+            Optimizer(const iOptimizationPass::DeclarationCountT &declarations, const int &inlinesize, const IntegerT &inlineafter);
+            
+            INLINE const PassListT &Passes() const { return mPasses; };
+            INLINE void Add(std::shared_ptr< iOptimizationPass > pass) { assert(pass); mPasses.push_back(pass); };
+            
+            //  Runs each pass over the whole of the program in turn. The root
+            //  of the tree, a module, is never replaced.
+            void Run(std::shared_ptr< iParseTreeNode > &program);
+        
+    };
+
+}
+
+#endif
+
@@ -28,8 +28,27 @@
 #include "cmdln.h"
 #include "exception.h"
 #include "log.h"
+#include "optimizer.h"
 #include "parser.h"
 
+////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+    class ScopedIncrement
+    {
+        private:
+            int &mValue;
+            
+        public:
+            INLINE ScopedIncrement(int &value) : mValue(value) { ++mValue; };
+            INLINE ~ScopedIncrement() { --mValue; };
+            
+    };
+
+}
+
 /******************************************************************************
 
     dish::Parser class definitions
@@ -51,7 +70,7 @@ void dish::Parser::generateMismatchError(const TokenTypeT &found, const TokenTyp
 std::shared_ptr< dish::iParseTreeNode > dish::Parser::parseAddChain(std::shared_ptr< dish::iParseTreeNode > node)
 {
     std::shared_ptr< AddOpChainParseTreeNode > addnode(
-        mSuppressLocationInformation ? AddOpChainParseTreeNode::MakeValue(node) : AddOpChainParseTreeNode::MakeValue(mInput.LocationString(), node)
+        mSuppressLocationInformation ? AddOpChainParseTreeNode::MakeValue(node) : AddOpChainParseTreeNode::MakeValue(mInput.Location(), node)
     );
 
     for(bool done(false); !done; )
@@ -90,7 +109,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::parseAddChain(std::shared_
 std::shared_ptr< dish::iParseTreeNode > dish::Parser::parseMulChain(std::shared_ptr< dish::iParseTreeNode > node)
 {
     std::shared_ptr< MulOpChainParseTreeNode > mulnode(
-        mSuppressLocationInformation ? MulOpChainParseTreeNode::MakeValue(node) : MulOpChainParseTreeNode::MakeValue(mInput.LocationString(), node)
+        mSuppressLocationInformation ? MulOpChainParseTreeNode::MakeValue(node) : MulOpChainParseTreeNode::MakeValue(mInput.Location(), node)
     );
 
     for(bool done(false); !done; )
@@ -114,7 +133,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::parseMulChain(std::shared_
 std::shared_ptr< dish::iParseTreeNode > dish::Parser::parseAndChain(std::shared_ptr< dish::iParseTreeNode > node)
 {
     std::shared_ptr< AndOpChainParseTreeNode > andnode(
-        mSuppressLocationInformation ? AndOpChainParseTreeNode::MakeValue(node) : AndOpChainParseTreeNode::MakeValue(mInput.LocationString(), node)
+        mSuppressLocationInformation ? AndOpChainParseTreeNode::MakeValue(node) : AndOpChainParseTreeNode::MakeValue(mInput.Location(), node)
     );
 
     for(bool done(false); !done; )
@@ -138,7 +157,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::parseAndChain(std::shared_
 std::shared_ptr< dish::iParseTreeNode > dish::Parser::parseOrChain(std::shared_ptr< dish::iParseTreeNode > node)
 {
     std::shared_ptr< OrOpChainParseTreeNode > ornode(
-        mSuppressLocationInformation ? OrOpChainParseTreeNode::MakeValue(node) : OrOpChainParseTreeNode::MakeValue(mInput.LocationString(), node)
+        mSuppressLocationInformation ? OrOpChainParseTreeNode::MakeValue(node) : OrOpChainParseTreeNode::MakeValue(mInput.Location(), node)
     );
 
     for(bool done(false); !done; )
@@ -162,7 +181,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::parseOrChain(std::shared_p
 std::shared_ptr< dish::iParseTreeNode > dish::Parser::parseXorChain(std::shared_ptr< dish::iParseTreeNode > node)
 {
     std::shared_ptr< XorOpChainParseTreeNode > xornode(
-        mSuppressLocationInformation ? XorOpChainParseTreeNode::MakeValue(node) : XorOpChainParseTreeNode::MakeValue(mInput.LocationString(), node)
+        mSuppressLocationInformation ? XorOpChainParseTreeNode::MakeValue(node) : XorOpChainParseTreeNode::MakeValue(mInput.Location(), node)
     );
 
     for(bool done(false); !done; )
@@ -183,23 +202,168 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::parseXorChain(std::shared_
     return xornode;
 }
 
-std::shared_ptr< dish::iParseTreeNode > dish::Parser::matchInList(dish::Parser::ExpressionListT &list, std::shared_ptr< dish::iParseTreeNode > node)
+dish::Parser::ScopedStaticScope::ScopedStaticScope(dish::Parser::StaticScopeStackT &stack, const dish::iExecutableAtomic::ParamListT &formalparams) :
+    mStack(stack),
+    mNum(1)
 {
-    if(mSuppressLocationInformation)
+    //  A function body executes on the stack of its caller, so nothing past
+    //  its parameters can be resolved statically.
+    mStack.push_back(StaticScopeT(true, -1));
+    
+    //  The parameters are only pushed onto the stack (in declaration order) 
+    //  if there are any.
+    if(!formalparams.empty())
     {
-        for(ExpressionListT::const_iterator i(list.begin()), last_i(list.end()); i != last_i; ++i)
-        {
-            if(node->IsEqual(**i))
+        mStack.push_back(StaticScopeT(false, -1));
+        ++mNum;
+        
+        std::for_each(
+            formalparams.begin(), formalparams.end(),
+            [&](const iExecutableAtomic::ParamListT::value_type &param)
             {
-                return *i;
+                mStack.back().Names.push_back(param.first);
             }
+        );
+    }
+}
+
+void dish::Parser::declare(const std::string &name)
+{
+    ++mDeclarations[name];
+    
+    if(0 != mModuleDeclarations)
+    {
+        mModuleDeclarations->push_back(name);
+    }
+}
+
+void dish::Parser::declareParameters(const dish::iExecutableAtomic::ParamListT &formalparams)
+{
+    std::for_each(
+        formalparams.begin(), formalparams.end(),
+        [&](const iExecutableAtomic::ParamListT::value_type &param)
+        {
+            declare(param.first);
+        }
+    );
+}
+
+void dish::Parser::declareLocal(const std::string &id)
+{
+    declare(BeginsWith(id, '`') ? id.substr(1, std::string::npos) : id);
+    
+    //  Declarations outside of any frame, or directly within a function body,
+    //  are not resolvable and do not affect any resolved identifiers.
+    if(mStaticScopes.empty() || mStaticScopes.back().Boundary || BeginsWith(id, '`'))
+    {
+        return;
+    }
+    
+    StaticScopeT &scope(mStaticScopes.back());
+    
+    if(scope.Stable)
+    {
+        if(mStatementDepth == scope.ChildDepth)
+        {
+            scope.Names.push_back(id);
+            return;
         }
+    
+        //  The declaration may or may not be executed, or executed more than
+        //  once, so neither the slots following it nor anything resolved past
+        //  this frame can be trusted any more.
+        scope.Stable = false;
+        
+        std::for_each(
+            scope.Through.begin(), scope.Through.end(),
+            [](std::shared_ptr< IdentifierParseTreeNode > &node)
+            {
+                node->Unresolve();
+            }
+        );
+        scope.Through.clear();
+    }
+}
+
+std::shared_ptr< dish::IdentifierParseTreeNode > dish::Parser::resolveLocal(const std::string &id)
+{
+    if(!BeginsWith(id, '`'))
+    {
+        int depth(0);
         
-        list.push_back(node);
+        //  The symbols declared so far in the frames resolved past; the slot
+        //  is only trusted at run-time if they hold no others (such as those
+        //  declared into the caller's frame by a function without
+        //  parameters).
+        int nearer(0);
+    
+        for(StaticScopeStackT::reverse_iterator scope_i(mStaticScopes.rbegin()), last_scope_i(mStaticScopes.rend()); (last_scope_i != scope_i) && !scope_i->Boundary; nearer += static_cast< int >(scope_i->Names.size()), ++scope_i, ++depth)
+        {
+            const std::vector< std::string >::const_iterator name(std::find(scope_i->Names.begin(), scope_i->Names.end(), id));
+            
+            if(scope_i->Names.end() != name)
+            {
+                std::shared_ptr< IdentifierParseTreeNode > node(
+                    mSuppressLocationInformation ? 
+                        IdentifierParseTreeNode::MakeValue(id, depth, static_cast< int >(name - scope_i->Names.begin()), nearer) : 
+                        IdentifierParseTreeNode::MakeValue(mInput.Location(), id, depth, static_cast< int >(name - scope_i->Names.begin()), nearer)
+                );
+                ++mNumResolved;
+                
+                //  Remember the node in each of the frames it was resolved
+                //  past in case one of them becomes unstable later on.
+                for(StaticScopeStackT::reverse_iterator i(mStaticScopes.rbegin()); scope_i != i; ++i)
+                {
+                    i->Through.push_back(node);
+                }
+                
+                return node;
+            }
+            
+            if(!scope_i->Stable)
+            {
+                break;
+            }
+        }
+    }
+
+    return mSuppressLocationInformation ? IdentifierParseTreeNode::MakeValue(id) : IdentifierParseTreeNode::MakeValue(mInput.Location(), id);
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::Parser::SharedNodeTable::Match(std::shared_ptr< dish::iParseTreeNode > node)
+{
+    ExpressionListT &bucket(mBuckets[node->Hash()]);
+    
+    for(ExpressionListT::const_iterator i(bucket.begin()), last_i(bucket.end()); i != last_i; ++i)
+    {
+        if(node->IsEqual(**i))
+        {
+            ++mShared;
+            
+            return *i;
+        }
     }
     
+    bucket.push_back(node);
+    ++mSize;
+    
     return node;
 }
+
+dish::IntegerT dish::Parser::SharedNodeTable::Clear()
+{
+    const IntegerT nodecount(mSize);
+    
+    mBuckets.clear();
+    mSize = 0;
+    
+    return nodecount;
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::Parser::matchInTable(dish::Parser::SharedNodeTable &table, std::shared_ptr< dish::iParseTreeNode > node)
+{
+    return mSuppressLocationInformation ? table.Match(node) : node;
+}
  
 dish::Parser::Parser(const bool profile, const int maxdepth, const std::string &source, const bool finput, const bool suppressloc) :
     mSymbolTable(new LanguageSymbolTable(profile, maxdepth)),
@@ -209,14 +373,22 @@ dish::Parser::Parser(const bool profile, const int maxdepth, const std::string &
     
     mSuppressLocationInformation(suppressloc),
     
-    mExpressionList(),
-    mDeclarationList()
+    mExpressionTable(),
+    mDeclarationTable(),
+    
+    mStaticScopes(),
+    mStatementDepth(0),
+    mNumResolved(0),
+    
+    mWholeProgram(false),
+    mModule(0),
+    mDeclarations(),
+    mInlineSize(0),
+    mInlineAfter(0),
+    
+    mParseTreeCache(),
+    mModuleDeclarations(0)
 {
-#ifdef LIST_TYPE_PREFER_VECTOR
-    mExpressionList.reserve(LIST_TYPE_PREFER_VECTOR);
-    mDeclarationList.reserve(LIST_TYPE_PREFER_VECTOR);
-#endif
-
     mTokenizer.Next();
 }
 
@@ -228,16 +400,24 @@ dish::Parser::Parser(std::shared_ptr< LanguageSymbolTable > symtab, const std::s
     
     mSuppressLocationInformation(suppressloc),
     
-    mExpressionList(),
-    mDeclarationList()
+    mExpressionTable(),
+    mDeclarationTable(),
+    
+    mStaticScopes(),
+    mStatementDepth(0),
+    mNumResolved(0),
+    
+    mWholeProgram(false),
+    mModule(0),
+    mDeclarations(),
+    mInlineSize(0),
+    mInlineAfter(0),
+    
+    mParseTreeCache(),
+    mModuleDeclarations(0)
 {
     assert(mSymbolTable);
 
-#ifdef LIST_TYPE_PREFER_VECTOR
-    mExpressionList.reserve(LIST_TYPE_PREFER_VECTOR);
-    mDeclarationList.reserve(LIST_TYPE_PREFER_VECTOR);
-#endif
-
     mTokenizer.Next();
 }
 
@@ -261,7 +441,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseTerminalFollower(std:
                 consume();
             
                 return ParseTerminalFollower(
-                    mSuppressLocationInformation ? MemberParseTreeNode::MakeValue(base, member) : MemberParseTreeNode::MakeValue(mInput.LocationString(), base, member)
+                    mSuppressLocationInformation ? MemberParseTreeNode::MakeValue(base, member) : MemberParseTreeNode::MakeValue(mInput.Location(), base, member)
                 );
             }
             
@@ -320,22 +500,34 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseTerminalFollower(std:
             
             if(typeid(IdentifierParseTreeNode) == typeid(*base))
             {
+                const IdentifierParseTreeNode &id(dynamic_cast< IdentifierParseTreeNode & >(*base));
+            
                 std::stringstream mangled_id;
-                mangled_id << dynamic_cast< IdentifierParseTreeNode & >(*base).Id();
+                mangled_id << id.Id();
                 mangled_id << "_";
                 mangled_id << param_list.size();
+                
+                std::shared_ptr< IdentifierParseTreeNode > function;
+                if(!id.IsBaseId())
+                {
+                    function = resolveLocal(mangled_id.str());
+                }
+                else
+                {
+                    function = mSuppressLocationInformation ? IdentifierParseTreeNode::MakeValue(mangled_id.str()) : IdentifierParseTreeNode::MakeValue(base->Location(), mangled_id.str());
+                }
             
                 return ParseTerminalFollower(
                     FunctionCallParseTreeNode::MakeValue(
-                        mInput.LocationString(), 
-                        mSuppressLocationInformation ? IdentifierParseTreeNode::MakeValue(mangled_id.str()) : IdentifierParseTreeNode::MakeValue(base->LocationString(), mangled_id.str()), 
+                        mInput.Location(), 
+                        function, 
                         param_list
                     )
                 );
             }
             
             return ParseTerminalFollower(
-                mSuppressLocationInformation ? FunctionCallParseTreeNode::MakeValue(base, param_list) : FunctionCallParseTreeNode::MakeValue(mInput.LocationString(), base, param_list)
+                mSuppressLocationInformation ? FunctionCallParseTreeNode::MakeValue(base, param_list) : FunctionCallParseTreeNode::MakeValue(mInput.Location(), base, param_list)
             );
         };
         
@@ -350,7 +542,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseTerminalFollower(std:
             consume(tknCloseSquareBrace);
             
             return ParseTerminalFollower(
-                mSuppressLocationInformation ? IndexParseTreeNode::MakeValue(base, index) : IndexParseTreeNode::MakeValue(mInput.LocationString(), base, index)
+                mSuppressLocationInformation ? IndexParseTreeNode::MakeValue(base, index) : IndexParseTreeNode::MakeValue(mInput.Location(), base, index)
             );
         };
         
@@ -374,7 +566,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseArrayLiteral()
     consume(tknOpenCurlyBrace);
 
     std::shared_ptr< LiteralArrayParseTreeNode > node(
-        mSuppressLocationInformation ? LiteralArrayParseTreeNode::MakeValue() : LiteralArrayParseTreeNode::MakeValue(mInput.LocationString())
+        mSuppressLocationInformation ? LiteralArrayParseTreeNode::MakeValue() : LiteralArrayParseTreeNode::MakeValue(mInput.Location())
     );
     
     if(!doesMatch(tknCloseCurlyBrace))
@@ -414,9 +606,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseTerminal()
     
         case tknIdentifier:
         {
-            std::shared_ptr< IdentifierParseTreeNode > node(
-                mSuppressLocationInformation ? IdentifierParseTreeNode::MakeValue(mTokenizer.This().Identifier.Id) : IdentifierParseTreeNode::MakeValue(mInput.LocationString(), mTokenizer.This().Identifier.Id)
-            );
+            std::shared_ptr< IdentifierParseTreeNode > node(resolveLocal(mTokenizer.This().Identifier.Id));
             consume();
             
             return ParseTerminalFollower(node);
@@ -432,7 +622,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseTerminal()
             const StringT litval(mTokenizer.This().StringLit.Value);
         
             std::shared_ptr< LiteralParseTreeNode > node(
-                mSuppressLocationInformation ? LiteralParseTreeNode::MakeValue(litval) : LiteralParseTreeNode::MakeValue(mInput.LocationString(), litval)
+                mSuppressLocationInformation ? LiteralParseTreeNode::MakeValue(litval) : LiteralParseTreeNode::MakeValue(mInput.Location(), litval)
             );
             consume();
             
@@ -444,7 +634,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseTerminal()
             const RealT litval(mTokenizer.This().RealLit.Value);
         
             std::shared_ptr< LiteralParseTreeNode > node(
-                mSuppressLocationInformation ? LiteralParseTreeNode::MakeValue(litval) : LiteralParseTreeNode::MakeValue(mInput.LocationString(), litval)
+                mSuppressLocationInformation ? LiteralParseTreeNode::MakeValue(litval) : LiteralParseTreeNode::MakeValue(mInput.Location(), litval)
             );
             consume();
             
@@ -456,7 +646,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseTerminal()
             const IntegerT litval(mTokenizer.This().IntegerLit.Value);
         
             std::shared_ptr< LiteralParseTreeNode > node(
-                mSuppressLocationInformation ? LiteralParseTreeNode::MakeValue(litval) : LiteralParseTreeNode::MakeValue(mInput.LocationString(), litval)
+                mSuppressLocationInformation ? LiteralParseTreeNode::MakeValue(litval) : LiteralParseTreeNode::MakeValue(mInput.Location(), litval)
             );
             consume();
             
@@ -466,7 +656,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseTerminal()
         case tknBooleanLit:
         {
             std::shared_ptr< LiteralParseTreeNode > node(
-                mSuppressLocationInformation ? LiteralParseTreeNode::MakeValue(mTokenizer.This().BooleanLit.Value) : LiteralParseTreeNode::MakeValue(mInput.LocationString(), mTokenizer.This().BooleanLit.Value)
+                mSuppressLocationInformation ? LiteralParseTreeNode::MakeValue(mTokenizer.This().BooleanLit.Value) : LiteralParseTreeNode::MakeValue(mInput.Location(), mTokenizer.This().BooleanLit.Value)
             );
             consume();
             
@@ -522,7 +712,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParsePower()
                 
         std::shared_ptr< iParseTreeNode > factor(ParseFactor());
         
-        node = mSuppressLocationInformation ? PowOpParseTreeNode::MakeValue(node, factor) : PowOpParseTreeNode::MakeValue(mInput.LocationString(), node, factor);
+        node = mSuppressLocationInformation ? PowOpParseTreeNode::MakeValue(node, factor) : PowOpParseTreeNode::MakeValue(mInput.Location(), node, factor);
     }
     
     return node;
@@ -544,7 +734,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseFactor()
             
             std::shared_ptr< iParseTreeNode > opr(ParseFactor());
             
-            node = mSuppressLocationInformation ? NegateOpParseTreeNode::MakeValue(opr) : NegateOpParseTreeNode::MakeValue(mInput.LocationString(), opr);
+            node = mSuppressLocationInformation ? NegateOpParseTreeNode::MakeValue(opr) : NegateOpParseTreeNode::MakeValue(mInput.Location(), opr);
         } break;
         
         case tknNotRW:
@@ -553,7 +743,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseFactor()
             
             std::shared_ptr< iParseTreeNode > opr(ParseFactor());
             
-            node = mSuppressLocationInformation ? NotOpParseTreeNode::MakeValue(opr) : NotOpParseTreeNode::MakeValue(mInput.LocationString(), opr);
+            node = mSuppressLocationInformation ? NotOpParseTreeNode::MakeValue(opr) : NotOpParseTreeNode::MakeValue(mInput.Location(), opr);
         } break;
         
         default:
@@ -589,7 +779,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseTerm()
                 
                 std::shared_ptr< iParseTreeNode > factor(ParseFactor());
                 
-                node = mSuppressLocationInformation ? DivOpParseTreeNode::MakeValue(node, factor) : DivOpParseTreeNode::MakeValue(mInput.LocationString(), node, factor);
+                node = mSuppressLocationInformation ? DivOpParseTreeNode::MakeValue(node, factor) : DivOpParseTreeNode::MakeValue(mInput.Location(), node, factor);
             } break;
             
             case tknModulusOp:
@@ -598,7 +788,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseTerm()
                 
                 std::shared_ptr< iParseTreeNode > factor(ParseFactor());
                 
-                node = mSuppressLocationInformation ? ModOpParseTreeNode::MakeValue(node, factor) : ModOpParseTreeNode::MakeValue(mInput.LocationString(), node, factor);
+                node = mSuppressLocationInformation ? ModOpParseTreeNode::MakeValue(node, factor) : ModOpParseTreeNode::MakeValue(mInput.Location(), node, factor);
             } break;
             
             default:
@@ -630,7 +820,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseComparison()
                 
                 std::shared_ptr< iParseTreeNode > lhs(ParseTerm());
                 
-                node = mSuppressLocationInformation ? LessThanOpParseTreeNode::MakeValue(node, lhs) : LessThanOpParseTreeNode::MakeValue(mInput.LocationString(), node, lhs);
+                node = mSuppressLocationInformation ? LessThanOpParseTreeNode::MakeValue(node, lhs) : LessThanOpParseTreeNode::MakeValue(mInput.Location(), node, lhs);
             } break;
             
             case tknLessThanEqualOp:
@@ -639,7 +829,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseComparison()
                 
                 std::shared_ptr< iParseTreeNode > lhs(ParseTerm());
                 
-                node = mSuppressLocationInformation ? LessThanEqualOpParseTreeNode::MakeValue(node, lhs) : LessThanEqualOpParseTreeNode::MakeValue(mInput.LocationString(), node, lhs);
+                node = mSuppressLocationInformation ? LessThanEqualOpParseTreeNode::MakeValue(node, lhs) : LessThanEqualOpParseTreeNode::MakeValue(mInput.Location(), node, lhs);
             } break;
             
             case tknEqualOp:
@@ -648,7 +838,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseComparison()
                 
                 std::shared_ptr< iParseTreeNode > lhs(ParseTerm());
                 
-                node = mSuppressLocationInformation ? EqualOpParseTreeNode::MakeValue(node, lhs) : EqualOpParseTreeNode::MakeValue(mInput.LocationString(), node, lhs);
+                node = mSuppressLocationInformation ? EqualOpParseTreeNode::MakeValue(node, lhs) : EqualOpParseTreeNode::MakeValue(mInput.Location(), node, lhs);
             } break;
             
             case tknNotEqualOp:
@@ -657,7 +847,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseComparison()
                 
                 std::shared_ptr< iParseTreeNode > lhs(ParseTerm());
                 
-                node = mSuppressLocationInformation ? NotEqualOpParseTreeNode::MakeValue(node, lhs) : NotEqualOpParseTreeNode::MakeValue(mInput.LocationString(), node, lhs);
+                node = mSuppressLocationInformation ? NotEqualOpParseTreeNode::MakeValue(node, lhs) : NotEqualOpParseTreeNode::MakeValue(mInput.Location(), node, lhs);
             } break;
             
             case tknGreaterThanEqualOp:
@@ -666,7 +856,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseComparison()
                 
                 std::shared_ptr< iParseTreeNode > lhs(ParseTerm());
                 
-                node = mSuppressLocationInformation ? GreaterThanEqualOpParseTreeNode::MakeValue(node, lhs) : GreaterThanEqualOpParseTreeNode::MakeValue(mInput.LocationString(), node, lhs);
+                node = mSuppressLocationInformation ? GreaterThanEqualOpParseTreeNode::MakeValue(node, lhs) : GreaterThanEqualOpParseTreeNode::MakeValue(mInput.Location(), node, lhs);
             } break;
             
             case tknGreaterThanOp:
@@ -675,7 +865,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseComparison()
                 
                 std::shared_ptr< iParseTreeNode > lhs(ParseTerm());
                 
-                node = mSuppressLocationInformation ? GreaterThanOpParseTreeNode::MakeValue(node, lhs) : GreaterThanOpParseTreeNode::MakeValue(mInput.LocationString(), node, lhs);
+                node = mSuppressLocationInformation ? GreaterThanOpParseTreeNode::MakeValue(node, lhs) : GreaterThanOpParseTreeNode::MakeValue(mInput.Location(), node, lhs);
             } break;
             
             default:
@@ -739,6 +929,8 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseExpression()
     TraceBlock trace("ParseExpression");
 #endif
 
+    const IntegerT numresolved(mNumResolved);
+
     std::shared_ptr< dish::iParseTreeNode > node(ParseExpr());
 
     if(doesMatch(tknAssignmentOp))
@@ -747,10 +939,12 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseExpression()
         
         std::shared_ptr< iParseTreeNode > lhs(ParseExpression());
         
-        node = mSuppressLocationInformation ? AssignmentParseTreeNode::MakeValue(node, lhs) : AssignmentParseTreeNode::MakeValue(mInput.LocationString(), node, lhs);
+        node = mSuppressLocationInformation ? AssignmentParseTreeNode::MakeValue(node, lhs) : AssignmentParseTreeNode::MakeValue(mInput.Location(), node, lhs);
     }
     
-    return matchInList(mExpressionList, node);
+    //  Expressions referring to resolved identifiers are not shared, since the
+    //  parser may need to unresolve those identifiers later on.
+    return (numresolved == mNumResolved) ? matchInTable(mExpressionTable, node) : node;
 }
 
 std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseArray()
@@ -768,7 +962,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseArray()
     consume(tknOfRW);
     std::shared_ptr< iParseTreeNode > type(ParseType());
     
-    return mSuppressLocationInformation ? ArrayTypeParseTreeNode::MakeValue(from, to, type) : ArrayTypeParseTreeNode::MakeValue(mInput.LocationString(), from, to, type);
+    return mSuppressLocationInformation ? ArrayTypeParseTreeNode::MakeValue(from, to, type) : ArrayTypeParseTreeNode::MakeValue(mInput.Location(), from, to, type);
 }
 
 std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseFunction()
@@ -824,9 +1018,14 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseFunction()
         mangled_id << "_";
         mangled_id << formalparams.size();
         
-        std::shared_ptr< iParseTreeNode > body(ParseStatement());
+        std::shared_ptr< iParseTreeNode > body;
+        {
+            declareParameters(formalparams);
+            ScopedStaticScope scope(mStaticScopes, formalparams);
+            body = ParseStatement();
+        }
         
-        return mSuppressLocationInformation ? DeclareFunctionParseTreeNode::MakeValue(mangled_id.str(), formalparams, body) : DeclareFunctionParseTreeNode::MakeValue(mInput.LocationString(), mangled_id.str(), formalparams, body);
+        return mSuppressLocationInformation ? DeclareFunctionParseTreeNode::MakeValue(mangled_id.str(), formalparams, body) : DeclareFunctionParseTreeNode::MakeValue(mInput.Location(), mangled_id.str(), formalparams, body);
     }
     
     std::stringstream message;
@@ -878,9 +1077,14 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseLambdaFunction()
     
     consume(tknCloseParenthesis);
     
-    std::shared_ptr< iParseTreeNode > body(ParseStatement());
+    std::shared_ptr< iParseTreeNode > body;
+    {
+        declareParameters(formalparams);
+        ScopedStaticScope scope(mStaticScopes, formalparams);
+        body = ParseStatement();
+    }
     
-    return mSuppressLocationInformation ? LambdaFunctionParseTreeNode::MakeValue(formalparams, body) : LambdaFunctionParseTreeNode::MakeValue(mInput.LocationString(), formalparams, body);
+    return mSuppressLocationInformation ? LambdaFunctionParseTreeNode::MakeValue(formalparams, body) : LambdaFunctionParseTreeNode::MakeValue(mInput.Location(), formalparams, body);
 }
 
 std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseStructure()
@@ -892,7 +1096,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseStructure()
     consume(tknStructureRW);
     
     std::shared_ptr< StructureTypeParseTreeNode > node(
-        mSuppressLocationInformation ? StructureTypeParseTreeNode::MakeValue() : StructureTypeParseTreeNode::MakeValue(mInput.LocationString())
+        mSuppressLocationInformation ? StructureTypeParseTreeNode::MakeValue() : StructureTypeParseTreeNode::MakeValue(mInput.Location())
     );
     
     while(!doesMatch(tknEndRW))
@@ -930,7 +1134,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseType()
         case tknBooleanRW:
         {
             static std::shared_ptr< dish::iParseTreeNode > type(
-                mSuppressLocationInformation ? BooleanTypeParseTreeNode::MakeValue() : BooleanTypeParseTreeNode::MakeValue(mInput.LocationString())
+                mSuppressLocationInformation ? BooleanTypeParseTreeNode::MakeValue() : BooleanTypeParseTreeNode::MakeValue(mInput.Location())
             );
             
             consume();
@@ -941,7 +1145,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseType()
         case tknDictionaryRW:
         {
             static std::shared_ptr< dish::iParseTreeNode > type(
-                mSuppressLocationInformation ? DictionaryTypeParseTreeNode::MakeValue() : DictionaryTypeParseTreeNode::MakeValue(mInput.LocationString())
+                mSuppressLocationInformation ? DictionaryTypeParseTreeNode::MakeValue() : DictionaryTypeParseTreeNode::MakeValue(mInput.Location())
             );
             
             consume();
@@ -961,7 +1165,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseType()
             if(tknOpenParenthesis != mTokenizer.This().Type)
             {
                 static std::shared_ptr< dish::iParseTreeNode > type(
-                    mSuppressLocationInformation ? IntegerTypeParseTreeNode::MakeValue() : IntegerTypeParseTreeNode::MakeValue(mInput.LocationString())
+                    mSuppressLocationInformation ? IntegerTypeParseTreeNode::MakeValue() : IntegerTypeParseTreeNode::MakeValue(mInput.Location())
                 );
             
                 return type;
@@ -983,20 +1187,20 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseType()
                 else
                 {
                     const IntegerT bound(static_cast< IntegerT >(iAtomic::rngbndError));
-                    boundary = mSuppressLocationInformation ? LiteralParseTreeNode::MakeValue(bound) : LiteralParseTreeNode::MakeValue(mInput.LocationString(), bound);
+                    boundary = mSuppressLocationInformation ? LiteralParseTreeNode::MakeValue(bound) : LiteralParseTreeNode::MakeValue(mInput.Location(), bound);
                 }
                 assert(0 != boundary.get());
                 
                 consume(tknCloseParenthesis);
                 
-                return mSuppressLocationInformation ? RangedIntegerTypeParseTreeNode::MakeValue(minval, maxval, boundary) : RangedIntegerTypeParseTreeNode::MakeValue(mInput.LocationString(), minval, maxval, boundary);
+                return mSuppressLocationInformation ? RangedIntegerTypeParseTreeNode::MakeValue(minval, maxval, boundary) : RangedIntegerTypeParseTreeNode::MakeValue(mInput.Location(), minval, maxval, boundary);
             }
         };
           
         case tknRealRW:
         {
             static std::shared_ptr< dish::iParseTreeNode > type(
-                mSuppressLocationInformation ? RealTypeParseTreeNode::MakeValue() : RealTypeParseTreeNode::MakeValue(mInput.LocationString())
+                mSuppressLocationInformation ? RealTypeParseTreeNode::MakeValue() : RealTypeParseTreeNode::MakeValue(mInput.Location())
             );
             
             consume();
@@ -1007,7 +1211,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseType()
         case tknStringRW:
         {
             static std::shared_ptr< dish::iParseTreeNode > type(
-                mSuppressLocationInformation ? StringTypeParseTreeNode::MakeValue() : StringTypeParseTreeNode::MakeValue(mInput.LocationString())
+                mSuppressLocationInformation ? StringTypeParseTreeNode::MakeValue() : StringTypeParseTreeNode::MakeValue(mInput.Location())
             );
             
             consume();
@@ -1057,8 +1261,10 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseReferece()
         consume();
         
         std::shared_ptr< iParseTreeNode > lhs(ParseExpression());
+        
+        declareLocal(id);
     
-        return mSuppressLocationInformation ? DeclareReferenceParseTreeNode::MakeValue(id, lhs) : DeclareReferenceParseTreeNode::MakeValue(mInput.LocationString(), id, lhs);
+        return mSuppressLocationInformation ? DeclareReferenceParseTreeNode::MakeValue(id, lhs) : DeclareReferenceParseTreeNode::MakeValue(mInput.Location(), id, lhs);
     }
     
     std::stringstream message;
@@ -1081,7 +1287,10 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseDeclaration()
     {
         case tknFunctionRW:
         {
-            return ParseFunction();
+            std::shared_ptr< iParseTreeNode > node(ParseFunction());
+            declareLocal(dynamic_cast< DeclareFunctionParseTreeNode & >(*node).Id());
+            
+            return node;
         };
         
         case tknReferenceRW:
@@ -1104,14 +1313,18 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseDeclaration()
             const std::string id(mTokenizer.This().Identifier.Id);
             consume();
             
-            std::shared_ptr< iParseTreeNode > node(mSuppressLocationInformation ? DeclareTypeParseTreeNode::MakeValue(type, id) : DeclareTypeParseTreeNode::MakeValue(mInput.LocationString(), type, id));
+            std::shared_ptr< iParseTreeNode > node(mSuppressLocationInformation ? DeclareTypeParseTreeNode::MakeValue(type, id) : DeclareTypeParseTreeNode::MakeValue(mInput.Location(), type, id));
             consume(tknSemiColon);
             
+            declareLocal(id);
+            
             return node;
         };
         
         default:
         {
+            const IntegerT numresolved(mNumResolved);
+        
             std::shared_ptr< iParseTreeNode > type(ParseType());
             
             consume(tknAsRW);
@@ -1121,9 +1334,15 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseDeclaration()
             consume();
             
             std::shared_ptr< iParseTreeNode > node(
-                mSuppressLocationInformation ? DeclareParseTreeNode::MakeValue(type, id) : DeclareParseTreeNode::MakeValue(mInput.LocationString(), type, id)
+                mSuppressLocationInformation ? DeclareParseTreeNode::MakeValue(type, id) : DeclareParseTreeNode::MakeValue(mInput.Location(), type, id)
             );
-            node = matchInList(mDeclarationList, node);
+            if(numresolved == mNumResolved)
+            {
+                node = matchInTable(mDeclarationTable, node);
+            }
+            
+            //  The symbol is declared before its initializer is executed.
+            declareLocal(id);
             
             if(doesMatch(tknAssignmentOp))
             {
@@ -1131,7 +1350,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseDeclaration()
                 
                 std::shared_ptr< iParseTreeNode > lhs(ParseExpression());
                 
-                node = mSuppressLocationInformation ? AssignmentParseTreeNode::MakeValue(node, lhs) : AssignmentParseTreeNode::MakeValue(mInput.LocationString(), node, lhs);
+                node = mSuppressLocationInformation ? AssignmentParseTreeNode::MakeValue(node, lhs) : AssignmentParseTreeNode::MakeValue(mInput.Location(), node, lhs);
             }
             
             consume(tknSemiColon);
@@ -1157,7 +1376,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseLock()
         const std::string id(mTokenizer.This().Identifier.Id);
         consume();
         
-        return mSuppressLocationInformation ? LockParseTreeNode::MakeValue(id) : LockParseTreeNode::MakeValue(mInput.LocationString(), id);
+        return mSuppressLocationInformation ? LockParseTreeNode::MakeValue(id) : LockParseTreeNode::MakeValue(mInput.Location(), id);
     }
     
     std::stringstream message;
@@ -1177,9 +1396,11 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseStatementBlock()
     consume(tknBeginRW);
     
     std::shared_ptr< StatementBlockParseTreeNode > block(
-        mSuppressLocationInformation ? StatementBlockParseTreeNode::MakeValue() : StatementBlockParseTreeNode::MakeValue(mInput.LocationString())
+        mSuppressLocationInformation ? StatementBlockParseTreeNode::MakeValue() : StatementBlockParseTreeNode::MakeValue(mInput.Location())
     );
     
+    ScopedStaticScope scope(mStaticScopes, mStatementDepth + 1);
+    
     while(!doesMatch(tknEndRW))
     {
         std::shared_ptr< dish::iParseTreeNode > stmt(ParseStatement());
@@ -1209,10 +1430,10 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseIfThenElse()
         
         std::shared_ptr< dish::iParseTreeNode > elseblk(ParseStatement());
     
-        return mSuppressLocationInformation ? IfStatementParseTreeNode::MakeValue(cond, ifblk, elseblk) : IfStatementParseTreeNode::MakeValue(mInput.LocationString(), cond, ifblk, elseblk);
+        return mSuppressLocationInformation ? IfStatementParseTreeNode::MakeValue(cond, ifblk, elseblk) : IfStatementParseTreeNode::MakeValue(mInput.Location(), cond, ifblk, elseblk);
     }
     
-    return mSuppressLocationInformation ? IfStatementParseTreeNode::MakeValue(cond, ifblk) : IfStatementParseTreeNode::MakeValue(mInput.LocationString(), cond, ifblk);
+    return mSuppressLocationInformation ? IfStatementParseTreeNode::MakeValue(cond, ifblk) : IfStatementParseTreeNode::MakeValue(mInput.Location(), cond, ifblk);
 }
 
 std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseSwitch()
@@ -1225,7 +1446,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseSwitch()
     std::shared_ptr< iParseTreeNode > expr(ParseExpression());
     
     std::shared_ptr< SwitchStatementParseTreeNode > switch_statement(
-        mSuppressLocationInformation ? SwitchStatementParseTreeNode::MakeValue(expr) : SwitchStatementParseTreeNode::MakeValue(mInput.LocationString(), expr)
+        mSuppressLocationInformation ? SwitchStatementParseTreeNode::MakeValue(expr) : SwitchStatementParseTreeNode::MakeValue(mInput.Location(), expr)
     );
     
     for(bool done(false); !done; )
@@ -1304,7 +1525,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseForLoop()
         
         return mSuppressLocationInformation ? 
             ForLoopParseTreeNode::MakeValue(id, from, to, step, body) : 
-            ForLoopParseTreeNode::MakeValue(mInput.LocationString(), id, from, to, step, body);
+            ForLoopParseTreeNode::MakeValue(mInput.Location(), id, from, to, step, body);
     }
     else
     {
@@ -1312,7 +1533,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseForLoop()
     
         return mSuppressLocationInformation ? 
             ForLoopParseTreeNode::MakeValue(id, from, to, body) : 
-            ForLoopParseTreeNode::MakeValue(mInput.LocationString(), id, from, to, body);
+            ForLoopParseTreeNode::MakeValue(mInput.Location(), id, from, to, body);
     }
     
     assert(false);
@@ -1341,11 +1562,19 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseForEachLoop()
     
     std::shared_ptr< dish::iParseTreeNode > collection(ParseTerminal());
     
-    std::shared_ptr< dish::iParseTreeNode > body(ParseStatement());
+    std::shared_ptr< dish::iParseTreeNode > body;
+    {
+        //  Each element is bound in a frame of its own.
+        ScopedStaticScope scope(mStaticScopes, -1);
+        mStaticScopes.back().Names.push_back(id);
+        declare(id);
+        
+        body = ParseStatement();
+    }
     
     return mSuppressLocationInformation ? 
         ForEachLoopParseTreeNode::MakeValue(reference, id, collection, body) : 
-        ForEachLoopParseTreeNode::MakeValue(mInput.LocationString(), reference, id, collection, body);
+        ForEachLoopParseTreeNode::MakeValue(mInput.Location(), reference, id, collection, body);
 }
 
 std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseWhileLoop()
@@ -1362,7 +1591,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseWhileLoop()
     
     return mSuppressLocationInformation ? 
         WhileLoopParseTreeNode::MakeValue(condition, body) : 
-        WhileLoopParseTreeNode::MakeValue(mInput.LocationString(), condition, body);
+        WhileLoopParseTreeNode::MakeValue(mInput.Location(), condition, body);
 }
 
 std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseRepeatLoop()
@@ -1384,7 +1613,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseRepeatLoop()
     
     return mSuppressLocationInformation ? 
         RepeatUntilLoopParseTreeNode::MakeValue(body, condition) : 
-        RepeatUntilLoopParseTreeNode::MakeValue(mInput.LocationString(), body, condition);
+        RepeatUntilLoopParseTreeNode::MakeValue(mInput.Location(), body, condition);
 }
 
 std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseReturn()
@@ -1397,7 +1626,20 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseReturn()
     
     std::shared_ptr< dish::iParseTreeNode > retval(ParseExpression());
     
-    return mSuppressLocationInformation ? ReturnParseTreeNode::MakeValue(retval) : ReturnParseTreeNode::MakeValue(mInput.LocationString(), retval);
+    //  A function call returned from within a function body is in tail
+    //  position.
+    const bool tailcall(
+        (typeid(FunctionCallParseTreeNode) == typeid(*retval)) &&
+        std::any_of(
+            mStaticScopes.begin(), mStaticScopes.end(),
+            [](const StaticScopeT &scope)
+            {
+                return scope.Boundary;
+            }
+        )
+    );
+    
+    return mSuppressLocationInformation ? ReturnParseTreeNode::MakeValue(retval, tailcall) : ReturnParseTreeNode::MakeValue(mInput.Location(), retval, tailcall);
 }
 
 std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseImport()
@@ -1415,13 +1657,114 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseImport()
     match(tknSemiColon);    //  Needed here to complete the statement but cannot 
                             //  be done in ParseStatement() because we will push
                             //  a new input stream onto the stack next.
+    const SourceLocationT location(mInput.Location());
+    const int depth(mInput.Depth());
+    
+    //  With a parse-tree cache, a file imported at the top level of another is
+    //  made a module of its own, whether the whole program is parsed or not,
+    //  and is loaded from the cache if it can be.
+    if((0 != mParseTreeCache.get()) && mStaticScopes.empty())
+    {
+        std::shared_ptr< iParseTreeNode > module(importModule(location, fname));
+        consume();          //  The semicolon token; see importModule().
+        
+        return module;
+    }
+    
     //mInput.PushFile(fname);
     mInput.PushFile(DishCommandLine::Instance().InputFileName(fname));
     consume();              //  Consume the semicolon token after we push the imported file onto the input stack.
     
     dish::Log::Instance().Writeln(dish::Log::logInfo, std::string("Importing ") + fname + "...");
     
-    return mSuppressLocationInformation ? NullParseTreeNode::MakeValue() : NullParseTreeNode::MakeValue(mInput.LocationString());
+    if(mWholeProgram)
+    {
+        //  The imported file is parsed here, in its entirety; it is off the
+        //  stack once the token following its last statement is read. A file
+        //  imported before is not pushed again, and so is an empty module.
+        std::shared_ptr< ModuleParseTreeNode > module(mSuppressLocationInformation ? ModuleParseTreeNode::MakeValue(fname, false) : ModuleParseTreeNode::MakeValue(location, fname, false));
+        
+        while((mInput.Depth() > depth) && !mInput.Empty())
+        {
+            module->Add(ParseStatement());
+        }
+        
+        return module;
+    }
+    
+    return mSuppressLocationInformation ? NullParseTreeNode::MakeValue() : NullParseTreeNode::MakeValue(mInput.Location());
+}
+
+std::shared_ptr< dish::ModuleParseTreeNode > dish::Parser::importModule(const dish::SourceLocationT &location, const std::string &fname)
+{
+    const std::string path(DishCommandLine::Instance().InputFileName(fname));
+    
+    dish::Log::Instance().Writeln(dish::Log::logInfo, std::string("Importing ") + fname + "...");
+    
+    std::shared_ptr< ModuleParseTreeNode > module(mSuppressLocationInformation ? ModuleParseTreeNode::MakeValue(fname, false) : ModuleParseTreeNode::MakeValue(location, fname, false));
+    
+    //  A file imported before is an empty module.
+    if(mInput.IsLoaded(path))
+    {
+        return module;
+    }
+    
+    ParseTreeCache::StatementListT statements;
+    ParseTreeCache::DeclarationListT declarations;
+    
+    if(mParseTreeCache->Load(path, statements, declarations))
+    {
+        //  The file counts as loaded before the files it imports are, just as
+        //  it would had it been pushed onto the input stack.
+        mInput.SetLoaded(path);
+        
+        std::for_each(
+            declarations.begin(), declarations.end(),
+            [&](const std::string &name)
+            {
+                ++mDeclarations[name];
+            }
+        );
+        
+        for(ParseTreeCache::StatementListT::const_iterator i(statements.begin()), last_i(statements.end()); i != last_i; ++i)
+        {
+            if(0 != i->Node.get())
+            {
+                module->Add(i->Node);
+            }
+            else
+            {
+                module->Add(importModule(i->Location, i->Import));
+            }
+        }
+        
+        return module;
+    }
+    
+    //  The file is parsed in its entirety on top of a semicolon token of our 
+    //  own, which becomes the lookahead once the file is off the stack; the 
+    //  caller consumes it in place of the one ending the import statement,
+    //  which is consumed here.
+    const int depth(mInput.Depth());
+    
+    mInput.PushString(";");
+    mInput.PushFile(path);
+    consume();
+    
+    ParseTreeCache::DeclarationListT * const enclosing(mModuleDeclarations);
+    mModuleDeclarations = &declarations;
+    
+    while((mInput.Depth() > (depth + 1)) && !mInput.Empty())
+    {
+        module->Add(ParseStatement());
+    }
+    
+    mModuleDeclarations = enclosing;
+    
+    match(tknSemiColon);
+    mParseTreeCache->Store(path, *module, declarations);
+    
+    return module;
 }
 
 std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseAssert()
@@ -1437,7 +1780,7 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseAssert()
     
     consume(tknCloseParenthesis);
     
-    return mSuppressLocationInformation ? AssertParseTreeNode::MakeValue(condition) : AssertParseTreeNode::MakeValue(mInput.LocationString(), condition);
+    return mSuppressLocationInformation ? AssertParseTreeNode::MakeValue(condition) : AssertParseTreeNode::MakeValue(mInput.Location(), condition);
 }
 
 std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseStatement()
@@ -1446,13 +1789,15 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseStatement()
     TraceBlock trace("ParseStatement");
 #endif
 
+    ScopedIncrement depth(mStatementDepth);
+
     std::shared_ptr< dish::iParseTreeNode > node;
 
     switch(mTokenizer.This().Type)
     {
         case tknSemiColon:
         {
-            node = mSuppressLocationInformation ? NullParseTreeNode::MakeValue() : NullParseTreeNode::MakeValue(mInput.LocationString());
+            node = mSuppressLocationInformation ? NullParseTreeNode::MakeValue() : NullParseTreeNode::MakeValue(mInput.Location());
             consume(tknSemiColon);
         } break;
     
@@ -1546,508 +1891,572 @@ std::shared_ptr< dish::iParseTreeNode > dish::Parser::ParseStatement()
     return node;
 }
 
-std::shared_ptr< dish::iAtomic > dish::Parser::Run()
+bool dish::Parser::execute(std::shared_ptr< dish::iParseTreeNode > statement, std::shared_ptr< dish::iAtomic > &ret)
 {
-    std::shared_ptr< iAtomic > ret = NullValue::MakeValue();   
-    
-    while(!mInput.Empty())
+    try
     {
-        std::shared_ptr< iParseTreeNode > statement(ParseStatement());
-
-        try
-        {
-            ret = statement->Execute(SymbolTable());
-        }
-        
-        catch(dish::ReturnParseTreeNode::ReturnValueT e)
-        {
-            return e;
-        }
-        
-        catch(IllegalCastException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_IllegalCast,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(ValueLockedException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_ValueLocked,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(NoSuchMemberException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_NoSuchMember,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(DuplicateSymbolException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_DuplicateSymbol,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(NoSuchSymbolException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_NoSuchSymbol,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(DivideByZeroException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_DivideByZero,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
+        ret = statement->Execute(SymbolTable());
         
-        catch(DomainErrorException &e)
+        //  A return statement at the top level ends the program.
+        if(SymbolTable().IsReturning())
         {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_DomainError,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(RangeErrorException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_RangeError,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(IllegalHandleException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_IllegalHandle,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(IllegalValueException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_IllegalValue,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
+            ret = SymbolTable().TakeReturnValue();
+            return true;
         }
+    }
     
-#ifdef LANG_LIB_FILEIO
+    catch(IllegalCastException &e)
+    {
+        ret = NullValue::MakeValue();
     
-        catch(TooManyOpenFilesException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_TooManyOpenFiles,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(UnableToOpenFileException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_UnableToOpenFile,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(FileNotOpenException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_FileNotOpen,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(FileWriteErrorException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_FileWriteError,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(FileReadErrorException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_FileReadError,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_IllegalCast,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
     
-#endif
-
-#ifdef LANG_LIB_NETWORK
+    catch(ValueLockedException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_ValueLocked,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(NoSuchMemberException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_NoSuchMember,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(DuplicateSymbolException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_DuplicateSymbol,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(NoSuchSymbolException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_NoSuchSymbol,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(DivideByZeroException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_DivideByZero,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(DomainErrorException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_DomainError,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(RangeErrorException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_RangeError,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(IllegalHandleException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_IllegalHandle,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(IllegalValueException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_IllegalValue,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
 
-        catch(TooManyOpenSocketsException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_TooManyOpenSockets,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(UnableToOpenSocketException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_UnableToOpenSocket,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(UnableToCloseSocketException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_UnableToCloseSocket,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(SocketInvalidAddressException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_NetworkInvalidAddress,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(SocketUnableToConnectToServerException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_NetworkUnableToConnectToServer,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(SocketNotOpenException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_NetworkSocketNotOpen,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(SocketWriteErrorException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_NetworkSocketWriteError,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(SocketReadErrorException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_NetworkSocketReadError,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
+#ifdef LANG_LIB_FILEIO
+
+    catch(TooManyOpenFilesException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_TooManyOpenFiles,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(UnableToOpenFileException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_UnableToOpenFile,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(FileNotOpenException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_FileNotOpen,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
     
+    catch(FileWriteErrorException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_FileWriteError,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(FileReadErrorException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_FileReadError,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+
 #endif
 
-#ifdef LANG_LIB_MATH_MATRIX
+#ifdef LANG_LIB_NETWORK
+
+    catch(TooManyOpenSocketsException &e)
+    {
+        ret = NullValue::MakeValue();
     
-        catch(MatrixNotValidException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_MatrixInvalidError,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(MatrixNotSquareException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_MatrixNotSquareError,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(ZeroDeterminantException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_ZeroDeterminantError,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(MatrixDimensionErrorException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_MatrixDimensionError,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(StackOverflowException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_StackOverflowError,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_TooManyOpenSockets,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(UnableToOpenSocketException &e)
+    {
+        ret = NullValue::MakeValue();
     
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_UnableToOpenSocket,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(UnableToCloseSocketException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_UnableToCloseSocket,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(SocketInvalidAddressException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_NetworkInvalidAddress,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(SocketUnableToConnectToServerException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_NetworkUnableToConnectToServer,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(SocketNotOpenException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_NetworkSocketNotOpen,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(SocketWriteErrorException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_NetworkSocketWriteError,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(SocketReadErrorException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_NetworkSocketReadError,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+
 #endif
+
+#ifdef LANG_LIB_MATH_MATRIX
+
+    catch(MatrixNotValidException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_MatrixInvalidError,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(MatrixNotSquareException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_MatrixNotSquareError,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(ZeroDeterminantException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_ZeroDeterminantError,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(MatrixDimensionErrorException &e)
+    {
+        ret = NullValue::MakeValue();
     
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_MatrixDimensionError,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(StackOverflowException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_StackOverflowError,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+
+#endif
+
 #ifdef LANG_LIB_DATABASE
+
+    catch(DatabaseInternalErrorException &e)
+    {
+        ret = NullValue::MakeValue();
     
-        catch(DatabaseInternalErrorException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_DB_InternalError,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(DatabaseInvalidConnectionTypeException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_DB_InvalidConnectionType,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(DatabaseInvalidHandleException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            //  Invoke the generic illegal-handle callback for an illegal
-            //  database handle.
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_IllegalHandle,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(DatabaseTooManyOpenConnectionsException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_DB_TooManyOpenConnections,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(DatabaseUnableToOpenConnectionException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_DB_UnableToOpenConnection,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(DatabaseConnectionNotOpenException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_DB_ConnectionNotOpen,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(DatabaseConnectionDroppedException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_DB_ConnectionDropped,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(DatabaseQueryErrorException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_DB_QueryError,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(DatabaseUnknownException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            //  Invoke the internal-error handler for an unknown database error.
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_DB_InternalError,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_DB_InternalError,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(DatabaseInvalidConnectionTypeException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_DB_InvalidConnectionType,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(DatabaseInvalidHandleException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        //  Invoke the generic illegal-handle callback for an illegal
+        //  database handle.
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_IllegalHandle,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(DatabaseTooManyOpenConnectionsException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_DB_TooManyOpenConnections,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(DatabaseUnableToOpenConnectionException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_DB_UnableToOpenConnection,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(DatabaseConnectionNotOpenException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_DB_ConnectionNotOpen,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
     
+    catch(DatabaseConnectionDroppedException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_DB_ConnectionDropped,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(DatabaseQueryErrorException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_DB_QueryError,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(DatabaseUnknownException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        //  Invoke the internal-error handler for an unknown database error.
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_DB_InternalError,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+
 #endif
 
 #ifdef LANG_LIB_RS232
+
+    catch(Rs232BadConfigurationException &e)
+    {
+        ret = NullValue::MakeValue();
     
-        catch(Rs232BadConfigurationException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_RS232_ConfigurationNotSupported,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
-        
-        catch(Rs232UnableToOpenPortException &e)
-        {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_RS232_UnableToOpenPort,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_RS232_ConfigurationNotSupported,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(Rs232UnableToOpenPortException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_RS232_UnableToOpenPort,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(Rs232PortNotOpenException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_RS232_PortNotOpen,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(Rs232WriteFailureException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_RS232_WriteFailure,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+    
+    catch(Rs232ReadFailureException &e)
+    {
+        ret = NullValue::MakeValue();
+    
+        ErrorCallbacks::Instance().Invoke(
+            ErrorCallbacks::ERR_RS232_ReadFailure,
+            ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
+            SymbolTable()
+        );
+    }
+
+#endif
+    
+    return false;
+}
+
+bool dish::Parser::execute(const dish::ModuleParseTreeNode &module, std::shared_ptr< dish::iAtomic > &ret)
+{
+    ScopedModule scope(*this, module);
+    
+    for(ModuleParseTreeNode::StatementListT::const_iterator i(module.Statements().begin()), last_i(module.Statements().end()); i != last_i; ++i)
+    {
+        //  Imported modules run statement by statement as well, so that an
+        //  error is reported against the statement which raised it.
+        const bool returned(
+            (typeid(ModuleParseTreeNode) == typeid(**i)) ?
+                execute(static_cast< const ModuleParseTreeNode & >(**i), ret) :
+                execute(*i, ret)
+        );
         
-        catch(Rs232PortNotOpenException &e)
+        if(returned)
         {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_RS232_PortNotOpen,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
+            return true;
         }
+    }
+    
+    return false;
+}
+
+std::shared_ptr< dish::ModuleParseTreeNode > dish::Parser::ParseProgram()
+{
+    std::shared_ptr< ModuleParseTreeNode > program(mSuppressLocationInformation ? ModuleParseTreeNode::MakeValue(Source(), true) : ModuleParseTreeNode::MakeValue(mInput.Location(), Source(), true));
+    
+    while(!mInput.Empty())
+    {
+        program->Add(ParseStatement());
+    }
+    
+    std::shared_ptr< iParseTreeNode > tree(program);
+    Optimizer(mDeclarations, mInlineSize, mInlineAfter).Run(tree);
+    
+    return program;
+}
+
+std::shared_ptr< dish::iAtomic > dish::Parser::Run()
+{
+    std::shared_ptr< iAtomic > ret = NullValue::MakeValue();   
+    
+    if(mWholeProgram)
+    {
+        execute(*ParseProgram(), ret);
         
-        catch(Rs232WriteFailureException &e)
-        {
-            ret = NullValue::MakeValue();
+        return ret;
+    }
+    
+    while(!mInput.Empty())
+    {
+        //  Files imported through the parse-tree cache are whole modules.
+        std::shared_ptr< iParseTreeNode > statement(ParseStatement());
         
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_RS232_WriteFailure,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
-        }
+        const bool returned(
+            (typeid(ModuleParseTreeNode) == typeid(*statement)) ?
+                execute(static_cast< const ModuleParseTreeNode & >(*statement), ret) :
+                execute(statement, ret)
+        );
         
-        catch(Rs232ReadFailureException &e)
+        if(returned)
         {
-            ret = NullValue::MakeValue();
-        
-            ErrorCallbacks::Instance().Invoke(
-                ErrorCallbacks::ERR_RS232_ReadFailure,
-                ErrorCallbacks::CallbackArg(statement->LocationString(), e.what()),
-                SymbolTable()
-            );
+            break;
         }
-    
-#endif
     }
     
     return ret;
@@ -2055,6 +2464,13 @@ std::shared_ptr< dish::iAtomic > dish::Parser::Run()
 
 void dish::Parser::Validate()
 {
+    if(mWholeProgram)
+    {
+        ParseProgram()->Validate(SymbolTable());
+        
+        return;
+    }
+    
     while(!mInput.Empty())
     {
         ParseStatement()->Validate(SymbolTable());
@@ -2063,6 +2479,15 @@ void dish::Parser::Validate()
 
 void dish::Parser::PrintParseTree(std::ostream &out)
 {
+    if(mWholeProgram)
+    {
+        out << "Program: ";
+        ParseProgram()->Print(out);
+        out << std::endl;
+        
+        return;
+    }
+    
     while(!mInput.Empty())
     {
         out << "Statement: ";
@@ -2097,20 +2522,6 @@ void dish::Parser::PrintRemainder(std::ostream &out)
 
 dish::IntegerT dish::Parser::ReleaseCachedParseTreeNodes()
 {
-    IntegerT nodecount(0);
-
-    nodecount += NumCachedExpressions();
-    mExpressionList.clear();
-#ifdef LIST_TYPE_PREFER_VECTOR
-    mExpressionList.reserve(LIST_TYPE_PREFER_VECTOR);
-#endif
-    
-    nodecount += NumCachedDeclarations();
-    mDeclarationList.clear();
-#ifdef LIST_TYPE_PREFER_VECTOR
-    mDeclarationList.reserve(LIST_TYPE_PREFER_VECTOR);
-#endif
-
-    return nodecount;
+    return (mExpressionTable.Clear() + mDeclarationTable.Clear());
 }
 
@@ -29,11 +29,14 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "inline.h"
 #include "input.h"
 #include "language.h"
+#include "optimizer.h"
+#include "ptcache.h"
 #include "ptnode.h"
 #include "tokenizer.h"
 
@@ -49,6 +52,85 @@ namespace dish
 #else
             using ExpressionListT = std::list< std::shared_ptr< iParseTreeNode > >;
 #endif
+
+            //  The nodes parsed so far which later equal nodes can share, kept
+            //  by their Hash() so that finding a match costs a single bucket
+            //  rather than a scan of every node parsed. Nodes within a bucket
+            //  are compared with IsEqual() in the order they were added, so the
+            //  first equal node is shared as it was by a scan.
+            class SharedNodeTable
+            {
+                private:
+                    using BucketTableT = std::unordered_map< std::size_t, ExpressionListT >;
+                    
+                    BucketTableT mBuckets;
+                    IntegerT mSize;
+                    IntegerT mShared;
+                
+                public:
+                    INLINE SharedNodeTable() : mBuckets(), mSize(0), mShared(0) {};
+                    
+                    //  Returns the node equal to node if there is one, or adds
+                    //  node and returns it.
+                    std::shared_ptr< iParseTreeNode > Match(std::shared_ptr< iParseTreeNode > node);
+                    
+                    //  Empties the table, returning the number of nodes it held.
+                    IntegerT Clear();
+                    
+                    INLINE const IntegerT &Size() const throw() { return mSize; };
+                    INLINE const IntegerT &NumShared() const throw() { return mShared; };
+                
+            };
+
+            //  The parser's model of the frames that will be on the stack when
+            //  the statement being parsed is executed. Identifiers declared
+            //  directly within a frame (at ChildDepth) occupy predictable slots
+            //  so references to them are resolved to (depth, slot) pairs. A
+            //  declaration anywhere else makes the frame unstable, and every
+            //  identifier resolved past it (Through) reverts to name lookup.
+            //  Symbols a call adds to a frame at run-time are not modelled, so
+            //  a resolved identifier also records how many symbols the frames
+            //  it was resolved past should hold, and reverts to name lookup
+            //  whenever they hold more. Boundaries mark function bodies, which run on the caller's 
+            //  stack and so cannot see the enclosing frames statically.
+            using StaticScopeT = struct StaticScope
+            {
+                bool Boundary;
+                bool Stable;
+                int ChildDepth;
+                
+                std::vector< std::string > Names;
+                std::vector< std::shared_ptr< IdentifierParseTreeNode > > Through;
+                
+                INLINE StaticScope(const bool &boundary, const int &childdepth) : Boundary(boundary), Stable(!boundary), ChildDepth(childdepth), Names(), Through() {};
+            };
+            
+            using StaticScopeStackT = std::vector< StaticScopeT >;
+            
+            class ScopedModule
+            {
+                private:
+                    Parser &mParser;
+                    const ModuleParseTreeNode * const mPrevious;
+                    
+                public:
+                    INLINE ScopedModule(Parser &parser, const ModuleParseTreeNode &module) : mParser(parser), mPrevious(parser.mModule) { mParser.mModule = &module; };
+                    INLINE ~ScopedModule() { mParser.mModule = mPrevious; };
+                    
+            };
+            
+            class ScopedStaticScope
+            {
+                private:
+                    StaticScopeStackT &mStack;
+                    StaticScopeStackT::size_type mNum;
+                    
+                public:
+                    INLINE ScopedStaticScope(StaticScopeStackT &stack, const int &childdepth) : mStack(stack), mNum(1) { mStack.push_back(StaticScopeT(false, childdepth)); };
+                    ScopedStaticScope(StaticScopeStackT &stack, const iExecutableAtomic::ParamListT &formalparams);
+                    INLINE ~ScopedStaticScope() { for(StaticScopeStackT::size_type i(0); i != mNum; ++i) { mStack.pop_back(); } };
+                    
+            };
     
         private:
             std::shared_ptr< LanguageSymbolTable > mSymbolTable;
@@ -58,8 +140,32 @@ namespace dish
             
             const bool mSuppressLocationInformation;
             
-            ExpressionListT mExpressionList;
-            ExpressionListT mDeclarationList;
+            SharedNodeTable mExpressionTable;
+            SharedNodeTable mDeclarationTable;
+            
+            StaticScopeStackT mStaticScopes;
+            int mStatementDepth;
+            IntegerT mNumResolved;
+            
+            //  Set if the whole program is parsed, and optimized, before any of
+            //  it is executed; the module being executed, if any.
+            bool mWholeProgram;
+            const ModuleParseTreeNode *mModule;
+            
+            //  The number of times each name is declared anywhere in the
+            //  program, for the optimizer.
+            iOptimizationPass::DeclarationCountT mDeclarations;
+            
+            //  The most nodes of a function inlined by the optimizer, if any,
+            //  and the number of calls made before a call site is inlined.
+            int mInlineSize;
+            IntegerT mInlineAfter;
+            
+            //  The parse-tree cache imported files are loaded from, if any, and
+            //  the names declared by the imported file being parsed, so that 
+            //  they can be stored with it.
+            std::shared_ptr< ParseTreeCache > mParseTreeCache;
+            ParseTreeCache::DeclarationListT *mModuleDeclarations;
             
         protected:
             void generateMismatchError(const TokenTypeT &found, const TokenTypeT &expecting, const std::string &locstr) const;
@@ -91,7 +197,23 @@ namespace dish
             std::shared_ptr< iParseTreeNode > parseOrChain(std::shared_ptr< iParseTreeNode > node);
             std::shared_ptr< iParseTreeNode > parseXorChain(std::shared_ptr< iParseTreeNode > node);
             
-            std::shared_ptr< iParseTreeNode > matchInList(ExpressionListT &list, std::shared_ptr< iParseTreeNode > node);
+            std::shared_ptr< iParseTreeNode > matchInTable(SharedNodeTable &table, std::shared_ptr< iParseTreeNode > node);
+            
+            void declare(const std::string &name);
+            void declareLocal(const std::string &id);
+            void declareParameters(const iExecutableAtomic::ParamListT &formalparams);
+            std::shared_ptr< IdentifierParseTreeNode > resolveLocal(const std::string &id);
+            
+            //  Execute a top-level statement, or each of those of a module, and
+            //  report any error; true is returned if a return statement ended
+            //  the program, with ret set to the value returned.
+            bool execute(std::shared_ptr< iParseTreeNode > statement, std::shared_ptr< iAtomic > &ret);
+            bool execute(const ModuleParseTreeNode &module, std::shared_ptr< iAtomic > &ret);
+            
+            //  Parses the file imported as fname at locstr into a module, or
+            //  loads it from the parse-tree cache, leaving a semicolon token as
+            //  the lookahead in either case.
+            std::shared_ptr< ModuleParseTreeNode > importModule(const SourceLocationT &location, const std::string &fname);
         
         public:
             Parser(const bool profile, const int maxdepth, const std::string &source, const bool finput, const bool suppressloc = false);
@@ -137,6 +259,20 @@ namespace dish
             
             std::shared_ptr< iParseTreeNode > ParseStatement();                 //  <--
             
+            //  Parses the rest of the input, including the files it imports,
+            //  into a module, and runs the optimizer over it.
+            std::shared_ptr< ModuleParseTreeNode > ParseProgram();
+            
+            INLINE bool IsWholeProgram() const throw() { return mWholeProgram; };
+            INLINE void SetWholeProgram(const bool &whole) { mWholeProgram = whole; };
+            
+            //  Functions are inlined by the optimizer if size is positive.
+            INLINE void SetInlining(const int &size, const IntegerT &after) { mInlineSize = size; mInlineAfter = after; };
+            
+            //  Files imported are loaded from, and stored in, a parse-tree cache
+            //  in dir, or next to each file if dir is empty.
+            INLINE void SetParseTreeCache(const std::string &dir) { mParseTreeCache.reset(new ParseTreeCache(dir, mSuppressLocationInformation)); };
+            
             
             INLINE const LanguageSymbolTable &SymbolTable() const { return *mSymbolTable; };
             INLINE LanguageSymbolTable &SymbolTable() { return *mSymbolTable; };
@@ -154,13 +290,19 @@ namespace dish
             //  This method returns true if the DISH-program's entry point (the
             //  file specifed on the command-line of the interpreter) is being
             //  processed, or false otherwise (an imported file is being 
-            //  processed). This information is available from the input stack.
-            INLINE bool IsEntryPoint() const { return mInput.IsEntryPoint(); };
+            //  processed). This information is available from the input stack,
+            //  or from the module being executed if the whole program was parsed.
+            INLINE bool IsEntryPoint() const { return (0 != mModule) ? mModule->IsEntryPoint() : mInput.IsEntryPoint(); };
             
             void PrintRemainder(std::ostream &out);
             
-            INLINE IntegerT NumCachedExpressions() const { return static_cast< IntegerT >(mExpressionList.size()); };
-            INLINE IntegerT NumCachedDeclarations() const { return static_cast< IntegerT >(mDeclarationList.size()); };
+            INLINE IntegerT NumCachedExpressions() const { return mExpressionTable.Size(); };
+            INLINE IntegerT NumCachedDeclarations() const { return mDeclarationTable.Size(); };
+            
+            //  The number of nodes parsed which were replaced by an equal node
+            //  parsed before.
+            INLINE IntegerT NumSharedExpressions() const { return mExpressionTable.NumShared(); };
+            INLINE IntegerT NumSharedDeclarations() const { return mDeclarationTable.NumShared(); };
             
             IntegerT ReleaseCachedParseTreeNodes();
         
@@ -0,0 +1,1134 @@
+/*
+    This file is part of the DISH programming language, Copyright 2014-2017 by
+    Chris Buck.
+    
+    DISH is free software for non-commercial use; you can redistribute it and/or
+    modify it provided
+    
+        (1) The following Copyright notice is displayed at runtime and in any
+            accompanying documentation:
+            
+            DISH programming language copyright (c) 2014-2017 by Chris Buck.
+        
+        (2) All source files duplicate this copyright statement in full.
+    
+    Commercial licenses can be negotiated by contacting Chris Buck at
+    chrisbuck1220@hotmail.com.
+    
+    DISH is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.
+*/
+
+#include <cassert>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <typeinfo>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include "exception.h"
+#include "log.h"
+#include "ptcache.h"
+#include "ptnode.h"
+#include "version.h"
+
+namespace
+{
+
+    //  Identifies a parse-tree cache file, and the layout of its values, which
+    //  are written in the byte order and sizes of the machine writing them.
+    const char * const MAGIC("DISHPTC");
+    const std::int32_t FORMAT_VERSION(5);
+    const std::int32_t BYTE_ORDER_MARK(0x01020304);
+    
+    //  The 64-bit FNV-1a hash of nbytes of data.
+    std::uint64_t fnv1a(const char *data, const std::size_t &nbytes)
+    {
+        std::uint64_t hash(14695981039346656037ULL);
+        
+        const unsigned char *bytes(reinterpret_cast< const unsigned char * >(data));
+        for(std::size_t i(0); i < nbytes; ++i)
+        {
+            hash = (hash ^ bytes[i]) * 1099511628211ULL;
+        }
+        
+        return hash;
+    }
+    
+    //  Makes a node through the factory taking its location, unless locations
+    //  were suppressed when the node was parsed.
+    template< typename NodeT, typename... ArgsT > std::shared_ptr< NodeT > make(const dish::SourceLocationT &location, ArgsT &... args)
+    {
+        return (dish::SourceLocationTable::NO_LOCATION == location) ? NodeT::MakeValue(args...) : NodeT::MakeValue(location, args...);
+    }
+    
+    //  The contents of a file, mapped into memory for as long as the object
+    //  exists; empty if the file cannot be mapped.
+    class MappedFile
+    {
+        private:
+            void *mData;
+            std::size_t mSize;
+        
+        public:
+            MappedFile(const std::string &fname) : mData(MAP_FAILED), mSize(0)
+            {
+                const int fd(open(fname.c_str(), O_RDONLY));
+                if(fd < 0)
+                {
+                    return;
+                }
+                
+                struct stat statinfo;
+                if((0 == fstat(fd, &statinfo)) && (statinfo.st_size > 0))
+                {
+                    mSize = static_cast< std::size_t >(statinfo.st_size);
+                    mData = mmap(0, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+                }
+                
+                close(fd);
+            };
+            
+            ~MappedFile() { if(!Empty()) { munmap(mData, mSize); } };
+            
+            bool Empty() const { return (MAP_FAILED == mData); };
+            
+            const char *Data() const { return static_cast< const char * >(mData); };
+            const std::size_t &Size() const { return mSize; };
+        
+    };
+    
+    //  Identifies the state of a source file: where it lives, when it was last
+    //  written, to the nanosecond, and a hash (64-bit FNV-1a) of its contents,
+    //  since an edit which keeps the size may share the time of the last.
+    struct SourceStamp
+    {
+        std::int64_t device;
+        std::int64_t inode;
+        std::int64_t seconds;
+        std::int64_t nanoseconds;
+        std::int64_t size;
+        std::uint64_t hash;
+        
+        bool Read(const std::string &path)
+        {
+            struct stat statinfo;
+            if(0 != stat(path.c_str(), &statinfo))
+            {
+                return false;
+            }
+            
+            device = static_cast< std::int64_t >(statinfo.st_dev);
+            inode = static_cast< std::int64_t >(statinfo.st_ino);
+            seconds = static_cast< std::int64_t >(statinfo.st_mtim.tv_sec);
+            nanoseconds = static_cast< std::int64_t >(statinfo.st_mtim.tv_nsec);
+            size = static_cast< std::int64_t >(statinfo.st_size);
+            
+            hash = fnv1a(0, 0);
+            if(size > 0)
+            {
+                const MappedFile source(path);
+                if(source.Empty())
+                {
+                    return false;
+                }
+                
+                hash = fnv1a(source.Data(), source.Size());
+            }
+            
+            return true;
+        };
+        
+    };
+    
+}
+
+/******************************************************************************
+
+    dish::ParseTreeWriter class definitions
+
+ ******************************************************************************/
+
+void dish::ParseTreeWriter::Write(const std::string &str)
+{
+    //  A string is written in full the first time only, and by its index into
+    //  those written before after that.
+    const auto written(mStrings.find(str));
+    if(mStrings.end() != written)
+    {
+        Write(written->second);
+        return;
+    }
+    
+    const std::int32_t index(static_cast< std::int32_t >(mStrings.size()));
+    mStrings[str] = index;
+    
+    Write(static_cast< std::int32_t >(-1));
+    Write(static_cast< std::int32_t >(str.size()));
+    write(str.data(), str.size());
+}
+
+void dish::ParseTreeWriter::WriteLocation(const dish::SourceLocationT &location)
+{
+    if(SourceLocationTable::NO_LOCATION == location)
+    {
+        Write(std::string());
+        return;
+    }
+    
+    Write(SourceLocationTable::Source(location));
+    Write(static_cast< std::int32_t >(SourceLocationTable::Line(location)));
+    Write(static_cast< std::int32_t >(SourceLocationTable::Column(location)));
+}
+
+void dish::ParseTreeWriter::Write(const dish::iExecutableAtomic::ParamListT &params)
+{
+    Write(static_cast< std::int32_t >(params.size()));
+    
+    for(iExecutableAtomic::ParamListT::const_iterator i(params.begin()), last_i(params.end()); i != last_i; ++i)
+    {
+        Write(i->first);
+        Write(i->second);
+    }
+}
+
+void dish::ParseTreeWriter::Write(const std::shared_ptr< dish::iParseTreeNode > &node)
+{
+    if(0 == node.get())
+    {
+        Write(ptnNone);
+        return;
+    }
+    
+    const auto written(mNodes.find(node.get()));
+    if(mNodes.end() != written)
+    {
+        Write(ptnBackReference);
+        Write(written->second);
+        return;
+    }
+    
+    node->Write(*this);
+    
+    //  Nodes are numbered once their children are written, in the order the
+    //  reader finishes making them.
+    const std::int32_t index(static_cast< std::int32_t >(mNodes.size()));
+    mNodes[node.get()] = index;
+}
+
+void dish::ParseTreeWriter::Begin(const dish::ParseTreeTagT &tag, const dish::iParseTreeNode &node)
+{
+    Write(tag);
+    WriteLocation(node.Location());
+}
+
+void dish::ParseTreeWriter::WriteModule(const dish::ModuleParseTreeNode &module)
+{
+    Write(static_cast< std::int32_t >(module.Statements().size()));
+    
+    for(ModuleParseTreeNode::StatementListT::const_iterator i(module.Statements().begin()), last_i(module.Statements().end()); i != last_i; ++i)
+    {
+        if(typeid(ModuleParseTreeNode) == typeid(**i))
+        {
+            const ModuleParseTreeNode &imported(static_cast< const ModuleParseTreeNode & >(**i));
+            
+            Write(ptnImport);
+            WriteLocation(imported.Location());
+            Write(imported.Name());
+        }
+        else
+        {
+            Write(*i);
+        }
+    }
+    
+    Write(ptnEnd);
+}
+
+/******************************************************************************
+
+    dish::ParseTreeReader class definitions
+
+ ******************************************************************************/
+
+void dish::ParseTreeReader::read(void *data, const std::size_t &nbytes)
+{
+    if(static_cast< std::size_t >(mEnd - mNext) < nbytes)
+    {
+        throw ParseTreeCacheException("The parse-tree cache file is truncated.");
+    }
+    
+    std::memcpy(data, mNext, nbytes);
+    mNext += nbytes;
+}
+
+dish::ParseTreeTagT dish::ParseTreeReader::ReadTag()
+{
+    const std::int32_t tag(ReadInt32());
+    if((tag < ptnBackReference) || (tag > ptnEnd))
+    {
+        throw ParseTreeCacheException("The parse-tree cache file is damaged.");
+    }
+    
+    return static_cast< ParseTreeTagT >(tag);
+}
+
+bool dish::ParseTreeReader::ReadBoolean()
+{
+    char byte(0);
+    read(&byte, sizeof(byte));
+    
+    return (0 != byte);
+}
+
+std::int32_t dish::ParseTreeReader::ReadInt32()
+{
+    std::int32_t value(0);
+    read(&value, sizeof(value));
+    
+    return value;
+}
+
+std::int64_t dish::ParseTreeReader::ReadInt64()
+{
+    std::int64_t value(0);
+    read(&value, sizeof(value));
+    
+    return value;
+}
+
+dish::RealT dish::ParseTreeReader::ReadReal()
+{
+    RealT value(0);
+    read(&value, sizeof(value));
+    
+    return value;
+}
+
+std::string dish::ParseTreeReader::ReadString()
+{
+    const std::int32_t index(ReadInt32());
+    if(index >= 0)
+    {
+        if(static_cast< std::size_t >(index) >= mStrings.size())
+        {
+            throw ParseTreeCacheException("The parse-tree cache file is damaged.");
+        }
+        
+        return mStrings[index];
+    }
+    
+    const std::int32_t nbytes(ReadInt32());
+    if((-1 != index) || (nbytes < 0) || (static_cast< std::size_t >(mEnd - mNext) < static_cast< std::size_t >(nbytes)))
+    {
+        throw ParseTreeCacheException("The parse-tree cache file is damaged.");
+    }
+    
+    mStrings.push_back(std::string(mNext, nbytes));
+    mNext += nbytes;
+    
+    return mStrings.back();
+}
+
+dish::SourceLocationT dish::ParseTreeReader::ReadLocation()
+{
+    const std::string source(ReadString());
+    if(source.empty())
+    {
+        return SourceLocationTable::NO_LOCATION;
+    }
+    
+    const std::int32_t line(ReadInt32());
+    const std::int32_t column(ReadInt32());
+    
+    return SourceLocationTable::Intern(source, line, column);
+}
+
+dish::iExecutableAtomic::ParamListT dish::ParseTreeReader::ReadParameters()
+{
+    iExecutableAtomic::ParamListT params;
+    
+    for(std::int32_t i(ReadInt32()); i > 0; --i)
+    {
+        const std::string id(ReadString());
+        const bool reference(ReadBoolean());
+        
+        params.push_back(std::make_pair(id, reference));
+    }
+    
+    return params;
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::ParseTreeReader::ReadNode()
+{
+    return readNode(ReadTag());
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::ParseTreeReader::readNode(const dish::ParseTreeTagT &tag)
+{
+    switch(tag)
+    {
+        case ptnBackReference:
+        {
+            const std::int32_t index(ReadInt32());
+            if((index < 0) || (static_cast< std::size_t >(index) >= mNodes.size()))
+            {
+                throw ParseTreeCacheException("The parse-tree cache file is damaged.");
+            }
+            
+            return mNodes[index];
+        }
+        
+        case ptnNone:
+        {
+            return std::shared_ptr< iParseTreeNode >();
+        }
+        
+        case ptnImport:
+        case ptnEnd:
+        {
+            throw ParseTreeCacheException("The parse-tree cache file is damaged.");
+        }
+        
+        default:
+        {
+            const SourceLocationT location(ReadLocation());
+            
+            std::shared_ptr< iParseTreeNode > node(makeNode(tag, location));
+            mNodes.push_back(node);
+            
+            return node;
+        }
+        
+    }
+    
+    assert(false);
+    return std::shared_ptr< iParseTreeNode >();
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::ParseTreeReader::readLiteral(const dish::SourceLocationT &location)
+{
+    const std::int32_t type(ReadInt32());
+    const bool locked(ReadBoolean());
+    
+    //  The parser makes unlocked literals, which are shared where locations
+    //  are suppressed; a locked one can only have come from folding constants.
+    std::shared_ptr< iAtomic > value;
+    switch(type)
+    {
+        case iAtomic::typeBoolean:
+        {
+            const BooleanT literal(ReadBoolean());
+            if(!locked)
+            {
+                return make< LiteralParseTreeNode >(location, literal);
+            }
+            
+            value = BooleanValue::MakeValue(literal, locked);
+        } break;
+        
+        case iAtomic::typeInteger:
+        {
+            const IntegerT literal(ReadInt64());
+            if(!locked)
+            {
+                return make< LiteralParseTreeNode >(location, literal);
+            }
+            
+            value = IntegerValue::MakeValue(literal, locked);
+        } break;
+        
+        case iAtomic::typeReal:
+        {
+            const RealT literal(ReadReal());
+            if(!locked)
+            {
+                return make< LiteralParseTreeNode >(location, literal);
+            }
+            
+            value = RealValue::MakeValue(literal, locked);
+        } break;
+        
+        case iAtomic::typeString:
+        {
+            const StringT literal(ReadString());
+            if(!locked)
+            {
+                return make< LiteralParseTreeNode >(location, literal);
+            }
+            
+            value = StringValue::MakeValue(literal, locked);
+        } break;
+        
+        default:
+        {
+            throw ParseTreeCacheException("The parse-tree cache file is damaged.");
+        }
+        
+    }
+    
+    return make< LiteralParseTreeNode >(location, value);
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::ParseTreeReader::makeNode(const dish::ParseTreeTagT &tag, const dish::SourceLocationT &location)
+{
+    //  Every node is made as the parser makes it; the children are read, in
+    //  the order they were written, before the node holding them.
+    switch(tag)
+    {
+        case ptnNull:
+        {
+            return make< NullParseTreeNode >(location);
+        }
+        
+        case ptnLiteral:
+        {
+            return readLiteral(location);
+        }
+        
+        case ptnLiteralArray:
+        {
+            std::shared_ptr< LiteralArrayParseTreeNode > node(make< LiteralArrayParseTreeNode >(location));
+            for(std::int32_t i(ReadInt32()); i > 0; --i)
+            {
+                node->Add(ReadNode());
+            }
+            
+            return node;
+        }
+        
+        case ptnIdentifier:
+        {
+            const bool baseid(ReadBoolean());
+            const std::string id(ReadString());
+            const int depth(ReadInt32());
+            const int slot(ReadInt32());
+            const int nearer(ReadInt32());
+            
+            if(IdentifierParseTreeNode::UNRESOLVED != depth)
+            {
+                return make< IdentifierParseTreeNode >(location, id, depth, slot, nearer);
+            }
+            
+            const std::string name(baseid ? ("`" + id) : id);
+            return make< IdentifierParseTreeNode >(location, name);
+        }
+        
+        case ptnLock:
+        {
+            const std::string id(ReadString());
+            return make< LockParseTreeNode >(location, id);
+        }
+        
+        case ptnBooleanType:
+        {
+            return make< BooleanTypeParseTreeNode >(location);
+        }
+        
+        case ptnIntegerType:
+        {
+            return make< IntegerTypeParseTreeNode >(location);
+        }
+        
+        case ptnRangedIntegerType:
+        {
+            std::shared_ptr< iParseTreeNode > minimum(ReadNode());
+            std::shared_ptr< iParseTreeNode > maximum(ReadNode());
+            std::shared_ptr< iParseTreeNode > boundary(ReadNode());
+            
+            return make< RangedIntegerTypeParseTreeNode >(location, minimum, maximum, boundary);
+        }
+        
+        case ptnRealType:
+        {
+            return make< RealTypeParseTreeNode >(location);
+        }
+        
+        case ptnRangedRealType:
+        {
+            std::shared_ptr< iParseTreeNode > minimum(ReadNode());
+            std::shared_ptr< iParseTreeNode > maximum(ReadNode());
+            std::shared_ptr< iParseTreeNode > boundary(ReadNode());
+            
+            return make< RangedRealTypeParseTreeNode >(location, minimum, maximum, boundary);
+        }
+        
+        case ptnStringType:
+        {
+            return make< StringTypeParseTreeNode >(location);
+        }
+        
+        case ptnArrayType:
+        {
+            std::shared_ptr< iParseTreeNode > from(ReadNode());
+            std::shared_ptr< iParseTreeNode > to(ReadNode());
+            std::shared_ptr< iParseTreeNode > type(ReadNode());
+            
+            return make< ArrayTypeParseTreeNode >(location, from, to, type);
+        }
+        
+        case ptnDictionaryType:
+        {
+            return make< DictionaryTypeParseTreeNode >(location);
+        }
+        
+        case ptnStructureType:
+        {
+            std::shared_ptr< StructureTypeParseTreeNode > node(make< StructureTypeParseTreeNode >(location));
+            for(std::int32_t i(ReadInt32()); i > 0; --i)
+            {
+                const std::string id(ReadString());
+                node->Add(id, ReadNode());
+            }
+            
+            return node;
+        }
+        
+        case ptnDeclare:
+        {
+            std::shared_ptr< iParseTreeNode > type(ReadNode());
+            const std::string id(ReadString());
+            
+            return make< DeclareParseTreeNode >(location, type, id);
+        }
+        
+        case ptnDeclareType:
+        {
+            std::shared_ptr< iParseTreeNode > type(ReadNode());
+            const std::string id(ReadString());
+            
+            return make< DeclareTypeParseTreeNode >(location, type, id);
+        }
+        
+        case ptnDeclareFunction:
+        {
+            const std::string id(ReadString());
+            const iExecutableAtomic::ParamListT params(ReadParameters());
+            std::shared_ptr< iParseTreeNode > body(ReadNode());
+            
+            return make< DeclareFunctionParseTreeNode >(location, id, params, body);
+        }
+        
+        case ptnLambdaFunction:
+        {
+            const iExecutableAtomic::ParamListT params(ReadParameters());
+            std::shared_ptr< iParseTreeNode > body(ReadNode());
+            
+            return make< LambdaFunctionParseTreeNode >(location, params, body);
+        }
+        
+        case ptnDeclareReference:
+        {
+            const std::string id(ReadString());
+            std::shared_ptr< iParseTreeNode > expr(ReadNode());
+            
+            return make< DeclareReferenceParseTreeNode >(location, id, expr);
+        }
+        
+        case ptnAssignment:
+        {
+            std::shared_ptr< iParseTreeNode > lhs(ReadNode());
+            std::shared_ptr< iParseTreeNode > rhs(ReadNode());
+            
+            return make< AssignmentParseTreeNode >(location, lhs, rhs);
+        }
+        
+        case ptnIndex:
+        {
+            std::shared_ptr< iParseTreeNode > base(ReadNode());
+            std::shared_ptr< iParseTreeNode > index(ReadNode());
+            
+            return make< IndexParseTreeNode >(location, base, index);
+        }
+        
+        case ptnMember:
+        {
+            std::shared_ptr< iParseTreeNode > base(ReadNode());
+            const std::string member(ReadString());
+            
+            return make< MemberParseTreeNode >(location, base, member);
+        }
+        
+        case ptnFunctionCall:
+        {
+            std::shared_ptr< iParseTreeNode > function(ReadNode());
+            
+            FunctionCallParseTreeNode::ParameterListT plist;
+            for(std::int32_t i(ReadInt32()); i > 0; --i)
+            {
+                plist.push_back(ReadNode());
+            }
+            
+            return make< FunctionCallParseTreeNode >(location, function, plist);
+        }
+        
+        case ptnReturn:
+        {
+            std::shared_ptr< iParseTreeNode > ret(ReadNode());
+            const bool tailcall(ReadBoolean());
+            
+            return make< ReturnParseTreeNode >(location, ret, tailcall);
+        }
+        
+        case ptnNegateOp:
+        {
+            std::shared_ptr< iParseTreeNode > opr(ReadNode());
+            return make< NegateOpParseTreeNode >(location, opr);
+        }
+        
+        case ptnNotOp:
+        {
+            std::shared_ptr< iParseTreeNode > opr(ReadNode());
+            return make< NotOpParseTreeNode >(location, opr);
+        }
+        
+        case ptnSubOp:
+        case ptnDivOp:
+        case ptnModOp:
+        case ptnPowOp:
+        case ptnLessThanOp:
+        case ptnLessThanEqualOp:
+        case ptnEqualOp:
+        case ptnNotEqualOp:
+        case ptnGreaterThanEqualOp:
+        case ptnGreaterThanOp:
+        {
+            std::shared_ptr< iParseTreeNode > opr1(ReadNode());
+            std::shared_ptr< iParseTreeNode > opr2(ReadNode());
+            
+            switch(tag)
+            {
+                case ptnSubOp: return make< SubOpParseTreeNode >(location, opr1, opr2);
+                case ptnDivOp: return make< DivOpParseTreeNode >(location, opr1, opr2);
+                case ptnModOp: return make< ModOpParseTreeNode >(location, opr1, opr2);
+                case ptnPowOp: return make< PowOpParseTreeNode >(location, opr1, opr2);
+                case ptnLessThanOp: return make< LessThanOpParseTreeNode >(location, opr1, opr2);
+                case ptnLessThanEqualOp: return make< LessThanEqualOpParseTreeNode >(location, opr1, opr2);
+                case ptnEqualOp: return make< EqualOpParseTreeNode >(location, opr1, opr2);
+                case ptnNotEqualOp: return make< NotEqualOpParseTreeNode >(location, opr1, opr2);
+                case ptnGreaterThanEqualOp: return make< GreaterThanEqualOpParseTreeNode >(location, opr1, opr2);
+                default: return make< GreaterThanOpParseTreeNode >(location, opr1, opr2);
+            }
+        }
+        
+        case ptnAddOpChain:
+        case ptnMulOpChain:
+        case ptnAndOpChain:
+        case ptnOrOpChain:
+        case ptnXorOpChain:
+        {
+            //  The operands were folded as the chain was parsed, leaving at
+            //  most one literal, the first; adding them again folds nothing.
+            const std::int32_t noperands(ReadInt32());
+            if(noperands < 1)
+            {
+                throw ParseTreeCacheException("The parse-tree cache file is damaged.");
+            }
+            
+            std::shared_ptr< iParseTreeNode > first(ReadNode());
+            
+            std::shared_ptr< ChainedOprParseTreeNode > node;
+            switch(tag)
+            {
+                case ptnAddOpChain: node = make< AddOpChainParseTreeNode >(location, first); break;
+                case ptnMulOpChain: node = make< MulOpChainParseTreeNode >(location, first); break;
+                case ptnAndOpChain: node = make< AndOpChainParseTreeNode >(location, first); break;
+                case ptnOrOpChain: node = make< OrOpChainParseTreeNode >(location, first); break;
+                default: node = make< XorOpChainParseTreeNode >(location, first);
+            }
+            
+            for(std::int32_t i(1); i < noperands; ++i)
+            {
+                node->AddOperand(ReadNode());
+            }
+            
+            return node;
+        }
+        
+        case ptnStatementBlock:
+        {
+            std::shared_ptr< StatementBlockParseTreeNode > node(make< StatementBlockParseTreeNode >(location));
+            for(std::int32_t i(ReadInt32()); i > 0; --i)
+            {
+                std::shared_ptr< iParseTreeNode > stmt(ReadNode());
+                node->Add(stmt);
+            }
+            
+            return node;
+        }
+        
+        case ptnIfStatement:
+        {
+            std::shared_ptr< iParseTreeNode > cond(ReadNode());
+            std::shared_ptr< iParseTreeNode > ifblk(ReadNode());
+            std::shared_ptr< iParseTreeNode > elseblk(ReadNode());
+            
+            if(0 == elseblk.get())
+            {
+                return make< IfStatementParseTreeNode >(location, cond, ifblk);
+            }
+            
+            return make< IfStatementParseTreeNode >(location, cond, ifblk, elseblk);
+        }
+        
+        case ptnSwitchStatement:
+        {
+            std::shared_ptr< iParseTreeNode > expr(ReadNode());
+            
+            std::shared_ptr< SwitchStatementParseTreeNode > node(make< SwitchStatementParseTreeNode >(location, expr));
+            for(std::int32_t i(ReadInt32()); i > 0; --i)
+            {
+                std::shared_ptr< iParseTreeNode > key(ReadNode());
+                std::shared_ptr< iParseTreeNode > value(ReadNode());
+                
+                node->AddCase(key, value);
+            }
+            
+            std::shared_ptr< iParseTreeNode > otherwise(ReadNode());
+            if(0 != otherwise.get())
+            {
+                node->AddOtherwise(otherwise);
+            }
+            
+            return node;
+        }
+        
+        case ptnForLoop:
+        {
+            std::shared_ptr< iParseTreeNode > id(ReadNode());
+            std::shared_ptr< iParseTreeNode > from(ReadNode());
+            std::shared_ptr< iParseTreeNode > to(ReadNode());
+            
+            if(ReadBoolean())
+            {
+                std::shared_ptr< iParseTreeNode > step(ReadNode());
+                std::shared_ptr< iParseTreeNode > body(ReadNode());
+                
+                return make< ForLoopParseTreeNode >(location, id, from, to, step, body);
+            }
+            
+            std::shared_ptr< iParseTreeNode > body(ReadNode());
+            return make< ForLoopParseTreeNode >(location, id, from, to, body);
+        }
+        
+        case ptnForEachLoop:
+        {
+            const bool reference(ReadBoolean());
+            const std::string id(ReadString());
+            std::shared_ptr< iParseTreeNode > collection(ReadNode());
+            std::shared_ptr< iParseTreeNode > body(ReadNode());
+            
+            return make< ForEachLoopParseTreeNode >(location, reference, id, collection, body);
+        }
+        
+        case ptnWhileLoop:
+        {
+            std::shared_ptr< iParseTreeNode > condition(ReadNode());
+            std::shared_ptr< iParseTreeNode > body(ReadNode());
+            
+            return make< WhileLoopParseTreeNode >(location, condition, body);
+        }
+        
+        case ptnRepeatUntilLoop:
+        {
+            RepeatUntilLoopParseTreeNode::BodyT body;
+            for(std::int32_t i(ReadInt32()); i > 0; --i)
+            {
+                body.push_back(ReadNode());
+            }
+            
+            std::shared_ptr< iParseTreeNode > condition(ReadNode());
+            
+            return make< RepeatUntilLoopParseTreeNode >(location, body, condition);
+        }
+        
+        case ptnAssert:
+        {
+            std::shared_ptr< iParseTreeNode > condition(ReadNode());
+            return make< AssertParseTreeNode >(location, condition);
+        }
+        
+        default:
+        {
+            throw ParseTreeCacheException("The parse-tree cache file is damaged.");
+        }
+        
+    }
+    
+    assert(false);
+    return std::shared_ptr< iParseTreeNode >();
+}
+
+void dish::ParseTreeReader::ReadModule(dish::ParseTreeReader::StatementListT &statements)
+{
+    for(std::int32_t i(ReadInt32()); i > 0; --i)
+    {
+        StatementT statement;
+        
+        const ParseTreeTagT tag(ReadTag());
+        if(ptnImport == tag)
+        {
+            statement.Location = ReadLocation();
+            statement.Import = ReadString();
+        }
+        else
+        {
+            statement.Node = readNode(tag);
+            if(0 == statement.Node.get())
+            {
+                throw ParseTreeCacheException("The parse-tree cache file is damaged.");
+            }
+        }
+        
+        statements.push_back(statement);
+    }
+    
+    if(ptnEnd != ReadTag())
+    {
+        throw ParseTreeCacheException("The parse-tree cache file is damaged.");
+    }
+}
+
+/******************************************************************************
+
+    dish::ParseTreeCache class definitions
+
+ ******************************************************************************/
+
+dish::IntegerT dish::ParseTreeCache::Loaded(0);
+dish::IntegerT dish::ParseTreeCache::Stored(0);
+dish::IntegerT dish::ParseTreeCache::Rejected(0);
+
+std::string dish::ParseTreeCache::cacheFileName(const std::string &path) const
+{
+    if(mDirectory.empty())
+    {
+        return path + ".ptc";
+    }
+    
+    //  Files from different directories share the cache directory, so each is
+    //  named for its full path; the path itself is checked on loading.
+    char fullpath[PATH_MAX];
+    const std::string key((0 != realpath(path.c_str(), fullpath)) ? std::string(fullpath) : path);
+    
+    const std::string::size_type slash(path.find_last_of('/'));
+    const std::string basename((std::string::npos == slash) ? path : path.substr(slash + 1));
+    
+    std::stringstream fname;
+    fname << mDirectory;
+    fname << "/";
+    fname << basename;
+    fname << ".";
+    fname << std::hex << std::hash< std::string >()(key);
+    fname << ".ptc";
+    
+    return fname.str();
+}
+
+void dish::ParseTreeCache::writeHeader(const std::string &path, dish::ParseTreeWriter &writer) const
+{
+    SourceStamp stamp;
+    if(!stamp.Read(path))
+    {
+        throw ParseTreeCacheException("Unable to find the source of the parse-tree.");
+    }
+    
+    writer.Write(std::string(MAGIC));
+    writer.Write(FORMAT_VERSION);
+    writer.Write(BYTE_ORDER_MARK);
+    writer.Write(static_cast< std::int32_t >(sizeof(IntegerT)));
+    writer.Write(static_cast< std::int32_t >(sizeof(RealT)));
+    
+    writer.Write(static_cast< std::int32_t >(MAJOR_VERSION));
+    writer.Write(static_cast< std::int32_t >(MINOR_VERSION));
+    writer.Write(static_cast< std::int32_t >(REVISION_VERSION));
+    writer.Write(static_cast< std::int32_t >(LANG_MAJOR_VERSION));
+    writer.Write(static_cast< std::int32_t >(LANG_MINOR_VERSION));
+    writer.Write(static_cast< std::int32_t >(LANG_REVISION_VERSION));
+    
+    writer.Write(mSuppressLocationInformation);
+    
+    writer.Write(path);
+    writer.Write(stamp.device);
+    writer.Write(stamp.inode);
+    writer.Write(stamp.seconds);
+    writer.Write(stamp.nanoseconds);
+    writer.Write(stamp.size);
+    writer.Write(static_cast< std::int64_t >(stamp.hash));
+}
+
+void dish::ParseTreeCache::readHeader(const std::string &path, dish::ParseTreeReader &reader) const
+{
+    if(MAGIC != reader.ReadString())
+    {
+        throw ParseTreeCacheException("Not a parse-tree cache file.");
+    }
+    
+    if((FORMAT_VERSION != reader.ReadInt32()) ||
+       (BYTE_ORDER_MARK != reader.ReadInt32()) ||
+       (static_cast< std::int32_t >(sizeof(IntegerT)) != reader.ReadInt32()) ||
+       (static_cast< std::int32_t >(sizeof(RealT)) != reader.ReadInt32()))
+    {
+        throw ParseTreeCacheException("The parse-tree cache file was written in another format.");
+    }
+    
+    if((MAJOR_VERSION != reader.ReadInt32()) ||
+       (MINOR_VERSION != reader.ReadInt32()) ||
+       (REVISION_VERSION != reader.ReadInt32()) ||
+       (LANG_MAJOR_VERSION != reader.ReadInt32()) ||
+       (LANG_MINOR_VERSION != reader.ReadInt32()) ||
+       (LANG_REVISION_VERSION != reader.ReadInt32()))
+    {
+        throw ParseTreeCacheException("The parse-tree cache file was written by another version of the interpreter.");
+    }
+    
+    if(mSuppressLocationInformation != reader.ReadBoolean())
+    {
+        throw ParseTreeCacheException("The parse-tree cache file was written with other options.");
+    }
+    
+    //  The cheaper checks are made first; the contents are only hashed if
+    //  the file still looks the same.
+    struct stat statinfo;
+    if((0 != stat(path.c_str(), &statinfo)) ||
+       (path != reader.ReadString()) ||
+       (static_cast< std::int64_t >(statinfo.st_dev) != reader.ReadInt64()) ||
+       (static_cast< std::int64_t >(statinfo.st_ino) != reader.ReadInt64()) ||
+       (static_cast< std::int64_t >(statinfo.st_mtim.tv_sec) != reader.ReadInt64()) ||
+       (static_cast< std::int64_t >(statinfo.st_mtim.tv_nsec) != reader.ReadInt64()) ||
+       (static_cast< std::int64_t >(statinfo.st_size) != reader.ReadInt64()))
+    {
+        throw ParseTreeCacheException("The parse-tree cache file is out of date.");
+    }
+    
+    SourceStamp stamp;
+    if((!stamp.Read(path)) || (static_cast< std::int64_t >(stamp.hash) != reader.ReadInt64()))
+    {
+        throw ParseTreeCacheException("The parse-tree cache file is out of date.");
+    }
+}
+
+bool dish::ParseTreeCache::Load(const std::string &path, dish::ParseTreeCache::StatementListT &statements, dish::ParseTreeCache::DeclarationListT &declarations) const
+{
+    const MappedFile cachefile(cacheFileName(path));
+    if(cachefile.Empty())
+    {
+        return false;
+    }
+    
+    try
+    {
+        ParseTreeReader reader(cachefile.Data(), cachefile.Size());
+        readHeader(path, reader);
+        
+        //  The header ends with a hash of the rest of the file, so that a file
+        //  damaged after it was written is not read as a different tree.
+        const std::int64_t payloadhash(reader.ReadInt64());
+        if(static_cast< std::int64_t >(fnv1a(cachefile.Data() + (cachefile.Size() - reader.Remaining()), reader.Remaining())) != payloadhash)
+        {
+            throw ParseTreeCacheException("The parse-tree cache file is damaged.");
+        }
+        
+        for(std::int32_t i(reader.ReadInt32()); i > 0; --i)
+        {
+            declarations.push_back(reader.ReadString());
+        }
+        
+        reader.ReadModule(statements);
+        
+        if(!reader.AtEnd())
+        {
+            throw ParseTreeCacheException("The parse-tree cache file is damaged.");
+        }
+    }
+    
+    catch(ParseTreeCacheException &e)
+    {
+        ++Rejected;
+        
+        statements.clear();
+        declarations.clear();
+        
+        dish::Log::Instance().Writeln(dish::Log::logInfo, std::string("Ignoring the parse-tree cache of ") + path + ": " + e.what());
+        return false;
+    }
+    
+    ++Loaded;
+    return true;
+}
+
+void dish::ParseTreeCache::Store(const std::string &path, const dish::ModuleParseTreeNode &module, const dish::ParseTreeCache::DeclarationListT &declarations) const
+{
+    std::string buffer;
+    
+    try
+    {
+        ParseTreeWriter writer(buffer);
+        writeHeader(path, writer);
+        
+        //  The hash of the payload is filled in once it is written.
+        writer.Write(static_cast< std::int64_t >(0));
+        const std::size_t payload(buffer.size());
+        
+        writer.Write(static_cast< std::int32_t >(declarations.size()));
+        for(DeclarationListT::const_iterator i(declarations.begin()), last_i(declarations.end()); i != last_i; ++i)
+        {
+            writer.Write(*i);
+        }
+        
+        writer.WriteModule(module);
+        
+        const std::int64_t payloadhash(static_cast< std::int64_t >(fnv1a(buffer.data() + payload, buffer.size() - payload)));
+        buffer.replace(payload - sizeof(payloadhash), sizeof(payloadhash), reinterpret_cast< const char * >(&payloadhash), sizeof(payloadhash));
+    }
+    
+    catch(ParseTreeCacheException &e)
+    {
+        dish::Log::Instance().Writeln(dish::Log::logInfo, std::string("Unable to cache the parse-tree of ") + path + ": " + e.what());
+        return;
+    }
+    
+    //  The file is written under a name of its own and then renamed, so that
+    //  another interpreter never maps a file only partly written.
+    const std::string fname(cacheFileName(path));
+    
+    std::stringstream tmpname;
+    tmpname << fname;
+    tmpname << ".";
+    tmpname << getpid();
+    
+    {
+        std::ofstream out(tmpname.str().c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        out.write(buffer.data(), buffer.size());
+        
+        if(!out)
+        {
+            out.close();
+            std::remove(tmpname.str().c_str());
+            
+            dish::Log::Instance().Writeln(dish::Log::logInfo, std::string("Unable to write the parse-tree cache file ") + fname + ".");
+            return;
+        }
+    }
+    
+    if(0 != std::rename(tmpname.str().c_str(), fname.c_str()))
+    {
+        std::remove(tmpname.str().c_str());
+        
+        dish::Log::Instance().Writeln(dish::Log::logInfo, std::string("Unable to write the parse-tree cache file ") + fname + ".");
+        return;
+    }
+    
+    ++Stored;
+}
+
@@ -0,0 +1,272 @@
+/*
+    This file is part of the DISH programming language, Copyright 2014-2017 by
+    Chris Buck.
+    
+    DISH is free software for non-commercial use; you can redistribute it and/or
+    modify it provided
+    
+        (1) The following Copyright notice is displayed at runtime and in any
+            accompanying documentation:
+            
+            DISH programming language copyright (c) 2014-2017 by Chris Buck.
+        
+        (2) All source files duplicate this copyright statement in full.
+    
+    Commercial licenses can be negotiated by contacting Chris Buck at
+    chrisbuck1220@hotmail.com.
+    
+    DISH is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.
+*/
+
+#ifndef DISH_PTCACHE_H
+#define DISH_PTCACHE_H
+
+#include "dishconfig.h"
+
+#include <cassert>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "atomics.h"
+#include "inline.h"
+#include "input.h"
+#include "types.h"
+
+namespace dish
+{
+    
+    class iParseTreeNode;
+    class ModuleParseTreeNode;
+
+    //  The kind of each record in a parse-tree cache file: a node of each
+    //  class, a node written before (so that nodes shared in the tree are
+    //  shared when it is read back), a file imported by the module, or a
+    //  child which is absent.
+    enum ParseTreeTagT
+    {
+        ptnBackReference = 0,
+        ptnImport,
+        ptnNone,
+        
+        ptnNull,
+        
+        ptnLiteral,
+        ptnLiteralArray,
+        
+        ptnIdentifier,
+        
+        ptnLock,
+        
+        ptnBooleanType,
+        ptnIntegerType,
+        ptnRangedIntegerType,
+        ptnRealType,
+        ptnRangedRealType,
+        ptnStringType,
+        ptnArrayType,
+        ptnDictionaryType,
+        ptnStructureType,
+        
+        ptnDeclare,
+        ptnDeclareType,
+        ptnDeclareFunction,
+        ptnLambdaFunction,
+        ptnDeclareReference,
+        
+        ptnAssignment,
+        
+        ptnIndex,
+        ptnMember,
+        
+        ptnFunctionCall,
+        
+        ptnReturn,
+        
+        ptnNegateOp,
+        ptnAddOpChain,
+        ptnSubOp,
+        ptnMulOpChain,
+        ptnDivOp,
+        ptnModOp,
+        ptnPowOp,
+        
+        ptnNotOp,
+        ptnAndOpChain,
+        ptnOrOpChain,
+        ptnXorOpChain,
+        
+        ptnLessThanOp,
+        ptnLessThanEqualOp,
+        ptnEqualOp,
+        ptnNotEqualOp,
+        ptnGreaterThanEqualOp,
+        ptnGreaterThanOp,
+        
+        ptnStatementBlock,
+        
+        ptnIfStatement,
+        ptnSwitchStatement,
+        
+        ptnForLoop,
+        ptnForEachLoop,
+        ptnWhileLoop,
+        ptnRepeatUntilLoop,
+        
+        ptnAssert,
+        
+        ptnEnd
+    };
+    
+    //  Serializes a parse-tree into a buffer; each node writes its own tag,
+    //  location and children through the Write() overloads. Strings and nodes
+    //  written more than once are written as an index into those written
+    //  before.
+    class ParseTreeWriter
+    {
+        private:
+            std::string &mBuffer;
+            
+            std::map< std::string, std::int32_t > mStrings;
+            std::map< const iParseTreeNode *, std::int32_t > mNodes;
+            
+            INLINE void write(const void *data, const std::size_t &nbytes) { mBuffer.append(static_cast< const char * >(data), nbytes); };
+        
+        public:
+            INLINE explicit ParseTreeWriter(std::string &buffer) : mBuffer(buffer), mStrings(), mNodes() {};
+            
+            INLINE void Write(const ParseTreeTagT &tag) { const std::int32_t value(tag); write(&value, sizeof(value)); };
+            INLINE void Write(const bool &value) { const char byte(value ? 1 : 0); write(&byte, sizeof(byte)); };
+            INLINE void Write(const std::int32_t &value) { write(&value, sizeof(value)); };
+            INLINE void Write(const std::int64_t &value) { write(&value, sizeof(value)); };
+            INLINE void Write(const RealT &value) { write(&value, sizeof(value)); };
+            void Write(const std::string &str);
+            void Write(const iExecutableAtomic::ParamListT &params);
+            void Write(const std::shared_ptr< iParseTreeNode > &node);
+            
+            //  A location is written as its source, line and column, since the
+            //  index of a location is that of this run of the interpreter.
+            void WriteLocation(const SourceLocationT &location);
+            
+            //  Starts the record of node.
+            void Begin(const ParseTreeTagT &tag, const iParseTreeNode &node);
+            
+            //  Writes the statements of module, the root of the tree; a module
+            //  among them, a file it imports, is written by name only.
+            void WriteModule(const ModuleParseTreeNode &module);
+        
+    };
+    
+    //  Deserializes a parse-tree written by ParseTreeWriter, building each node
+    //  through the same factories the parser uses. Every read is checked
+    //  against the end of the buffer, and a damaged file raises a
+    //  ParseTreeCacheException.
+    class ParseTreeReader
+    {
+        public:
+        
+            //  A statement of the module read: a node, or a file imported at
+            //  the given location if Node is empty.
+            using StatementT = struct Statement
+            {
+                std::shared_ptr< iParseTreeNode > Node;
+                SourceLocationT Location;
+                std::string Import;
+            };
+            
+            using StatementListT = std::vector< StatementT >;
+        
+        private:
+            const char *mNext;
+            const char * const mEnd;
+            
+            std::vector< std::string > mStrings;
+            std::vector< std::shared_ptr< iParseTreeNode > > mNodes;
+            
+            void read(void *data, const std::size_t &nbytes);
+            
+            std::shared_ptr< iParseTreeNode > readLiteral(const SourceLocationT &location);
+            std::shared_ptr< iParseTreeNode > readNode(const ParseTreeTagT &tag);
+            std::shared_ptr< iParseTreeNode > makeNode(const ParseTreeTagT &tag, const SourceLocationT &location);
+        
+        public:
+            INLINE ParseTreeReader(const char *data, const std::size_t &nbytes) : mNext(data), mEnd(data + nbytes), mStrings(), mNodes() {};
+            
+            ParseTreeTagT ReadTag();
+            bool ReadBoolean();
+            std::int32_t ReadInt32();
+            std::int64_t ReadInt64();
+            RealT ReadReal();
+            std::string ReadString();
+            SourceLocationT ReadLocation();
+            iExecutableAtomic::ParamListT ReadParameters();
+            std::shared_ptr< iParseTreeNode > ReadNode();
+            
+            //  Reads the statements written by ParseTreeWriter::WriteModule().
+            void ReadModule(StatementListT &statements);
+            
+            INLINE bool AtEnd() const throw() { return (mNext == mEnd); };
+            INLINE std::size_t Remaining() const throw() { return static_cast< std::size_t >(mEnd - mNext); };
+        
+    };
+    
+    //  The parse-trees of imported files, kept on disk so that a file which has
+    //  not changed is loaded rather than parsed again. Each cache file records
+    //  the path, inode, size, modification time (to the nanosecond) and a hash
+    //  of the contents of its source, the version of the interpreter which
+    //  wrote it and whether locations were suppressed; any
+    //  difference makes the file stale, and the source is parsed instead. A
+    //  hash of the tree written after the header guards against a damaged
+    //  file, which is likewise ignored. The
+    //  cache file is written next to the source, or into a directory of its
+    //  own, and is memory-mapped when read.
+    class ParseTreeCache
+    {
+        public:
+            using StatementT = ParseTreeReader::StatementT;
+            using StatementListT = ParseTreeReader::StatementListT;
+            
+            //  The names declared by the module, once for each declaration, so
+            //  that the parser's count of declarations is unaffected by whether
+            //  the module was parsed or loaded.
+            using DeclarationListT = std::vector< std::string >;
+        
+        private:
+            const std::string mDirectory;
+            const bool mSuppressLocationInformation;
+            
+            static IntegerT Loaded;
+            static IntegerT Stored;
+            static IntegerT Rejected;
+            
+            std::string cacheFileName(const std::string &path) const;
+            void writeHeader(const std::string &path, ParseTreeWriter &writer) const;
+            void readHeader(const std::string &path, ParseTreeReader &reader) const;
+        
+        public:
+            //  Cache files are written next to their sources if dir is empty.
+            INLINE ParseTreeCache(const std::string &dir, const bool &suppressloc) : mDirectory(dir), mSuppressLocationInformation(suppressloc) {};
+            
+            //  Loads the statements and declarations of the file at path, the
+            //  name it was imported by resolved; false if there is no usable
+            //  cache file for it.
+            bool Load(const std::string &path, StatementListT &statements, DeclarationListT &declarations) const;
+            
+            //  Writes the cache file for the module parsed from path; a module
+            //  which cannot be cached is skipped.
+            void Store(const std::string &path, const ModuleParseTreeNode &module, const DeclarationListT &declarations) const;
+            
+            static INLINE const IntegerT &NumLoaded() throw() { return Loaded; };
+            static INLINE const IntegerT &NumStored() throw() { return Stored; };
+            static INLINE const IntegerT &NumRejected() throw() { return Rejected; };
+        
+    };
+    
+}
+
+#endif
+
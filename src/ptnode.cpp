@@ -21,6 +21,7 @@
 */
 
 #include <algorithm>
+#include <functional>
 #include <sstream>
 
 #include "exception.h"
@@ -28,12 +29,88 @@
 #include "ptnode.h"
 #include "utility.h"
 
+/******************************************************************************
+
+    dish::ParseTreeArena class definitions
+
+ ******************************************************************************/
+
+char *dish::ParseTreeArena::Next(0);
+char *dish::ParseTreeArena::End(0);
+dish::ParseTreeArena::FreeNodeT *dish::ParseTreeArena::FreeLists[MAX_NODE_SIZE / ALIGNMENT];
+
+dish::IntegerT dish::ParseTreeArena::BytesReserved(0);
+dish::IntegerT dish::ParseTreeArena::BytesInUse(0);
+
+void *dish::ParseTreeArena::allocateFromBlock(const std::size_t &nbytes)
+{
+    if(static_cast< std::size_t >(End - Next) < nbytes)
+    {
+        //  The remainder of the block is abandoned; it is smaller than the
+        //  node.
+        Next = static_cast< char * >(::operator new(BLOCK_SIZE));
+        End = Next + BLOCK_SIZE;
+        
+        BytesReserved += BLOCK_SIZE;
+    }
+    
+    void * const node(Next);
+    Next += nbytes;
+    
+    return node;
+}
+
+void *dish::ParseTreeArena::Allocate(const std::size_t &nbytes)
+{
+    const std::size_t sclass(sizeClass(nbytes));
+    
+    if(sclass > (MAX_NODE_SIZE / ALIGNMENT))
+    {
+        return ::operator new(nbytes);
+    }
+    
+    BytesInUse += sclass * ALIGNMENT;
+    
+    FreeNodeT *&list(FreeLists[sclass - 1]);
+    
+    if(0 != list)
+    {
+        FreeNodeT * const node(list);
+        list = node->Next;
+        
+        return node;
+    }
+    
+    return allocateFromBlock(sclass * ALIGNMENT);
+}
+
+void dish::ParseTreeArena::Release(void *node, const std::size_t &nbytes)
+{
+    const std::size_t sclass(sizeClass(nbytes));
+    
+    if(sclass > (MAX_NODE_SIZE / ALIGNMENT))
+    {
+        ::operator delete(node);
+    }
+    else if(0 != node)
+    {
+        BytesInUse -= sclass * ALIGNMENT;
+        
+        FreeNodeT * const freed(static_cast< FreeNodeT * >(node));
+        freed->Next = FreeLists[sclass - 1];
+        FreeLists[sclass - 1] = freed;
+    }
+}
+
 /******************************************************************************
 
     dish::ParseTreeNode class definitions
 
  ******************************************************************************/
  
+dish::IntegerT dish::ParseTreeNode::UnboxedOperations(0);
+dish::IntegerT dish::ParseTreeNode::GenericFallbacks(0);
+
 bool dish::ParseTreeNode::isEqual(const dish::NullParseTreeNode &ptn) const
 {
     return false;
@@ -279,9 +356,19 @@ bool dish::ParseTreeNode::isEqual(const dish::AssertParseTreeNode &ptn) const
     return false;
 }
  
-const std::string &dish::ParseTreeNode::LocationString() const
+bool dish::ParseTreeNode::isEqual(const dish::ModuleParseTreeNode &ptn) const
+{
+    return false;
+}
+
+const dish::SourceLocationT &dish::ParseTreeNode::Location() const
+{
+    return mLocation;
+}
+
+std::string dish::ParseTreeNode::LocationString() const
 {
-    return mLocationString;
+    return SourceLocationTable::Format(mLocation);
 }
  
 bool dish::ParseTreeNode::IsLiteral() const
@@ -300,16 +387,68 @@ std::shared_ptr< dish::iAtomic > dish::ParseTreeNode::Execute()
     throw NonLiteralExpressionException(LocationString(), message.str());
 }
 
+void dish::ParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &opr)
+{
+    opr.Set(static_cast< iParseTreeNode & >(*this).Execute(symtab));
+}
+
+std::shared_ptr< dish::iAtomic > dish::ParseTreeNode::Inspect(dish::LanguageSymbolTable &symtab)
+{
+    return static_cast< iParseTreeNode & >(*this).Execute(symtab);
+}
+
 void dish::ParseTreeNode::Validate(LanguageSymbolTable &symtab) const
 {
     //  Empty
 }
 
+std::size_t dish::ParseTreeNode::hashValue(const dish::iAtomic &value)
+{
+    const iAtomic::TypeT type(value.Type());
+    
+    switch(type)
+    {
+        case iAtomic::typeBoolean:
+        {
+            return combineHash(type, value.AsBoolean() ? 1 : 0);
+        }
+        
+        case iAtomic::typeInteger:
+        {
+            return combineHash(type, std::hash< IntegerT >()(value.AsInteger()));
+        }
+        
+        case iAtomic::typeReal:
+        {
+            return combineHash(type, std::hash< RealT >()(value.AsReal()));
+        }
+        
+        case iAtomic::typeString:
+        {
+            return combineHash(type, std::hash< StringT >()(value.AsString()));
+        }
+        
+        default:
+        {
+            //  Values which are never equal hash by their type alone.
+        }
+        
+    }
+    
+    return type;
+}
+
 bool dish::ParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
 {
     return false;
 }
 
+std::size_t dish::ParseTreeNode::Hash() const
+{
+    //  A node equal to no other node hashes by its address.
+    return std::hash< const void * >()(this);
+}
+
 const std::string &dish::ParseTreeNode::ToString() const
 {
     static const std::string StringRep("(empty)");
@@ -317,6 +456,31 @@ const std::string &dish::ParseTreeNode::ToString() const
     return StringRep;
 }
 
+void dish::ParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    //  Empty
+}
+
+void dish::ParseTreeNode::AssignableChildren(dish::iParseTreeNode::ChildListT &children)
+{
+    Children(children);
+}
+
+void dish::ParseTreeNode::ChildrenReplaced()
+{
+    //  Empty
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::ParseTreeNode::Copy() const
+{
+    return std::shared_ptr< iParseTreeNode >();
+}
+
+void dish::ParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    throw ParseTreeCacheException(LocationString(), "Nodes of this kind cannot be written to a parse-tree cache.");
+}
+
 void dish::ParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -339,7 +503,7 @@ bool dish::NullParseTreeNode::isEqual(const dish::NullParseTreeNode &ptn) const
 
 std::shared_ptr< dish::NullParseTreeNode > dish::NullParseTreeNode::MakeValue()
 {
-    static std::shared_ptr< NullParseTreeNode > node(new NullParseTreeNode());
+    static std::shared_ptr< NullParseTreeNode > node(MakeShared< NullParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) NullParseTreeNode(); }));
     
     return node;
 }
@@ -354,6 +518,16 @@ bool dish::NullParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::NullParseTreeNode::Hash() const
+{
+    return ptnNull;
+}
+
+void dish::NullParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnNull, *this);
+}
+
 void dish::NullParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -389,7 +563,9 @@ bool dish::ReferenceParseTreeNode::isEqual(const dish::ReferenceParseTreeNode &p
             
             case iAtomic::typeReal:
             {
-                return dish::IsEqual(mReference->AsReal(), ptn.mReference->AsReal());
+                //  Only exactly equal reals are shared, so that they can be
+                //  hashed by value.
+                return (mReference->AsReal() == ptn.mReference->AsReal());
             }
             
             case iAtomic::typeString:
@@ -427,6 +603,11 @@ bool dish::ReferenceParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) cons
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::ReferenceParseTreeNode::Hash() const
+{
+    return combineHash(ptnDeclareReference, hashValue(*mReference));
+}
+
 void dish::ReferenceParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {    
     printIndent(out, indent);
@@ -469,7 +650,9 @@ bool dish::LiteralParseTreeNode::isEqual(const dish::LiteralParseTreeNode &ptn)
             
             case iAtomic::typeReal:
             {
-                return dish::IsEqual(mLiteral->AsReal(), ptn.mLiteral->AsReal());
+                //  Only exactly equal reals are shared, so that they can be
+                //  hashed by value.
+                return (mLiteral->AsReal() == ptn.mLiteral->AsReal());
             }
             
             case iAtomic::typeString:
@@ -493,13 +676,13 @@ std::shared_ptr< dish::LiteralParseTreeNode > dish::LiteralParseTreeNode::MakeVa
 {
     if(value)
     {
-        static std::shared_ptr< LiteralParseTreeNode > true_literal(new LiteralParseTreeNode(true));
+        static std::shared_ptr< LiteralParseTreeNode > true_literal(MakeShared< LiteralParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LiteralParseTreeNode(true); }));
         
         return true_literal;
     }
     else
     {
-        static std::shared_ptr< LiteralParseTreeNode > false_literal(new LiteralParseTreeNode(false));
+        static std::shared_ptr< LiteralParseTreeNode > false_literal(MakeShared< LiteralParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LiteralParseTreeNode(false); }));
         
         return false_literal;
     }
@@ -515,7 +698,7 @@ std::shared_ptr< dish::LiteralParseTreeNode > dish::LiteralParseTreeNode::MakeVa
         return cached->second;
     }
     
-    std::shared_ptr< LiteralParseTreeNode > node(new LiteralParseTreeNode(value));
+    std::shared_ptr< LiteralParseTreeNode > node(MakeShared< LiteralParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LiteralParseTreeNode(value); }));
     CachedIntegerLiteralNodes[value] = node;
     
     return node;
@@ -529,7 +712,7 @@ std::shared_ptr< dish::LiteralParseTreeNode > dish::LiteralParseTreeNode::MakeVa
         return cached->second;
     }
     
-    std::shared_ptr< LiteralParseTreeNode > node(new LiteralParseTreeNode(value));
+    std::shared_ptr< LiteralParseTreeNode > node(MakeShared< LiteralParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LiteralParseTreeNode(value); }));
     CachedRealLiteralNodes[value] = node;
     
     return node;
@@ -543,7 +726,7 @@ std::shared_ptr< dish::LiteralParseTreeNode > dish::LiteralParseTreeNode::MakeVa
         return cached->second;
     }
     
-    std::shared_ptr< LiteralParseTreeNode > node(new LiteralParseTreeNode(value));
+    std::shared_ptr< LiteralParseTreeNode > node(MakeShared< LiteralParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LiteralParseTreeNode(value); }));
     CachedStringLiteralNodes[value] = node;
     
     return node;
@@ -580,11 +763,82 @@ std::shared_ptr< dish::iAtomic > dish::LiteralParseTreeNode::Execute(dish::Langu
     return mLiteral->Clone();
 }
 
+void dish::LiteralParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &opr)
+{
+    //  Locked literals clone to locked values, which must stay boxed.
+    if(!mLiteral->IsLocked())
+    {
+        switch(mLiteral->Type())
+        {
+            case iAtomic::typeInteger:
+            {
+                opr.SetInteger(mLiteral->AsInteger());
+            } return;
+            
+            case iAtomic::typeReal:
+            {
+                opr.SetReal(mLiteral->AsReal());
+            } return;
+            
+            default:
+            {
+            } break;
+        }
+    }
+    
+    opr.Set(mLiteral->Clone());
+}
+
 bool dish::LiteralParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
 {
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::LiteralParseTreeNode::Hash() const
+{
+    return combineHash(ptnLiteral, hashValue(*mLiteral));
+}
+
+void dish::LiteralParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnLiteral, *this);
+    
+    //  The parser only makes literals of the basic types, and the folding of
+    //  constant operands keeps to them.
+    const iAtomic::TypeT type(mLiteral->Type());
+    writer.Write(static_cast< std::int32_t >(type));
+    writer.Write(mLiteral->IsLocked());
+    
+    switch(type)
+    {
+        case iAtomic::typeBoolean:
+        {
+            writer.Write(mLiteral->AsBoolean());
+        } break;
+        
+        case iAtomic::typeInteger:
+        {
+            writer.Write(mLiteral->AsInteger());
+        } break;
+        
+        case iAtomic::typeReal:
+        {
+            writer.Write(mLiteral->AsReal());
+        } break;
+        
+        case iAtomic::typeString:
+        {
+            writer.Write(mLiteral->AsString());
+        } break;
+        
+        default:
+        {
+            throw ParseTreeCacheException(LocationString(), "Literals of this type cannot be written to a parse-tree cache.");
+        }
+        
+    }
+}
+
 void dish::LiteralParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -616,13 +870,32 @@ std::shared_ptr< dish::iAtomic > dish::LiteralArrayParseTreeNode::Execute(dish::
         mElements.begin(), mElements.end(),
         [&](ElementT::value_type &elem)
         {
-            array->Add(elem->Execute(symtab), array->mValue.size());
+            array->Add(elem->Execute(symtab), array->elements().size());
         }
     );
     
     return array;
 }
 
+void dish::LiteralArrayParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    for(ElementT::iterator i(mElements.begin()), last_i(mElements.end()); i != last_i; ++i)
+    {
+        children.push_back(&(*i));
+    }
+}
+
+void dish::LiteralArrayParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnLiteralArray, *this);
+    
+    writer.Write(static_cast< std::int32_t >(mElements.size()));
+    for(ElementT::const_iterator i(mElements.begin()), last_i(mElements.end()); i != last_i; ++i)
+    {
+        writer.Write(*i);
+    }
+}
+
 void dish::LiteralArrayParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -658,6 +931,9 @@ void dish::LiteralArrayParseTreeNode::Print(std::ostream &out, const std::string
  
 dish::IntegerT dish::IdentifierParseTreeNode::Count(0);
 dish::IntegerT dish::IdentifierParseTreeNode::Instances(0);
+dish::IntegerT dish::IdentifierParseTreeNode::Resolved(0);
+
+const int dish::IdentifierParseTreeNode::UNRESOLVED(-1);
 
 std::map< std::string, std::shared_ptr< dish::IdentifierParseTreeNode > > dish::IdentifierParseTreeNode::CachedNodes;
 
@@ -669,7 +945,7 @@ bool dish::IdentifierParseTreeNode::isEqual(const dish::IdentifierParseTreeNode
     {
         if(!ptn.mBaseId)
         {
-            return (mId == ptn.mId);
+            return ((mId == ptn.mId) && (mDepth == ptn.mDepth) && (mSlot == ptn.mSlot) && (mNearer == ptn.mNearer));
         }
         
         return (mId == (prefix + ptn.mId));
@@ -686,7 +962,7 @@ std::shared_ptr< dish::IdentifierParseTreeNode > dish::IdentifierParseTreeNode::
         return cached->second;
     }
     
-    std::shared_ptr< dish::IdentifierParseTreeNode > node(new IdentifierParseTreeNode(id));
+    std::shared_ptr< dish::IdentifierParseTreeNode > node(MakeShared< IdentifierParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) IdentifierParseTreeNode(id); }));
     CachedNodes[id] = node;
     
     return node;
@@ -705,7 +981,12 @@ std::shared_ptr< dish::iAtomic > dish::IdentifierParseTreeNode::Execute(dish::La
 {
     try
     {
-        return (mBaseId ? symtab.LookupInBase(mId) : symtab.Lookup(mId));
+        if(IsResolved())
+        {
+            return symtab.Lookup(mDepth, mSlot, mNearer, mId);
+        }
+    
+        return (mBaseId ? symtab.LookupInBase(mKey, mId) : symtab.LookupInterned(mKey, mId));
     }
     
     catch(DishException &e)
@@ -744,17 +1025,38 @@ bool dish::IdentifierParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) con
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::IdentifierParseTreeNode::Hash() const
+{
+    //  Base identifiers are equal to any identifier of the same name, so only
+    //  the name is hashed.
+    return combineHash(ptnIdentifier, std::hash< std::string >()(mId));
+}
+
 const std::string &dish::IdentifierParseTreeNode::ToString() const
 {
     return mId;
 }
 
+void dish::IdentifierParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnIdentifier, *this);
+    writer.Write(mBaseId);
+    writer.Write(mId);
+    writer.Write(static_cast< std::int32_t >(mDepth));
+    writer.Write(static_cast< std::int32_t >(mSlot));
+    writer.Write(static_cast< std::int32_t >(mNearer));
+}
+
 void dish::IdentifierParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
     
     out << "PTN: ID(";
     out << mId;
+    if(IsResolved())
+    {
+        out << "[" << mDepth << ", " << mSlot << ", " << mNearer << "]";
+    }
     out << ")";
 }
 
@@ -784,6 +1086,17 @@ bool dish::LockParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::LockParseTreeNode::Hash() const
+{
+    return combineHash(ptnLock, std::hash< std::string >()(mId));
+}
+
+void dish::LockParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnLock, *this);
+    writer.Write(mId);
+}
+
 void dish::LockParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -816,6 +1129,16 @@ bool dish::BooleanTypeParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) co
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::BooleanTypeParseTreeNode::Hash() const
+{
+    return ptnBooleanType;
+}
+
+void dish::BooleanTypeParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnBooleanType, *this);
+}
+
 void dish::BooleanTypeParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -846,6 +1169,16 @@ bool dish::IntegerTypeParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) co
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::IntegerTypeParseTreeNode::Hash() const
+{
+    return ptnIntegerType;
+}
+
+void dish::IntegerTypeParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnIntegerType, *this);
+}
+
 void dish::IntegerTypeParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -905,6 +1238,26 @@ bool dish::RangedIntegerTypeParseTreeNode::IsEqual(const dish::iParseTreeNode &p
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::RangedIntegerTypeParseTreeNode::Hash() const
+{
+    return ptnRangedIntegerType;
+}
+
+void dish::RangedIntegerTypeParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    children.push_back(&mMinimum);
+    children.push_back(&mMaximum);
+    children.push_back(&mBoundary);
+}
+
+void dish::RangedIntegerTypeParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnRangedIntegerType, *this);
+    writer.Write(mMinimum);
+    writer.Write(mMaximum);
+    writer.Write(mBoundary);
+}
+
 void dish::RangedIntegerTypeParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -941,6 +1294,16 @@ bool dish::RealTypeParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::RealTypeParseTreeNode::Hash() const
+{
+    return ptnRealType;
+}
+
+void dish::RealTypeParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnRealType, *this);
+}
+
 void dish::RealTypeParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -1000,6 +1363,26 @@ bool dish::RangedRealTypeParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn)
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::RangedRealTypeParseTreeNode::Hash() const
+{
+    return ptnRangedRealType;
+}
+
+void dish::RangedRealTypeParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    children.push_back(&mMinimum);
+    children.push_back(&mMaximum);
+    children.push_back(&mBoundary);
+}
+
+void dish::RangedRealTypeParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnRangedRealType, *this);
+    writer.Write(mMinimum);
+    writer.Write(mMaximum);
+    writer.Write(mBoundary);
+}
+
 void dish::RangedRealTypeParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -1036,6 +1419,16 @@ bool dish::StringTypeParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) con
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::StringTypeParseTreeNode::Hash() const
+{
+    return ptnStringType;
+}
+
+void dish::StringTypeParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnStringType, *this);
+}
+
 void dish::StringTypeParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -1081,6 +1474,26 @@ bool dish::ArrayTypeParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) cons
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::ArrayTypeParseTreeNode::Hash() const
+{
+    return combineHash(combineHash(combineHash(ptnArrayType, mFromIndex->Hash()), mToIndex->Hash()), mType->Hash());
+}
+
+void dish::ArrayTypeParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    children.push_back(&mFromIndex);
+    children.push_back(&mToIndex);
+    children.push_back(&mType);
+}
+
+void dish::ArrayTypeParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnArrayType, *this);
+    writer.Write(mFromIndex);
+    writer.Write(mToIndex);
+    writer.Write(mType);
+}
+
 void dish::ArrayTypeParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -1117,6 +1530,16 @@ bool dish::DictionaryTypeParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn)
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::DictionaryTypeParseTreeNode::Hash() const
+{
+    return ptnDictionaryType;
+}
+
+void dish::DictionaryTypeParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnDictionaryType, *this);
+}
+
 void dish::DictionaryTypeParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -1162,6 +1585,26 @@ std::shared_ptr< dish::iAtomic > dish::StructureTypeParseTreeNode::Execute(dish:
     return mStructureNode;
 }
 
+void dish::StructureTypeParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    for(MemberListT::iterator i(mMemberList.begin()), last_i(mMemberList.end()); i != last_i; ++i)
+    {
+        children.push_back(&(i->second));
+    }
+}
+
+void dish::StructureTypeParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnStructureType, *this);
+    
+    writer.Write(static_cast< std::int32_t >(mMemberList.size()));
+    for(MemberListT::const_iterator i(mMemberList.begin()), last_i(mMemberList.end()); i != last_i; ++i)
+    {
+        writer.Write(i->first);
+        writer.Write(i->second);
+    }
+}
+
 void dish::StructureTypeParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -1220,6 +1663,23 @@ bool dish::DeclareParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::DeclareParseTreeNode::Hash() const
+{
+    return combineHash(combineHash(ptnDeclare, mType->Hash()), std::hash< std::string >()(mId));
+}
+
+void dish::DeclareParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    children.push_back(&mType);
+}
+
+void dish::DeclareParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnDeclare, *this);
+    writer.Write(mType);
+    writer.Write(mId);
+}
+
 void dish::DeclareParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -1268,10 +1728,27 @@ bool dish::DeclareTypeParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) co
     return ptn.isEqual(*this);
 }
 
-void dish::DeclareTypeParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
+std::size_t dish::DeclareTypeParseTreeNode::Hash() const
 {
-    printIndent(out, indent);
-    out << "PTN: declare type ";
+    return combineHash(combineHash(ptnDeclareType, mType->Hash()), std::hash< std::string >()(mId));
+}
+
+void dish::DeclareTypeParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    children.push_back(&mType);
+}
+
+void dish::DeclareTypeParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnDeclareType, *this);
+    writer.Write(mType);
+    writer.Write(mId);
+}
+
+void dish::DeclareTypeParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
+{
+    printIndent(out, indent);
+    out << "PTN: declare type ";
     mType->Print(out, 0);
     out << " as ";
     out << mId;
@@ -1283,9 +1760,50 @@ void dish::DeclareTypeParseTreeNode::Print(std::ostream &out, const std::string:
 
  ******************************************************************************/
 
+std::shared_ptr< dish::iAtomic > dish::FunctionParseTreeNode::FunctionValue::executeBody(dish::LanguageSymbolTable &symtab) const
+{
+    std::shared_ptr< iAtomic > value(mBody->Execute(symtab));
+    
+    //  Take the value of a return statement executed by the body.
+    if(symtab.IsReturning())
+    {
+        return symtab.TakeReturnValue();
+    }
+    
+    return value;
+}
+
 std::shared_ptr< dish::iAtomic > dish::FunctionParseTreeNode::FunctionValue::Execute(dish::LanguageSymbolTable &symtab) const
 {
-    return mBody->Execute(symtab);
+    ScopedFunction scopedfunction(symtab, this);
+    
+    std::shared_ptr< iAtomic > value(executeBody(symtab));
+    
+    //  Make the calls left by the body in tail position. Each callee runs with
+    //  its actual parameters in a frame of its own in place of the previous
+    //  one, so neither the native nor the symbol-table stack grows.
+    std::shared_ptr< iAtomic > function;
+    std::unique_ptr< ScopedScope > frame;
+    
+    while(symtab.IsTailCalling())
+    {
+        std::shared_ptr< iSymbolTable > table;
+        function = symtab.TakeTailCall(table);
+        
+        frame.reset();
+        if(table)
+        {
+            frame.reset(new ScopedScope(symtab, std::move(table)));
+        }
+        
+        symtab.SetFunction(function.get());
+        
+        ++TailCalls;
+        
+        value = static_cast< const FunctionValue & >(*function).executeBody(symtab);
+    }
+    
+    return value;
 }
 
 void dish::FunctionParseTreeNode::FunctionValue::Validate(LanguageSymbolTable &symtab) const
@@ -1293,6 +1811,19 @@ void dish::FunctionParseTreeNode::FunctionValue::Validate(LanguageSymbolTable &s
     mBody->Validate(symtab);
 }
 
+/******************************************************************************
+
+    dish::FunctionParseTreeNode class definitions
+
+ ******************************************************************************/
+
+dish::IntegerT dish::FunctionParseTreeNode::TailCalls(0);
+
+void dish::FunctionParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    children.push_back(&mBody);
+}
+
 /******************************************************************************
 
     dish::DeclareFunctionParseTreeNode class definitions
@@ -1328,13 +1859,21 @@ void dish::DeclareFunctionParseTreeNode::Validate(LanguageSymbolTable &symtab) c
     }
     
     //  Add the Function ID.
-    std::shared_ptr< iParseTreeNode > null(NullParseTreeNode::MakeValue(LocationString()));
+    std::shared_ptr< iParseTreeNode > null(NullParseTreeNode::MakeValue(Location()));
     symtab.Insert(
         mId, 
         FunctionValue::MakeValue(formalParameters(), null)
     );
 }
 
+void dish::DeclareFunctionParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnDeclareFunction, *this);
+    writer.Write(mId);
+    writer.Write(FormalParameters());
+    writer.Write(Body());
+}
+
 void dish::DeclareFunctionParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -1410,6 +1949,13 @@ void dish::LambdaFunctionParseTreeNode::Validate(dish::LanguageSymbolTable &symt
     body()->Validate(symtab);
 }
 
+void dish::LambdaFunctionParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnLambdaFunction, *this);
+    writer.Write(FormalParameters());
+    writer.Write(Body());
+}
+
 void dish::LambdaFunctionParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -1477,6 +2023,23 @@ void dish::DeclareReferenceParseTreeNode::Validate(LanguageSymbolTable &symtab)
     symtab.Insert(mId, NullValue::MakeValue());
 }
 
+void dish::DeclareReferenceParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    mExpression->AssignableChildren(children);
+}
+
+void dish::DeclareReferenceParseTreeNode::ChildrenReplaced()
+{
+    mExpression->ChildrenReplaced();
+}
+
+void dish::DeclareReferenceParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnDeclareReference, *this);
+    writer.Write(mId);
+    writer.Write(mExpression);
+}
+
 void dish::DeclareReferenceParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -1510,7 +2073,9 @@ std::shared_ptr< dish::iAtomic > dish::AssignmentParseTreeNode::Execute(dish::La
     {
         std::shared_ptr< dish::iAtomic > lhs(mLeftHandSide->Execute(symtab));
         
-        lhs->Assign(mRightHandSide->Execute(symtab));
+        ValueHandle rhs;
+        mRightHandSide->ExecuteOperand(symtab, rhs);
+        rhs.AssignTo(*lhs);
         
         return lhs;
     }
@@ -1537,6 +2102,29 @@ bool dish::AssignmentParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) con
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::AssignmentParseTreeNode::Hash() const
+{
+    return combineHash(combineHash(ptnAssignment, mLeftHandSide->Hash()), mRightHandSide->Hash());
+}
+
+void dish::AssignmentParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    mLeftHandSide->AssignableChildren(children);
+    children.push_back(&mRightHandSide);
+}
+
+void dish::AssignmentParseTreeNode::ChildrenReplaced()
+{
+    mLeftHandSide->ChildrenReplaced();
+}
+
+void dish::AssignmentParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnAssignment, *this);
+    writer.Write(mLeftHandSide);
+    writer.Write(mRightHandSide);
+}
+
 void dish::AssignmentParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -1572,8 +2160,14 @@ std::shared_ptr< dish::iAtomic > dish::IndexParseTreeNode::Execute(dish::Languag
         std::shared_ptr< dish::iAtomic > base(mBase->Execute(symtab));
         std::shared_ptr< dish::iAtomic > index(mIndex->Execute(symtab));
         
-        if((iAtomic::typeInteger == index->Type()) && (iAtomic::typeDictionary != base->Type()))
+        if(iAtomic::typeInteger == index->Type())
         {
+            //  An integer key is looked up without formatting it as a string.
+            if(iAtomic::typeDictionary == base->Type())
+            {
+                return base->Lookup(index->AsInteger());
+            }
+            
             return base->Element(index->AsInteger());
         }
         
@@ -1591,6 +2185,75 @@ std::shared_ptr< dish::iAtomic > dish::IndexParseTreeNode::Execute(dish::Languag
     }
 }
 
+void dish::IndexParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &opr)
+{
+    try
+    {
+        std::shared_ptr< dish::iAtomic > base(mBase->Execute(symtab));
+        std::shared_ptr< dish::iAtomic > index(mIndex->Execute(symtab));
+        
+        //  An element of an array of primitives is read without boxing it.
+        if(iAtomic::typeInteger == index->Type())
+        {
+            if(iAtomic::typeDictionary == base->Type())
+            {
+                opr.Set(base->InspectLookup(index->AsInteger()));
+            }
+            else
+            {
+                base->InspectElement(index->AsInteger(), opr);
+            }
+        }
+        else
+        {
+            opr.Set(base->InspectLookup(index->AsString()));
+        }
+    }
+    
+    catch(DishException &e)
+    {
+        if(!e.IsLocationSupplied())
+        {
+            e.AddLocation(LocationString());
+        }
+        
+        throw;
+    }
+}
+
+std::shared_ptr< dish::iAtomic > dish::IndexParseTreeNode::Inspect(dish::LanguageSymbolTable &symtab)
+{
+    try
+    {
+        //  The base is executed rather than inspected, since looking up a
+        //  missing key inserts it into a dictionary.
+        std::shared_ptr< dish::iAtomic > base(mBase->Execute(symtab));
+        std::shared_ptr< dish::iAtomic > index(mIndex->Execute(symtab));
+        
+        if(iAtomic::typeInteger == index->Type())
+        {
+            if(iAtomic::typeDictionary == base->Type())
+            {
+                return base->InspectLookup(index->AsInteger());
+            }
+            
+            return base->InspectElement(index->AsInteger());
+        }
+        
+        return base->InspectLookup(index->AsString());
+    }
+    
+    catch(DishException &e)
+    {
+        if(!e.IsLocationSupplied())
+        {
+            e.AddLocation(LocationString());
+        }
+        
+        throw;
+    }
+}
+
 void dish::IndexParseTreeNode::Validate(LanguageSymbolTable &symtab) const
 {
     mBase->Validate(symtab);
@@ -1602,6 +2265,40 @@ bool dish::IndexParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::IndexParseTreeNode::Hash() const
+{
+    return combineHash(combineHash(ptnIndex, mBase->Hash()), mIndex->Hash());
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::IndexParseTreeNode::Copy() const
+{
+    return MakeShared< IndexParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) IndexParseTreeNode(*this); });
+}
+
+void dish::IndexParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    children.push_back(&mBase);
+    children.push_back(&mIndex);
+}
+
+void dish::IndexParseTreeNode::AssignableChildren(dish::iParseTreeNode::ChildListT &children)
+{
+    mBase->AssignableChildren(children);
+    children.push_back(&mIndex);
+}
+
+void dish::IndexParseTreeNode::ChildrenReplaced()
+{
+    mBase->ChildrenReplaced();
+}
+
+void dish::IndexParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnIndex, *this);
+    writer.Write(mBase);
+    writer.Write(mIndex);
+}
+
 void dish::IndexParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -1634,7 +2331,30 @@ std::shared_ptr< dish::iAtomic > dish::MemberParseTreeNode::Execute(dish::Langua
 {
     try
     {
-        return mBase->Execute(symtab)->Member(mMember);
+        return mBase->Execute(symtab)->Member(mMember, mCache);
+    }
+    
+    catch(DishException &e)
+    {
+        if(!e.IsLocationSupplied())
+        {
+            e.AddLocation(LocationString());
+        }
+        
+        throw;
+    }
+}
+
+void dish::MemberParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &opr)
+{
+    opr.Set(Inspect(symtab));
+}
+
+std::shared_ptr< dish::iAtomic > dish::MemberParseTreeNode::Inspect(dish::LanguageSymbolTable &symtab)
+{
+    try
+    {
+        return mBase->Inspect(symtab)->InspectMember(mMember, mCache);
     }
     
     catch(DishException &e)
@@ -1658,6 +2378,38 @@ bool dish::MemberParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::MemberParseTreeNode::Hash() const
+{
+    return combineHash(combineHash(ptnMember, std::hash< std::string >()(mMember)), mBase->Hash());
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::MemberParseTreeNode::Copy() const
+{
+    return MakeShared< MemberParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) MemberParseTreeNode(*this); });
+}
+
+void dish::MemberParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    children.push_back(&mBase);
+}
+
+void dish::MemberParseTreeNode::AssignableChildren(dish::iParseTreeNode::ChildListT &children)
+{
+    mBase->AssignableChildren(children);
+}
+
+void dish::MemberParseTreeNode::ChildrenReplaced()
+{
+    mBase->ChildrenReplaced();
+}
+
+void dish::MemberParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnMember, *this);
+    writer.Write(mBase);
+    writer.Write(mMember);
+}
+
 void dish::MemberParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -1669,6 +2421,45 @@ void dish::MemberParseTreeNode::Print(std::ostream &out, const std::string::size
     out << ")";
 }
 
+/******************************************************************************
+
+    dish::InlinedFunction class definitions
+
+ ******************************************************************************/
+
+std::shared_ptr< dish::iAtomic > dish::InlinedFunction::Execute(dish::LanguageSymbolTable &symtab, const std::shared_ptr< dish::iAtomic > *arguments)
+{
+    assert(mExpression);
+    
+    //  The calls restore the arguments of any call they were made from.
+    ScopedArguments scope(*this, arguments);
+    
+    return mExpression->Execute(symtab);
+}
+
+/******************************************************************************
+
+    dish::InlinedParameterParseTreeNode class definitions
+
+ ******************************************************************************/
+ 
+dish::IntegerT dish::InlinedParameterParseTreeNode::Count(0);
+dish::IntegerT dish::InlinedParameterParseTreeNode::Instances(0);
+
+std::shared_ptr< dish::iAtomic > dish::InlinedParameterParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
+{
+    return mFunction.Argument(mParameter);
+}
+
+void dish::InlinedParameterParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
+{
+    printIndent(out, indent);
+    
+    out << "PTN: inlined-parameter( ";
+    out << mFunction.FormalParameters()[mParameter].first;
+    out << " )";
+}
+
 /******************************************************************************
 
     dish::FunctionCallParseTreeNode class definitions
@@ -1678,6 +2469,11 @@ void dish::MemberParseTreeNode::Print(std::ostream &out, const std::string::size
 dish::IntegerT dish::FunctionCallParseTreeNode::Count(0);
 dish::IntegerT dish::FunctionCallParseTreeNode::Instances(0);
 
+dish::IntegerT dish::FunctionCallParseTreeNode::CacheHits(0);
+dish::IntegerT dish::FunctionCallParseTreeNode::CacheMisses(0);
+
+dish::IntegerT dish::FunctionCallParseTreeNode::InlinedCalls(0);
+
 bool dish::FunctionCallParseTreeNode::isEqual(const dish::FunctionCallParseTreeNode &ptn) const
 {
     if(mFunction->IsEqual(*(ptn.mFunction)))
@@ -1711,120 +2507,246 @@ bool dish::FunctionCallParseTreeNode::isEqual(const dish::FunctionCallParseTreeN
     return false;
 }
 
-std::shared_ptr< dish::iAtomic > dish::FunctionCallParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
+std::shared_ptr< dish::iAtomic > dish::FunctionCallParseTreeNode::Callee(dish::LanguageSymbolTable &symtab)
 {
+    const bool cacheable((0 != mFunctionId) && !mFunctionId->IsResolved());
+    
+    if(cacheable)
+    {
+        if((LanguageSymbolTable::CurrentEpoch() == mCachedEpoch) && (&symtab == mCachedSymbolTable))
+        {
+            ++CacheHits;
+            
+            return mCachedFunction;
+        }
+        
+        ++CacheMisses;
+    }
+    
     //  Get the function object.
     std::shared_ptr< dish::iAtomic > function(mFunction->Execute(symtab));
     
-    //  Get the formal parameter list of the function.
-    const iExecutableAtomic::ParamListT &formalparams(function->ParameterList());
-    
     //  Make sure the number of actual parameters matches the number of formal
     //  parameters.
-    if(mParameterList.size() == formalparams.size())
+    if(mParameterList.size() != function->ParameterList().size())
+    {
+        ThrowArgumentCountError();
+    }
+    
+    if(cacheable && (iAtomic::typeExecutable == function->Type()))
+    {
+        mCachedFunction = function;
+        mCachedSymbolTable = &symtab;
+        mCachedEpoch = LanguageSymbolTable::CurrentEpoch();
+    }
+    
+    return function;
+}
+
+bool dish::FunctionCallParseTreeNode::IsTailCallable(const dish::LanguageSymbolTable &symtab, const dish::iAtomic &function)
+{
+    //  Calls record their time in the execution profile, so leave them all to
+    //  be made when profiling.
+    if(symtab.CollectExecutionProfile() || (0 == symtab.Function()))
+    {
+        return false;
+    }
+    
+    if(!symtab.EliminateTailCalls() || (typeid(FunctionParseTreeNode::FunctionValue) != typeid(function)))
+    {
+        return false;
+    }
+    
+    //  The scopes entered since the executing function was, its locals and
+    //  the frame of any call it replaced, are dropped. Unless the callee binds
+    //  each of their symbols as a parameter, it or a function it calls could
+    //  see one of them by name.
+    return symtab.ScopesHoldOnlyParameters(symtab.FunctionDepth(), function);
+}
+
+std::shared_ptr< dish::iAtomic > dish::FunctionCallParseTreeNode::ExecuteTailCall(dish::LanguageSymbolTable &symtab)
+{
+    //  Get the function object.
+    std::shared_ptr< dish::iAtomic > function(Callee(symtab));
+    
+    if(isInlined(symtab, *function))
     {
-        std::string fsignature;
+        return executeInlined(symtab);
+    }
+    
+    if(!IsTailCallable(symtab, *function))
+    {
+        return call(symtab, function);
+    }
+    
+    std::shared_ptr< FrameSymbolTable > table;
+    
+    if(!mParameterList.empty())
+    {
+        table = symtab.NewFrame(static_cast< int >(mParameterList.size()));
+        
+        ParameterListT::const_iterator ap_i(mParameterList.begin());
+        const ParameterListT::const_iterator ap_last_i(mParameterList.end());
+
+        iExecutableAtomic::ParamListT::const_iterator fp_i(function->ParameterList().begin());
         
+        for(; ap_i != ap_last_i; ++ap_i, ++fp_i)
+        {
+            table->Insert(fp_i->first, fp_i->second ? (*ap_i)->Execute(symtab) : (*ap_i)->Inspect(symtab)->Clone());
+        }
+    }
+    
+    symtab.SetTailCall(function, table);
+    
+    return NullValue::MakeValue();
+}
+
+std::shared_ptr< dish::iAtomic > dish::FunctionCallParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
+{
+    std::shared_ptr< dish::iAtomic > function(Callee(symtab));
+    
+    if(isInlined(symtab, *function))
+    {
+        return executeInlined(symtab);
+    }
+    
+    return call(symtab, function);
+}
+
+bool dish::FunctionCallParseTreeNode::isInlined(const dish::LanguageSymbolTable &symtab, const dish::iAtomic &function)
+{
+    //  Calls record their time in the execution profile, so leave them all to
+    //  be made when profiling.
+    if((0 == mInlined.get()) || symtab.CollectExecutionProfile())
+    {
+        return false;
+    }
+    
+    if(mCalls < mInlineAfter)
+    {
+        ++mCalls;
+        return false;
+    }
+    
+    //  The name may have been bound to another function since.
+    return (typeid(FunctionParseTreeNode::FunctionValue) == typeid(function)) && (static_cast< const FunctionParseTreeNode::FunctionValue & >(function).Body() == mInlined->Body());
+}
+
+std::shared_ptr< dish::iAtomic > dish::FunctionCallParseTreeNode::executeInlined(dish::LanguageSymbolTable &symtab)
+{
+    //  The actual parameters are evaluated just as for a call, by reference or
+    //  by value, but are kept on the native stack rather than in a frame.
+    std::shared_ptr< iAtomic > arguments[InlinedFunction::MAX_PARAMETERS];
+    
+    ParameterListT::const_iterator ap_i(mParameterList.begin());
+    const ParameterListT::const_iterator ap_last_i(mParameterList.end());
+
+    iExecutableAtomic::ParamListT::const_iterator fp_i(mInlined->FormalParameters().begin());
+    
+    for(int i(0); ap_i != ap_last_i; ++ap_i, ++fp_i, ++i)
+    {
+        arguments[i] = fp_i->second ? (*ap_i)->Execute(symtab) : (*ap_i)->Inspect(symtab)->Clone();
+    }
+    
+    ++InlinedCalls;
+    
+    return mInlined->Execute(symtab, arguments);
+}
+
+std::shared_ptr< dish::iAtomic > dish::FunctionCallParseTreeNode::call(dish::LanguageSymbolTable &symtab, std::shared_ptr< dish::iAtomic > function)
+{
+    //  Get the formal parameter list of the function.
+    const iExecutableAtomic::ParamListT &formalparams(function->ParameterList());
+    
+    std::string fsignature;
+    
+    if(symtab.CollectExecutionProfile())
+    {
+        fsignature = mFunction->ToString();
+        fsignature = fsignature.substr(0, fsignature.find_last_of('_'));
+        fsignature += "(";
+    }
+
+    //  Does the function accept parameters?
+    if(mParameterList.empty())
+    {
+        //  No, there are no parameters. Make the function call.
+        std::shared_ptr< ExecutionProfile::AccumulateTime > profile;
         if(symtab.CollectExecutionProfile())
         {
-            fsignature = mFunction->ToString();
-            fsignature = fsignature.substr(0, fsignature.find_last_of('_'));
-            fsignature += "(";
+            fsignature += ")";
+            profile = symtab.ProfileInformation().ScopedProfileAccumulator(fsignature);
         }
     
-        //  Does the function accept parameters?
-        if(mParameterList.empty())
+        return function->Execute(symtab);
+    }
+    else
+    {   
+        //  Yes, there are parameters. Get a frame, from the symbol-table's
+        //  pool if it has one, to store the actual parameters.
+        std::shared_ptr< FrameSymbolTable > table(symtab.NewFrame(static_cast< int >(mParameterList.size())));
+        
+        //  Loop through the formal- and actual-parameter lists and add them
+        //  to the new table.
+        ParameterListT::const_iterator ap_i(mParameterList.begin());
+        const ParameterListT::const_iterator ap_last_i(mParameterList.end());
+
+        iExecutableAtomic::ParamListT::const_iterator fp_i(formalparams.begin());
+        const iExecutableAtomic::ParamListT::const_iterator fp_last_i(formalparams.end());
+        
+        if(!symtab.CollectExecutionProfile())
         {
-            //  No, there are no parameters. Make the function call.
-            try
-            {
-                std::shared_ptr< ExecutionProfile::AccumulateTime > profile;
-                if(symtab.CollectExecutionProfile())
-                {
-                    fsignature += ")";
-                    profile = symtab.ProfileInformation().ScopedProfileAccumulator(fsignature);
-                }
-            
-                return function->Execute(symtab);
-            }
-            
-            catch(ReturnParseTreeNode::ReturnValueT e)
+            while((ap_i != ap_last_i) && (fp_i != fp_last_i))
             {
-                return e;
+                table->Insert(fp_i->first, fp_i->second ? (*ap_i)->Execute(symtab) : (*ap_i)->Inspect(symtab)->Clone());
+                
+                ++ap_i;
+                ++fp_i;
             }
         }
         else
-        {   
-            //  Yes, there are parameters. Create a new symbol-table to store
-            //  the actual parameters.
-            std::shared_ptr< BasicSymbolTable > table(BasicSymbolTable::MakeValue());
-            
-            //  Loop through the formal- and actual-parameter lists and add them
-            //  to the new table.
-            ParameterListT::const_iterator ap_i(mParameterList.begin());
-            const ParameterListT::const_iterator ap_last_i(mParameterList.end());
-    
-            iExecutableAtomic::ParamListT::const_iterator fp_i(formalparams.begin());
-            const iExecutableAtomic::ParamListT::const_iterator fp_last_i(formalparams.end());
-            
-            if(!symtab.CollectExecutionProfile())
+        {
+            for(bool first(true); (ap_i != ap_last_i) && (fp_i != fp_last_i); ++ap_i, ++fp_i)
             {
-                while((ap_i != ap_last_i) && (fp_i != fp_last_i))
+                if(!first)
                 {
-                    table->Insert(fp_i->first, fp_i->second ? (*ap_i)->Execute(symtab) : (*ap_i)->Execute(symtab)->Clone());
-                    
-                    ++ap_i;
-                    ++fp_i;
+                    fsignature += ", ";
                 }
-            }
-            else
-            {
-                for(bool first(true); (ap_i != ap_last_i) && (fp_i != fp_last_i); ++ap_i, ++fp_i)
+                else
                 {
-                    if(!first)
-                    {
-                        fsignature += ", ";
-                    }
-                    else
-                    {
-                        first = false;
-                    }
-                    if(fp_i->second)
-                    {
-                        fsignature += "&";
-                    }
-                    fsignature += fp_i->first;
-                
-                    table->Insert(fp_i->first, fp_i->second ? (*ap_i)->Execute(symtab) : (*ap_i)->Execute(symtab)->Clone());
+                    first = false;
                 }
-            }
-        
-            assert(ap_last_i == ap_i);
-            assert(fp_last_i == fp_i);
-            
-            //  Add a new scope with the parameters to the stack.
-            ScopedScope scope(symtab, table);
-        
-            //  Make the function call.
-            try
-            {
-                std::shared_ptr< ExecutionProfile::AccumulateTime > profile;
-                if(symtab.CollectExecutionProfile())
+                if(fp_i->second)
                 {
-                    fsignature += ")";
-                    profile = symtab.ProfileInformation().ScopedProfileAccumulator(fsignature);
+                    fsignature += "&";
                 }
+                fsignature += fp_i->first;
             
-                return function->Execute(symtab);
-            }
-            
-            catch(ReturnParseTreeNode::ReturnValueT e)
-            {
-                return e;
+                table->Insert(fp_i->first, fp_i->second ? (*ap_i)->Execute(symtab) : (*ap_i)->Inspect(symtab)->Clone());
             }
         }
-    }
     
+        assert(ap_last_i == ap_i);
+        assert(fp_last_i == fp_i);
+        
+        //  Add a new scope with the parameters to the stack, leaving it the
+        //  only owner of the frame so that it can be reused once popped.
+        ScopedScope scope(symtab, std::move(table));
+    
+        //  Make the function call.
+        std::shared_ptr< ExecutionProfile::AccumulateTime > profile;
+        if(symtab.CollectExecutionProfile())
+        {
+            fsignature += ")";
+            profile = symtab.ProfileInformation().ScopedProfileAccumulator(fsignature);
+        }
+    
+        return function->Execute(symtab);
+    }
+}
+
+void dish::FunctionCallParseTreeNode::ThrowArgumentCountError() const
+{
     std::stringstream message;
     message << LocationString() << " : ";
     message << "Syntax error: Incorrect number of arguments in call to function '";
@@ -1852,6 +2774,55 @@ bool dish::FunctionCallParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) c
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::FunctionCallParseTreeNode::Hash() const
+{
+    std::size_t hash(combineHash(ptnFunctionCall, mFunction->Hash()));
+    
+    for(ParameterListT::const_iterator i(mParameterList.begin()), last_i(mParameterList.end()); i != last_i; ++i)
+    {
+        hash = combineHash(hash, (*i)->Hash());
+    }
+    
+    return hash;
+}
+
+void dish::FunctionCallParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    children.push_back(&mFunction);
+    
+    for(ParameterListT::iterator i(mParameterList.begin()), last_i(mParameterList.end()); i != last_i; ++i)
+    {
+        children.push_back(&(*i));
+    }
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::FunctionCallParseTreeNode::Copy() const
+{
+    return MakeShared< FunctionCallParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) FunctionCallParseTreeNode(*this); });
+}
+
+void dish::FunctionCallParseTreeNode::ChildrenReplaced()
+{
+    //  The function may have been replaced, so the inline cache starts over.
+    mFunctionId = functionId(mFunction);
+    
+    mCachedFunction.reset();
+    mCachedSymbolTable = 0;
+    mCachedEpoch = -1;
+}
+
+void dish::FunctionCallParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnFunctionCall, *this);
+    writer.Write(mFunction);
+    
+    writer.Write(static_cast< std::int32_t >(mParameterList.size()));
+    for(ParameterListT::const_iterator i(mParameterList.begin()), last_i(mParameterList.end()); i != last_i; ++i)
+    {
+        writer.Write(*i);
+    }
+}
+
 void dish::FunctionCallParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -1879,6 +2850,11 @@ void dish::FunctionCallParseTreeNode::Print(std::ostream &out, const std::string
     );
     
     out << ") )";
+    
+    if(mInlined)
+    {
+        out << " inlined";
+    }
 }
 
 /******************************************************************************
@@ -1892,12 +2868,28 @@ dish::IntegerT dish::ReturnParseTreeNode::Instances(0);
 
 bool dish::ReturnParseTreeNode::isEqual(const dish::ReturnParseTreeNode &ptn) const
 {
-    return mReturn->IsEqual(*(ptn.mReturn));
+    return (mTailCall == ptn.mTailCall) && mReturn->IsEqual(*(ptn.mReturn));
 }
  
 std::shared_ptr< dish::iAtomic > dish::ReturnParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
-    throw mReturn->Execute(symtab);
+    if(mTailCall)
+    {
+        std::shared_ptr< iAtomic > value(static_cast< FunctionCallParseTreeNode & >(*mReturn).ExecuteTailCall(symtab));
+        
+        //  Unless the call was left to the executing function to make.
+        if(!symtab.IsTailCalling())
+        {
+            symtab.SetReturnValue(value);
+        }
+        
+        return value;
+    }
+
+    std::shared_ptr< iAtomic > value(mReturn->Execute(symtab));
+    symtab.SetReturnValue(value);
+    
+    return value;
 }
 
 void dish::ReturnParseTreeNode::Validate(LanguageSymbolTable &symtab) const
@@ -1910,11 +2902,48 @@ bool dish::ReturnParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::ReturnParseTreeNode::Hash() const
+{
+    return combineHash(combineHash(ptnReturn, mTailCall ? 1 : 0), mReturn->Hash());
+}
+
+void dish::ReturnParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    //  A tail call has to remain a call; only its operands may be replaced.
+    if(mTailCall)
+    {
+        mReturn->Children(children);
+    }
+    else
+    {
+        children.push_back(&mReturn);
+    }
+}
+
+void dish::ReturnParseTreeNode::ChildrenReplaced()
+{
+    if(mTailCall)
+    {
+        mReturn->ChildrenReplaced();
+    }
+}
+
+void dish::ReturnParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnReturn, *this);
+    writer.Write(mReturn);
+    writer.Write(mTailCall);
+}
+
 void dish::ReturnParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
     
     out << "PTN: return ";
+    if(mTailCall)
+    {
+        out << "tail-call ";
+    }
     mReturn->Print(out, 0);
 }
 
@@ -1934,6 +2963,17 @@ void dish::OneOprParseTreeNode::Validate(LanguageSymbolTable &symtab) const
     mOpr->Validate(symtab);
 }
 
+void dish::OneOprParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    children.push_back(&mOpr);
+}
+
+void dish::OneOprParseTreeNode::write(dish::ParseTreeWriter &writer, const dish::ParseTreeTagT &tag) const
+{
+    writer.Begin(tag, *this);
+    writer.Write(mOpr);
+}
+
 /******************************************************************************
 
     dish::TwoOprParseTreeNode class definitions
@@ -1951,6 +2991,60 @@ void dish::TwoOprParseTreeNode::Validate(LanguageSymbolTable &symtab) const
     mOpr2->Validate(symtab);
 }
 
+void dish::TwoOprParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    children.push_back(&mOpr1);
+    children.push_back(&mOpr2);
+}
+
+void dish::TwoOprParseTreeNode::write(dish::ParseTreeWriter &writer, const dish::ParseTreeTagT &tag) const
+{
+    writer.Begin(tag, *this);
+    writer.Write(mOpr1);
+    writer.Write(mOpr2);
+}
+
+void dish::TwoOprParseTreeNode::executeOperands(dish::LanguageSymbolTable &symtab, dish::ValueHandle &result, const bool &reversed, dish::TwoArgHandleOpF op)
+{
+    try
+    {
+        ValueHandle rhs;
+        
+        if(!reversed)
+        {
+            mOpr1->ExecuteOperand(symtab, result);
+            mOpr2->ExecuteOperand(symtab, rhs);
+        }
+        else
+        {
+            mOpr2->ExecuteOperand(symtab, rhs);
+            mOpr1->ExecuteOperand(symtab, result);
+        }
+        
+        if(result.IsPrimitive() && rhs.IsPrimitive())
+        {
+            ++UnboxedOperations;
+        }
+        else if(!mGeneric)
+        {
+            mGeneric = true;
+            ++GenericFallbacks;
+        }
+        
+        op(result, rhs);
+    }
+    
+    catch(DishException &e)
+    {
+        if(!e.IsLocationSupplied())
+        {
+            e.AddLocation(LocationString());
+        }
+        
+        throw;
+    }
+}
+
 /******************************************************************************
 
     dish::ChainedOprParseTreeNode class definitions
@@ -1988,6 +3082,18 @@ bool dish::ChainedOprParseTreeNode::equal(const dish::ChainedOprParseTreeNode &p
     
     return false;
 }
+
+std::size_t dish::ChainedOprParseTreeNode::hash(const dish::ParseTreeTagT &tag) const
+{
+    std::size_t hash(tag);
+    
+    for(ChainedOprListT::const_iterator i(mOprList.begin()), last_i(mOprList.end()); i != last_i; ++i)
+    {
+        hash = combineHash(hash, (*i)->Hash());
+    }
+    
+    return hash;
+}
  
 void dish::ChainedOprParseTreeNode::AddOperand(std::shared_ptr< dish::iParseTreeNode > opr)
 {
@@ -2037,6 +3143,54 @@ bool dish::ChainedOprParseTreeNode::IsLiteral() const
     return true;
 }
 
+void dish::ChainedOprParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    for(ChainedOprListT::iterator i(mOprList.begin()), last_i(mOprList.end()); i != last_i; ++i)
+    {
+        children.push_back(&(*i));
+    }
+}
+
+void dish::ChainedOprParseTreeNode::write(dish::ParseTreeWriter &writer, const dish::ParseTreeTagT &tag) const
+{
+    writer.Begin(tag, *this);
+    
+    writer.Write(static_cast< std::int32_t >(mOprList.size()));
+    for(ChainedOprListT::const_iterator i(mOprList.begin()), last_i(mOprList.end()); i != last_i; ++i)
+    {
+        writer.Write(*i);
+    }
+}
+
+void dish::ChainedOprParseTreeNode::executeOperands(dish::LanguageSymbolTable &symtab, dish::ValueHandle &result, dish::TwoArgHandleOpF op)
+{
+    assert(!mOprList.empty());
+
+    ChainedOprListT::const_iterator i(mOprList.begin());
+    const ChainedOprListT::const_iterator last_i(mOprList.end());
+    
+    (*i++)->ExecuteOperand(symtab, result);
+    
+    ValueHandle opr;
+    
+    while(i != last_i)
+    {
+        (*i++)->ExecuteOperand(symtab, opr);
+        
+        if(result.IsPrimitive() && opr.IsPrimitive())
+        {
+            ++UnboxedOperations;
+        }
+        else if(!mGeneric)
+        {
+            mGeneric = true;
+            ++GenericFallbacks;
+        }
+        
+        op(result, opr);
+    }
+}
+
 /******************************************************************************
 
     dish::NegateOpParseTreeNode class definitions
@@ -2058,14 +3212,62 @@ std::shared_ptr< dish::iAtomic > dish::NegateOpParseTreeNode::Execute()
 
 std::shared_ptr< dish::iAtomic > dish::NegateOpParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
+    if(!mGeneric)
+    {
+        ValueHandle result;
+        
+        ExecuteOperand(symtab, result);
+        
+        return result.Box();
+    }
+    
     return -(mOpr->Execute(symtab));
 }
 
+void dish::NegateOpParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &opr)
+{
+    if(mGeneric)
+    {
+        opr.Set(Execute(symtab));
+        
+        return;
+    }
+    
+    mOpr->ExecuteOperand(symtab, opr);
+    
+    if(opr.IsPrimitive())
+    {
+        ++UnboxedOperations;
+    }
+    else
+    {
+        mGeneric = true;
+        ++GenericFallbacks;
+    }
+    
+    OpNeg(opr);
+}
+
 bool dish::NegateOpParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
 {
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::NegateOpParseTreeNode::Hash() const
+{
+    return hash(ptnNegateOp);
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::NegateOpParseTreeNode::Copy() const
+{
+    return MakeShared< NegateOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) NegateOpParseTreeNode(*this); });
+}
+
+void dish::NegateOpParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    write(writer, ptnNegateOp);
+}
+
 void dish::NegateOpParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -2118,6 +3320,15 @@ std::shared_ptr< dish::iAtomic > dish::AddOpChainParseTreeNode::Execute()
 
 std::shared_ptr< dish::iAtomic > dish::AddOpChainParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
+    if(!mGeneric)
+    {
+        ValueHandle result;
+        
+        ExecuteOperand(symtab, result);
+        
+        return result.Box();
+    }
+    
     assert(!mOprList.empty());
 
     ChainedOprListT::const_iterator i(mOprList.begin());
@@ -2133,11 +3344,38 @@ std::shared_ptr< dish::iAtomic > dish::AddOpChainParseTreeNode::Execute(dish::La
     return result;
 }
 
+void dish::AddOpChainParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &result)
+{
+    if(mGeneric)
+    {
+        result.Set(Execute(symtab));
+        
+        return;
+    }
+    
+    executeOperands(symtab, result, OpAdd);
+}
+
 bool dish::AddOpChainParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
 {
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::AddOpChainParseTreeNode::Hash() const
+{
+    return hash(ptnAddOpChain);
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::AddOpChainParseTreeNode::Copy() const
+{
+    return MakeShared< AddOpChainParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) AddOpChainParseTreeNode(*this); });
+}
+
+void dish::AddOpChainParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    write(writer, ptnAddOpChain);
+}
+
 void dish::AddOpChainParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -2190,6 +3428,15 @@ std::shared_ptr< dish::iAtomic > dish::SubOpParseTreeNode::Execute()
 
 std::shared_ptr< dish::iAtomic > dish::SubOpParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
+    if(!mGeneric)
+    {
+        ValueHandle result;
+        
+        ExecuteOperand(symtab, result);
+        
+        return result.Box();
+    }
+    
     try
     {
         return OpSub(mOpr1->Execute(symtab), mOpr2->Execute(symtab));
@@ -2206,11 +3453,38 @@ std::shared_ptr< dish::iAtomic > dish::SubOpParseTreeNode::Execute(dish::Languag
     }
 }
 
+void dish::SubOpParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &result)
+{
+    if(mGeneric)
+    {
+        result.Set(Execute(symtab));
+        
+        return;
+    }
+    
+    executeOperands(symtab, result, true, OpSub);
+}
+
 bool dish::SubOpParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
 {
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::SubOpParseTreeNode::Hash() const
+{
+    return hash(ptnSubOp);
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::SubOpParseTreeNode::Copy() const
+{
+    return MakeShared< SubOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) SubOpParseTreeNode(*this); });
+}
+
+void dish::SubOpParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    write(writer, ptnSubOp);
+}
+
 void dish::SubOpParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -2265,6 +3539,15 @@ std::shared_ptr< dish::iAtomic > dish::MulOpChainParseTreeNode::Execute()
 
 std::shared_ptr< dish::iAtomic > dish::MulOpChainParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
+    if(!mGeneric)
+    {
+        ValueHandle result;
+        
+        ExecuteOperand(symtab, result);
+        
+        return result.Box();
+    }
+    
     assert(!mOprList.empty());
 
     ChainedOprListT::const_iterator i(mOprList.begin());
@@ -2280,11 +3563,38 @@ std::shared_ptr< dish::iAtomic > dish::MulOpChainParseTreeNode::Execute(dish::La
     return result;
 }
 
+void dish::MulOpChainParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &result)
+{
+    if(mGeneric)
+    {
+        result.Set(Execute(symtab));
+        
+        return;
+    }
+    
+    executeOperands(symtab, result, OpMul);
+}
+
 bool dish::MulOpChainParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
 {
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::MulOpChainParseTreeNode::Hash() const
+{
+    return hash(ptnMulOpChain);
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::MulOpChainParseTreeNode::Copy() const
+{
+    return MakeShared< MulOpChainParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) MulOpChainParseTreeNode(*this); });
+}
+
+void dish::MulOpChainParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    write(writer, ptnMulOpChain);
+}
+
 void dish::MulOpChainParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -2337,6 +3647,15 @@ std::shared_ptr< dish::iAtomic > dish::DivOpParseTreeNode::Execute()
 
 std::shared_ptr< dish::iAtomic > dish::DivOpParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
+    if(!mGeneric)
+    {
+        ValueHandle result;
+        
+        ExecuteOperand(symtab, result);
+        
+        return result.Box();
+    }
+    
     try
     {
         return OpDiv(mOpr1->Execute(symtab), mOpr2->Execute(symtab));
@@ -2353,11 +3672,38 @@ std::shared_ptr< dish::iAtomic > dish::DivOpParseTreeNode::Execute(dish::Languag
     }
 }
 
+void dish::DivOpParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &result)
+{
+    if(mGeneric)
+    {
+        result.Set(Execute(symtab));
+        
+        return;
+    }
+    
+    executeOperands(symtab, result, true, OpDiv);
+}
+
 bool dish::DivOpParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
 {
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::DivOpParseTreeNode::Hash() const
+{
+    return hash(ptnDivOp);
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::DivOpParseTreeNode::Copy() const
+{
+    return MakeShared< DivOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) DivOpParseTreeNode(*this); });
+}
+
+void dish::DivOpParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    write(writer, ptnDivOp);
+}
+
 void dish::DivOpParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -2403,6 +3749,15 @@ std::shared_ptr< dish::iAtomic > dish::ModOpParseTreeNode::Execute()
 
 std::shared_ptr< dish::iAtomic > dish::ModOpParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
+    if(!mGeneric)
+    {
+        ValueHandle result;
+        
+        ExecuteOperand(symtab, result);
+        
+        return result.Box();
+    }
+    
     try
     {
         return OpMod(mOpr1->Execute(symtab), mOpr2->Execute(symtab));
@@ -2419,11 +3774,38 @@ std::shared_ptr< dish::iAtomic > dish::ModOpParseTreeNode::Execute(dish::Languag
     }
 }
 
+void dish::ModOpParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &result)
+{
+    if(mGeneric)
+    {
+        result.Set(Execute(symtab));
+        
+        return;
+    }
+    
+    executeOperands(symtab, result, true, OpMod);
+}
+
 bool dish::ModOpParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
 {
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::ModOpParseTreeNode::Hash() const
+{
+    return hash(ptnModOp);
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::ModOpParseTreeNode::Copy() const
+{
+    return MakeShared< ModOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) ModOpParseTreeNode(*this); });
+}
+
+void dish::ModOpParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    write(writer, ptnModOp);
+}
+
 void dish::ModOpParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -2490,6 +3872,21 @@ bool dish::PowOpParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::PowOpParseTreeNode::Hash() const
+{
+    return hash(ptnPowOp);
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::PowOpParseTreeNode::Copy() const
+{
+    return MakeShared< PowOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) PowOpParseTreeNode(*this); });
+}
+
+void dish::PowOpParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    write(writer, ptnPowOp);
+}
+
 void dish::PowOpParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -2535,6 +3932,15 @@ std::shared_ptr< dish::iAtomic > dish::NotOpParseTreeNode::Execute()
 
 std::shared_ptr< dish::iAtomic > dish::NotOpParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
+    if(!mGeneric)
+    {
+        ValueHandle result;
+        
+        ExecuteOperand(symtab, result);
+        
+        return result.Box();
+    }
+    
     try
     {
         return !(mOpr->Execute(symtab));
@@ -2551,11 +3957,63 @@ std::shared_ptr< dish::iAtomic > dish::NotOpParseTreeNode::Execute(dish::Languag
     }
 }
 
+void dish::NotOpParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &opr)
+{
+    if(mGeneric)
+    {
+        opr.Set(Execute(symtab));
+        
+        return;
+    }
+    
+    try
+    {
+        mOpr->ExecuteOperand(symtab, opr);
+        
+        if(opr.IsPrimitive())
+        {
+            ++UnboxedOperations;
+        }
+        else
+        {
+            mGeneric = true;
+            ++GenericFallbacks;
+        }
+        
+        OpNot(opr);
+    }
+    
+    catch(DishException &e)
+    {
+        if(!e.IsLocationSupplied())
+        {
+            e.AddLocation(LocationString());
+        }
+        
+        throw;
+    }
+}
+
 bool dish::NotOpParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
 {
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::NotOpParseTreeNode::Hash() const
+{
+    return hash(ptnNotOp);
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::NotOpParseTreeNode::Copy() const
+{
+    return MakeShared< NotOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) NotOpParseTreeNode(*this); });
+}
+
+void dish::NotOpParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    write(writer, ptnNotOp);
+}
+
 void dish::NotOpParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -2608,6 +4066,15 @@ std::shared_ptr< dish::iAtomic > dish::AndOpChainParseTreeNode::Execute()
 
 std::shared_ptr< dish::iAtomic > dish::AndOpChainParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
+    if(!mGeneric)
+    {
+        ValueHandle result;
+        
+        ExecuteOperand(symtab, result);
+        
+        return result.Box();
+    }
+    
     assert(!mOprList.empty());
 
     ChainedOprListT::const_iterator i(mOprList.begin());
@@ -2617,10 +4084,22 @@ std::shared_ptr< dish::iAtomic > dish::AndOpChainParseTreeNode::Execute(dish::La
     
     while(i != last_i)
     {
-        result = OpAnd(result, (*i++)->Execute(symtab));
+        result = OpAnd(result, (*i++)->Execute(symtab));
+    }
+    
+    return result;
+}
+
+void dish::AndOpChainParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &result)
+{
+    if(mGeneric)
+    {
+        result.Set(Execute(symtab));
+        
+        return;
     }
     
-    return result;
+    executeOperands(symtab, result, OpAnd);
 }
 
 bool dish::AndOpChainParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
@@ -2628,6 +4107,21 @@ bool dish::AndOpChainParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) con
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::AndOpChainParseTreeNode::Hash() const
+{
+    return hash(ptnAndOpChain);
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::AndOpChainParseTreeNode::Copy() const
+{
+    return MakeShared< AndOpChainParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) AndOpChainParseTreeNode(*this); });
+}
+
+void dish::AndOpChainParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    write(writer, ptnAndOpChain);
+}
+
 void dish::AndOpChainParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -2689,6 +4183,15 @@ std::shared_ptr< dish::iAtomic > dish::OrOpChainParseTreeNode::Execute()
 
 std::shared_ptr< dish::iAtomic > dish::OrOpChainParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
+    if(!mGeneric)
+    {
+        ValueHandle result;
+        
+        ExecuteOperand(symtab, result);
+        
+        return result.Box();
+    }
+    
     assert(!mOprList.empty());
 
     ChainedOprListT::const_iterator i(mOprList.begin());
@@ -2704,11 +4207,38 @@ std::shared_ptr< dish::iAtomic > dish::OrOpChainParseTreeNode::Execute(dish::Lan
     return result;
 }
 
+void dish::OrOpChainParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &result)
+{
+    if(mGeneric)
+    {
+        result.Set(Execute(symtab));
+        
+        return;
+    }
+    
+    executeOperands(symtab, result, OpOr);
+}
+
 bool dish::OrOpChainParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
 {
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::OrOpChainParseTreeNode::Hash() const
+{
+    return hash(ptnOrOpChain);
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::OrOpChainParseTreeNode::Copy() const
+{
+    return MakeShared< OrOpChainParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) OrOpChainParseTreeNode(*this); });
+}
+
+void dish::OrOpChainParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    write(writer, ptnOrOpChain);
+}
+
 void dish::OrOpChainParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -2770,6 +4300,15 @@ std::shared_ptr< dish::iAtomic > dish::XorOpChainParseTreeNode::Execute()
 
 std::shared_ptr< dish::iAtomic > dish::XorOpChainParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
+    if(!mGeneric)
+    {
+        ValueHandle result;
+        
+        ExecuteOperand(symtab, result);
+        
+        return result.Box();
+    }
+    
     assert(!mOprList.empty());
 
     ChainedOprListT::const_iterator i(mOprList.begin());
@@ -2785,11 +4324,38 @@ std::shared_ptr< dish::iAtomic > dish::XorOpChainParseTreeNode::Execute(dish::La
     return result;
 }
 
+void dish::XorOpChainParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &result)
+{
+    if(mGeneric)
+    {
+        result.Set(Execute(symtab));
+        
+        return;
+    }
+    
+    executeOperands(symtab, result, OpXor);
+}
+
 bool dish::XorOpChainParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
 {
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::XorOpChainParseTreeNode::Hash() const
+{
+    return hash(ptnXorOpChain);
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::XorOpChainParseTreeNode::Copy() const
+{
+    return MakeShared< XorOpChainParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) XorOpChainParseTreeNode(*this); });
+}
+
+void dish::XorOpChainParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    write(writer, ptnXorOpChain);
+}
+
 void dish::XorOpChainParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -2842,6 +4408,15 @@ std::shared_ptr< dish::iAtomic > dish::LessThanOpParseTreeNode::Execute()
 
 std::shared_ptr< dish::iAtomic > dish::LessThanOpParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
+    if(!mGeneric)
+    {
+        ValueHandle result;
+        
+        ExecuteOperand(symtab, result);
+        
+        return result.Box();
+    }
+    
     try
     {
         return OpLessThan(mOpr1->Execute(symtab), mOpr2->Execute(symtab));
@@ -2858,11 +4433,38 @@ std::shared_ptr< dish::iAtomic > dish::LessThanOpParseTreeNode::Execute(dish::La
     }
 }
 
+void dish::LessThanOpParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &result)
+{
+    if(mGeneric)
+    {
+        result.Set(Execute(symtab));
+        
+        return;
+    }
+    
+    executeOperands(symtab, result, true, OpLessThan);
+}
+
 bool dish::LessThanOpParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
 {
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::LessThanOpParseTreeNode::Hash() const
+{
+    return hash(ptnLessThanOp);
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::LessThanOpParseTreeNode::Copy() const
+{
+    return MakeShared< LessThanOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LessThanOpParseTreeNode(*this); });
+}
+
+void dish::LessThanOpParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    write(writer, ptnLessThanOp);
+}
+
 void dish::LessThanOpParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -2908,6 +4510,15 @@ std::shared_ptr< dish::iAtomic > dish::LessThanEqualOpParseTreeNode::Execute()
 
 std::shared_ptr< dish::iAtomic > dish::LessThanEqualOpParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
+    if(!mGeneric)
+    {
+        ValueHandle result;
+        
+        ExecuteOperand(symtab, result);
+        
+        return result.Box();
+    }
+    
     try
     {
         return OpLessThanOrEqual(mOpr1->Execute(symtab), mOpr2->Execute(symtab));
@@ -2924,11 +4535,38 @@ std::shared_ptr< dish::iAtomic > dish::LessThanEqualOpParseTreeNode::Execute(dis
     }
 }
 
+void dish::LessThanEqualOpParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &result)
+{
+    if(mGeneric)
+    {
+        result.Set(Execute(symtab));
+        
+        return;
+    }
+    
+    executeOperands(symtab, result, true, OpLessThanOrEqual);
+}
+
 bool dish::LessThanEqualOpParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
 {
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::LessThanEqualOpParseTreeNode::Hash() const
+{
+    return hash(ptnLessThanEqualOp);
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::LessThanEqualOpParseTreeNode::Copy() const
+{
+    return MakeShared< LessThanEqualOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LessThanEqualOpParseTreeNode(*this); });
+}
+
+void dish::LessThanEqualOpParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    write(writer, ptnLessThanEqualOp);
+}
+
 void dish::LessThanEqualOpParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -2974,6 +4612,15 @@ std::shared_ptr< dish::iAtomic > dish::EqualOpParseTreeNode::Execute()
 
 std::shared_ptr< dish::iAtomic > dish::EqualOpParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
+    if(!mGeneric)
+    {
+        ValueHandle result;
+        
+        ExecuteOperand(symtab, result);
+        
+        return result.Box();
+    }
+    
     try
     {
         return OpEqual(mOpr1->Execute(symtab), mOpr2->Execute(symtab));
@@ -2990,11 +4637,38 @@ std::shared_ptr< dish::iAtomic > dish::EqualOpParseTreeNode::Execute(dish::Langu
     }
 }
 
+void dish::EqualOpParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &result)
+{
+    if(mGeneric)
+    {
+        result.Set(Execute(symtab));
+        
+        return;
+    }
+    
+    executeOperands(symtab, result, true, OpEqual);
+}
+
 bool dish::EqualOpParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
 {
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::EqualOpParseTreeNode::Hash() const
+{
+    return hash(ptnEqualOp);
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::EqualOpParseTreeNode::Copy() const
+{
+    return MakeShared< EqualOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) EqualOpParseTreeNode(*this); });
+}
+
+void dish::EqualOpParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    write(writer, ptnEqualOp);
+}
+
 void dish::EqualOpParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -3040,6 +4714,15 @@ std::shared_ptr< dish::iAtomic > dish::NotEqualOpParseTreeNode::Execute()
 
 std::shared_ptr< dish::iAtomic > dish::NotEqualOpParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
+    if(!mGeneric)
+    {
+        ValueHandle result;
+        
+        ExecuteOperand(symtab, result);
+        
+        return result.Box();
+    }
+    
     try
     {
         return OpNotEqual(mOpr1->Execute(symtab), mOpr2->Execute(symtab));
@@ -3056,11 +4739,38 @@ std::shared_ptr< dish::iAtomic > dish::NotEqualOpParseTreeNode::Execute(dish::La
     }
 }
 
+void dish::NotEqualOpParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &result)
+{
+    if(mGeneric)
+    {
+        result.Set(Execute(symtab));
+        
+        return;
+    }
+    
+    executeOperands(symtab, result, true, OpNotEqual);
+}
+
 bool dish::NotEqualOpParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
 {
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::NotEqualOpParseTreeNode::Hash() const
+{
+    return hash(ptnNotEqualOp);
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::NotEqualOpParseTreeNode::Copy() const
+{
+    return MakeShared< NotEqualOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) NotEqualOpParseTreeNode(*this); });
+}
+
+void dish::NotEqualOpParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    write(writer, ptnNotEqualOp);
+}
+
 void dish::NotEqualOpParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -3106,6 +4816,15 @@ std::shared_ptr< dish::iAtomic > dish::GreaterThanEqualOpParseTreeNode::Execute(
 
 std::shared_ptr< dish::iAtomic > dish::GreaterThanEqualOpParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
+    if(!mGeneric)
+    {
+        ValueHandle result;
+        
+        ExecuteOperand(symtab, result);
+        
+        return result.Box();
+    }
+    
     try
     {
         return OpGreaterThanOrEqual(mOpr1->Execute(symtab), mOpr2->Execute(symtab));
@@ -3122,11 +4841,38 @@ std::shared_ptr< dish::iAtomic > dish::GreaterThanEqualOpParseTreeNode::Execute(
     }
 }
 
+void dish::GreaterThanEqualOpParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &result)
+{
+    if(mGeneric)
+    {
+        result.Set(Execute(symtab));
+        
+        return;
+    }
+    
+    executeOperands(symtab, result, true, OpGreaterThanOrEqual);
+}
+
 bool dish::GreaterThanEqualOpParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
 {
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::GreaterThanEqualOpParseTreeNode::Hash() const
+{
+    return hash(ptnGreaterThanEqualOp);
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::GreaterThanEqualOpParseTreeNode::Copy() const
+{
+    return MakeShared< GreaterThanEqualOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) GreaterThanEqualOpParseTreeNode(*this); });
+}
+
+void dish::GreaterThanEqualOpParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    write(writer, ptnGreaterThanEqualOp);
+}
+
 void dish::GreaterThanEqualOpParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -3172,6 +4918,15 @@ std::shared_ptr< dish::iAtomic > dish::GreaterThanOpParseTreeNode::Execute()
 
 std::shared_ptr< dish::iAtomic > dish::GreaterThanOpParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
+    if(!mGeneric)
+    {
+        ValueHandle result;
+        
+        ExecuteOperand(symtab, result);
+        
+        return result.Box();
+    }
+    
     try
     {
         return OpGreaterThan(mOpr1->Execute(symtab), mOpr2->Execute(symtab));
@@ -3188,11 +4943,38 @@ std::shared_ptr< dish::iAtomic > dish::GreaterThanOpParseTreeNode::Execute(dish:
     }
 }
 
+void dish::GreaterThanOpParseTreeNode::ExecuteOperand(dish::LanguageSymbolTable &symtab, dish::ValueHandle &result)
+{
+    if(mGeneric)
+    {
+        result.Set(Execute(symtab));
+        
+        return;
+    }
+    
+    executeOperands(symtab, result, true, OpGreaterThan);
+}
+
 bool dish::GreaterThanOpParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
 {
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::GreaterThanOpParseTreeNode::Hash() const
+{
+    return hash(ptnGreaterThanOp);
+}
+
+std::shared_ptr< dish::iParseTreeNode > dish::GreaterThanOpParseTreeNode::Copy() const
+{
+    return MakeShared< GreaterThanOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) GreaterThanOpParseTreeNode(*this); });
+}
+
+void dish::GreaterThanOpParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    write(writer, ptnGreaterThanOp);
+}
+
 void dish::GreaterThanOpParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -3249,43 +5031,177 @@ std::shared_ptr< dish::iAtomic > dish::StatementBlockParseTreeNode::Execute(dish
 {
     ScopedScope scope(symtab);
 
+    for(StatementBlockT::const_iterator i(mBlock.begin()), last_i(mBlock.end()); (i != last_i) && !symtab.IsReturning(); ++i)
+    {
+        (*i)->Execute(symtab);
+    }
+    
+    return NullValue::MakeValue();
+}
+
+void dish::StatementBlockParseTreeNode::Validate(LanguageSymbolTable &symtab) const
+{
+    ScopedScope scope(symtab);
+
+    std::for_each(
+        mBlock.begin(), mBlock.end(),
+        [&](const StatementBlockT::value_type &statement)
+        {
+            statement->Validate(symtab);
+        }
+    );
+}
+
+bool dish::StatementBlockParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
+{
+    return ptn.isEqual(*this);
+}
+
+std::size_t dish::StatementBlockParseTreeNode::Hash() const
+{
+    std::size_t hash(ptnStatementBlock);
+    
+    for(StatementBlockT::const_iterator i(mBlock.begin()), last_i(mBlock.end()); i != last_i; ++i)
+    {
+        hash = combineHash(hash, (*i)->Hash());
+    }
+    
+    return hash;
+}
+
+void dish::StatementBlockParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    for(StatementBlockT::iterator i(mBlock.begin()), last_i(mBlock.end()); i != last_i; ++i)
+    {
+        children.push_back(&(*i));
+    }
+}
+
+void dish::StatementBlockParseTreeNode::ChildrenReplaced()
+{
+    mBlock.erase(std::remove(mBlock.begin(), mBlock.end(), std::shared_ptr< iParseTreeNode >()), mBlock.end());
+}
+
+void dish::StatementBlockParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnStatementBlock, *this);
+    
+    writer.Write(static_cast< std::int32_t >(mBlock.size()));
+    for(StatementBlockT::const_iterator i(mBlock.begin()), last_i(mBlock.end()); i != last_i; ++i)
+    {
+        writer.Write(*i);
+    }
+}
+
+void dish::StatementBlockParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
+{
+    printIndent(out, indent);
+    out << "PTN: block" << std::endl;
+    
     std::for_each(
         mBlock.begin(), mBlock.end(),
         [&](const StatementBlockT::value_type &statement)
         {
-            statement->Execute(symtab);
+            statement->Print(out, indent + 4);
+            out << std::endl;
         }
     );
     
+    printIndent(out, indent);
+    out << "end";
+}
+
+/******************************************************************************
+
+    dish::ModuleParseTreeNode class definitions
+
+ ******************************************************************************/
+ 
+dish::IntegerT dish::ModuleParseTreeNode::Count(0);
+dish::IntegerT dish::ModuleParseTreeNode::Instances(0);
+
+bool dish::ModuleParseTreeNode::isEqual(const dish::ModuleParseTreeNode &ptn) const
+{
+    return (
+        (mName == ptn.mName) &&
+        (mEntryPoint == ptn.mEntryPoint) &&
+        (mStatements.size() == ptn.mStatements.size()) &&
+        std::equal(
+            mStatements.begin(), mStatements.end(), ptn.mStatements.begin(),
+            [](const StatementListT::value_type &lhs, const StatementListT::value_type &rhs)
+            {
+                return lhs->IsEqual(*rhs);
+            }
+        )
+    );
+}
+
+std::shared_ptr< dish::iAtomic > dish::ModuleParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
+{
+    for(StatementListT::const_iterator i(mStatements.begin()), last_i(mStatements.end()); (i != last_i) && !symtab.IsReturning(); ++i)
+    {
+        (*i)->Execute(symtab);
+    }
+    
     return NullValue::MakeValue();
 }
 
-void dish::StatementBlockParseTreeNode::Validate(LanguageSymbolTable &symtab) const
+void dish::ModuleParseTreeNode::Validate(LanguageSymbolTable &symtab) const
 {
-    ScopedScope scope(symtab);
-
     std::for_each(
-        mBlock.begin(), mBlock.end(),
-        [&](const StatementBlockT::value_type &statement)
+        mStatements.begin(), mStatements.end(),
+        [&](const StatementListT::value_type &statement)
         {
             statement->Validate(symtab);
         }
     );
 }
 
-bool dish::StatementBlockParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
+bool dish::ModuleParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
 {
     return ptn.isEqual(*this);
 }
 
-void dish::StatementBlockParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
+std::size_t dish::ModuleParseTreeNode::Hash() const
+{
+    std::size_t hash(combineHash(combineHash(ptnStatementBlock, std::hash< std::string >()(mName)), mEntryPoint ? 1 : 0));
+    
+    for(StatementListT::const_iterator i(mStatements.begin()), last_i(mStatements.end()); i != last_i; ++i)
+    {
+        hash = combineHash(hash, (*i)->Hash());
+    }
+    
+    return hash;
+}
+
+void dish::ModuleParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    for(StatementListT::iterator i(mStatements.begin()), last_i(mStatements.end()); i != last_i; ++i)
+    {
+        children.push_back(&(*i));
+    }
+}
+
+void dish::ModuleParseTreeNode::ChildrenReplaced()
+{
+    mStatements.erase(std::remove(mStatements.begin(), mStatements.end(), std::shared_ptr< iParseTreeNode >()), mStatements.end());
+}
+
+void dish::ModuleParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    //  Imported files are cached by name, as statements of the file importing
+    //  them; see ParseTreeWriter::WriteModule().
+    throw ParseTreeCacheException(LocationString(), "Only files imported at the top level of a file can be written to a parse-tree cache.");
+}
+
+void dish::ModuleParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
-    out << "PTN: block" << std::endl;
+    out << "PTN: module \"" << mName << "\"" << std::endl;
     
     std::for_each(
-        mBlock.begin(), mBlock.end(),
-        [&](const StatementBlockT::value_type &statement)
+        mStatements.begin(), mStatements.end(),
+        [&](const StatementListT::value_type &statement)
         {
             statement->Print(out, indent + 4);
             out << std::endl;
@@ -3326,7 +5242,7 @@ bool dish::IfStatementParseTreeNode::isEqual(const dish::IfStatementParseTreeNod
 
 std::shared_ptr< dish::iAtomic > dish::IfStatementParseTreeNode::Execute(LanguageSymbolTable &symtab)
 {
-    if(mCondition->Execute(symtab)->AsBoolean())
+    if(isTrue(symtab, *mCondition))
     {
         return mIfBlock->Execute(symtab);
     }
@@ -3355,6 +5271,37 @@ bool dish::IfStatementParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) co
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::IfStatementParseTreeNode::Hash() const
+{
+    std::size_t hash(combineHash(combineHash(ptnIfStatement, mCondition->Hash()), mIfBlock->Hash()));
+    
+    if(0 != mElseBlock.get())
+    {
+        hash = combineHash(hash, mElseBlock->Hash());
+    }
+    
+    return hash;
+}
+
+void dish::IfStatementParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    children.push_back(&mCondition);
+    children.push_back(&mIfBlock);
+    
+    if(mElseBlock)
+    {
+        children.push_back(&mElseBlock);
+    }
+}
+
+void dish::IfStatementParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnIfStatement, *this);
+    writer.Write(mCondition);
+    writer.Write(mIfBlock);
+    writer.Write(mElseBlock);
+}
+
 void dish::IfStatementParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -3486,6 +5433,54 @@ bool dish::SwitchStatementParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::SwitchStatementParseTreeNode::Hash() const
+{
+    std::size_t hash(combineHash(ptnSwitchStatement, mExpression->Hash()));
+    
+    for(SwitchStatementT::const_iterator i(mSwitch.begin()), last_i(mSwitch.end()); i != last_i; ++i)
+    {
+        hash = combineHash(combineHash(hash, i->first->Hash()), i->second->Hash());
+    }
+    
+    if(0 != mOtherwise.get())
+    {
+        hash = combineHash(hash, mOtherwise->Hash());
+    }
+    
+    return hash;
+}
+
+void dish::SwitchStatementParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    children.push_back(&mExpression);
+    
+    for(SwitchStatementT::iterator i(mSwitch.begin()), last_i(mSwitch.end()); i != last_i; ++i)
+    {
+        children.push_back(&(i->first));
+        children.push_back(&(i->second));
+    }
+    
+    if(mOtherwise)
+    {
+        children.push_back(&mOtherwise);
+    }
+}
+
+void dish::SwitchStatementParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnSwitchStatement, *this);
+    writer.Write(mExpression);
+    
+    writer.Write(static_cast< std::int32_t >(mSwitch.size()));
+    for(SwitchStatementT::const_iterator i(mSwitch.begin()), last_i(mSwitch.end()); i != last_i; ++i)
+    {
+        writer.Write(i->first);
+        writer.Write(i->second);
+    }
+    
+    writer.Write(mOtherwise);
+}
+
 void dish::SwitchStatementParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -3530,7 +5525,13 @@ void dish::SwitchStatementParseTreeNode::Print(std::ostream &out, const std::str
 std::shared_ptr< dish::iAtomic > dish::ForLoopParseTreeNode::StepF::Execute(dish::LanguageSymbolTable &symtab)
 {
     std::shared_ptr< iAtomic > lhs(mLeftHandSide->Execute(symtab));
-    lhs->Assign(OpAdd(lhs, mStep->Execute(symtab)));
+    
+    ValueHandle value(lhs);
+    ValueHandle step;
+    
+    mStep->ExecuteOperand(symtab, step);
+    OpAdd(value, step);
+    value.AssignTo(*lhs);
     
     return NullValue::MakeValue();
 }
@@ -3555,6 +5556,95 @@ std::shared_ptr< dish::iParseTreeNode > dish::ForLoopParseTreeNode::OneLit(Liter
  
 dish::IntegerT dish::ForLoopParseTreeNode::Count(0);
 dish::IntegerT dish::ForLoopParseTreeNode::Instances(0);
+dish::IntegerT dish::ForLoopParseTreeNode::CountedIterations(0);
+
+void dish::ForLoopParseTreeNode::executeCounted(dish::LanguageSymbolTable &symtab, std::shared_ptr< dish::iAtomic > variable)
+{
+    const std::shared_ptr< iParseTreeNode > &step(mIncrement->mStep);
+    
+    if(mTo->IsLiteral() && step->IsLiteral() && (typeid(IntegerValue) == typeid(*variable)))
+    {
+        ValueHandle to;
+        ValueHandle by;
+        
+        mTo->ExecuteOperand(symtab, to);
+        step->ExecuteOperand(symtab, by);
+        
+        if(to.IsInteger() && by.IsInteger())
+        {
+            //  Neither bound changes, so the counter is kept here and only
+            //  written to the variable. It is read back after the body in
+            //  case the body assigned the variable.
+            const IntegerT last(to.AsInteger());
+            const IntegerT increment(by.AsInteger());
+            
+            for(IntegerT counter(variable->AsInteger()); counter != last; ++CountedIterations)
+            {
+                mBody->Execute(symtab);
+                
+                if(symtab.IsReturning())
+                {
+                    return;
+                }
+                
+                counter = variable->AsInteger() + increment;
+                variable->Assign(counter);
+            }
+            
+            mBody->Execute(symtab);
+            
+            return;
+        }
+    }
+    
+    //  The bounds are evaluated on every iteration, as the condition and
+    //  the increment would, but the variable is not looked up again.
+    while(true)
+    {
+        ValueHandle condition(variable);
+        
+        try
+        {
+            ValueHandle to;
+            
+            mTo->ExecuteOperand(symtab, to);
+            OpNotEqual(condition, to);
+        }
+        
+        catch(DishException &e)
+        {
+            if(!e.IsLocationSupplied())
+            {
+                e.AddLocation(LocationString());
+            }
+            
+            throw;
+        }
+        
+        if(!condition.AsBoolean())
+        {
+            break;
+        }
+        
+        mBody->Execute(symtab);
+        
+        if(symtab.IsReturning())
+        {
+            return;
+        }
+        
+        ValueHandle value(variable);
+        ValueHandle by;
+        
+        step->ExecuteOperand(symtab, by);
+        OpAdd(value, by);
+        value.AssignTo(*variable);
+        
+        ++CountedIterations;
+    }
+    
+    mBody->Execute(symtab);
+}
 
 bool dish::ForLoopParseTreeNode::isEqual(const dish::ForLoopParseTreeNode &ptn) const
 {
@@ -3571,9 +5661,21 @@ bool dish::ForLoopParseTreeNode::isEqual(const dish::ForLoopParseTreeNode &ptn)
 
 std::shared_ptr< dish::iAtomic > dish::ForLoopParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
-    for(mAssign->Execute(symtab); mCondition->Execute(symtab)->AsBoolean(); mIncrement->Execute(symtab))
+    if(mCounted)
+    {
+        executeCounted(symtab, mAssign->Execute(symtab));
+        
+        return NullValue::MakeValue();
+    }
+    
+    for(mAssign->Execute(symtab); isTrue(symtab, *mCondition); mIncrement->Execute(symtab))
     {
         mBody->Execute(symtab);
+        
+        if(symtab.IsReturning())
+        {
+            return NullValue::MakeValue();
+        }
     }
     
     mBody->Execute(symtab);
@@ -3595,6 +5697,54 @@ bool dish::ForLoopParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::ForLoopParseTreeNode::Hash() const
+{
+    std::size_t hash(combineHash(combineHash(ptnForLoop, mAssign->Hash()), mCondition->Hash()));
+    
+    hash = combineHash(combineHash(hash, mIncrement->mLeftHandSide->Hash()), mIncrement->mStep->Hash());
+    
+    return combineHash(hash, mBody->Hash());
+}
+
+void dish::ForLoopParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    //  The condition is made of the variable and the final value, so it is
+    //  rebuilt from them rather than being optimized on its own.
+    mAssign->Children(children);
+    children.push_back(&mTo);
+    children.push_back(&(mIncrement->mStep));
+    children.push_back(&mBody);
+}
+
+void dish::ForLoopParseTreeNode::ChildrenReplaced()
+{
+    mAssign->ChildrenReplaced();
+    
+    std::shared_ptr< iParseTreeNode > &id(mIncrement->mLeftHandSide);
+    mCondition = (SourceLocationTable::NO_LOCATION == Location()) ? NotEqualOpParseTreeNode::MakeValue(id, mTo) : NotEqualOpParseTreeNode::MakeValue(Location(), id, mTo);
+}
+
+void dish::ForLoopParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    //  The loop is written as it was parsed: the variable, its bounds and the
+    //  step, if one was given, from which the loop's own nodes are rebuilt.
+    const AssignmentParseTreeNode &assign(static_cast< const AssignmentParseTreeNode & >(*mAssign));
+    const bool stepped(OneLit != mIncrement->mStep);
+    
+    writer.Begin(ptnForLoop, *this);
+    writer.Write(assign.LeftHandSide());
+    writer.Write(assign.RightHandSide());
+    writer.Write(mTo);
+    writer.Write(stepped);
+    
+    if(stepped)
+    {
+        writer.Write(mIncrement->mStep);
+    }
+    
+    writer.Write(mBody);
+}
+
 void dish::ForLoopParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -3636,41 +5786,99 @@ std::shared_ptr< dish::iAtomic > dish::ForEachLoopParseTreeNode::Execute(dish::L
     {
         case iAtomic::typeArray:
         {
+            //  The scope of the loop is bound to each element in turn, and a
+            //  new one made only if the body has held on to the last.
+            std::shared_ptr< SingleSymbolTable > table;
+            
             const IntegerT last_i(collection->Member("finish")->AsInteger());
             for(IntegerT i(collection->Member("start")->AsInteger()); i <= last_i; ++i)
             {
-                std::shared_ptr< iAtomic > element(collection->Element(i));
-                ScopedScope scope(symtab, SingleSymbolTable::MakeValue(mId, mReference ? element : element->Clone()));
+                std::shared_ptr< iAtomic > element(mReference ? collection->Element(i) : collection->InspectElement(i));
+                
+                //  An element of a packed array is inspected as a value of its
+                //  own, which needs no copy.
+                if(!mReference && (element.use_count() > 1))
+                {
+                    element = element->Clone();
+                }
+                
+                if((0 == table.get()) || (table.use_count() > 1))
+                {
+                    table = SingleSymbolTable::MakeValue(mId, element);
+                }
+                else
+                {
+                    table->Bind(element);
+                }
+                
+                ScopedScope scope(symtab, table);
                 
                 mBody->Execute(symtab);
+                
+                if(symtab.IsReturning())
+                {
+                    return NullValue::MakeValue();
+                }
             }
         } break;
         
         case iAtomic::typeDictionary:
         {
-            std::shared_ptr< iAtomic > keys(collection->Keys());
+            //  The cursor holds the keys as they were when the loop started,
+            //  so the body may add to the dictionary as before.
+            iAtomic::CursorT cursor;
             
-            const IntegerT last_i(keys->Member("finish")->AsInteger());
-            for(IntegerT i(keys->Member("start")->AsInteger()); i <= last_i; ++i)
+            //  The structure of the key and value of the entry, and the scope
+            //  of the loop, are bound to each entry in turn. A new binding is
+            //  made only if the body has held on to part of the last; each of
+            //  the parts below is otherwise held once more, by the binding.
+            std::shared_ptr< EntryKeyValue > key;
+            std::shared_ptr< iAtomic > value;
+            std::shared_ptr< StructureValue > element;
+            std::shared_ptr< SingleSymbolTable > table;
+            
+            for(bool more(collection->FirstEntry(cursor)); more; more = collection->NextEntry(cursor))
             {
-                std::shared_ptr< iAtomic > key(ReferenceValue::MakeValue(keys->Element(i)));
-                std::shared_ptr< iAtomic > value(ReferenceValue::MakeValue(collection->Lookup(key->AsString())));
+                const bool rebind((0 != table.get()) && (1 == table.use_count()) && (2 == element.use_count()) && !element->IsLocked() && (2 == key.use_count()) && (mReference || (2 == value.use_count())));
+                
+                if(!rebind)
+                {
+                    key = EntryKeyValue::MakeValue(LOCKED);
+                    value.reset();
+                }
+                
+                key->Bind(cursor.Key());
                 
-                std::shared_ptr< StructureValue > element(StructureValue::MakeValue());
                 if(mReference)
                 {
-                    element->Add("key", key);
-                    element->Add("value", value);
+                    value = collection->EntryValue(cursor);
+                }
+                else
+                {
+                    collection->CopyEntryValue(cursor, value);
+                }
+                
+                if(rebind)
+                {
+                    element->Bind("value", value);
                 }
                 else
                 {
-                    element->Add("key", key->Clone());
-                    element->Add("value", value->Clone());
+                    element = StructureValue::MakeValue();
+                    element->Add("key", key);
+                    element->Add("value", value);
+                    
+                    table = SingleSymbolTable::MakeValue(mId, element);
                 }
                 
-                ScopedScope scope(symtab, SingleSymbolTable::MakeValue(mId, element));
+                ScopedScope scope(symtab, table);
                 
                 mBody->Execute(symtab);
+                
+                if(symtab.IsReturning())
+                {
+                    return NullValue::MakeValue();
+                }
             }
         } break;
         
@@ -3700,6 +5908,45 @@ bool dish::ForEachLoopParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) co
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::ForEachLoopParseTreeNode::Hash() const
+{
+    std::size_t hash(combineHash(combineHash(ptnForEachLoop, mReference ? 1 : 0), std::hash< std::string >()(mId)));
+    
+    return combineHash(combineHash(hash, mCollection->Hash()), mBody->Hash());
+}
+
+void dish::ForEachLoopParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    //  Looping by reference modifies the elements of the collection itself.
+    if(mReference)
+    {
+        mCollection->AssignableChildren(children);
+    }
+    else
+    {
+        children.push_back(&mCollection);
+    }
+    
+    children.push_back(&mBody);
+}
+
+void dish::ForEachLoopParseTreeNode::ChildrenReplaced()
+{
+    if(mReference)
+    {
+        mCollection->ChildrenReplaced();
+    }
+}
+
+void dish::ForEachLoopParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnForEachLoop, *this);
+    writer.Write(mReference);
+    writer.Write(mId);
+    writer.Write(mCollection);
+    writer.Write(mBody);
+}
+
 void dish::ForEachLoopParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -3734,9 +5981,14 @@ bool dish::WhileLoopParseTreeNode::isEqual(const dish::WhileLoopParseTreeNode &p
 
 std::shared_ptr< dish::iAtomic > dish::WhileLoopParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
-    while(mCondition->Execute(symtab)->AsBoolean())
+    while(isTrue(symtab, *mCondition))
     {
         mBody->Execute(symtab);
+        
+        if(symtab.IsReturning())
+        {
+            break;
+        }
     }
     
     return NullValue::MakeValue(); 
@@ -3753,6 +6005,24 @@ bool dish::WhileLoopParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) cons
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::WhileLoopParseTreeNode::Hash() const
+{
+    return combineHash(combineHash(ptnWhileLoop, mCondition->Hash()), mBody->Hash());
+}
+
+void dish::WhileLoopParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    children.push_back(&mCondition);
+    children.push_back(&mBody);
+}
+
+void dish::WhileLoopParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnWhileLoop, *this);
+    writer.Write(mCondition);
+    writer.Write(mBody);
+}
+
 void dish::WhileLoopParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -3812,14 +6082,16 @@ std::shared_ptr< dish::iAtomic > dish::RepeatUntilLoopParseTreeNode::Execute(dis
 {
     do
     {
-        std::for_each(
-            mBody.begin(), mBody.end(),
-            [&](BodyT::value_type &line)
+        for(BodyT::const_iterator i(mBody.begin()), last_i(mBody.end()); i != last_i; ++i)
+        {
+            (*i)->Execute(symtab);
+            
+            if(symtab.IsReturning())
             {
-                line->Execute(symtab);
+                return NullValue::MakeValue();
             }
-        );
-    } while(!mCondition->Execute(symtab)->AsBoolean());
+        }
+    } while(!isTrue(symtab, *mCondition));
     
     return NullValue::MakeValue(); 
 }
@@ -3842,6 +6114,46 @@ bool dish::RepeatUntilLoopParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::RepeatUntilLoopParseTreeNode::Hash() const
+{
+    std::size_t hash(combineHash(ptnRepeatUntilLoop, mCondition->Hash()));
+    
+    for(BodyT::const_iterator i(mBody.begin()), last_i(mBody.end()); i != last_i; ++i)
+    {
+        hash = combineHash(hash, (*i)->Hash());
+    }
+    
+    return hash;
+}
+
+void dish::RepeatUntilLoopParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    for(BodyT::iterator i(mBody.begin()), last_i(mBody.end()); i != last_i; ++i)
+    {
+        children.push_back(&(*i));
+    }
+    
+    children.push_back(&mCondition);
+}
+
+void dish::RepeatUntilLoopParseTreeNode::ChildrenReplaced()
+{
+    mBody.erase(std::remove(mBody.begin(), mBody.end(), std::shared_ptr< iParseTreeNode >()), mBody.end());
+}
+
+void dish::RepeatUntilLoopParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnRepeatUntilLoop, *this);
+    
+    writer.Write(static_cast< std::int32_t >(mBody.size()));
+    for(BodyT::const_iterator i(mBody.begin()), last_i(mBody.end()); i != last_i; ++i)
+    {
+        writer.Write(*i);
+    }
+    
+    writer.Write(mCondition);
+}
+
 void dish::RepeatUntilLoopParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -3878,7 +6190,7 @@ bool dish::AssertParseTreeNode::isEqual(const dish::AssertParseTreeNode &ptn) co
 
 std::shared_ptr< dish::iAtomic > dish::AssertParseTreeNode::Execute(dish::LanguageSymbolTable &symtab)
 {
-    if(!mCondition->Execute(symtab)->AsBoolean())
+    if(!isTrue(symtab, *mCondition))
     {
         std::stringstream message;
         message << "Assert failed: ";
@@ -3901,6 +6213,22 @@ bool dish::AssertParseTreeNode::IsEqual(const dish::iParseTreeNode &ptn) const
     return ptn.isEqual(*this);
 }
 
+std::size_t dish::AssertParseTreeNode::Hash() const
+{
+    return combineHash(ptnAssert, mCondition->Hash());
+}
+
+void dish::AssertParseTreeNode::Children(dish::iParseTreeNode::ChildListT &children)
+{
+    children.push_back(&mCondition);
+}
+
+void dish::AssertParseTreeNode::Write(dish::ParseTreeWriter &writer) const
+{
+    writer.Begin(ptnAssert, *this);
+    writer.Write(mCondition);
+}
+
 void dish::AssertParseTreeNode::Print(std::ostream &out, const std::string::size_type &indent) const
 {
     printIndent(out, indent);
@@ -4008,6 +6336,10 @@ void dish::PrintParseTreeStatistics(std::ostream &out)
     live_nodes += dish::FunctionCallParseTreeNode::NumLiveInstances();
     total_nodes += dish::FunctionCallParseTreeNode::NumInstances();
     
+    out << " Inlined Parameter PTN: " << dish::InlinedParameterParseTreeNode::NumLiveInstances() << " / " << dish::InlinedParameterParseTreeNode::NumInstances() << std::endl;
+    live_nodes += dish::InlinedParameterParseTreeNode::NumLiveInstances();
+    total_nodes += dish::InlinedParameterParseTreeNode::NumInstances();
+    
     out << "            Return PTN: " << dish::ReturnParseTreeNode::NumLiveInstances() << " / " << dish::ReturnParseTreeNode::NumInstances() << std::endl;
     live_nodes += dish::ReturnParseTreeNode::NumLiveInstances();
     total_nodes += dish::ReturnParseTreeNode::NumInstances();
@@ -4095,6 +6427,9 @@ void dish::PrintParseTreeStatistics(std::ostream &out)
     out << "   Statement Block PTN: " << dish::StatementBlockParseTreeNode::NumLiveInstances() << " / " << dish::StatementBlockParseTreeNode::NumInstances() << std::endl;
     live_nodes += dish::StatementBlockParseTreeNode::NumLiveInstances();
     total_nodes += dish::StatementBlockParseTreeNode::NumInstances();
+    out << "             Module PTN: " << dish::ModuleParseTreeNode::NumLiveInstances() << " / " << dish::ModuleParseTreeNode::NumInstances() << std::endl;
+    live_nodes += dish::ModuleParseTreeNode::NumLiveInstances();
+    total_nodes += dish::ModuleParseTreeNode::NumInstances();
     
     out << std::endl;
     
@@ -4135,5 +6470,6 @@ void dish::PrintParseTreeStatistics(std::ostream &out)
     out << "                       ----------" << std::endl;
     out << "                  Live: " << live_nodes << std::endl;
     out << "                 Total: " << total_nodes << std::endl;
+    out << "            Bytes Live: " << dish::ParseTreeArena::NumBytesInUse() << " / " << dish::ParseTreeArena::NumBytesReserved() << std::endl;
 }
 
@@ -35,12 +35,14 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <typeinfo>
 #include <vector>
 
 #include "atomics.h"
 #include "inline.h"
 #include "input.h"
 #include "language.h"
+#include "ptcache.h"
 #include "types.h"
 #include "utility.h"
 
@@ -80,6 +82,7 @@ namespace dish
     class IndexParseTreeNode;
     class MemberParseTreeNode;
     
+    class InlinedParameterParseTreeNode;
     class FunctionCallParseTreeNode;
     
     class ReturnParseTreeNode;
@@ -105,6 +108,7 @@ namespace dish
     class GreaterThanOpParseTreeNode;
     
     class StatementBlockParseTreeNode;
+    class ModuleParseTreeNode;
     
     class IfStatementParseTreeNode;
     class SwitchStatementParseTreeNode;
@@ -118,6 +122,48 @@ namespace dish
 
     ////////////////////////////////////////////////////////////////////////////
     
+    //  The memory of the parse-tree nodes. Nodes are carved in the order they
+    //  are made from large blocks, so that a tree, and the nodes evaluated one
+    //  after another, lie together rather than scattered over the heap. The
+    //  memory of a node released is kept for the next node of the same size.
+    //  Blocks are never returned, so a node may be released at any time, even
+    //  by the destructor of a static as the program exits.
+    class ParseTreeArena
+    {
+        private:
+            static const std::size_t ALIGNMENT = 16;
+            static const std::size_t BLOCK_SIZE = 64 * 1024;
+            static const std::size_t MAX_NODE_SIZE = 1024;
+            
+            using FreeNodeT = struct FreeNode
+            {
+                FreeNode *Next;
+            };
+            
+            static char *Next;
+            static char *End;
+            static FreeNodeT *FreeLists[MAX_NODE_SIZE / ALIGNMENT];
+            
+            static IntegerT BytesReserved;
+            static IntegerT BytesInUse;
+            
+            static INLINE std::size_t sizeClass(const std::size_t &nbytes) throw() { return ((nbytes + ALIGNMENT - 1) / ALIGNMENT); };
+            
+            static void *allocateFromBlock(const std::size_t &nbytes);
+        
+        public:
+            static void *Allocate(const std::size_t &nbytes);
+            static void Release(void *node, const std::size_t &nbytes);
+            
+            //  The bytes taken from the heap for nodes, and the bytes of the
+            //  nodes alive.
+            static INLINE const IntegerT &NumBytesReserved() throw() { return BytesReserved; };
+            static INLINE const IntegerT &NumBytesInUse() throw() { return BytesInUse; };
+        
+    };
+    
+    ////////////////////////////////////////////////////////////////////////////
+    
     class iParseTreeNode : public iPrintable
     {
         friend NullParseTreeNode;
@@ -176,6 +222,7 @@ namespace dish
         friend GreaterThanOpParseTreeNode;
     
         friend StatementBlockParseTreeNode;
+        friend ModuleParseTreeNode;
     
         friend IfStatementParseTreeNode;
         friend SwitchStatementParseTreeNode;
@@ -244,6 +291,7 @@ namespace dish
             virtual bool isEqual(const GreaterThanOpParseTreeNode &ptn) const = 0;
     
             virtual bool isEqual(const StatementBlockParseTreeNode &ptn) const = 0;
+            virtual bool isEqual(const ModuleParseTreeNode &ptn) const = 0;
     
             virtual bool isEqual(const IfStatementParseTreeNode &ptn) const = 0;
             virtual bool isEqual(const SwitchStatementParseTreeNode &ptn) const = 0;
@@ -256,31 +304,85 @@ namespace dish
             virtual bool isEqual(const AssertParseTreeNode &ptn) const = 0;
     
         public:
+        
+            using ChildListT = std::vector< std::shared_ptr< iParseTreeNode > * >;
+            
             virtual ~iParseTreeNode() {};
             
-            virtual const std::string &LocationString() const = 0;
+            //  The location of the node in its source, formatted; empty if
+            //  locations are suppressed.
+            virtual const SourceLocationT &Location() const = 0;
+            virtual std::string LocationString() const = 0;
             
             virtual bool IsLiteral() const = 0;
             
             virtual std::shared_ptr< iAtomic > Execute() = 0;
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab) = 0;
             
+            //  Evaluates the node as the operand of an operator or as a
+            //  condition; the value is that of Execute(), but need not be boxed.
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr) = 0;
+            
+            //  Evaluates the node for reading only; the value is that of
+            //  Execute(), but may still be shared with copies of the aggregate
+            //  holding it, so the caller must neither modify nor keep it.
+            virtual std::shared_ptr< iAtomic > Inspect(LanguageSymbolTable &symtab) = 0;
+            
             virtual void Validate(LanguageSymbolTable &symtab) const = 0;
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const = 0;
             
+            //  A hash of the kind of the node and of what IsEqual() compares,
+            //  so that nodes which are equal hash alike; the parser finds the
+            //  nodes it can share through it.
+            virtual std::size_t Hash() const = 0;
+            
             virtual const std::string &ToString() const = 0;
+            
+            //  Appends the addresses of the node's children to children, so
+            //  that the optimizer can replace them.
+            virtual void Children(ChildListT &children) = 0;
+            
+            //  As Children(), for a node which is assigned to or referenced and
+            //  so must keep referring to the same variable: only the children
+            //  which are evaluated for their value are appended.
+            virtual void AssignableChildren(ChildListT &children) = 0;
+            
+            //  Called once the optimizer has replaced any of the node's
+            //  children; an empty child is a statement to be removed.
+            virtual void ChildrenReplaced() = 0;
+            
+            //  Makes a copy of the node sharing its children, which the
+            //  optimizer may then replace; empty if the node cannot be copied.
+            virtual std::shared_ptr< iParseTreeNode > Copy() const = 0;
+            
+            //  Writes the node, and its children, to a parse-tree cache file;
+            //  see ParseTreeCache.
+            virtual void Write(ParseTreeWriter &writer) const = 0;
         
     };
     
     class ParseTreeNode : public iParseTreeNode
     {
         private:
-            const std::string mLocationString;
+            const SourceLocationT mLocation;
         
         protected:
-            INLINE ParseTreeNode() : iParseTreeNode(), mLocationString() {};
-            INLINE ParseTreeNode(const std::string &locstr) : iParseTreeNode(), mLocationString(locstr) {};
+            static IntegerT UnboxedOperations;
+            static IntegerT GenericFallbacks;
+            
+            //  Combines the hash of a part of a node into seed.
+            static INLINE std::size_t combineHash(const std::size_t &seed, const std::size_t &hash) throw() { return (seed ^ (hash + 0x9e3779b9 + (seed << 6) + (seed >> 2))); };
+            
+            //  The hash of a literal value, consistent with the comparison of
+            //  literal nodes.
+            static std::size_t hashValue(const iAtomic &value);
+            
+            //  Evaluates the condition of a statement without boxing its value.
+            static INLINE BooleanT isTrue(LanguageSymbolTable &symtab, iParseTreeNode &condition) { ValueHandle value; condition.ExecuteOperand(symtab, value); return value.AsBoolean(); };
+            
+            INLINE ParseTreeNode() : iParseTreeNode(), mLocation(SourceLocationTable::NO_LOCATION) {};
+            INLINE ParseTreeNode(const SourceLocationT &location) : iParseTreeNode(), mLocation(location) {};
             
             //  From iParseTreeNode
             
@@ -340,6 +442,7 @@ namespace dish
             virtual bool isEqual(const GreaterThanOpParseTreeNode &ptn) const;
     
             virtual bool isEqual(const StatementBlockParseTreeNode &ptn) const;
+            virtual bool isEqual(const ModuleParseTreeNode &ptn) const;
     
             virtual bool isEqual(const IfStatementParseTreeNode &ptn) const;
             virtual bool isEqual(const SwitchStatementParseTreeNode &ptn) const;
@@ -353,20 +456,41 @@ namespace dish
         
         public:
             
+            //  Nodes are allocated from the ParseTreeArena.
+            static INLINE void *operator new(std::size_t nbytes) { return ParseTreeArena::Allocate(nbytes); };
+            static INLINE void operator delete(void *node, std::size_t nbytes) { ParseTreeArena::Release(node, nbytes); };
+            
+            static INLINE const IntegerT &NumUnboxedOperations() throw() { return UnboxedOperations; };
+            static INLINE const IntegerT &NumGenericFallbacks() throw() { return GenericFallbacks; };
+            
             //  From iParseTreeNode
             
-            virtual const std::string &LocationString() const;
+            virtual const SourceLocationT &Location() const;
+            virtual std::string LocationString() const;
             
             virtual bool IsLiteral() const;
             
             virtual std::shared_ptr< iAtomic > Execute();
             
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            
+            virtual std::shared_ptr< iAtomic > Inspect(LanguageSymbolTable &symtab);
+            
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
             
             virtual const std::string &ToString() const;
             
+            virtual void Children(ChildListT &children);
+            virtual void AssignableChildren(ChildListT &children);
+            virtual void ChildrenReplaced();
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
+            
             //  From iPrintable
             
             virtual void Print(std::ostream &out, const std::string::size_type &indent = 0) const;
@@ -384,7 +508,7 @@ namespace dish
     
         protected:
             INLINE NullParseTreeNode() : ParseTreeNode() { ++Count; ++Instances; };
-            INLINE NullParseTreeNode(const std::string &locstr) : ParseTreeNode(locstr) { ++Count; ++Instances; };
+            INLINE NullParseTreeNode(const SourceLocationT &location) : ParseTreeNode(location) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
             
@@ -394,7 +518,7 @@ namespace dish
             virtual ~NullParseTreeNode() { --Instances; };
             
             static std::shared_ptr< NullParseTreeNode > MakeValue();
-            static INLINE std::shared_ptr< NullParseTreeNode > MakeValue(const std::string &locstr) { return std::shared_ptr< NullParseTreeNode >(new NullParseTreeNode(locstr)); };
+            static INLINE std::shared_ptr< NullParseTreeNode > MakeValue(const SourceLocationT &location) { return MakeShared< NullParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) NullParseTreeNode(location); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -404,6 +528,9 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -431,7 +558,7 @@ namespace dish
         public:
             virtual ~ReferenceParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< ReferenceParseTreeNode > MakeValue(std::shared_ptr< iAtomic > &ref) { return std::shared_ptr< ReferenceParseTreeNode >(new ReferenceParseTreeNode(ref)); };
+            static INLINE std::shared_ptr< ReferenceParseTreeNode > MakeValue(std::shared_ptr< iAtomic > &ref) { return MakeShared< ReferenceParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) ReferenceParseTreeNode(ref); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -443,6 +570,7 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
             
             //  From iPrintable
             
@@ -469,11 +597,11 @@ namespace dish
             INLINE explicit LiteralParseTreeNode(const RealT &value) : ParseTreeNode(), mLiteral(RealValue::MakeValue(value)) { assert(0 != mLiteral.get()); ++Count; ++Instances; };
             INLINE explicit LiteralParseTreeNode(const StringT &value) : ParseTreeNode(), mLiteral(StringValue::MakeValue(value)) { assert(0 != mLiteral.get()); ++Count; ++Instances; };
             
-            INLINE LiteralParseTreeNode(const std::string &locstr, std::shared_ptr< iAtomic > &value) : ParseTreeNode(locstr), mLiteral(value) { assert(0 != mLiteral.get()); ++Count; ++Instances; };
-            INLINE LiteralParseTreeNode(const std::string &locstr, const BooleanT &value) : ParseTreeNode(locstr), mLiteral(BooleanValue::MakeUnlockedValue(value)) { assert(0 != mLiteral.get()); ++Count; ++Instances; };
-            INLINE LiteralParseTreeNode(const std::string &locstr, const IntegerT &value) : ParseTreeNode(locstr), mLiteral(IntegerValue::MakeValue(value)) { assert(0 != mLiteral.get()); ++Count; ++Instances; };
-            INLINE LiteralParseTreeNode(const std::string &locstr, const RealT &value) : ParseTreeNode(locstr), mLiteral(RealValue::MakeValue(value)) { assert(0 != mLiteral.get()); ++Count; ++Instances; };
-            INLINE LiteralParseTreeNode(const std::string &locstr, const StringT &value) : ParseTreeNode(locstr), mLiteral(StringValue::MakeValue(value)) { assert(0 != mLiteral.get()); ++Count; ++Instances; };
+            INLINE LiteralParseTreeNode(const SourceLocationT &location, std::shared_ptr< iAtomic > &value) : ParseTreeNode(location), mLiteral(value) { assert(0 != mLiteral.get()); ++Count; ++Instances; };
+            INLINE LiteralParseTreeNode(const SourceLocationT &location, const BooleanT &value) : ParseTreeNode(location), mLiteral(BooleanValue::MakeUnlockedValue(value)) { assert(0 != mLiteral.get()); ++Count; ++Instances; };
+            INLINE LiteralParseTreeNode(const SourceLocationT &location, const IntegerT &value) : ParseTreeNode(location), mLiteral(IntegerValue::MakeValue(value)) { assert(0 != mLiteral.get()); ++Count; ++Instances; };
+            INLINE LiteralParseTreeNode(const SourceLocationT &location, const RealT &value) : ParseTreeNode(location), mLiteral(RealValue::MakeValue(value)) { assert(0 != mLiteral.get()); ++Count; ++Instances; };
+            INLINE LiteralParseTreeNode(const SourceLocationT &location, const StringT &value) : ParseTreeNode(location), mLiteral(StringValue::MakeValue(value)) { assert(0 != mLiteral.get()); ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -482,21 +610,23 @@ namespace dish
         public:
             virtual ~LiteralParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< LiteralParseTreeNode > MakeValue(std::shared_ptr< iAtomic > &value) { return std::shared_ptr< LiteralParseTreeNode >(new LiteralParseTreeNode(value)); };
+            static INLINE std::shared_ptr< LiteralParseTreeNode > MakeValue(std::shared_ptr< iAtomic > &value) { return MakeShared< LiteralParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LiteralParseTreeNode(value); }); };
             static std::shared_ptr< LiteralParseTreeNode > MakeValue(const BooleanT &value);
             static std::shared_ptr< LiteralParseTreeNode > MakeValue(const IntegerT &value);
             static std::shared_ptr< LiteralParseTreeNode > MakeValue(const RealT &value);
             static std::shared_ptr< LiteralParseTreeNode > MakeValue(const StringT &value);
             
-            static INLINE std::shared_ptr< LiteralParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iAtomic > &value) { return std::shared_ptr< LiteralParseTreeNode >(new LiteralParseTreeNode(locstr, value)); };
-            static INLINE std::shared_ptr< LiteralParseTreeNode > MakeValue(const std::string &locstr, const BooleanT &value) { return std::shared_ptr< LiteralParseTreeNode >(new LiteralParseTreeNode(locstr, value)); };
-            static INLINE std::shared_ptr< LiteralParseTreeNode > MakeValue(const std::string &locstr, const IntegerT &value) { return std::shared_ptr< LiteralParseTreeNode >(new LiteralParseTreeNode(locstr, value)); };
-            static INLINE std::shared_ptr< LiteralParseTreeNode > MakeValue(const std::string &locstr, const RealT &value) { return std::shared_ptr< LiteralParseTreeNode >(new LiteralParseTreeNode(locstr, value)); };
-            static INLINE std::shared_ptr< LiteralParseTreeNode > MakeValue(const std::string &locstr, const StringT &value) { return std::shared_ptr< LiteralParseTreeNode >(new LiteralParseTreeNode(locstr, value)); };
+            static INLINE std::shared_ptr< LiteralParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iAtomic > &value) { return MakeShared< LiteralParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LiteralParseTreeNode(location, value); }); };
+            static INLINE std::shared_ptr< LiteralParseTreeNode > MakeValue(const SourceLocationT &location, const BooleanT &value) { return MakeShared< LiteralParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LiteralParseTreeNode(location, value); }); };
+            static INLINE std::shared_ptr< LiteralParseTreeNode > MakeValue(const SourceLocationT &location, const IntegerT &value) { return MakeShared< LiteralParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LiteralParseTreeNode(location, value); }); };
+            static INLINE std::shared_ptr< LiteralParseTreeNode > MakeValue(const SourceLocationT &location, const RealT &value) { return MakeShared< LiteralParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LiteralParseTreeNode(location, value); }); };
+            static INLINE std::shared_ptr< LiteralParseTreeNode > MakeValue(const SourceLocationT &location, const StringT &value) { return MakeShared< LiteralParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LiteralParseTreeNode(location, value); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
             
+            INLINE const std::shared_ptr< iAtomic > &Value() const { return mLiteral; };
+            
             static INLINE IntegerT NumCachedIntegerLiteralNodes() { return static_cast< IntegerT >(CachedIntegerLiteralNodes.size()); };
             static INLINE IntegerT NumCachedRealLiteralNodes() { return static_cast< IntegerT >(CachedRealLiteralNodes.size()); };
             static INLINE IntegerT NumCachedStringLiteralNodes() { return static_cast< IntegerT >(CachedStringLiteralNodes.size()); };
@@ -510,7 +640,12 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute();
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -532,13 +667,13 @@ namespace dish
         
         protected:
             INLINE LiteralArrayParseTreeNode() : ParseTreeNode(), mElements() { ++Count; ++Instances; };
-            INLINE LiteralArrayParseTreeNode(const std::string &locstr) : ParseTreeNode(locstr), mElements() { ++Count; ++Instances; };
+            INLINE LiteralArrayParseTreeNode(const SourceLocationT &location) : ParseTreeNode(location), mElements() { ++Count; ++Instances; };
         
         public:
             virtual ~LiteralArrayParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< LiteralArrayParseTreeNode > MakeValue() { return std::shared_ptr< LiteralArrayParseTreeNode >(new LiteralArrayParseTreeNode()); };
-            static INLINE std::shared_ptr< LiteralArrayParseTreeNode > MakeValue(const StringT &locstr) { return std::shared_ptr< LiteralArrayParseTreeNode >(new LiteralArrayParseTreeNode(locstr)); };
+            static INLINE std::shared_ptr< LiteralArrayParseTreeNode > MakeValue() { return MakeShared< LiteralArrayParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LiteralArrayParseTreeNode(); }); };
+            static INLINE std::shared_ptr< LiteralArrayParseTreeNode > MakeValue(const SourceLocationT &location) { return MakeShared< LiteralArrayParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LiteralArrayParseTreeNode(location); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -551,6 +686,10 @@ namespace dish
             
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
+            virtual void Children(ChildListT &children);
+            
+            virtual void Write(ParseTreeWriter &writer) const;
+            
             //  From iPrintable
             
             virtual void Print(std::ostream &out, const std::string::size_type &indent = 0) const;
@@ -562,33 +701,70 @@ namespace dish
         private:
             const bool mBaseId;
             std::string mId;
+            
+            //  The frame (counted from the top of the stack) and the slot in
+            //  that frame the parser resolved this identifier to, or
+            //  UNRESOLVED if the identifier must be looked up by name, and the
+            //  number of symbols the parser expects the nearer frames to hold.
+            int mDepth;
+            int mSlot;
+            int mNearer;
+            
+            InternedKeys::IdT mKey;
         
             static IntegerT Count;
             static IntegerT Instances;
+            static IntegerT Resolved;
             
             static std::map< std::string, std::shared_ptr< IdentifierParseTreeNode > > CachedNodes;
 
         protected:
-            INLINE IdentifierParseTreeNode(const std::string &id) : ParseTreeNode(), mBaseId(BeginsWith(id, '`')), mId()
-                { mId = (!mBaseId) ? id : id.substr(1, std::string::npos); ++Count; ++Instances; };
+            INLINE IdentifierParseTreeNode(const std::string &id) : ParseTreeNode(), mBaseId(BeginsWith(id, '`')), mId(), mDepth(UNRESOLVED), mSlot(UNRESOLVED), mNearer(0), mKey(InternedKeys::NO_ID)
+                { mId = (!mBaseId) ? id : id.substr(1, std::string::npos); mKey = InternedKeys::Intern(mId); ++Count; ++Instances; };
+                
+            INLINE IdentifierParseTreeNode(const SourceLocationT &location, const std::string &id) : ParseTreeNode(location), mBaseId(BeginsWith(id, '`')), mId(), mDepth(UNRESOLVED), mSlot(UNRESOLVED), mNearer(0), mKey(InternedKeys::NO_ID)
+                { mId = (!mBaseId) ? id : id.substr(1, std::string::npos); mKey = InternedKeys::Intern(mId); ++Count; ++Instances; };
                 
-            INLINE IdentifierParseTreeNode(const std::string &locstr, const std::string &id) : ParseTreeNode(locstr), mBaseId(BeginsWith(id, '`')), mId()
-                { mId = (!mBaseId) ? id : id.substr(1, std::string::npos); ++Count; ++Instances; };
+            INLINE IdentifierParseTreeNode(const std::string &id, const int &depth, const int &slot, const int &nearer) : ParseTreeNode(), mBaseId(false), mId(id), mDepth(depth), mSlot(slot), mNearer(nearer), mKey(InternedKeys::Intern(id))
+                { assert(!BeginsWith(id, '`')); ++Count; ++Instances; ++Resolved; };
+                
+            INLINE IdentifierParseTreeNode(const SourceLocationT &location, const std::string &id, const int &depth, const int &slot, const int &nearer) : ParseTreeNode(location), mBaseId(false), mId(id), mDepth(depth), mSlot(slot), mNearer(nearer), mKey(InternedKeys::Intern(id))
+                { assert(!BeginsWith(id, '`')); ++Count; ++Instances; ++Resolved; };
             
             //  From iParseTreeNode
     
             virtual bool isEqual(const IdentifierParseTreeNode &ptn) const;
         
         public:
+            static const int UNRESOLVED;
+        
             virtual ~IdentifierParseTreeNode() { --Instances; };
             
             static std::shared_ptr< IdentifierParseTreeNode > MakeValue(const std::string &id);
-            static INLINE std::shared_ptr< IdentifierParseTreeNode > MakeValue(const std::string &locstr, const std::string &id) { return std::shared_ptr< IdentifierParseTreeNode >(new IdentifierParseTreeNode(locstr, id)); };
+            static INLINE std::shared_ptr< IdentifierParseTreeNode > MakeValue(const SourceLocationT &location, const std::string &id) { return MakeShared< IdentifierParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) IdentifierParseTreeNode(location, id); }); };
+            
+            //  Resolved identifiers are never cached since the same name can
+            //  resolve to different slots in different scopes.
+            static INLINE std::shared_ptr< IdentifierParseTreeNode > MakeValue(const std::string &id, const int &depth, const int &slot, const int &nearer) { return MakeShared< IdentifierParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) IdentifierParseTreeNode(id, depth, slot, nearer); }); };
+            static INLINE std::shared_ptr< IdentifierParseTreeNode > MakeValue(const SourceLocationT &location, const std::string &id, const int &depth, const int &slot, const int &nearer) { return MakeShared< IdentifierParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) IdentifierParseTreeNode(location, id, depth, slot, nearer); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
             
+            static INLINE const IntegerT &NumResolved() throw() { return Resolved; };
+            
             INLINE const std::string &Id() const { return mId; };
+            INLINE bool IsBaseId() const throw() { return mBaseId; };
+            INLINE const InternedKeys::IdT &Key() const throw() { return mKey; };
+            
+            INLINE bool IsResolved() const throw() { return (UNRESOLVED != mDepth); };
+            INLINE const int &Depth() const throw() { return mDepth; };
+            INLINE const int &Slot() const throw() { return mSlot; };
+            INLINE const int &Nearer() const throw() { return mNearer; };
+            
+            //  Reverts the identifier to a lookup by name; used by the parser
+            //  when a later declaration invalidates the slot it resolved to.
+            INLINE void Unresolve() { if(IsResolved()) { mDepth = mSlot = UNRESOLVED; --Resolved; } };
             
             static INLINE IntegerT NumCachedNodes() { return static_cast< IntegerT >(CachedNodes.size()); };
             
@@ -601,9 +777,12 @@ namespace dish
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
             
             virtual const std::string &ToString() const;
             
+            virtual void Write(ParseTreeWriter &writer) const;
+            
             //  From iPrintable
             
             virtual void Print(std::ostream &out, const std::string::size_type &indent = 0) const;
@@ -620,7 +799,7 @@ namespace dish
 
         protected:
             INLINE LockParseTreeNode(const std::string &id) : ParseTreeNode(), mId(id) { ++Count; ++Instances; };
-            INLINE LockParseTreeNode(const std::string &locstr, const std::string &id) : ParseTreeNode(locstr), mId(id) { ++Count; ++Instances; };
+            INLINE LockParseTreeNode(const SourceLocationT &location, const std::string &id) : ParseTreeNode(location), mId(id) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -629,17 +808,22 @@ namespace dish
         public:
             virtual ~LockParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< LockParseTreeNode > MakeValue(const std::string &id) { return std::shared_ptr< LockParseTreeNode >(new LockParseTreeNode(id)); };
-            static INLINE std::shared_ptr< LockParseTreeNode > MakeValue(const StringT &locstr, const std::string &id) { return std::shared_ptr< LockParseTreeNode >(new LockParseTreeNode(locstr, id)); };
+            static INLINE std::shared_ptr< LockParseTreeNode > MakeValue(const std::string &id) { return MakeShared< LockParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LockParseTreeNode(id); }); };
+            static INLINE std::shared_ptr< LockParseTreeNode > MakeValue(const SourceLocationT &location, const std::string &id) { return MakeShared< LockParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LockParseTreeNode(location, id); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
             
+            INLINE const std::string &Id() const { return mId; };
+            
             //  From iParseTreeNode
             
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -658,7 +842,7 @@ namespace dish
     
         protected:
             INLINE BooleanTypeParseTreeNode() : ParseTreeNode() { ++Count; ++Instances; };
-            INLINE BooleanTypeParseTreeNode(const std::string &locstr) : ParseTreeNode(locstr) { ++Count; ++Instances; };
+            INLINE BooleanTypeParseTreeNode(const SourceLocationT &location) : ParseTreeNode(location) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -667,8 +851,8 @@ namespace dish
         public:
             virtual ~BooleanTypeParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< BooleanTypeParseTreeNode > MakeValue() { return std::shared_ptr< BooleanTypeParseTreeNode >(new BooleanTypeParseTreeNode()); };
-            static INLINE std::shared_ptr< BooleanTypeParseTreeNode > MakeValue(const StringT &locstr) { return std::shared_ptr< BooleanTypeParseTreeNode >(new BooleanTypeParseTreeNode(locstr)); };
+            static INLINE std::shared_ptr< BooleanTypeParseTreeNode > MakeValue() { return MakeShared< BooleanTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) BooleanTypeParseTreeNode(); }); };
+            static INLINE std::shared_ptr< BooleanTypeParseTreeNode > MakeValue(const SourceLocationT &location) { return MakeShared< BooleanTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) BooleanTypeParseTreeNode(location); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -678,6 +862,9 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -694,7 +881,7 @@ namespace dish
             
         protected:
             INLINE IntegerTypeParseTreeNode() : ParseTreeNode() { ++Count; ++Instances; };
-            INLINE IntegerTypeParseTreeNode(const std::string &locstr) : ParseTreeNode(locstr) { ++Count; ++Instances; };
+            INLINE IntegerTypeParseTreeNode(const SourceLocationT &location) : ParseTreeNode(location) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -703,8 +890,8 @@ namespace dish
         public:
             virtual ~IntegerTypeParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< IntegerTypeParseTreeNode > MakeValue() { return std::shared_ptr< IntegerTypeParseTreeNode >(new IntegerTypeParseTreeNode()); };
-            static INLINE std::shared_ptr< IntegerTypeParseTreeNode > MakeValue(const StringT &locstr) { return std::shared_ptr< IntegerTypeParseTreeNode >(new IntegerTypeParseTreeNode(locstr)); };
+            static INLINE std::shared_ptr< IntegerTypeParseTreeNode > MakeValue() { return MakeShared< IntegerTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) IntegerTypeParseTreeNode(); }); };
+            static INLINE std::shared_ptr< IntegerTypeParseTreeNode > MakeValue(const SourceLocationT &location) { return MakeShared< IntegerTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) IntegerTypeParseTreeNode(location); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -714,6 +901,9 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -735,8 +925,8 @@ namespace dish
             INLINE RangedIntegerTypeParseTreeNode(std::shared_ptr< iParseTreeNode > &min, std::shared_ptr< iParseTreeNode > &max, std::shared_ptr< iParseTreeNode > &bound) : 
                 ParseTreeNode(), mMinimum(min), mMaximum(max), mBoundary(bound) { assert(0 != mMinimum.get()); assert(0 != mMaximum.get()); assert(0 != mBoundary.get()); ++Count; ++Instances; };
             
-            INLINE RangedIntegerTypeParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &min, std::shared_ptr< iParseTreeNode > &max, std::shared_ptr< iParseTreeNode > &bound) : 
-                ParseTreeNode(locstr), mMinimum(min), mMaximum(max), mBoundary(bound) { assert(0 != mMinimum.get()); assert(0 != mMaximum.get()); assert(0 != mBoundary.get()); ++Count; ++Instances; };
+            INLINE RangedIntegerTypeParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &min, std::shared_ptr< iParseTreeNode > &max, std::shared_ptr< iParseTreeNode > &bound) : 
+                ParseTreeNode(location), mMinimum(min), mMaximum(max), mBoundary(bound) { assert(0 != mMinimum.get()); assert(0 != mMaximum.get()); assert(0 != mBoundary.get()); ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -745,8 +935,8 @@ namespace dish
         public:
             virtual ~RangedIntegerTypeParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< RangedIntegerTypeParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &min, std::shared_ptr< iParseTreeNode > &max, std::shared_ptr< iParseTreeNode > &bound) { return std::shared_ptr< RangedIntegerTypeParseTreeNode >(new RangedIntegerTypeParseTreeNode(min, max, bound)); };
-            static INLINE std::shared_ptr< RangedIntegerTypeParseTreeNode > MakeValue(const StringT &locstr, std::shared_ptr< iParseTreeNode > &min, std::shared_ptr< iParseTreeNode > &max, std::shared_ptr< iParseTreeNode > &bound) { return std::shared_ptr< RangedIntegerTypeParseTreeNode >(new RangedIntegerTypeParseTreeNode(locstr, min, max, bound)); };
+            static INLINE std::shared_ptr< RangedIntegerTypeParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &min, std::shared_ptr< iParseTreeNode > &max, std::shared_ptr< iParseTreeNode > &bound) { return MakeShared< RangedIntegerTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) RangedIntegerTypeParseTreeNode(min, max, bound); }); };
+            static INLINE std::shared_ptr< RangedIntegerTypeParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &min, std::shared_ptr< iParseTreeNode > &max, std::shared_ptr< iParseTreeNode > &bound) { return MakeShared< RangedIntegerTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) RangedIntegerTypeParseTreeNode(location, min, max, bound); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -756,6 +946,11 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Children(ChildListT &children);
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -772,7 +967,7 @@ namespace dish
             
         protected:
             INLINE RealTypeParseTreeNode() : ParseTreeNode() { ++Count; ++Instances; };
-            INLINE RealTypeParseTreeNode(const std::string &locstr) : ParseTreeNode(locstr) { ++Count; ++Instances; };
+            INLINE RealTypeParseTreeNode(const SourceLocationT &location) : ParseTreeNode(location) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -781,8 +976,8 @@ namespace dish
         public:
             virtual ~RealTypeParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< RealTypeParseTreeNode > MakeValue() { return std::shared_ptr< RealTypeParseTreeNode >(new RealTypeParseTreeNode()); };
-            static INLINE std::shared_ptr< RealTypeParseTreeNode > MakeValue(const StringT &locstr) { return std::shared_ptr< RealTypeParseTreeNode >(new RealTypeParseTreeNode(locstr)); };
+            static INLINE std::shared_ptr< RealTypeParseTreeNode > MakeValue() { return MakeShared< RealTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) RealTypeParseTreeNode(); }); };
+            static INLINE std::shared_ptr< RealTypeParseTreeNode > MakeValue(const SourceLocationT &location) { return MakeShared< RealTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) RealTypeParseTreeNode(location); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -792,6 +987,9 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -813,8 +1011,8 @@ namespace dish
             INLINE RangedRealTypeParseTreeNode(std::shared_ptr< iParseTreeNode > &min, std::shared_ptr< iParseTreeNode > &max, std::shared_ptr< iParseTreeNode > &bound) : 
                 ParseTreeNode(), mMinimum(min), mMaximum(max), mBoundary(bound) { assert(0 != mMinimum.get()); assert(0 != mMaximum.get()); assert(0 != mBoundary.get()); ++Count; ++Instances; };
             
-            INLINE RangedRealTypeParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &min, std::shared_ptr< iParseTreeNode > &max, std::shared_ptr< iParseTreeNode > &bound) : 
-                ParseTreeNode(locstr), mMinimum(min), mMaximum(max), mBoundary(bound) { assert(0 != mMinimum.get()); assert(0 != mMaximum.get()); assert(0 != mBoundary.get()); ++Count; ++Instances; };
+            INLINE RangedRealTypeParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &min, std::shared_ptr< iParseTreeNode > &max, std::shared_ptr< iParseTreeNode > &bound) : 
+                ParseTreeNode(location), mMinimum(min), mMaximum(max), mBoundary(bound) { assert(0 != mMinimum.get()); assert(0 != mMaximum.get()); assert(0 != mBoundary.get()); ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -823,8 +1021,8 @@ namespace dish
         public:
             virtual ~RangedRealTypeParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< RangedRealTypeParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &min, std::shared_ptr< iParseTreeNode > &max, std::shared_ptr< iParseTreeNode > &bound) { return std::shared_ptr< RangedRealTypeParseTreeNode >(new RangedRealTypeParseTreeNode(min, max, bound)); };
-            static INLINE std::shared_ptr< RangedRealTypeParseTreeNode > MakeValue(const StringT &locstr, std::shared_ptr< iParseTreeNode > &min, std::shared_ptr< iParseTreeNode > &max, std::shared_ptr< iParseTreeNode > &bound) { return std::shared_ptr< RangedRealTypeParseTreeNode >(new RangedRealTypeParseTreeNode(locstr, min, max, bound)); };
+            static INLINE std::shared_ptr< RangedRealTypeParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &min, std::shared_ptr< iParseTreeNode > &max, std::shared_ptr< iParseTreeNode > &bound) { return MakeShared< RangedRealTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) RangedRealTypeParseTreeNode(min, max, bound); }); };
+            static INLINE std::shared_ptr< RangedRealTypeParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &min, std::shared_ptr< iParseTreeNode > &max, std::shared_ptr< iParseTreeNode > &bound) { return MakeShared< RangedRealTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) RangedRealTypeParseTreeNode(location, min, max, bound); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -834,6 +1032,11 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Children(ChildListT &children);
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -850,7 +1053,7 @@ namespace dish
             
         protected:
             INLINE StringTypeParseTreeNode() : ParseTreeNode() { ++Count; ++Instances; };
-            INLINE StringTypeParseTreeNode(const std::string &locstr) : ParseTreeNode(locstr) { ++Count; ++Instances; };
+            INLINE StringTypeParseTreeNode(const SourceLocationT &location) : ParseTreeNode(location) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -859,8 +1062,8 @@ namespace dish
         public:
             virtual ~StringTypeParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< StringTypeParseTreeNode > MakeValue() { return std::shared_ptr< StringTypeParseTreeNode >(new StringTypeParseTreeNode()); };
-            static INLINE std::shared_ptr< StringTypeParseTreeNode > MakeValue(const StringT &locstr) { return std::shared_ptr< StringTypeParseTreeNode >(new StringTypeParseTreeNode(locstr)); };
+            static INLINE std::shared_ptr< StringTypeParseTreeNode > MakeValue() { return MakeShared< StringTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) StringTypeParseTreeNode(); }); };
+            static INLINE std::shared_ptr< StringTypeParseTreeNode > MakeValue(const SourceLocationT &location) { return MakeShared< StringTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) StringTypeParseTreeNode(location); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -870,6 +1073,9 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -892,8 +1098,8 @@ namespace dish
             INLINE ArrayTypeParseTreeNode(std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &type) : 
                 ParseTreeNode(), mFromIndex(from), mToIndex(to), mType(type) { assert(mFromIndex); assert(mToIndex); assert(mType); ++Count; ++Instances; };
                 
-            INLINE ArrayTypeParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &type) : 
-                ParseTreeNode(locstr), mFromIndex(from), mToIndex(to), mType(type) { assert(mFromIndex); assert(mToIndex); assert(mType); ++Count; ++Instances; };
+            INLINE ArrayTypeParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &type) : 
+                ParseTreeNode(location), mFromIndex(from), mToIndex(to), mType(type) { assert(mFromIndex); assert(mToIndex); assert(mType); ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -902,8 +1108,8 @@ namespace dish
         public:
             virtual ~ArrayTypeParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< ArrayTypeParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &type) { return std::shared_ptr< ArrayTypeParseTreeNode >(new ArrayTypeParseTreeNode(from, to, type)); };
-            static INLINE std::shared_ptr< ArrayTypeParseTreeNode > MakeValue(const StringT &locstr, std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &type) { return std::shared_ptr< ArrayTypeParseTreeNode >(new ArrayTypeParseTreeNode(locstr, from, to, type)); };
+            static INLINE std::shared_ptr< ArrayTypeParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &type) { return MakeShared< ArrayTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) ArrayTypeParseTreeNode(from, to, type); }); };
+            static INLINE std::shared_ptr< ArrayTypeParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &type) { return MakeShared< ArrayTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) ArrayTypeParseTreeNode(location, from, to, type); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -915,6 +1121,11 @@ namespace dish
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Children(ChildListT &children);
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -931,7 +1142,7 @@ namespace dish
             
         protected:
             INLINE DictionaryTypeParseTreeNode() : ParseTreeNode() { ++Count; ++Instances; };
-            INLINE DictionaryTypeParseTreeNode(const std::string &locstr) : ParseTreeNode(locstr) { ++Count; ++Instances; };
+            INLINE DictionaryTypeParseTreeNode(const SourceLocationT &location) : ParseTreeNode(location) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -940,8 +1151,8 @@ namespace dish
         public:
             virtual ~DictionaryTypeParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< DictionaryTypeParseTreeNode > MakeValue() { return std::shared_ptr< DictionaryTypeParseTreeNode >(new DictionaryTypeParseTreeNode()); };
-            static INLINE std::shared_ptr< DictionaryTypeParseTreeNode > MakeValue(const StringT &locstr) { return std::shared_ptr< DictionaryTypeParseTreeNode >(new DictionaryTypeParseTreeNode(locstr)); };
+            static INLINE std::shared_ptr< DictionaryTypeParseTreeNode > MakeValue() { return MakeShared< DictionaryTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) DictionaryTypeParseTreeNode(); }); };
+            static INLINE std::shared_ptr< DictionaryTypeParseTreeNode > MakeValue(const SourceLocationT &location) { return MakeShared< DictionaryTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) DictionaryTypeParseTreeNode(location); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -951,6 +1162,9 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -987,7 +1201,7 @@ namespace dish
                 ++Instances;
             };
             
-            INLINE StructureTypeParseTreeNode(const std::string &locstr) : ParseTreeNode(locstr), mMemberList(), mStructureNode()
+            INLINE StructureTypeParseTreeNode(const SourceLocationT &location) : ParseTreeNode(location), mMemberList(), mStructureNode()
             {
 #ifdef LIST_TYPE_PREFER_VECTOR
                 mMemberList.reserve(LIST_TYPE_PREFER_VECTOR);
@@ -1000,8 +1214,8 @@ namespace dish
         public:
             virtual ~StructureTypeParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< StructureTypeParseTreeNode > MakeValue() { return std::shared_ptr< StructureTypeParseTreeNode >(new StructureTypeParseTreeNode()); };
-            static INLINE std::shared_ptr< StructureTypeParseTreeNode > MakeValue(const StringT &locstr) { return std::shared_ptr< StructureTypeParseTreeNode >(new StructureTypeParseTreeNode(locstr)); };
+            static INLINE std::shared_ptr< StructureTypeParseTreeNode > MakeValue() { return MakeShared< StructureTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) StructureTypeParseTreeNode(); }); };
+            static INLINE std::shared_ptr< StructureTypeParseTreeNode > MakeValue(const SourceLocationT &location) { return MakeShared< StructureTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) StructureTypeParseTreeNode(location); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -1012,6 +1226,10 @@ namespace dish
             
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
+            virtual void Children(ChildListT &children);
+            
+            virtual void Write(ParseTreeWriter &writer) const;
+            
             //  From iPrintable
             
             virtual void Print(std::ostream &out, const std::string::size_type &indent = 0) const;
@@ -1029,7 +1247,7 @@ namespace dish
         
         protected:
             INLINE DeclareParseTreeNode(std::shared_ptr< iParseTreeNode > &type, const std::string &id) : ParseTreeNode(), mType(type), mId(id) { assert(mType); ++Count; ++Instances; };
-            INLINE DeclareParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &type, const std::string &id) : ParseTreeNode(locstr), mType(type), mId(id) { assert(mType); ++Count; ++Instances; };
+            INLINE DeclareParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &type, const std::string &id) : ParseTreeNode(location), mType(type), mId(id) { assert(mType); ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -1038,12 +1256,15 @@ namespace dish
         public:
             virtual ~DeclareParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< DeclareParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &type, const std::string &id) { return std::shared_ptr< DeclareParseTreeNode >(new DeclareParseTreeNode(type, id)); };
-            static INLINE std::shared_ptr< DeclareParseTreeNode > MakeValue(const StringT &locstr, std::shared_ptr< iParseTreeNode > &type, const std::string &id) { return std::shared_ptr< DeclareParseTreeNode >(new DeclareParseTreeNode(locstr, type, id)); };
+            static INLINE std::shared_ptr< DeclareParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &type, const std::string &id) { return MakeShared< DeclareParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) DeclareParseTreeNode(type, id); }); };
+            static INLINE std::shared_ptr< DeclareParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &type, const std::string &id) { return MakeShared< DeclareParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) DeclareParseTreeNode(location, type, id); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
             
+            INLINE const std::shared_ptr< iParseTreeNode > &Type() const { return mType; };
+            INLINE const std::string &Id() const { return mId; };
+            
             //  From iParseTreeNode
             
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
@@ -1051,6 +1272,11 @@ namespace dish
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Children(ChildListT &children);
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -1069,7 +1295,7 @@ namespace dish
         
         protected:
             INLINE DeclareTypeParseTreeNode(std::shared_ptr< iParseTreeNode > &type, const std::string &id) : ParseTreeNode(), mType(type), mId(id) { assert(mType); ++Count; ++Instances; };
-            INLINE DeclareTypeParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &type, const std::string &id) : ParseTreeNode(locstr), mType(type), mId(id) { assert(mType); ++Count; ++Instances; };
+            INLINE DeclareTypeParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &type, const std::string &id) : ParseTreeNode(location), mType(type), mId(id) { assert(mType); ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -1078,8 +1304,8 @@ namespace dish
         public:
             virtual ~DeclareTypeParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< DeclareTypeParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &type, const std::string &id) { return std::shared_ptr< DeclareTypeParseTreeNode >(new DeclareTypeParseTreeNode(type, id)); };
-            static INLINE std::shared_ptr< DeclareTypeParseTreeNode > MakeValue(const StringT &locstr, std::shared_ptr< iParseTreeNode > &type, const std::string &id) { return std::shared_ptr< DeclareTypeParseTreeNode >(new DeclareTypeParseTreeNode(locstr, type, id)); };
+            static INLINE std::shared_ptr< DeclareTypeParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &type, const std::string &id) { return MakeShared< DeclareTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) DeclareTypeParseTreeNode(type, id); }); };
+            static INLINE std::shared_ptr< DeclareTypeParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &type, const std::string &id) { return MakeShared< DeclareTypeParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) DeclareTypeParseTreeNode(location, type, id); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -1091,6 +1317,11 @@ namespace dish
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Children(ChildListT &children);
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -1111,12 +1342,16 @@ namespace dish
                 private:
                     std::shared_ptr< iParseTreeNode > mBody;
                     
+                    std::shared_ptr< iAtomic > executeBody(LanguageSymbolTable &symtab) const;
+                    
                 protected:
                     INLINE FunctionValue(const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) : ExecutableAtomic(), mBody(body) { assert(0 != mBody.get()); AddParam(params); };
                 
                 public:
                 
-                    static INLINE std::shared_ptr< FunctionValue > MakeValue(const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) { return std::shared_ptr< FunctionValue >(new FunctionValue(params, body)); };
+                    static INLINE std::shared_ptr< FunctionValue > MakeValue(const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) { return MakeShared< FunctionValue, ParseTreeArena >([&](void *memory) { ::new(memory) FunctionValue(params, body); }); };
+                    
+                    INLINE const std::shared_ptr< iParseTreeNode > &Body() const { return mBody; };
                 
                     //  From iAtomic
                     
@@ -1131,15 +1366,27 @@ namespace dish
             
             std::shared_ptr< iParseTreeNode > mBody;
             
+            static IntegerT TailCalls;
+            
         protected:
             INLINE FunctionParseTreeNode(const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) : ParseTreeNode(), mFormalParameters(params), mBody(body) { assert(0 != mBody.get()); };
-            INLINE FunctionParseTreeNode(const std::string &locstr, const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) : ParseTreeNode(locstr), mFormalParameters(params), mBody(body) { assert(0 != mBody.get()); };
-
+            INLINE FunctionParseTreeNode(const SourceLocationT &location, const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) : ParseTreeNode(location), mFormalParameters(params), mBody(body) { assert(0 != mBody.get()); };
+            
             INLINE const ParamListT &formalParameters() const { return mFormalParameters; };
             INLINE ParamListT &formalParameters() { return mFormalParameters; };
             
             INLINE const std::shared_ptr< iParseTreeNode > &body() const { return mBody; };
             INLINE std::shared_ptr< iParseTreeNode > &body() { return mBody; };
+            
+        public:
+            static INLINE const IntegerT &NumTailCalls() throw() { return TailCalls; };
+            
+            INLINE const ParamListT &FormalParameters() const { return mFormalParameters; };
+            INLINE const std::shared_ptr< iParseTreeNode > &Body() const { return mBody; };
+            
+            //  From iParseTreeNode
+            
+            virtual void Children(ChildListT &children);
 
     };
     
@@ -1153,23 +1400,27 @@ namespace dish
     
         protected:
             INLINE DeclareFunctionParseTreeNode(const std::string &id, const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) : FunctionParseTreeNode(params, body), mId(id) { ++Count; ++Instances; };
-            INLINE DeclareFunctionParseTreeNode(const std::string &locstr, const std::string &id, const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) : FunctionParseTreeNode(locstr, params, body), mId(id) { ++Count; ++Instances; };
+            INLINE DeclareFunctionParseTreeNode(const SourceLocationT &location, const std::string &id, const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) : FunctionParseTreeNode(location, params, body), mId(id) { ++Count; ++Instances; };
         
         public:
             virtual ~DeclareFunctionParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< DeclareFunctionParseTreeNode > MakeValue(const std::string &id, const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) { return std::shared_ptr< DeclareFunctionParseTreeNode >(new DeclareFunctionParseTreeNode(id, params, body)); };
-            static INLINE std::shared_ptr< DeclareFunctionParseTreeNode > MakeValue(const StringT &locstr, const std::string &id, const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) { return std::shared_ptr< DeclareFunctionParseTreeNode >(new DeclareFunctionParseTreeNode(locstr, id, params, body)); };
+            static INLINE std::shared_ptr< DeclareFunctionParseTreeNode > MakeValue(const std::string &id, const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) { return MakeShared< DeclareFunctionParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) DeclareFunctionParseTreeNode(id, params, body); }); };
+            static INLINE std::shared_ptr< DeclareFunctionParseTreeNode > MakeValue(const SourceLocationT &location, const std::string &id, const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) { return MakeShared< DeclareFunctionParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) DeclareFunctionParseTreeNode(location, id, params, body); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
             
+            INLINE const std::string &Id() const { return mId; };
+            
             //  From iParseTreeNode
             
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
+            virtual void Write(ParseTreeWriter &writer) const;
+            
             //  From iPrintable
             
             virtual void Print(std::ostream &out, const std::string::size_type &indent = 0) const;
@@ -1185,13 +1436,13 @@ namespace dish
         
         protected:
             INLINE LambdaFunctionParseTreeNode(const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) : FunctionParseTreeNode(params, body) { ++Count; ++Instances; };
-            INLINE LambdaFunctionParseTreeNode(const std::string &locstr, const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) : FunctionParseTreeNode(locstr, params, body) { ++Count; ++Instances; };
+            INLINE LambdaFunctionParseTreeNode(const SourceLocationT &location, const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) : FunctionParseTreeNode(location, params, body) { ++Count; ++Instances; };
         
         public:
             virtual ~LambdaFunctionParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< LambdaFunctionParseTreeNode > MakeValue(const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) { return std::shared_ptr< LambdaFunctionParseTreeNode >(new LambdaFunctionParseTreeNode(params, body)); };
-            static INLINE std::shared_ptr< LambdaFunctionParseTreeNode > MakeValue(const StringT &locstr, const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) { return std::shared_ptr< LambdaFunctionParseTreeNode >(new LambdaFunctionParseTreeNode(locstr, params, body)); };
+            static INLINE std::shared_ptr< LambdaFunctionParseTreeNode > MakeValue(const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) { return MakeShared< LambdaFunctionParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LambdaFunctionParseTreeNode(params, body); }); };
+            static INLINE std::shared_ptr< LambdaFunctionParseTreeNode > MakeValue(const SourceLocationT &location, const ParamListT &params, std::shared_ptr< iParseTreeNode > &body) { return MakeShared< LambdaFunctionParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LambdaFunctionParseTreeNode(location, params, body); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -1202,6 +1453,8 @@ namespace dish
             
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
+            virtual void Write(ParseTreeWriter &writer) const;
+            
             //  From iPrintable
             
             virtual void Print(std::ostream &out, const std::string::size_type &indent = 0) const;
@@ -1224,14 +1477,14 @@ namespace dish
             INLINE DeclareReferenceParseTreeNode(const std::string &id, std::shared_ptr< iParseTreeNode > &expr) : 
                 ParseTreeNode(), mId(id), mExpression(expr) { assert(mExpression); ++Count; ++Instances; };
                 
-            INLINE DeclareReferenceParseTreeNode(const std::string &locstr, const std::string &id, std::shared_ptr< iParseTreeNode > &expr) : 
-                ParseTreeNode(locstr), mId(id), mExpression(expr) { assert(mExpression); ++Count; ++Instances; };
+            INLINE DeclareReferenceParseTreeNode(const SourceLocationT &location, const std::string &id, std::shared_ptr< iParseTreeNode > &expr) : 
+                ParseTreeNode(location), mId(id), mExpression(expr) { assert(mExpression); ++Count; ++Instances; };
         
         public:
             virtual ~DeclareReferenceParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< DeclareReferenceParseTreeNode > MakeValue(const std::string &id, std::shared_ptr< iParseTreeNode > &expr) { return std::shared_ptr< DeclareReferenceParseTreeNode >(new DeclareReferenceParseTreeNode(id, expr)); };
-            static INLINE std::shared_ptr< DeclareReferenceParseTreeNode > MakeValue(const StringT &locstr, const std::string &id, std::shared_ptr< iParseTreeNode > &expr) { return std::shared_ptr< DeclareReferenceParseTreeNode >(new DeclareReferenceParseTreeNode(locstr, id, expr)); };
+            static INLINE std::shared_ptr< DeclareReferenceParseTreeNode > MakeValue(const std::string &id, std::shared_ptr< iParseTreeNode > &expr) { return MakeShared< DeclareReferenceParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) DeclareReferenceParseTreeNode(id, expr); }); };
+            static INLINE std::shared_ptr< DeclareReferenceParseTreeNode > MakeValue(const SourceLocationT &location, const std::string &id, std::shared_ptr< iParseTreeNode > &expr) { return MakeShared< DeclareReferenceParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) DeclareReferenceParseTreeNode(location, id, expr); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -1242,6 +1495,11 @@ namespace dish
             
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
+            virtual void Children(ChildListT &children);
+            virtual void ChildrenReplaced();
+            
+            virtual void Write(ParseTreeWriter &writer) const;
+            
             //  From iPrintable
             
             virtual void Print(std::ostream &out, const std::string::size_type &indent = 0) const;
@@ -1263,8 +1521,8 @@ namespace dish
             INLINE AssignmentParseTreeNode(std::shared_ptr< iParseTreeNode > &lhs, std::shared_ptr< iParseTreeNode > &rhs) : 
                 ParseTreeNode(), mLeftHandSide(lhs), mRightHandSide(rhs) { assert(mLeftHandSide); assert(mRightHandSide); ++Count; ++Instances; };
                 
-            INLINE AssignmentParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &lhs, std::shared_ptr< iParseTreeNode > &rhs) : 
-                ParseTreeNode(locstr), mLeftHandSide(lhs), mRightHandSide(rhs) { assert(mLeftHandSide); assert(mRightHandSide); ++Count; ++Instances; };
+            INLINE AssignmentParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &lhs, std::shared_ptr< iParseTreeNode > &rhs) : 
+                ParseTreeNode(location), mLeftHandSide(lhs), mRightHandSide(rhs) { assert(mLeftHandSide); assert(mRightHandSide); ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -1273,12 +1531,15 @@ namespace dish
         public:
             virtual ~AssignmentParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< AssignmentParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &lhs, std::shared_ptr< iParseTreeNode > &rhs) { return std::shared_ptr< AssignmentParseTreeNode >(new AssignmentParseTreeNode(lhs, rhs)); };
-            static INLINE std::shared_ptr< AssignmentParseTreeNode > MakeValue(const StringT &locstr, std::shared_ptr< iParseTreeNode > &lhs, std::shared_ptr< iParseTreeNode > &rhs) { return std::shared_ptr< AssignmentParseTreeNode >(new AssignmentParseTreeNode(locstr, lhs, rhs)); };
+            static INLINE std::shared_ptr< AssignmentParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &lhs, std::shared_ptr< iParseTreeNode > &rhs) { return MakeShared< AssignmentParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) AssignmentParseTreeNode(lhs, rhs); }); };
+            static INLINE std::shared_ptr< AssignmentParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &lhs, std::shared_ptr< iParseTreeNode > &rhs) { return MakeShared< AssignmentParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) AssignmentParseTreeNode(location, lhs, rhs); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
             
+            INLINE const std::shared_ptr< iParseTreeNode > &LeftHandSide() const { return mLeftHandSide; };
+            INLINE const std::shared_ptr< iParseTreeNode > &RightHandSide() const { return mRightHandSide; };
+            
             //  From iParseTreeNode
             
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
@@ -1286,6 +1547,12 @@ namespace dish
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Children(ChildListT &children);
+            virtual void ChildrenReplaced();
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -1306,8 +1573,10 @@ namespace dish
             INLINE IndexParseTreeNode(std::shared_ptr< iParseTreeNode > &base, std::shared_ptr< iParseTreeNode > &index) : 
                 ParseTreeNode(), mBase(base), mIndex(index) { assert(mBase); assert(mIndex); ++Count; ++Instances; };
                 
-            INLINE IndexParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &base, std::shared_ptr< iParseTreeNode > &index) : 
-                ParseTreeNode(locstr), mBase(base), mIndex(index) { assert(mBase); assert(mIndex); ++Count; ++Instances; };
+            INLINE IndexParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &base, std::shared_ptr< iParseTreeNode > &index) : 
+                ParseTreeNode(location), mBase(base), mIndex(index) { assert(mBase); assert(mIndex); ++Count; ++Instances; };
+            
+            INLINE IndexParseTreeNode(const IndexParseTreeNode &ptn) : ParseTreeNode(ptn), mBase(ptn.mBase), mIndex(ptn.mIndex) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -1316,8 +1585,8 @@ namespace dish
         public:
             virtual ~IndexParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< IndexParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &base, std::shared_ptr< iParseTreeNode > &index) { return std::shared_ptr< IndexParseTreeNode >(new IndexParseTreeNode(base, index)); };
-            static INLINE std::shared_ptr< IndexParseTreeNode > MakeValue(const StringT &locstr, std::shared_ptr< iParseTreeNode > &base, std::shared_ptr< iParseTreeNode > &index) { return std::shared_ptr< IndexParseTreeNode >(new IndexParseTreeNode(locstr, base, index)); };
+            static INLINE std::shared_ptr< IndexParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &base, std::shared_ptr< iParseTreeNode > &index) { return MakeShared< IndexParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) IndexParseTreeNode(base, index); }); };
+            static INLINE std::shared_ptr< IndexParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &base, std::shared_ptr< iParseTreeNode > &index) { return MakeShared< IndexParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) IndexParseTreeNode(location, base, index); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -1325,10 +1594,21 @@ namespace dish
             //  From iParseTreeNode
             
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            virtual std::shared_ptr< iAtomic > Inspect(LanguageSymbolTable &symtab);
             
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Children(ChildListT &children);
+            virtual void AssignableChildren(ChildListT &children);
+            virtual void ChildrenReplaced();
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -1341,16 +1621,21 @@ namespace dish
         private:
             std::shared_ptr< iParseTreeNode > mBase;
             const std::string mMember;
+            
+            //  Where the member was found in the structure read last.
+            iAtomic::MemberCacheT mCache;
         
             static IntegerT Count;
             static IntegerT Instances;
         
         protected:
             INLINE MemberParseTreeNode(std::shared_ptr< iParseTreeNode > &base, const std::string &member) : 
-                ParseTreeNode(), mBase(base), mMember(member) { assert(mBase); ++Count; ++Instances; };
+                ParseTreeNode(), mBase(base), mMember(member), mCache() { assert(mBase); ++Count; ++Instances; };
                 
-            INLINE MemberParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &base, const std::string &member) : 
-                ParseTreeNode(locstr), mBase(base), mMember(member) { assert(mBase); ++Count; ++Instances; };
+            INLINE MemberParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &base, const std::string &member) : 
+                ParseTreeNode(location), mBase(base), mMember(member), mCache() { assert(mBase); ++Count; ++Instances; };
+            
+            INLINE MemberParseTreeNode(const MemberParseTreeNode &ptn) : ParseTreeNode(ptn), mBase(ptn.mBase), mMember(ptn.mMember), mCache() { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -1359,8 +1644,8 @@ namespace dish
         public:
             virtual ~MemberParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< MemberParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &base, const std::string &member) { return std::shared_ptr< MemberParseTreeNode >(new MemberParseTreeNode(base, member)); };
-            static INLINE std::shared_ptr< MemberParseTreeNode > MakeValue(const StringT &locstr, std::shared_ptr< iParseTreeNode > &base, const std::string &member) { return std::shared_ptr< MemberParseTreeNode >(new MemberParseTreeNode(locstr, base, member)); };
+            static INLINE std::shared_ptr< MemberParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &base, const std::string &member) { return MakeShared< MemberParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) MemberParseTreeNode(base, member); }); };
+            static INLINE std::shared_ptr< MemberParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &base, const std::string &member) { return MakeShared< MemberParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) MemberParseTreeNode(location, base, member); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -1368,10 +1653,104 @@ namespace dish
             //  From iParseTreeNode
             
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            virtual std::shared_ptr< iAtomic > Inspect(LanguageSymbolTable &symtab);
             
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Children(ChildListT &children);
+            virtual void AssignableChildren(ChildListT &children);
+            virtual void ChildrenReplaced();
+            
+            virtual void Write(ParseTreeWriter &writer) const;
+            
+            //  From iPrintable
+            
+            virtual void Print(std::ostream &out, const std::string::size_type &indent = 0) const;
+        
+    };
+    
+    //  A function whose body only returns an expression, prepared by the
+    //  optimizer for inlining into its call sites. The copy of the expression
+    //  reads the parameters from the actual parameters of the call being made
+    //  instead of from a frame of their own.
+    class InlinedFunction
+    {
+        public:
+        
+            using ParamListT = iExecutableAtomic::ParamListT;
+            
+            //  The most parameters a function can have to be inlined.
+            static const int MAX_PARAMETERS = 8;
+        
+        private:
+            std::shared_ptr< iParseTreeNode > mBody;
+            ParamListT mFormalParameters;
+            
+            std::shared_ptr< iParseTreeNode > mExpression;
+            
+            //  The actual parameters of the innermost call being made.
+            const std::shared_ptr< iAtomic > *mArguments;
+            
+            class ScopedArguments
+            {
+                private:
+                    InlinedFunction &mFunction;
+                    const std::shared_ptr< iAtomic > * const mPrevious;
+                
+                public:
+                    INLINE ScopedArguments(InlinedFunction &function, const std::shared_ptr< iAtomic > *arguments) : mFunction(function), mPrevious(function.mArguments) { mFunction.mArguments = arguments; };
+                    INLINE ~ScopedArguments() { mFunction.mArguments = mPrevious; };
+                
+            };
+        
+        public:
+            INLINE InlinedFunction(const std::shared_ptr< iParseTreeNode > &body, const ParamListT &params) : mBody(body), mFormalParameters(params), mExpression(), mArguments(0) { assert(0 != mBody.get()); assert(static_cast< int >(mFormalParameters.size()) <= MAX_PARAMETERS); };
+            
+            INLINE const std::shared_ptr< iParseTreeNode > &Body() const { return mBody; };
+            INLINE const ParamListT &FormalParameters() const { return mFormalParameters; };
+            
+            INLINE const std::shared_ptr< iParseTreeNode > &Expression() const { return mExpression; };
+            INLINE void SetExpression(std::shared_ptr< iParseTreeNode > expr) { assert(expr); mExpression = expr; };
+            
+            INLINE const std::shared_ptr< iAtomic > &Argument(const int &n) const { assert(0 != mArguments); assert((n >= 0) && (n < MAX_PARAMETERS)); return mArguments[n]; };
+            
+            //  Evaluates the expression with the actual parameters given, one
+            //  for each of the formal parameters.
+            std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab, const std::shared_ptr< iAtomic > *arguments);
+        
+    };
+    
+    class InlinedParameterParseTreeNode : public ParseTreeNode
+    {
+        private:
+            const InlinedFunction &mFunction;
+            const int mParameter;
+        
+            static IntegerT Count;
+            static IntegerT Instances;
+        
+        protected:
+            INLINE InlinedParameterParseTreeNode(const InlinedFunction &function, const int &param) : ParseTreeNode(), mFunction(function), mParameter(param) { assert((mParameter >= 0) && (mParameter < static_cast< int >(mFunction.FormalParameters().size()))); ++Count; ++Instances; };
+            INLINE InlinedParameterParseTreeNode(const SourceLocationT &location, const InlinedFunction &function, const int &param) : ParseTreeNode(location), mFunction(function), mParameter(param) { assert((mParameter >= 0) && (mParameter < static_cast< int >(mFunction.FormalParameters().size()))); ++Count; ++Instances; };
+        
+        public:
+            virtual ~InlinedParameterParseTreeNode() { --Instances; };
+            
+            static INLINE std::shared_ptr< InlinedParameterParseTreeNode > MakeValue(const InlinedFunction &function, const int &param) { return MakeShared< InlinedParameterParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) InlinedParameterParseTreeNode(function, param); }); };
+            static INLINE std::shared_ptr< InlinedParameterParseTreeNode > MakeValue(const SourceLocationT &location, const InlinedFunction &function, const int &param) { return MakeShared< InlinedParameterParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) InlinedParameterParseTreeNode(location, function, param); }); };
+            
+            static INLINE const IntegerT &NumInstances() throw() { return Count; };
+            static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
+            
+            //  From iParseTreeNode
+            
+            virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
             //  From iPrintable
             
@@ -1392,12 +1771,36 @@ namespace dish
         private:
             std::shared_ptr< iParseTreeNode > mFunction;
             ParameterListT mParameterList;
+            
+            //  Inline cache of the function a call by name last resolved to,
+            //  valid while the symbol-table epoch is unchanged. Only calls
+            //  through an identifier which is looked up by name are cached.
+            const IdentifierParseTreeNode *mFunctionId;
+            std::shared_ptr< iAtomic > mCachedFunction;
+            const LanguageSymbolTable *mCachedSymbolTable;
+            IntegerT mCachedEpoch;
+            
+            //  The function inlined into the call, if any, and the number of
+            //  calls to make before the inlined body is used.
+            std::shared_ptr< InlinedFunction > mInlined;
+            IntegerT mInlineAfter;
+            IntegerT mCalls;
         
             static IntegerT Count;
             static IntegerT Instances;
+            
+            static IntegerT CacheHits;
+            static IntegerT CacheMisses;
+            
+            static IntegerT InlinedCalls;
+            
+            static INLINE const IdentifierParseTreeNode *functionId(const std::shared_ptr< iParseTreeNode > &function)
+            {
+                return (typeid(IdentifierParseTreeNode) == typeid(*function)) ? static_cast< const IdentifierParseTreeNode * >(function.get()) : 0;
+            }
         
         protected:
-            INLINE FunctionCallParseTreeNode(std::shared_ptr< iParseTreeNode > &function) : ParseTreeNode(), mFunction(function), mParameterList()
+            INLINE FunctionCallParseTreeNode(std::shared_ptr< iParseTreeNode > &function) : ParseTreeNode(), mFunction(function), mParameterList(), mFunctionId(functionId(function)), mCachedFunction(), mCachedSymbolTable(0), mCachedEpoch(-1), mInlined(), mInlineAfter(0), mCalls(0)
             {
                 assert(mFunction);
                 
@@ -1409,7 +1812,7 @@ namespace dish
                 ++Instances;
             };
                 
-            INLINE FunctionCallParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &function) : ParseTreeNode(locstr), mFunction(function), mParameterList()
+            INLINE FunctionCallParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &function) : ParseTreeNode(location), mFunction(function), mParameterList(), mFunctionId(functionId(function)), mCachedFunction(), mCachedSymbolTable(0), mCachedEpoch(-1), mInlined(), mInlineAfter(0), mCalls(0)
             {
                 assert(mFunction);
                 
@@ -1421,7 +1824,7 @@ namespace dish
                 ++Instances;
             };
             
-            INLINE FunctionCallParseTreeNode(std::shared_ptr< iParseTreeNode > &function, const ParameterListT &plist) : ParseTreeNode(), mFunction(function), mParameterList(plist.begin(), plist.end())
+            INLINE FunctionCallParseTreeNode(std::shared_ptr< iParseTreeNode > &function, const ParameterListT &plist) : ParseTreeNode(), mFunction(function), mParameterList(plist.begin(), plist.end()), mFunctionId(functionId(function)), mCachedFunction(), mCachedSymbolTable(0), mCachedEpoch(-1), mInlined(), mInlineAfter(0), mCalls(0)
             {
                 assert(mFunction);
                 
@@ -1433,7 +1836,7 @@ namespace dish
                 ++Instances;
             };
                 
-            INLINE FunctionCallParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &function, const ParameterListT &plist) : ParseTreeNode(locstr), mFunction(function), mParameterList(plist.begin(), plist.end())
+            INLINE FunctionCallParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &function, const ParameterListT &plist) : ParseTreeNode(location), mFunction(function), mParameterList(plist.begin(), plist.end()), mFunctionId(functionId(function)), mCachedFunction(), mCachedSymbolTable(0), mCachedEpoch(-1), mInlined(), mInlineAfter(0), mCalls(0)
             {
                 assert(mFunction);
                 
@@ -1445,6 +1848,22 @@ namespace dish
                 ++Instances;
             };
             
+            INLINE FunctionCallParseTreeNode(const FunctionCallParseTreeNode &ptn) : ParseTreeNode(ptn), mFunction(ptn.mFunction), mParameterList(ptn.mParameterList), mFunctionId(functionId(mFunction)), mCachedFunction(), mCachedSymbolTable(0), mCachedEpoch(-1), mInlined(ptn.mInlined), mInlineAfter(ptn.mInlineAfter), mCalls(0)
+            {
+                ++Count;
+                ++Instances;
+            };
+            
+            //  Calls function, which must be the callee, with the actual
+            //  parameters.
+            std::shared_ptr< iAtomic > call(LanguageSymbolTable &symtab, std::shared_ptr< iAtomic > function);
+            
+            //  True if the call can be made through the inlined function, i.e.,
+            //  function, the callee, is the function inlined.
+            bool isInlined(const LanguageSymbolTable &symtab, const iAtomic &function);
+            
+            std::shared_ptr< iAtomic > executeInlined(LanguageSymbolTable &symtab);
+            
             //  From iParseTreeNode
     
             virtual bool isEqual(const FunctionCallParseTreeNode &ptn) const;
@@ -1452,18 +1871,48 @@ namespace dish
         public:
             virtual ~FunctionCallParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< FunctionCallParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > function) { return std::shared_ptr< FunctionCallParseTreeNode >(new FunctionCallParseTreeNode(function)); };
-            static INLINE std::shared_ptr< FunctionCallParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > function) { return std::shared_ptr< FunctionCallParseTreeNode >(new FunctionCallParseTreeNode(locstr, function)); };
+            static INLINE std::shared_ptr< FunctionCallParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > function) { return MakeShared< FunctionCallParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) FunctionCallParseTreeNode(function); }); };
+            static INLINE std::shared_ptr< FunctionCallParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > function) { return MakeShared< FunctionCallParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) FunctionCallParseTreeNode(location, function); }); };
             
-            static INLINE std::shared_ptr< FunctionCallParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > function, const ParameterListT &plist) { return std::shared_ptr< FunctionCallParseTreeNode >(new FunctionCallParseTreeNode(function, plist)); };
-            static INLINE std::shared_ptr< FunctionCallParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > function, const ParameterListT &plist) { return std::shared_ptr< FunctionCallParseTreeNode >(new FunctionCallParseTreeNode(locstr, function, plist)); };
+            static INLINE std::shared_ptr< FunctionCallParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > function, const ParameterListT &plist) { return MakeShared< FunctionCallParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) FunctionCallParseTreeNode(function, plist); }); };
+            static INLINE std::shared_ptr< FunctionCallParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > function, const ParameterListT &plist) { return MakeShared< FunctionCallParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) FunctionCallParseTreeNode(location, function, plist); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
             
+            static INLINE const IntegerT &NumCacheHits() throw() { return CacheHits; };
+            static INLINE const IntegerT &NumCacheMisses() throw() { return CacheMisses; };
+            
+            static INLINE const IntegerT &NumInlinedCalls() throw() { return InlinedCalls; };
+            
             INLINE void Add(std::shared_ptr< iParseTreeNode > param) { assert(param); mParameterList.push_back(param); };
             INLINE void Add(const ParameterListT &plist) { mParameterList.insert(mParameterList.end(), plist.begin(), plist.end()); };
             
+            INLINE const std::shared_ptr< iParseTreeNode > &Function() const { return mFunction; };
+            
+            //  Makes the calls through function, once after calls have been
+            //  made the usual way; until then, and whenever the callee turns
+            //  out to be some other function, the call is made as usual.
+            INLINE void Inline(std::shared_ptr< InlinedFunction > function, const IntegerT &after) { assert(function); mInlined = function; mInlineAfter = after; mCalls = 0; };
+            INLINE bool IsInlined() const throw() { return (0 != mInlined.get()); };
+            
+            //  Returns the function to call, checked against the number of
+            //  arguments; a function taken from the inline cache was checked
+            //  when it was cached.
+            std::shared_ptr< iAtomic > Callee(LanguageSymbolTable &symtab);
+            
+            void ThrowArgumentCountError() const;
+            
+            //  True if a call of function in tail position can be made in
+            //  place of the call to the executing function: it must not be
+            //  able to tell, so every symbol declared since the executing
+            //  function was entered must be bound by a parameter of function.
+            static bool IsTailCallable(const LanguageSymbolTable &symtab, const iAtomic &function);
+            
+            //  Executes the call in tail position: if the callee qualifies, the
+            //  call is left to the executing function to make in its place.
+            std::shared_ptr< iAtomic > ExecuteTailCall(LanguageSymbolTable &symtab);
+            
             //  From iParseTreeNode
             
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
@@ -1471,6 +1920,14 @@ namespace dish
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Children(ChildListT &children);
+            virtual void ChildrenReplaced();
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -1482,17 +1939,19 @@ namespace dish
     {
         public:
         
-            using ReturnValueT = std::shared_ptr< iAtomic >;
-        
             static IntegerT Count;
             static IntegerT Instances;
     
         private:
             std::shared_ptr< iParseTreeNode > mReturn;
+            
+            //  Set if the value returned is a function call made from within a
+            //  function body, i.e., a call in tail position.
+            const bool mTailCall;
         
         protected:
-            INLINE ReturnParseTreeNode(std::shared_ptr< iParseTreeNode > &ret) : ParseTreeNode(), mReturn(ret) { ++Count; ++Instances; };
-            INLINE ReturnParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &ret) : ParseTreeNode(locstr), mReturn(ret) { ++Count; ++Instances; };
+            INLINE ReturnParseTreeNode(std::shared_ptr< iParseTreeNode > &ret, const bool &tailcall) : ParseTreeNode(), mReturn(ret), mTailCall(tailcall) { assert(!mTailCall || (typeid(FunctionCallParseTreeNode) == typeid(*mReturn))); ++Count; ++Instances; };
+            INLINE ReturnParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &ret, const bool &tailcall) : ParseTreeNode(location), mReturn(ret), mTailCall(tailcall) { assert(!mTailCall || (typeid(FunctionCallParseTreeNode) == typeid(*mReturn))); ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -1501,12 +1960,15 @@ namespace dish
         public:
             virtual ~ReturnParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< ReturnParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &ret) { return std::shared_ptr< ReturnParseTreeNode >(new ReturnParseTreeNode(ret)); };
-            static INLINE std::shared_ptr< ReturnParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &ret) { return std::shared_ptr< ReturnParseTreeNode >(new ReturnParseTreeNode(locstr, ret)); };
+            static INLINE std::shared_ptr< ReturnParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &ret, const bool &tailcall = false) { return MakeShared< ReturnParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) ReturnParseTreeNode(ret, tailcall); }); };
+            static INLINE std::shared_ptr< ReturnParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &ret, const bool &tailcall = false) { return MakeShared< ReturnParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) ReturnParseTreeNode(location, ret, tailcall); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
             
+            INLINE const std::shared_ptr< iParseTreeNode > &Expression() const { return mReturn; };
+            INLINE bool IsTailCall() const throw() { return mTailCall; };
+            
             //  From iParseTreeNode
             
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
@@ -1514,6 +1976,12 @@ namespace dish
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Children(ChildListT &children);
+            virtual void ChildrenReplaced();
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -1528,10 +1996,18 @@ namespace dish
         protected:
             std::shared_ptr< iParseTreeNode > mOpr;
             
-            INLINE OneOprParseTreeNode(std::shared_ptr< iParseTreeNode > opr) : ParseTreeNode(), mOpr(opr) { assert(0 != mOpr.get()); };
-            INLINE OneOprParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr) : ParseTreeNode(locstr), mOpr(opr) { assert(0 != mOpr.get()); };
+            //  Set once the operand was not a boolean, integer or real; from
+            //  then on the node evaluates through the boxed operators only.
+            bool mGeneric;
+            
+            INLINE OneOprParseTreeNode(std::shared_ptr< iParseTreeNode > opr) : ParseTreeNode(), mOpr(opr), mGeneric(false) { assert(0 != mOpr.get()); };
+            INLINE OneOprParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr) : ParseTreeNode(location), mOpr(opr), mGeneric(false) { assert(0 != mOpr.get()); };
             
             INLINE bool equal(const OneOprParseTreeNode &ptn) const { return mOpr->IsEqual(*(ptn.mOpr)); };
+            INLINE std::size_t hash(const ParseTreeTagT &tag) const { return combineHash(tag, mOpr->Hash()); };
+            
+            //  Writes the node, under tag, and its operand.
+            void write(ParseTreeWriter &writer, const ParseTreeTagT &tag) const;
             
         public:
             
@@ -1539,6 +2015,8 @@ namespace dish
             
             virtual bool IsLiteral() const;
             
+            virtual void Children(ChildListT &children);
+            
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
     };
@@ -1549,13 +2027,26 @@ namespace dish
             std::shared_ptr< iParseTreeNode > mOpr1;
             std::shared_ptr< iParseTreeNode > mOpr2;
             
+            //  Set once an operand was not a boolean, integer or real; from
+            //  then on the node evaluates through the boxed operators only.
+            bool mGeneric;
+            
             INLINE TwoOprParseTreeNode(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : 
-                ParseTreeNode(), mOpr1(opr1), mOpr2(opr2) { assert(0 != mOpr1.get()); assert(0 != mOpr2.get()); };
+                ParseTreeNode(), mOpr1(opr1), mOpr2(opr2), mGeneric(false) { assert(0 != mOpr1.get()); assert(0 != mOpr2.get()); };
                 
-            INLINE TwoOprParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : 
-                ParseTreeNode(locstr), mOpr1(opr1), mOpr2(opr2) { assert(0 != mOpr1.get()); assert(0 != mOpr2.get()); };
+            INLINE TwoOprParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : 
+                ParseTreeNode(location), mOpr1(opr1), mOpr2(opr2), mGeneric(false) { assert(0 != mOpr1.get()); assert(0 != mOpr2.get()); };
                 
             INLINE bool equal(const TwoOprParseTreeNode &ptn) const { return (mOpr1->IsEqual(*(ptn.mOpr1)) && mOpr2->IsEqual(*(ptn.mOpr2))); };
+            INLINE std::size_t hash(const ParseTreeTagT &tag) const { return combineHash(combineHash(tag, mOpr1->Hash()), mOpr2->Hash()); };
+            
+            //  Evaluates the operands, right first if reversed is set, and
+            //  combines them by op into result; the location of the node is
+            //  added to any error.
+            void executeOperands(LanguageSymbolTable &symtab, ValueHandle &result, const bool &reversed, TwoArgHandleOpF op);
+            
+            //  Writes the node, under tag, and its operands.
+            void write(ParseTreeWriter &writer, const ParseTreeTagT &tag) const;
         
         public:
             
@@ -1563,6 +2054,8 @@ namespace dish
             
             virtual bool IsLiteral() const;
             
+            virtual void Children(ChildListT &children);
+            
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
     };
@@ -1576,13 +2069,25 @@ namespace dish
         protected:
             ChainedOprListT mOprList;
             
-            INLINE ChainedOprParseTreeNode() : ParseTreeNode(), mOprList() {};
-            INLINE ChainedOprParseTreeNode(std::shared_ptr< iParseTreeNode > &opr) : ParseTreeNode(), mOprList() { assert(0 != opr.get()); mOprList.push_back(opr); };
+            //  Set once an operand was not a boolean, integer or real; from
+            //  then on the node evaluates through the boxed operators only.
+            bool mGeneric;
+            
+            INLINE ChainedOprParseTreeNode() : ParseTreeNode(), mOprList(), mGeneric(false) {};
+            INLINE ChainedOprParseTreeNode(std::shared_ptr< iParseTreeNode > &opr) : ParseTreeNode(), mOprList(), mGeneric(false) { assert(0 != opr.get()); mOprList.push_back(opr); };
             
-            INLINE ChainedOprParseTreeNode(const std::string &locstr) : ParseTreeNode(locstr), mOprList() {};
-            INLINE ChainedOprParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr) : ParseTreeNode(locstr), mOprList() { assert(0 != opr.get()); mOprList.push_back(opr); };
+            INLINE ChainedOprParseTreeNode(const SourceLocationT &location) : ParseTreeNode(location), mOprList(), mGeneric(false) {};
+            INLINE ChainedOprParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr) : ParseTreeNode(location), mOprList(), mGeneric(false) { assert(0 != opr.get()); mOprList.push_back(opr); };
             
             bool equal(const ChainedOprParseTreeNode &ptn) const;
+            std::size_t hash(const ParseTreeTagT &tag) const;
+            
+            //  Evaluates the operands from left to right, combining them by op
+            //  into result.
+            void executeOperands(LanguageSymbolTable &symtab, ValueHandle &result, TwoArgHandleOpF op);
+            
+            //  Writes the node, under tag, and its operands.
+            void write(ParseTreeWriter &writer, const ParseTreeTagT &tag) const;
             
             virtual std::shared_ptr< iAtomic > execute(std::shared_ptr< iAtomic > opr1, std::shared_ptr< iAtomic > opr2) = 0;
         
@@ -1593,6 +2098,8 @@ namespace dish
             //  From iParseTreeNode
             
             virtual bool IsLiteral() const;
+            
+            virtual void Children(ChildListT &children);
         
     };
 
@@ -1607,7 +2114,9 @@ namespace dish
     
         protected:
             INLINE NegateOpParseTreeNode(std::shared_ptr< iParseTreeNode > &opr) : OneOprParseTreeNode(opr) { ++Count; ++Instances; };
-            INLINE NegateOpParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr) : OneOprParseTreeNode(locstr, opr) { ++Count; ++Instances; };
+            INLINE NegateOpParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr) : OneOprParseTreeNode(location, opr) { ++Count; ++Instances; };
+            
+            INLINE NegateOpParseTreeNode(const NegateOpParseTreeNode &ptn) : OneOprParseTreeNode(ptn) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -1616,8 +2125,8 @@ namespace dish
         public:
             virtual ~NegateOpParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< NegateOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr) { return std::shared_ptr< NegateOpParseTreeNode >(new NegateOpParseTreeNode(opr)); };
-            static INLINE std::shared_ptr< NegateOpParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr) { return std::shared_ptr< NegateOpParseTreeNode >(new NegateOpParseTreeNode(locstr, opr)); };
+            static INLINE std::shared_ptr< NegateOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr) { return MakeShared< NegateOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) NegateOpParseTreeNode(opr); }); };
+            static INLINE std::shared_ptr< NegateOpParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr) { return MakeShared< NegateOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) NegateOpParseTreeNode(location, opr); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -1627,7 +2136,14 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute();
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -1644,7 +2160,9 @@ namespace dish
     
         protected:
             INLINE AddOpChainParseTreeNode(std::shared_ptr< iParseTreeNode > &term) : ChainedOprParseTreeNode(term) { ++Count; ++Instances; };
-            INLINE AddOpChainParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &term) : ChainedOprParseTreeNode(locstr, term) { ++Count; ++Instances; };
+            INLINE AddOpChainParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &term) : ChainedOprParseTreeNode(location, term) { ++Count; ++Instances; };
+            
+            INLINE AddOpChainParseTreeNode(const AddOpChainParseTreeNode &ptn) : ChainedOprParseTreeNode(ptn) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -1659,8 +2177,8 @@ namespace dish
         public:
             virtual ~AddOpChainParseTreeNode() { --Instances; };
         
-            static INLINE std::shared_ptr< AddOpChainParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &term) { return std::shared_ptr< AddOpChainParseTreeNode >(new AddOpChainParseTreeNode(term)); };
-            static INLINE std::shared_ptr< AddOpChainParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &term) { return std::shared_ptr< AddOpChainParseTreeNode >(new AddOpChainParseTreeNode(locstr, term)); };
+            static INLINE std::shared_ptr< AddOpChainParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &term) { return MakeShared< AddOpChainParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) AddOpChainParseTreeNode(term); }); };
+            static INLINE std::shared_ptr< AddOpChainParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &term) { return MakeShared< AddOpChainParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) AddOpChainParseTreeNode(location, term); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -1670,7 +2188,14 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute();
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -1687,7 +2212,9 @@ namespace dish
     
         protected:
             INLINE SubOpParseTreeNode(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(opr1, opr2) { ++Count; ++Instances; };
-            INLINE SubOpParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(locstr, opr1, opr2) { ++Count; ++Instances; };
+            INLINE SubOpParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(location, opr1, opr2) { ++Count; ++Instances; };
+            
+            INLINE SubOpParseTreeNode(const SubOpParseTreeNode &ptn) : TwoOprParseTreeNode(ptn) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -1696,8 +2223,8 @@ namespace dish
         public:
             virtual ~SubOpParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< SubOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< SubOpParseTreeNode >(new SubOpParseTreeNode(opr1, opr2)); };
-            static INLINE std::shared_ptr< SubOpParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< SubOpParseTreeNode >(new SubOpParseTreeNode(locstr, opr1, opr2)); };
+            static INLINE std::shared_ptr< SubOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< SubOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) SubOpParseTreeNode(opr1, opr2); }); };
+            static INLINE std::shared_ptr< SubOpParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< SubOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) SubOpParseTreeNode(location, opr1, opr2); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -1707,7 +2234,14 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute();
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -1724,7 +2258,9 @@ namespace dish
     
         protected:
             INLINE MulOpChainParseTreeNode(std::shared_ptr< iParseTreeNode > &term) : ChainedOprParseTreeNode(term) { ++Count; ++Instances; };
-            INLINE MulOpChainParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &term) : ChainedOprParseTreeNode(locstr, term) { ++Count; ++Instances; };
+            INLINE MulOpChainParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &term) : ChainedOprParseTreeNode(location, term) { ++Count; ++Instances; };
+            
+            INLINE MulOpChainParseTreeNode(const MulOpChainParseTreeNode &ptn) : ChainedOprParseTreeNode(ptn) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -1739,8 +2275,8 @@ namespace dish
         public:
             virtual ~MulOpChainParseTreeNode() { --Instances; };
         
-            static INLINE std::shared_ptr< MulOpChainParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &term) { return std::shared_ptr< MulOpChainParseTreeNode >(new MulOpChainParseTreeNode(term)); };
-            static INLINE std::shared_ptr< MulOpChainParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &term) { return std::shared_ptr< MulOpChainParseTreeNode >(new MulOpChainParseTreeNode(locstr, term)); };
+            static INLINE std::shared_ptr< MulOpChainParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &term) { return MakeShared< MulOpChainParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) MulOpChainParseTreeNode(term); }); };
+            static INLINE std::shared_ptr< MulOpChainParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &term) { return MakeShared< MulOpChainParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) MulOpChainParseTreeNode(location, term); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -1750,7 +2286,14 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute();
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -1767,7 +2310,9 @@ namespace dish
     
         protected:
             INLINE DivOpParseTreeNode(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(opr1, opr2) { ++Count; ++Instances; };
-            INLINE DivOpParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(locstr, opr1, opr2) { ++Count; ++Instances; };
+            INLINE DivOpParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(location, opr1, opr2) { ++Count; ++Instances; };
+            
+            INLINE DivOpParseTreeNode(const DivOpParseTreeNode &ptn) : TwoOprParseTreeNode(ptn) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -1776,8 +2321,8 @@ namespace dish
         public:
             virtual ~DivOpParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< DivOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< DivOpParseTreeNode >(new DivOpParseTreeNode(opr1, opr2)); };
-            static INLINE std::shared_ptr< DivOpParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< DivOpParseTreeNode >(new DivOpParseTreeNode(locstr, opr1, opr2)); };
+            static INLINE std::shared_ptr< DivOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< DivOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) DivOpParseTreeNode(opr1, opr2); }); };
+            static INLINE std::shared_ptr< DivOpParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< DivOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) DivOpParseTreeNode(location, opr1, opr2); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -1787,7 +2332,14 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute();
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -1804,7 +2356,9 @@ namespace dish
     
         protected:
             INLINE ModOpParseTreeNode(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(opr1, opr2) { ++Count; ++Instances; };
-            INLINE ModOpParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(locstr, opr1, opr2) { ++Count; ++Instances; };
+            INLINE ModOpParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(location, opr1, opr2) { ++Count; ++Instances; };
+            
+            INLINE ModOpParseTreeNode(const ModOpParseTreeNode &ptn) : TwoOprParseTreeNode(ptn) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -1813,8 +2367,8 @@ namespace dish
         public:
             virtual ~ModOpParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< ModOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< ModOpParseTreeNode >(new ModOpParseTreeNode(opr1, opr2)); };
-            static INLINE std::shared_ptr< ModOpParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< ModOpParseTreeNode >(new ModOpParseTreeNode(locstr, opr1, opr2)); };
+            static INLINE std::shared_ptr< ModOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< ModOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) ModOpParseTreeNode(opr1, opr2); }); };
+            static INLINE std::shared_ptr< ModOpParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< ModOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) ModOpParseTreeNode(location, opr1, opr2); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -1824,7 +2378,14 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute();
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -1841,7 +2402,9 @@ namespace dish
     
         protected:
             INLINE PowOpParseTreeNode(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(opr1, opr2) { ++Count; ++Instances; };
-            INLINE PowOpParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(locstr, opr1, opr2) { ++Count; ++Instances; };
+            INLINE PowOpParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(location, opr1, opr2) { ++Count; ++Instances; };
+            
+            INLINE PowOpParseTreeNode(const PowOpParseTreeNode &ptn) : TwoOprParseTreeNode(ptn) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -1850,8 +2413,8 @@ namespace dish
         public:
             virtual ~PowOpParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< PowOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< PowOpParseTreeNode >(new PowOpParseTreeNode(opr1, opr2)); };
-            static INLINE std::shared_ptr< PowOpParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< PowOpParseTreeNode >(new PowOpParseTreeNode(locstr, opr1, opr2)); };
+            static INLINE std::shared_ptr< PowOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< PowOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) PowOpParseTreeNode(opr1, opr2); }); };
+            static INLINE std::shared_ptr< PowOpParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< PowOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) PowOpParseTreeNode(location, opr1, opr2); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -1862,6 +2425,11 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -1880,7 +2448,9 @@ namespace dish
     
         protected:
             INLINE NotOpParseTreeNode(std::shared_ptr< iParseTreeNode > &opr) : OneOprParseTreeNode(opr) { ++Count; ++Instances; };
-            INLINE NotOpParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr) : OneOprParseTreeNode(locstr, opr) { ++Count; ++Instances; };
+            INLINE NotOpParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr) : OneOprParseTreeNode(location, opr) { ++Count; ++Instances; };
+            
+            INLINE NotOpParseTreeNode(const NotOpParseTreeNode &ptn) : OneOprParseTreeNode(ptn) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -1889,8 +2459,8 @@ namespace dish
         public:
             virtual ~NotOpParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< NotOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr) { return std::shared_ptr< NotOpParseTreeNode >(new NotOpParseTreeNode(opr)); };
-            static INLINE std::shared_ptr< NotOpParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr) { return std::shared_ptr< NotOpParseTreeNode >(new NotOpParseTreeNode(locstr, opr)); };
+            static INLINE std::shared_ptr< NotOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr) { return MakeShared< NotOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) NotOpParseTreeNode(opr); }); };
+            static INLINE std::shared_ptr< NotOpParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr) { return MakeShared< NotOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) NotOpParseTreeNode(location, opr); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -1900,7 +2470,14 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute();
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -1917,7 +2494,9 @@ namespace dish
     
         protected:
             INLINE AndOpChainParseTreeNode(std::shared_ptr< iParseTreeNode > &term) : ChainedOprParseTreeNode(term) { ++Count; ++Instances; };
-            INLINE AndOpChainParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &term) : ChainedOprParseTreeNode(locstr, term) { ++Count; ++Instances; };
+            INLINE AndOpChainParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &term) : ChainedOprParseTreeNode(location, term) { ++Count; ++Instances; };
+            
+            INLINE AndOpChainParseTreeNode(const AndOpChainParseTreeNode &ptn) : ChainedOprParseTreeNode(ptn) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -1932,8 +2511,8 @@ namespace dish
         public:
             virtual ~AndOpChainParseTreeNode() { --Instances; };
         
-            static INLINE std::shared_ptr< AndOpChainParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &term) { return std::shared_ptr< AndOpChainParseTreeNode >(new AndOpChainParseTreeNode(term)); };
-            static INLINE std::shared_ptr< AndOpChainParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &term) { return std::shared_ptr< AndOpChainParseTreeNode >(new AndOpChainParseTreeNode(locstr, term)); };
+            static INLINE std::shared_ptr< AndOpChainParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &term) { return MakeShared< AndOpChainParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) AndOpChainParseTreeNode(term); }); };
+            static INLINE std::shared_ptr< AndOpChainParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &term) { return MakeShared< AndOpChainParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) AndOpChainParseTreeNode(location, term); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -1943,7 +2522,14 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute();
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -1960,7 +2546,9 @@ namespace dish
     
         protected:
             INLINE OrOpChainParseTreeNode(std::shared_ptr< iParseTreeNode > &term) : ChainedOprParseTreeNode(term) { ++Count; ++Instances; };
-            INLINE OrOpChainParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &term) : ChainedOprParseTreeNode(locstr, term) { ++Count; ++Instances; };
+            INLINE OrOpChainParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &term) : ChainedOprParseTreeNode(location, term) { ++Count; ++Instances; };
+            
+            INLINE OrOpChainParseTreeNode(const OrOpChainParseTreeNode &ptn) : ChainedOprParseTreeNode(ptn) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -1976,8 +2564,8 @@ namespace dish
         public:
             virtual ~OrOpChainParseTreeNode() { --Instances; };
         
-            static INLINE std::shared_ptr< OrOpChainParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &term) { return std::shared_ptr< OrOpChainParseTreeNode >(new OrOpChainParseTreeNode(term)); };
-            static INLINE std::shared_ptr< OrOpChainParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &term) { return std::shared_ptr< OrOpChainParseTreeNode >(new OrOpChainParseTreeNode(locstr, term)); };
+            static INLINE std::shared_ptr< OrOpChainParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &term) { return MakeShared< OrOpChainParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) OrOpChainParseTreeNode(term); }); };
+            static INLINE std::shared_ptr< OrOpChainParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &term) { return MakeShared< OrOpChainParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) OrOpChainParseTreeNode(location, term); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -1987,7 +2575,14 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute();
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -2004,7 +2599,9 @@ namespace dish
     
         protected:
             INLINE XorOpChainParseTreeNode(std::shared_ptr< iParseTreeNode > &term) : ChainedOprParseTreeNode(term) { ++Count; ++Instances; };
-            INLINE XorOpChainParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &term) : ChainedOprParseTreeNode(locstr, term) { ++Count; ++Instances; };
+            INLINE XorOpChainParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &term) : ChainedOprParseTreeNode(location, term) { ++Count; ++Instances; };
+            
+            INLINE XorOpChainParseTreeNode(const XorOpChainParseTreeNode &ptn) : ChainedOprParseTreeNode(ptn) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -2019,8 +2616,8 @@ namespace dish
         public:
             virtual ~XorOpChainParseTreeNode() { --Instances; };
         
-            static INLINE std::shared_ptr< XorOpChainParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &term) { return std::shared_ptr< XorOpChainParseTreeNode >(new XorOpChainParseTreeNode(term)); };
-            static INLINE std::shared_ptr< XorOpChainParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &term) { return std::shared_ptr< XorOpChainParseTreeNode >(new XorOpChainParseTreeNode(locstr, term)); };
+            static INLINE std::shared_ptr< XorOpChainParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &term) { return MakeShared< XorOpChainParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) XorOpChainParseTreeNode(term); }); };
+            static INLINE std::shared_ptr< XorOpChainParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &term) { return MakeShared< XorOpChainParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) XorOpChainParseTreeNode(location, term); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -2030,7 +2627,14 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute();
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -2049,7 +2653,9 @@ namespace dish
     
         protected:
             INLINE LessThanOpParseTreeNode(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(opr1, opr2) { ++Count; ++Instances; };
-            INLINE LessThanOpParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(locstr, opr1, opr2) { ++Count; ++Instances; };
+            INLINE LessThanOpParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(location, opr1, opr2) { ++Count; ++Instances; };
+            
+            INLINE LessThanOpParseTreeNode(const LessThanOpParseTreeNode &ptn) : TwoOprParseTreeNode(ptn) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -2058,8 +2664,8 @@ namespace dish
         public:
             virtual ~LessThanOpParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< LessThanOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< LessThanOpParseTreeNode >(new LessThanOpParseTreeNode(opr1, opr2)); };
-            static INLINE std::shared_ptr< LessThanOpParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< LessThanOpParseTreeNode >(new LessThanOpParseTreeNode(locstr, opr1, opr2)); };
+            static INLINE std::shared_ptr< LessThanOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< LessThanOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LessThanOpParseTreeNode(opr1, opr2); }); };
+            static INLINE std::shared_ptr< LessThanOpParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< LessThanOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LessThanOpParseTreeNode(location, opr1, opr2); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -2069,7 +2675,14 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute();
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -2086,7 +2699,9 @@ namespace dish
     
         protected:
             INLINE LessThanEqualOpParseTreeNode(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(opr1, opr2) { ++Count; ++Instances; };
-            INLINE LessThanEqualOpParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(locstr, opr1, opr2) { ++Count; ++Instances; };
+            INLINE LessThanEqualOpParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(location, opr1, opr2) { ++Count; ++Instances; };
+            
+            INLINE LessThanEqualOpParseTreeNode(const LessThanEqualOpParseTreeNode &ptn) : TwoOprParseTreeNode(ptn) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -2095,8 +2710,8 @@ namespace dish
         public:
             virtual ~LessThanEqualOpParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< LessThanEqualOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< LessThanEqualOpParseTreeNode >(new LessThanEqualOpParseTreeNode(opr1, opr2)); };
-            static INLINE std::shared_ptr< LessThanEqualOpParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< LessThanEqualOpParseTreeNode >(new LessThanEqualOpParseTreeNode(locstr, opr1, opr2)); };
+            static INLINE std::shared_ptr< LessThanEqualOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< LessThanEqualOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LessThanEqualOpParseTreeNode(opr1, opr2); }); };
+            static INLINE std::shared_ptr< LessThanEqualOpParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< LessThanEqualOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) LessThanEqualOpParseTreeNode(location, opr1, opr2); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -2106,7 +2721,14 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute();
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -2123,7 +2745,9 @@ namespace dish
     
         protected:
             INLINE EqualOpParseTreeNode(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(opr1, opr2) { ++Count; ++Instances; };
-            INLINE EqualOpParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(locstr, opr1, opr2) { ++Count; ++Instances; };
+            INLINE EqualOpParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(location, opr1, opr2) { ++Count; ++Instances; };
+            
+            INLINE EqualOpParseTreeNode(const EqualOpParseTreeNode &ptn) : TwoOprParseTreeNode(ptn) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -2132,8 +2756,8 @@ namespace dish
         public:
             virtual ~EqualOpParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< EqualOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< EqualOpParseTreeNode >(new EqualOpParseTreeNode(opr1, opr2)); };
-            static INLINE std::shared_ptr< EqualOpParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< EqualOpParseTreeNode >(new EqualOpParseTreeNode(locstr, opr1, opr2)); };
+            static INLINE std::shared_ptr< EqualOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< EqualOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) EqualOpParseTreeNode(opr1, opr2); }); };
+            static INLINE std::shared_ptr< EqualOpParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< EqualOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) EqualOpParseTreeNode(location, opr1, opr2); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -2143,7 +2767,14 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute();
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -2160,7 +2791,9 @@ namespace dish
     
         protected:
             INLINE NotEqualOpParseTreeNode(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(opr1, opr2) { ++Count; ++Instances; };
-            INLINE NotEqualOpParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(locstr, opr1, opr2) { ++Count; ++Instances; };
+            INLINE NotEqualOpParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(location, opr1, opr2) { ++Count; ++Instances; };
+            
+            INLINE NotEqualOpParseTreeNode(const NotEqualOpParseTreeNode &ptn) : TwoOprParseTreeNode(ptn) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -2169,8 +2802,8 @@ namespace dish
         public:
             virtual ~NotEqualOpParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< NotEqualOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< NotEqualOpParseTreeNode >(new NotEqualOpParseTreeNode(opr1, opr2)); };
-            static INLINE std::shared_ptr< NotEqualOpParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< NotEqualOpParseTreeNode >(new NotEqualOpParseTreeNode(locstr, opr1, opr2)); };
+            static INLINE std::shared_ptr< NotEqualOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< NotEqualOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) NotEqualOpParseTreeNode(opr1, opr2); }); };
+            static INLINE std::shared_ptr< NotEqualOpParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< NotEqualOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) NotEqualOpParseTreeNode(location, opr1, opr2); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -2180,7 +2813,14 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute();
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -2197,7 +2837,9 @@ namespace dish
     
         protected:
             INLINE GreaterThanEqualOpParseTreeNode(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(opr1, opr2) { ++Count; ++Instances; };
-            INLINE GreaterThanEqualOpParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(locstr, opr1, opr2) { ++Count; ++Instances; };
+            INLINE GreaterThanEqualOpParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(location, opr1, opr2) { ++Count; ++Instances; };
+            
+            INLINE GreaterThanEqualOpParseTreeNode(const GreaterThanEqualOpParseTreeNode &ptn) : TwoOprParseTreeNode(ptn) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -2206,8 +2848,8 @@ namespace dish
         public:
             virtual ~GreaterThanEqualOpParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< GreaterThanEqualOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< GreaterThanEqualOpParseTreeNode >(new GreaterThanEqualOpParseTreeNode(opr1, opr2)); };
-            static INLINE std::shared_ptr< GreaterThanEqualOpParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< GreaterThanEqualOpParseTreeNode >(new GreaterThanEqualOpParseTreeNode(locstr, opr1, opr2)); };
+            static INLINE std::shared_ptr< GreaterThanEqualOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< GreaterThanEqualOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) GreaterThanEqualOpParseTreeNode(opr1, opr2); }); };
+            static INLINE std::shared_ptr< GreaterThanEqualOpParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< GreaterThanEqualOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) GreaterThanEqualOpParseTreeNode(location, opr1, opr2); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -2217,7 +2859,14 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute();
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -2234,7 +2883,9 @@ namespace dish
     
         protected:
             INLINE GreaterThanOpParseTreeNode(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(opr1, opr2) { ++Count; ++Instances; };
-            INLINE GreaterThanOpParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(locstr, opr1, opr2) { ++Count; ++Instances; };
+            INLINE GreaterThanOpParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) : TwoOprParseTreeNode(location, opr1, opr2) { ++Count; ++Instances; };
+            
+            INLINE GreaterThanOpParseTreeNode(const GreaterThanOpParseTreeNode &ptn) : TwoOprParseTreeNode(ptn) { ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -2243,8 +2894,8 @@ namespace dish
         public:
             virtual ~GreaterThanOpParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< GreaterThanOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< GreaterThanOpParseTreeNode >(new GreaterThanOpParseTreeNode(opr1, opr2)); };
-            static INLINE std::shared_ptr< GreaterThanOpParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return std::shared_ptr< GreaterThanOpParseTreeNode >(new GreaterThanOpParseTreeNode(locstr, opr1, opr2)); };
+            static INLINE std::shared_ptr< GreaterThanOpParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< GreaterThanOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) GreaterThanOpParseTreeNode(opr1, opr2); }); };
+            static INLINE std::shared_ptr< GreaterThanOpParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &opr1, std::shared_ptr< iParseTreeNode > &opr2) { return MakeShared< GreaterThanOpParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) GreaterThanOpParseTreeNode(location, opr1, opr2); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -2254,7 +2905,14 @@ namespace dish
             virtual std::shared_ptr< iAtomic > Execute();
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
             
+            virtual void ExecuteOperand(LanguageSymbolTable &symtab, ValueHandle &opr);
+            
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual std::shared_ptr< iParseTreeNode > Copy() const;
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -2291,7 +2949,7 @@ namespace dish
                 ++Instances;
             };
             
-            INLINE StatementBlockParseTreeNode(const std::string &locstr) : ParseTreeNode(locstr), mBlock()
+            INLINE StatementBlockParseTreeNode(const SourceLocationT &location) : ParseTreeNode(location), mBlock()
             {
 #ifdef LIST_TYPE_PREFER_VECTOR
                 mBlock.reserve(LIST_TYPE_PREFER_VECTOR);
@@ -2308,8 +2966,8 @@ namespace dish
         public:
             virtual ~StatementBlockParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< StatementBlockParseTreeNode > MakeValue() { return std::shared_ptr< StatementBlockParseTreeNode >(new StatementBlockParseTreeNode()); };
-            static INLINE std::shared_ptr< StatementBlockParseTreeNode > MakeValue(const std::string &locstr) { return std::shared_ptr< StatementBlockParseTreeNode >(new StatementBlockParseTreeNode(locstr)); };
+            static INLINE std::shared_ptr< StatementBlockParseTreeNode > MakeValue() { return MakeShared< StatementBlockParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) StatementBlockParseTreeNode(); }); };
+            static INLINE std::shared_ptr< StatementBlockParseTreeNode > MakeValue(const SourceLocationT &location) { return MakeShared< StatementBlockParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) StatementBlockParseTreeNode(location); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -2323,6 +2981,12 @@ namespace dish
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Children(ChildListT &children);
+            virtual void ChildrenReplaced();
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -2330,6 +2994,93 @@ namespace dish
         
     };
     
+    //  A file parsed in its entirety before any of it is executed: either the
+    //  program itself, or a file it imports. The statements are executed in
+    //  the scope the module is executed in, as those of an imported file are
+    //  when the program is executed a statement at a time.
+    class ModuleParseTreeNode : public ParseTreeNode
+    {
+        public:
+        
+#ifdef LIST_TYPE_PREFER_VECTOR
+            using StatementListT = std::vector< std::shared_ptr< iParseTreeNode > >;
+#else
+            using StatementListT = std::list< std::shared_ptr< iParseTreeNode > >;
+#endif
+    
+        private:
+            const std::string mName;
+            const bool mEntryPoint;
+            
+            StatementListT mStatements;
+        
+            static IntegerT Count;
+            static IntegerT Instances;
+    
+        protected:
+            INLINE ModuleParseTreeNode(const std::string &name, const bool &entry) : ParseTreeNode(), mName(name), mEntryPoint(entry), mStatements()
+            {
+#ifdef LIST_TYPE_PREFER_VECTOR
+                mStatements.reserve(LIST_TYPE_PREFER_VECTOR);
+#endif
+
+                ++Count;
+                ++Instances;
+            };
+            
+            INLINE ModuleParseTreeNode(const SourceLocationT &location, const std::string &name, const bool &entry) : ParseTreeNode(location), mName(name), mEntryPoint(entry), mStatements()
+            {
+#ifdef LIST_TYPE_PREFER_VECTOR
+                mStatements.reserve(LIST_TYPE_PREFER_VECTOR);
+#endif
+
+                ++Count;
+                ++Instances;
+            };
+            
+            //  From iParseTreeNode
+    
+            virtual bool isEqual(const ModuleParseTreeNode &ptn) const;
+            
+        public:
+            virtual ~ModuleParseTreeNode() { --Instances; };
+            
+            static INLINE std::shared_ptr< ModuleParseTreeNode > MakeValue(const std::string &name, const bool &entry) { return MakeShared< ModuleParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) ModuleParseTreeNode(name, entry); }); };
+            static INLINE std::shared_ptr< ModuleParseTreeNode > MakeValue(const SourceLocationT &location, const std::string &name, const bool &entry) { return MakeShared< ModuleParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) ModuleParseTreeNode(location, name, entry); }); };
+            
+            static INLINE const IntegerT &NumInstances() throw() { return Count; };
+            static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
+            
+            INLINE const std::string &Name() const { return mName; };
+            
+            //  Set for the file named on the command-line, and clear for the
+            //  files it imports.
+            INLINE bool IsEntryPoint() const throw() { return mEntryPoint; };
+            
+            INLINE const StatementListT &Statements() const { return mStatements; };
+            
+            INLINE void Add(std::shared_ptr< iParseTreeNode > stmt) { assert(stmt); mStatements.push_back(stmt); };
+            
+            //  From iParseTreeNode
+            
+            virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
+            
+            virtual void Validate(LanguageSymbolTable &symtab) const;
+            
+            virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Children(ChildListT &children);
+            virtual void ChildrenReplaced();
+            
+            virtual void Write(ParseTreeWriter &writer) const;
+            
+            //  From iPrintable
+            
+            virtual void Print(std::ostream &out, const std::string::size_type &indent = 0) const;
+        
+    };
+
     class IfStatementParseTreeNode : public ParseTreeNode
     {
         private:
@@ -2344,14 +3095,14 @@ namespace dish
             INLINE IfStatementParseTreeNode(std::shared_ptr< iParseTreeNode > &cond, std::shared_ptr< iParseTreeNode > &ifblk) : 
                 ParseTreeNode(), mCondition(cond), mIfBlock(ifblk), mElseBlock() { assert(mCondition); assert(mIfBlock); ++Count; ++Instances; };
                 
-            INLINE IfStatementParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &cond, std::shared_ptr< iParseTreeNode > &ifblk) : 
-                ParseTreeNode(locstr), mCondition(cond), mIfBlock(ifblk), mElseBlock() { assert(mCondition); assert(mIfBlock); ++Count; ++Instances; };
+            INLINE IfStatementParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &cond, std::shared_ptr< iParseTreeNode > &ifblk) : 
+                ParseTreeNode(location), mCondition(cond), mIfBlock(ifblk), mElseBlock() { assert(mCondition); assert(mIfBlock); ++Count; ++Instances; };
             
             INLINE IfStatementParseTreeNode(std::shared_ptr< iParseTreeNode > &cond, std::shared_ptr< iParseTreeNode > &ifblk, std::shared_ptr< iParseTreeNode > &elseblk) : 
                 ParseTreeNode(), mCondition(cond), mIfBlock(ifblk), mElseBlock(elseblk) { assert(mCondition); assert(mIfBlock); assert(mElseBlock); ++Count; ++Instances; };
                 
-            INLINE IfStatementParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &cond, std::shared_ptr< iParseTreeNode > &ifblk, std::shared_ptr< iParseTreeNode > &elseblk) : 
-                ParseTreeNode(locstr), mCondition(cond), mIfBlock(ifblk), mElseBlock(elseblk) { assert(mCondition); assert(mIfBlock); assert(mElseBlock); ++Count; ++Instances; };
+            INLINE IfStatementParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &cond, std::shared_ptr< iParseTreeNode > &ifblk, std::shared_ptr< iParseTreeNode > &elseblk) : 
+                ParseTreeNode(location), mCondition(cond), mIfBlock(ifblk), mElseBlock(elseblk) { assert(mCondition); assert(mIfBlock); assert(mElseBlock); ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -2360,11 +3111,11 @@ namespace dish
         public:
             virtual ~IfStatementParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< IfStatementParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &cond, std::shared_ptr< iParseTreeNode > &ifblk) { return std::shared_ptr< IfStatementParseTreeNode >(new IfStatementParseTreeNode(cond, ifblk)); };
-            static INLINE std::shared_ptr< IfStatementParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &cond, std::shared_ptr< iParseTreeNode > &ifblk) { return std::shared_ptr< IfStatementParseTreeNode >(new IfStatementParseTreeNode(locstr, cond, ifblk)); };
+            static INLINE std::shared_ptr< IfStatementParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &cond, std::shared_ptr< iParseTreeNode > &ifblk) { return MakeShared< IfStatementParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) IfStatementParseTreeNode(cond, ifblk); }); };
+            static INLINE std::shared_ptr< IfStatementParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &cond, std::shared_ptr< iParseTreeNode > &ifblk) { return MakeShared< IfStatementParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) IfStatementParseTreeNode(location, cond, ifblk); }); };
             
-            static INLINE std::shared_ptr< IfStatementParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &cond, std::shared_ptr< iParseTreeNode > &ifblk, std::shared_ptr< iParseTreeNode > &elseblk) { return std::shared_ptr< IfStatementParseTreeNode >(new IfStatementParseTreeNode(cond, ifblk, elseblk)); };
-            static INLINE std::shared_ptr< IfStatementParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &cond, std::shared_ptr< iParseTreeNode > &ifblk, std::shared_ptr< iParseTreeNode > &elseblk) { return std::shared_ptr< IfStatementParseTreeNode >(new IfStatementParseTreeNode(locstr, cond, ifblk, elseblk)); };
+            static INLINE std::shared_ptr< IfStatementParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &cond, std::shared_ptr< iParseTreeNode > &ifblk, std::shared_ptr< iParseTreeNode > &elseblk) { return MakeShared< IfStatementParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) IfStatementParseTreeNode(cond, ifblk, elseblk); }); };
+            static INLINE std::shared_ptr< IfStatementParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &cond, std::shared_ptr< iParseTreeNode > &ifblk, std::shared_ptr< iParseTreeNode > &elseblk) { return MakeShared< IfStatementParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) IfStatementParseTreeNode(location, cond, ifblk, elseblk); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -2376,6 +3127,11 @@ namespace dish
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Children(ChildListT &children);
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -2411,7 +3167,7 @@ namespace dish
         
         protected:
             INLINE SwitchStatementParseTreeNode(std::shared_ptr< iParseTreeNode > &expr) : ParseTreeNode(), mExpression(expr), mSwitch(), mOtherwise() { assert(mExpression); ++Count; ++Instances; };
-            INLINE SwitchStatementParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &expr) : ParseTreeNode(locstr), mExpression(expr), mSwitch(), mOtherwise() { assert(mExpression); ++Count; ++Instances; };
+            INLINE SwitchStatementParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &expr) : ParseTreeNode(location), mExpression(expr), mSwitch(), mOtherwise() { assert(mExpression); ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -2420,8 +3176,8 @@ namespace dish
         public:
             virtual ~SwitchStatementParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< SwitchStatementParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &expr) { return std::shared_ptr< SwitchStatementParseTreeNode >(new SwitchStatementParseTreeNode(expr)); };
-            static INLINE std::shared_ptr< SwitchStatementParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &expr) { return std::shared_ptr< SwitchStatementParseTreeNode >(new SwitchStatementParseTreeNode(locstr, expr)); };
+            static INLINE std::shared_ptr< SwitchStatementParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &expr) { return MakeShared< SwitchStatementParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) SwitchStatementParseTreeNode(expr); }); };
+            static INLINE std::shared_ptr< SwitchStatementParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &expr) { return MakeShared< SwitchStatementParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) SwitchStatementParseTreeNode(location, expr); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -2436,6 +3192,11 @@ namespace dish
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Children(ChildListT &children);
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -2459,16 +3220,16 @@ namespace dish
                 
                 protected:
                     INLINE StepF(std::shared_ptr< iParseTreeNode > &lhs) : ParseTreeNode(), mLeftHandSide(lhs), mStep(OneLit) { assert(0 != mLeftHandSide.get()); assert(0 != mStep.get()); };
-                    INLINE StepF(std::shared_ptr< iParseTreeNode > &lhs, const std::string &locstr) : ParseTreeNode(locstr), mLeftHandSide(lhs), mStep(OneLit) { assert(0 != mLeftHandSide.get()); assert(0 != mStep.get()); };
+                    INLINE StepF(std::shared_ptr< iParseTreeNode > &lhs, const SourceLocationT &location) : ParseTreeNode(location), mLeftHandSide(lhs), mStep(OneLit) { assert(0 != mLeftHandSide.get()); assert(0 != mStep.get()); };
                     INLINE StepF(std::shared_ptr< iParseTreeNode > &lhs, std::shared_ptr< iParseTreeNode > &step) : ParseTreeNode(), mLeftHandSide(lhs), mStep(step) { assert(0 != mLeftHandSide.get()); assert(0 != mStep.get()); };
-                    INLINE StepF(std::shared_ptr< iParseTreeNode > &lhs, std::shared_ptr< iParseTreeNode > &step, const std::string &locstr) : ParseTreeNode(locstr), mLeftHandSide(lhs), mStep(step) { assert(0 != mLeftHandSide.get()); assert(0 != mStep.get()); };
+                    INLINE StepF(std::shared_ptr< iParseTreeNode > &lhs, std::shared_ptr< iParseTreeNode > &step, const SourceLocationT &location) : ParseTreeNode(location), mLeftHandSide(lhs), mStep(step) { assert(0 != mLeftHandSide.get()); assert(0 != mStep.get()); };
                 
                 public:
                 
-                    static std::shared_ptr< StepF > MakeValue(std::shared_ptr< iParseTreeNode > &lhs) { return std::shared_ptr< StepF >(new StepF(lhs)); };
-                    static std::shared_ptr< StepF > MakeValue(std::shared_ptr< iParseTreeNode > &lhs, const std::string &locstr) { return std::shared_ptr< StepF >(new StepF(lhs, locstr)); };
-                    static std::shared_ptr< StepF > MakeValue(std::shared_ptr< iParseTreeNode > &lhs, std::shared_ptr< iParseTreeNode > &step) { return std::shared_ptr< StepF >(new StepF(lhs, step)); };
-                    static std::shared_ptr< StepF > MakeValue(std::shared_ptr< iParseTreeNode > &lhs, std::shared_ptr< iParseTreeNode > &step, const std::string &locstr) { return std::shared_ptr< StepF >(new StepF(lhs, step, locstr)); };
+                    static std::shared_ptr< StepF > MakeValue(std::shared_ptr< iParseTreeNode > &lhs) { return MakeShared< StepF, ParseTreeArena >([&](void *memory) { ::new(memory) StepF(lhs); }); };
+                    static std::shared_ptr< StepF > MakeValue(std::shared_ptr< iParseTreeNode > &lhs, const SourceLocationT &location) { return MakeShared< StepF, ParseTreeArena >([&](void *memory) { ::new(memory) StepF(lhs, location); }); };
+                    static std::shared_ptr< StepF > MakeValue(std::shared_ptr< iParseTreeNode > &lhs, std::shared_ptr< iParseTreeNode > &step) { return MakeShared< StepF, ParseTreeArena >([&](void *memory) { ::new(memory) StepF(lhs, step); }); };
+                    static std::shared_ptr< StepF > MakeValue(std::shared_ptr< iParseTreeNode > &lhs, std::shared_ptr< iParseTreeNode > &step, const SourceLocationT &location) { return MakeShared< StepF, ParseTreeArena >([&](void *memory) { ::new(memory) StepF(lhs, step, location); }); };
             
                     //  From iParseTreeNode
                     
@@ -2486,9 +3247,19 @@ namespace dish
             std::shared_ptr< iParseTreeNode > mAssign;
             std::shared_ptr< iParseTreeNode > mCondition;
             std::shared_ptr< StepF > mIncrement;
+            
+            //  The loop runs as a counted loop, holding on to the variable
+            //  rather than looking it up on every iteration, when the loop
+            //  variable is a plain identifier.
+            std::shared_ptr< iParseTreeNode > mTo;
+            const bool mCounted;
         
             static IntegerT Count;
             static IntegerT Instances;
+            static IntegerT CountedIterations;
+            
+            //  Runs the loop after the variable has been initialized.
+            void executeCounted(LanguageSymbolTable &symtab, std::shared_ptr< iAtomic > variable);
         
         protected:
             INLINE ForLoopParseTreeNode(std::shared_ptr< iParseTreeNode > &id, std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &body) : ParseTreeNode(),
@@ -2496,7 +3267,10 @@ namespace dish
                 
                 mAssign(AssignmentParseTreeNode::MakeValue(id, from)),
                 mCondition(NotEqualOpParseTreeNode::MakeValue(id, to)),
-                mIncrement(StepF::MakeValue(id, OneLit))
+                mIncrement(StepF::MakeValue(id, OneLit)),
+                
+                mTo(to),
+                mCounted(typeid(IdentifierParseTreeNode) == typeid(*id))
             {
                 assert(mAssign);
                 assert(mCondition);
@@ -2507,12 +3281,15 @@ namespace dish
                 ++Instances;
             }
             
-            INLINE ForLoopParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &id, std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &body) : ParseTreeNode(locstr),
+            INLINE ForLoopParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &id, std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &body) : ParseTreeNode(location),
                 mBody(body),
                 
-                mAssign(AssignmentParseTreeNode::MakeValue(locstr, id, from)),
-                mCondition(NotEqualOpParseTreeNode::MakeValue(locstr, id, to)),
-                mIncrement(StepF::MakeValue(id, OneLit, locstr))
+                mAssign(AssignmentParseTreeNode::MakeValue(location, id, from)),
+                mCondition(NotEqualOpParseTreeNode::MakeValue(location, id, to)),
+                mIncrement(StepF::MakeValue(id, OneLit, location)),
+                
+                mTo(to),
+                mCounted(typeid(IdentifierParseTreeNode) == typeid(*id))
             {
                 assert(mAssign);
                 assert(mCondition);
@@ -2528,7 +3305,10 @@ namespace dish
                 
                 mAssign(AssignmentParseTreeNode::MakeValue(id, from)),
                 mCondition(NotEqualOpParseTreeNode::MakeValue(id, to)),
-                mIncrement(StepF::MakeValue(id, step))
+                mIncrement(StepF::MakeValue(id, step)),
+                
+                mTo(to),
+                mCounted(typeid(IdentifierParseTreeNode) == typeid(*id))
             {
                 assert(mAssign);
                 assert(mCondition);
@@ -2539,12 +3319,15 @@ namespace dish
                 ++Instances;
             }
             
-            INLINE ForLoopParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &id, std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &step, std::shared_ptr< iParseTreeNode > &body) : ParseTreeNode(locstr),
+            INLINE ForLoopParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &id, std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &step, std::shared_ptr< iParseTreeNode > &body) : ParseTreeNode(location),
                 mBody(body),
                 
-                mAssign(AssignmentParseTreeNode::MakeValue(locstr, id, from)),
-                mCondition(NotEqualOpParseTreeNode::MakeValue(locstr, id, to)),
-                mIncrement(StepF::MakeValue(id, step, locstr))
+                mAssign(AssignmentParseTreeNode::MakeValue(location, id, from)),
+                mCondition(NotEqualOpParseTreeNode::MakeValue(location, id, to)),
+                mIncrement(StepF::MakeValue(id, step, location)),
+                
+                mTo(to),
+                mCounted(typeid(IdentifierParseTreeNode) == typeid(*id))
             {
                 assert(mAssign);
                 assert(mCondition);
@@ -2562,15 +3345,17 @@ namespace dish
         public:
             virtual ~ForLoopParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< ForLoopParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &id, std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &body) { return std::shared_ptr< ForLoopParseTreeNode >(new ForLoopParseTreeNode(id, from, to, body)); };
-            static INLINE std::shared_ptr< ForLoopParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &id, std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &body) { return std::shared_ptr< ForLoopParseTreeNode >(new ForLoopParseTreeNode(locstr, id, from, to, body)); };
+            static INLINE std::shared_ptr< ForLoopParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &id, std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &body) { return MakeShared< ForLoopParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) ForLoopParseTreeNode(id, from, to, body); }); };
+            static INLINE std::shared_ptr< ForLoopParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &id, std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &body) { return MakeShared< ForLoopParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) ForLoopParseTreeNode(location, id, from, to, body); }); };
             
-            static INLINE std::shared_ptr< ForLoopParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > id, std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &step, std::shared_ptr< iParseTreeNode > &body) { return std::shared_ptr< ForLoopParseTreeNode >(new ForLoopParseTreeNode(id, from, to, step, body)); };
-            static INLINE std::shared_ptr< ForLoopParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &id, std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &step, std::shared_ptr< iParseTreeNode > &body) { return std::shared_ptr< ForLoopParseTreeNode >(new ForLoopParseTreeNode(locstr, id, from, to, step, body)); };
+            static INLINE std::shared_ptr< ForLoopParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > id, std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &step, std::shared_ptr< iParseTreeNode > &body) { return MakeShared< ForLoopParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) ForLoopParseTreeNode(id, from, to, step, body); }); };
+            static INLINE std::shared_ptr< ForLoopParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &id, std::shared_ptr< iParseTreeNode > &from, std::shared_ptr< iParseTreeNode > &to, std::shared_ptr< iParseTreeNode > &step, std::shared_ptr< iParseTreeNode > &body) { return MakeShared< ForLoopParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) ForLoopParseTreeNode(location, id, from, to, step, body); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
             
+            static INLINE const IntegerT &NumCountedIterations() throw() { return CountedIterations; };
+            
             //  From iParseTreeNode
             
             virtual std::shared_ptr< iAtomic > Execute(LanguageSymbolTable &symtab);
@@ -2578,6 +3363,12 @@ namespace dish
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Children(ChildListT &children);
+            virtual void ChildrenReplaced();
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -2601,8 +3392,8 @@ namespace dish
             INLINE ForEachLoopParseTreeNode(const bool &ref, const std::string &id, std::shared_ptr< iParseTreeNode > &collection, std::shared_ptr< iParseTreeNode > &body) : 
                 ParseTreeNode(), mReference(ref), mId(id), mCollection(collection), mBody(body) { assert(mCollection); assert(mBody); ++Count; ++Instances; };
                 
-            INLINE ForEachLoopParseTreeNode(const std::string &locstr, const bool &ref, const std::string &id, std::shared_ptr< iParseTreeNode > &collection, std::shared_ptr< iParseTreeNode > &body) : 
-                ParseTreeNode(locstr), mReference(ref), mId(id), mCollection(collection), mBody(body) { assert(mCollection); assert(mBody); ++Count; ++Instances; };
+            INLINE ForEachLoopParseTreeNode(const SourceLocationT &location, const bool &ref, const std::string &id, std::shared_ptr< iParseTreeNode > &collection, std::shared_ptr< iParseTreeNode > &body) : 
+                ParseTreeNode(location), mReference(ref), mId(id), mCollection(collection), mBody(body) { assert(mCollection); assert(mBody); ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -2611,8 +3402,8 @@ namespace dish
         public:
             virtual ~ForEachLoopParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< ForEachLoopParseTreeNode > MakeValue(const bool &ref, const std::string &id, std::shared_ptr< iParseTreeNode > &collection, std::shared_ptr< iParseTreeNode > &body) { return std::shared_ptr< ForEachLoopParseTreeNode >(new ForEachLoopParseTreeNode(ref, id, collection, body)); };
-            static INLINE std::shared_ptr< ForEachLoopParseTreeNode > MakeValue(const std::string &locstr, const bool &ref, const std::string &id, std::shared_ptr< iParseTreeNode > &collection, std::shared_ptr< iParseTreeNode > &body) { return std::shared_ptr< ForEachLoopParseTreeNode >(new ForEachLoopParseTreeNode(locstr, ref, id, collection, body)); };
+            static INLINE std::shared_ptr< ForEachLoopParseTreeNode > MakeValue(const bool &ref, const std::string &id, std::shared_ptr< iParseTreeNode > &collection, std::shared_ptr< iParseTreeNode > &body) { return MakeShared< ForEachLoopParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) ForEachLoopParseTreeNode(ref, id, collection, body); }); };
+            static INLINE std::shared_ptr< ForEachLoopParseTreeNode > MakeValue(const SourceLocationT &location, const bool &ref, const std::string &id, std::shared_ptr< iParseTreeNode > &collection, std::shared_ptr< iParseTreeNode > &body) { return MakeShared< ForEachLoopParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) ForEachLoopParseTreeNode(location, ref, id, collection, body); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -2624,6 +3415,12 @@ namespace dish
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Children(ChildListT &children);
+            virtual void ChildrenReplaced();
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -2644,8 +3441,8 @@ namespace dish
             INLINE WhileLoopParseTreeNode(std::shared_ptr< iParseTreeNode > &condition, std::shared_ptr< iParseTreeNode > &body) : 
                 ParseTreeNode(), mCondition(condition), mBody(body) { assert(mCondition); assert(mBody); ++Count; ++Instances; };
                 
-            INLINE WhileLoopParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &condition, std::shared_ptr< iParseTreeNode > &body) : 
-                ParseTreeNode(locstr), mCondition(condition), mBody(body) { assert(mCondition); assert(mBody); ++Count; ++Instances; };
+            INLINE WhileLoopParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &condition, std::shared_ptr< iParseTreeNode > &body) : 
+                ParseTreeNode(location), mCondition(condition), mBody(body) { assert(mCondition); assert(mBody); ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -2654,8 +3451,8 @@ namespace dish
         public:
             virtual ~WhileLoopParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< WhileLoopParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &condition, std::shared_ptr< iParseTreeNode > &body) { return std::shared_ptr< WhileLoopParseTreeNode >(new WhileLoopParseTreeNode(condition, body)); };
-            static INLINE std::shared_ptr< WhileLoopParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &condition, std::shared_ptr< iParseTreeNode > &body) { return std::shared_ptr< WhileLoopParseTreeNode >(new WhileLoopParseTreeNode(locstr, condition, body)); };
+            static INLINE std::shared_ptr< WhileLoopParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &condition, std::shared_ptr< iParseTreeNode > &body) { return MakeShared< WhileLoopParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) WhileLoopParseTreeNode(condition, body); }); };
+            static INLINE std::shared_ptr< WhileLoopParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &condition, std::shared_ptr< iParseTreeNode > &body) { return MakeShared< WhileLoopParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) WhileLoopParseTreeNode(location, condition, body); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -2667,6 +3464,11 @@ namespace dish
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Children(ChildListT &children);
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -2704,7 +3506,7 @@ namespace dish
                 ++Instances;
             };
                 
-            INLINE RepeatUntilLoopParseTreeNode(const std::string &locstr, const BodyT &body, std::shared_ptr< iParseTreeNode > &condition) : ParseTreeNode(locstr), mBody(body.begin(), body.end()), mCondition(condition)
+            INLINE RepeatUntilLoopParseTreeNode(const SourceLocationT &location, const BodyT &body, std::shared_ptr< iParseTreeNode > &condition) : ParseTreeNode(location), mBody(body.begin(), body.end()), mCondition(condition)
             {
                 assert(mCondition);
                 
@@ -2723,8 +3525,8 @@ namespace dish
         public:
             virtual ~RepeatUntilLoopParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< RepeatUntilLoopParseTreeNode > MakeValue(const BodyT &body, std::shared_ptr< iParseTreeNode > &condition) { return std::shared_ptr< RepeatUntilLoopParseTreeNode >(new RepeatUntilLoopParseTreeNode(body, condition)); };
-            static INLINE std::shared_ptr< RepeatUntilLoopParseTreeNode > MakeValue(const std::string &locstr, const BodyT &body, std::shared_ptr< iParseTreeNode > &condition) { return std::shared_ptr< RepeatUntilLoopParseTreeNode >(new RepeatUntilLoopParseTreeNode(locstr, body, condition)); };
+            static INLINE std::shared_ptr< RepeatUntilLoopParseTreeNode > MakeValue(const BodyT &body, std::shared_ptr< iParseTreeNode > &condition) { return MakeShared< RepeatUntilLoopParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) RepeatUntilLoopParseTreeNode(body, condition); }); };
+            static INLINE std::shared_ptr< RepeatUntilLoopParseTreeNode > MakeValue(const SourceLocationT &location, const BodyT &body, std::shared_ptr< iParseTreeNode > &condition) { return MakeShared< RepeatUntilLoopParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) RepeatUntilLoopParseTreeNode(location, body, condition); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -2736,6 +3538,12 @@ namespace dish
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Children(ChildListT &children);
+            virtual void ChildrenReplaced();
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -2755,7 +3563,7 @@ namespace dish
         
         protected:
             INLINE AssertParseTreeNode(std::shared_ptr< iParseTreeNode > &condition) : ParseTreeNode(), mCondition(condition) { assert(mCondition); ++Count; ++Instances; };
-            INLINE AssertParseTreeNode(const std::string &locstr, std::shared_ptr< iParseTreeNode > &condition) : ParseTreeNode(locstr), mCondition(condition) { assert(mCondition); ++Count; ++Instances; };
+            INLINE AssertParseTreeNode(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &condition) : ParseTreeNode(location), mCondition(condition) { assert(mCondition); ++Count; ++Instances; };
             
             //  From iParseTreeNode
     
@@ -2764,8 +3572,8 @@ namespace dish
         public:
             virtual ~AssertParseTreeNode() { --Instances; };
             
-            static INLINE std::shared_ptr< AssertParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &condition) { return std::shared_ptr< AssertParseTreeNode >(new AssertParseTreeNode(condition)); };
-            static INLINE std::shared_ptr< AssertParseTreeNode > MakeValue(const std::string &locstr, std::shared_ptr< iParseTreeNode > &condition) { return std::shared_ptr< AssertParseTreeNode >(new AssertParseTreeNode(locstr, condition)); };
+            static INLINE std::shared_ptr< AssertParseTreeNode > MakeValue(std::shared_ptr< iParseTreeNode > &condition) { return MakeShared< AssertParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) AssertParseTreeNode(condition); }); };
+            static INLINE std::shared_ptr< AssertParseTreeNode > MakeValue(const SourceLocationT &location, std::shared_ptr< iParseTreeNode > &condition) { return MakeShared< AssertParseTreeNode, ParseTreeArena >([&](void *memory) { ::new(memory) AssertParseTreeNode(location, condition); }); };
             
             static INLINE const IntegerT &NumInstances() throw() { return Count; };
             static INLINE const IntegerT &NumLiveInstances() throw() { return Instances; };
@@ -2777,6 +3585,11 @@ namespace dish
             virtual void Validate(LanguageSymbolTable &symtab) const;
             
             virtual bool IsEqual(const iParseTreeNode &ptn) const;
+            virtual std::size_t Hash() const;
+            
+            virtual void Children(ChildListT &children);
+            
+            virtual void Write(ParseTreeWriter &writer) const;
             
             //  From iPrintable
             
@@ -25,8 +25,10 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdlib>
+#include <iterator>
 #include <ctime>
 #include <sstream>
+#include <typeinfo>
 
 #include "atomics.h"
 #include "exception.h"
@@ -35,19 +37,61 @@
 
 ////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+
+    const int TBL_HEIGHT(74);
 
-#if not defined(SYMTAB_HASH_FUNC_WHOLE_ID) and not defined(SYMTAB_HASH_FUNC_PARTIAL_ID) and not defined(SYMTAB_HASH_FUNC_MULTI_BYTE) and not defined(SYMTAB_HASH_FUNC_HASHED_WHOLE_ID) and not defined(SYMTAB_HASH_FUNC_HASHED_PARTIAL_ID)
-#warning One of SYMTAB_HASH_FUNC_WHOLE_ID, SYMTAB_HASH_FUNC_PARTIAL_ID, SYMTAB_HASH_FUNC_HASHED_WHOLE_ID, SYMTAB_HASH_FUNC_HASHED_PARTIAL_ID, or SYMTAB_HASH_FUNC_MULTI_BYTE should be defined to determine the behavior of the hash-function in the hashed-table.
-#endif
+}
 
+/******************************************************************************
 
-////////////////////////////////////////////////////////////////////////////////
+    dish::InternedKeys class definitions
 
-namespace
+ ******************************************************************************/
+
+const dish::InternedKeys::IdT dish::InternedKeys::NO_ID(-1);
+
+dish::InternedKeys::TableT &dish::InternedKeys::table()
 {
+    //  Keys are interned while the run-time library is registered, which may
+    //  happen before any other static has been initialized.
+    static TableT Table;
+    
+    return Table;
+}
 
-    const int TBL_HEIGHT(74);
+dish::InternedKeys::KeyListT &dish::InternedKeys::keys()
+{
+    static KeyListT Keys;
+    
+    return Keys;
+}
+
+dish::InternedKeys::IdT dish::InternedKeys::Intern(const std::string &key)
+{
+    const std::pair< TableT::iterator, bool > elem(table().insert(std::make_pair(key, static_cast< IdT >(keys().size()))));
+    
+    if(elem.second)
+    {
+        keys().push_back(&(elem.first->first));
+    }
+    
+    return elem.first->second;
+}
 
+dish::InternedKeys::IdT dish::InternedKeys::Find(const std::string &key)
+{
+    const TableT::const_iterator elem(table().find(key));
+    
+    return (table().end() != elem) ? elem->second : NO_ID;
+}
+
+const std::string &dish::InternedKeys::Key(const dish::InternedKeys::IdT &id)
+{
+    assert((id >= 0) && (static_cast< KeyListT::size_type >(id) < keys().size()));
+    
+    return *keys()[id];
 }
 
 /******************************************************************************
@@ -76,6 +120,23 @@ bool dish::SymbolTable::IsEmpty() const
     throw IllegalOperationException("dish::SymbolTable::IsEmpty()");
 }
 
+std::shared_ptr< dish::iAtomic > dish::SymbolTable::LookupSlot(const int &slot, const std::string &key) const
+{
+    //  By default tables are not slot-addressable.
+    return std::shared_ptr< iAtomic >(0);
+}
+
+std::shared_ptr< dish::iAtomic > dish::SymbolTable::LookupInterned(const int &id, const std::string &key) const
+{
+    //  By default tables are keyed by name alone.
+    return Lookup(key);
+}
+
+bool dish::SymbolTable::BindsExecutable() const
+{
+    return mBindsExecutable;
+}
+
 /******************************************************************************
 
     dish::SingleSymbolTable class definitions
@@ -136,6 +197,13 @@ std::shared_ptr< dish::iAtomic > dish::SingleSymbolTable::Lookup(const std::stri
     return (key == mId) ? mValue : std::shared_ptr< iAtomic >(0);
 }
 
+std::shared_ptr< dish::iAtomic > dish::SingleSymbolTable::LookupSlot(const int &slot, const std::string &key) const
+{
+    ++LookupCount;
+
+    return ((0 == slot) && (key == mId)) ? mValue : std::shared_ptr< iAtomic >(0);
+}
+
 void dish::SingleSymbolTable::Load(dish::iSymbolTable &symtab, const dish::iSymbolTable::CloneT &type) const
 {
     throw IllegalOperationException("Load operation not supported by SingleSymbolTable.");
@@ -190,6 +258,250 @@ void dish::SingleSymbolTable::Print(std::ostream &out, const std::string::size_t
     out << mId << std::endl;
 }
 
+/******************************************************************************
+
+    dish::FrameSymbolTable class definitions
+
+ ******************************************************************************/
+ 
+dish::IntegerT dish::FrameSymbolTable::LookupCount(0);
+dish::IntegerT dish::FrameSymbolTable::SlotLookupCount(0);
+
+const dish::FrameSymbolTable::TableT::size_type dish::FrameSymbolTable::INDEX_SIZE(8);
+
+int dish::FrameSymbolTable::find(const std::string &key) const
+{
+    if(!mIndex.empty())
+    {
+        const std::unordered_map< std::string, int >::const_iterator elem(mIndex.find(key));
+        
+        return (mIndex.end() != elem) ? elem->second : -1;
+    }
+    
+    for(TableT::size_type i(0); i != mTable.size(); ++i)
+    {
+        if(key == mTable[i].first)
+        {
+            return static_cast< int >(i);
+        }
+    }
+    
+    return -1;
+}
+
+void dish::FrameSymbolTable::index(const dish::FrameSymbolTable::TableT::size_type &slot)
+{
+    if(mTable.size() > INDEX_SIZE)
+    {
+        //  Index every symbol the first time the frame grows past the size;
+        //  after that, only the one inserted.
+        for(TableT::size_type i(mIndex.empty() ? 0 : slot); i <= slot; ++i)
+        {
+            mIndex[mTable[i].first] = static_cast< int >(i);
+        }
+    }
+}
+
+dish::FrameSymbolTable::FrameSymbolTable(const dish::FrameSymbolTable &table, const dish::iSymbolTable::CloneT &type) : SymbolTable(),
+    mTable(),
+    mIndex(table.mIndex)
+{
+    mBindsExecutable = table.mBindsExecutable;
+    
+    mTable.reserve(table.mTable.size());
+
+    switch(type)
+    {
+        case cloneMinimal:
+        case cloneShallow:
+        {
+            mTable.assign(table.mTable.begin(), table.mTable.end());
+        } break;
+        
+        case cloneDeep:
+        {
+            std::for_each(
+                table.mTable.begin(), table.mTable.end(),
+                [&](const TableT::value_type &value)
+                {
+                    mTable.push_back(std::make_pair(value.first, value.second->Clone()));
+                }
+            );
+        } break;
+        
+        default:
+        {
+            assert(false);
+        }
+        
+    }
+}
+
+std::shared_ptr< dish::iSymbolTable > dish::FrameSymbolTable::Clone(const dish::iSymbolTable::CloneT &type) const
+{
+    return std::shared_ptr< FrameSymbolTable >(new FrameSymbolTable(*this, type));
+}
+ 
+void dish::FrameSymbolTable::Shuffle()
+{
+    //  Empty; the order of the symbols in a frame determines their slots, so
+    //  it must not change once they have been inserted.
+}
+ 
+int dish::FrameSymbolTable::Num() const
+{
+    return static_cast< int >(mTable.size());
+}
+
+bool dish::FrameSymbolTable::Exists(const std::string &key) const
+{
+    ++LookupCount;
+
+    return (find(key) >= 0);
+}
+
+void dish::FrameSymbolTable::Insert(const std::string &key, std::shared_ptr< dish::iAtomic > value)
+{
+    if(find(key) >= 0)
+    {
+        std::stringstream message;
+        message << "The symbol '";
+        message << key;
+        message << "' already exists.";
+        
+        throw DuplicateSymbolException(message.str());
+    }
+    
+    mTable.push_back(std::make_pair(key, value));
+    index(mTable.size() - 1);
+    noteKey(key);
+}
+
+std::shared_ptr< dish::iAtomic > dish::FrameSymbolTable::Lookup(const std::string &key) const
+{
+    ++LookupCount;
+
+    const int slot(find(key));
+    
+    if(slot >= 0)
+    {
+        return mTable[slot].second;
+    }
+    
+    return std::shared_ptr< iAtomic >(0);
+}
+
+std::shared_ptr< dish::iAtomic > dish::FrameSymbolTable::LookupSlot(const int &slot, const std::string &key) const
+{
+    ++SlotLookupCount;
+    
+    //  The key is verified so that a slot resolved against a frame whose
+    //  layout differs at runtime falls back to a lookup by name.
+    if((slot >= 0) && (static_cast< TableT::size_type >(slot) < mTable.size()))
+    {
+        const TableT::value_type &elem(mTable[slot]);
+        
+        if(key == elem.first)
+        {
+            return elem.second;
+        }
+    }
+    
+    return std::shared_ptr< iAtomic >(0);
+}
+
+void dish::FrameSymbolTable::Load(dish::iSymbolTable &symtab, const dish::iSymbolTable::CloneT &type) const
+{
+    switch(type)
+    {
+        case cloneMinimal:
+        case cloneShallow:
+        {
+            std::for_each(
+                mTable.begin(), mTable.end(),
+                [&](const TableT::value_type &value)
+                {
+                    symtab.Insert(value.first, value.second);
+                }
+            );
+        } break;
+        
+        case cloneDeep:
+        {
+            std::for_each(
+                mTable.begin(), mTable.end(),
+                [&](const TableT::value_type &value)
+                {
+                    symtab.Insert(value.first, value.second->Clone());
+                }
+            );
+        } break;
+        
+        default:
+        {
+            assert(false);
+        }
+        
+    }
+}
+
+void dish::FrameSymbolTable::Clear()
+{
+    mTable.clear();
+    mIndex.clear();
+    mBindsExecutable = false;
+}
+
+void dish::FrameSymbolTable::Histogram(std::ostream &out) const
+{
+    const int max(Num());
+    const int num(Num());
+    
+    int len(static_cast< double >(TBL_HEIGHT) * static_cast< double >(num) / static_cast< double >(max) + 0.5);
+    if(num > 0)
+    {
+        if(0 == len)
+        {
+            len = 1;
+        }
+    }
+    
+    out << num;
+    if(num < 1000)
+    {
+        out << " ";
+        
+        if(num < 100)
+        {
+            out << " ";
+            
+            if(num < 10)
+            {
+                out << " ";
+            }
+        }
+    }
+    
+    out << "|";
+    if(len > 0)
+    {
+        out << std::string(len, '>');
+    }
+    out << std::endl;
+}
+
+void dish::FrameSymbolTable::Print(std::ostream &out, const std::string::size_type &indent) const
+{
+    std::for_each(
+        mTable.begin(), mTable.end(),
+        [&](const TableT::value_type &value)
+        {
+            printIndent(out, indent);
+            out << value.first << std::endl;
+        }
+    );
+}
+
 /******************************************************************************
 
     dish::BasicSymbolTable class definitions
@@ -201,6 +513,8 @@ dish::IntegerT dish::BasicSymbolTable::LookupCount(0);
 dish::BasicSymbolTable::BasicSymbolTable(const dish::BasicSymbolTable &table, const dish::iSymbolTable::CloneT &type) : SymbolTable(),
     mTable()
 {
+    mBindsExecutable = table.mBindsExecutable;
+    
     switch(type)
     {
         case cloneMinimal:
@@ -312,6 +626,8 @@ void dish::BasicSymbolTable::Insert(const std::string &key, std::shared_ptr< dis
         
         throw DuplicateSymbolException(message.str());
     }
+    
+    noteKey(key);
 }
 
 std::shared_ptr< dish::iAtomic > dish::BasicSymbolTable::Lookup(const std::string &key) const
@@ -366,6 +682,7 @@ void dish::BasicSymbolTable::Load(dish::iSymbolTable &symtab, const dish::iSymbo
 void dish::BasicSymbolTable::Clear()
 {
     mTable.clear();
+    mBindsExecutable = false;
 }
 
 void dish::BasicSymbolTable::Histogram(std::ostream &out) const
@@ -425,311 +742,65 @@ void dish::BasicSymbolTable::Print(std::ostream &out, const std::string::size_ty
  ******************************************************************************/
  
 dish::IntegerT dish::HashedSymbolTable::LookupCount(0);
+dish::IntegerT dish::HashedSymbolTable::ProbeCount(0);
  
-const dish::HashedSymbolTable::TableT::size_type dish::HashedSymbolTable::TABLE_SIZE(19);
+const int dish::HashedSymbolTable::INITIAL_TABLE_BITS(5);
 
-namespace
+dish::HashedSymbolTable::HashedSymbolTable() : SymbolTable(), 
+    mTable(),
+    mMask(0),
+    mShift(0),
+    mNum(0)
 {
+    resize(INITIAL_TABLE_BITS);
+}
 
-#ifdef SYMTAB_HASH_FUNC_PARTIAL_ID
-        
-    const uint32_t CRCTBL[256] = {
-        0x00000000, 0x0183AF29, 0x03075E52, 0x0284F17B, 0x060EBCA4, 0x078D138D, 0x0509E2F6, 0x048A4DDF, 
-        0x0C1D7948, 0x0D9ED661, 0x0F1A271A, 0x0E998833, 0x0A13C5EC, 0x0B906AC5, 0x09149BBE, 0x08973497, 
-        0x183AF290, 0x19B95DB9, 0x1B3DACC2, 0x1ABE03EB, 0x1E344E34, 0x1FB7E11D, 0x1D331066, 0x1CB0BF4F, 
-        0x14278BD8, 0x15A424F1, 0x1720D58A, 0x16A37AA3, 0x1229377C, 0x13AA9855, 0x112E692E, 0x10ADC607, 
-        0x3075E520, 0x31F64A09, 0x3372BB72, 0x32F1145B, 0x367B5984, 0x37F8F6AD, 0x357C07D6, 0x34FFA8FF, 
-        0x3C689C68, 0x3DEB3341, 0x3F6FC23A, 0x3EEC6D13, 0x3A6620CC, 0x3BE58FE5, 0x39617E9E, 0x38E2D1B7, 
-        0x284F17B0, 0x29CCB899, 0x2B4849E2, 0x2ACBE6CB, 0x2E41AB14, 0x2FC2043D, 0x2D46F546, 0x2CC55A6F, 
-        0x24526EF8, 0x25D1C1D1, 0x275530AA, 0x26D69F83, 0x225CD25C, 0x23DF7D75, 0x215B8C0E, 0x20D82327, 
-        0x60EBCA40, 0x61686569, 0x63EC9412, 0x626F3B3B, 0x66E576E4, 0x6766D9CD, 0x65E228B6, 0x6461879F, 
-        0x6CF6B308, 0x6D751C21, 0x6FF1ED5A, 0x6E724273, 0x6AF80FAC, 0x6B7BA085, 0x69FF51FE, 0x687CFED7, 
-        0x78D138D0, 0x795297F9, 0x7BD66682, 0x7A55C9AB, 0x7EDF8474, 0x7F5C2B5D, 0x7DD8DA26, 0x7C5B750F, 
-        0x74CC4198, 0x754FEEB1, 0x77CB1FCA, 0x7648B0E3, 0x72C2FD3C, 0x73415215, 0x71C5A36E, 0x70460C47, 
-        0x509E2F60, 0x511D8049, 0x53997132, 0x521ADE1B, 0x569093C4, 0x57133CED, 0x5597CD96, 0x541462BF, 
-        0x5C835628, 0x5D00F901, 0x5F84087A, 0x5E07A753, 0x5A8DEA8C, 0x5B0E45A5, 0x598AB4DE, 0x58091BF7, 
-        0x48A4DDF0, 0x492772D9, 0x4BA383A2, 0x4A202C8B, 0x4EAA6154, 0x4F29CE7D, 0x4DAD3F06, 0x4C2E902F, 
-        0x44B9A4B8, 0x453A0B91, 0x47BEFAEA, 0x463D55C3, 0x42B7181C, 0x4334B735, 0x41B0464E, 0x4033E967, 
-        0xC1D79480, 0xC0543BA9, 0xC2D0CAD2, 0xC35365FB, 0xC7D92824, 0xC65A870D, 0xC4DE7676, 0xC55DD95F, 
-        0xCDCAEDC8, 0xCC4942E1, 0xCECDB39A, 0xCF4E1CB3, 0xCBC4516C, 0xCA47FE45, 0xC8C30F3E, 0xC940A017, 
-        0xD9ED6610, 0xD86EC939, 0xDAEA3842, 0xDB69976B, 0xDFE3DAB4, 0xDE60759D, 0xDCE484E6, 0xDD672BCF, 
-        0xD5F01F58, 0xD473B071, 0xD6F7410A, 0xD774EE23, 0xD3FEA3FC, 0xD27D0CD5, 0xD0F9FDAE, 0xD17A5287, 
-        0xF1A271A0, 0xF021DE89, 0xF2A52FF2, 0xF32680DB, 0xF7ACCD04, 0xF62F622D, 0xF4AB9356, 0xF5283C7F, 
-        0xFDBF08E8, 0xFC3CA7C1, 0xFEB856BA, 0xFF3BF993, 0xFBB1B44C, 0xFA321B65, 0xF8B6EA1E, 0xF9354537, 
-        0xE9988330, 0xE81B2C19, 0xEA9FDD62, 0xEB1C724B, 0xEF963F94, 0xEE1590BD, 0xEC9161C6, 0xED12CEEF, 
-        0xE585FA78, 0xE4065551, 0xE682A42A, 0xE7010B03, 0xE38B46DC, 0xE208E9F5, 0xE08C188E, 0xE10FB7A7, 
-        0xA13C5EC0, 0xA0BFF1E9, 0xA23B0092, 0xA3B8AFBB, 0xA732E264, 0xA6B14D4D, 0xA435BC36, 0xA5B6131F, 
-        0xAD212788, 0xACA288A1, 0xAE2679DA, 0xAFA5D6F3, 0xAB2F9B2C, 0xAAAC3405, 0xA828C57E, 0xA9AB6A57, 
-        0xB906AC50, 0xB8850379, 0xBA01F202, 0xBB825D2B, 0xBF0810F4, 0xBE8BBFDD, 0xBC0F4EA6, 0xBD8CE18F, 
-        0xB51BD518, 0xB4987A31, 0xB61C8B4A, 0xB79F2463, 0xB31569BC, 0xB296C695, 0xB01237EE, 0xB19198C7, 
-        0x9149BBE0, 0x90CA14C9, 0x924EE5B2, 0x93CD4A9B, 0x97470744, 0x96C4A86D, 0x94405916, 0x95C3F63F, 
-        0x9D54C2A8, 0x9CD76D81, 0x9E539CFA, 0x9FD033D3, 0x9B5A7E0C, 0x9AD9D125, 0x985D205E, 0x99DE8F77, 
-        0x89734970, 0x88F0E659, 0x8A741722, 0x8BF7B80B, 0x8F7DF5D4, 0x8EFE5AFD, 0x8C7AAB86, 0x8DF904AF, 
-        0x856E3038, 0x84ED9F11, 0x86696E6A, 0x87EAC143, 0x83608C9C, 0x82E323B5, 0x8067D2CE, 0x81E47DE7
-    };
-            
-#endif
-
-#ifdef SYMTAB_HASH_FUNC_MULTI_BYTE
-
-    INLINEC uint32_t Sum8_32(const char * const ptr)
+dish::HashedSymbolTable::HashedSymbolTable(const dish::HashedSymbolTable &table, const dish::iSymbolTable::CloneT &type) : SymbolTable(), 
+    mTable(table.mTable),
+    mMask(table.mMask),
+    mShift(table.mShift),
+    mNum(table.mNum)
+{
+    mBindsExecutable = table.mBindsExecutable;
+    
+    if(cloneDeep == type)
     {
-        return static_cast< uint32_t >(*reinterpret_cast< const uint8_t * >(ptr));
+        for(TableT::iterator i(mTable.begin()), last_i(mTable.end()); i != last_i; ++i)
+        {
+            if(InternedKeys::NO_ID != i->Id)
+            {
+                i->Value = i->Value->Clone();
+            }
+        }
     }
+}
 
-    INLINEC uint32_t Sum16_32(const char * const ptr)
+void dish::HashedSymbolTable::resize(const int &bits)
+{
+    TableT table(static_cast< TableT::size_type >(1) << bits);
+    
+    mTable.swap(table);
+    mMask = mTable.size() - 1;
+    mShift = 32 - bits;
+    mNum = 0;
+    
+    for(TableT::iterator i(table.begin()), last_i(table.end()); i != last_i; ++i)
     {
-        return static_cast< uint32_t >(*reinterpret_cast< const uint16_t * >(ptr));
+        if(InternedKeys::NO_ID != i->Id)
+        {
+            insert(i->Id, std::move(i->Value));
+        }
     }
+}
 
-    INLINEC uint32_t Sum32_32(const char * const ptr)
-    {
-        return static_cast< uint32_t >(*reinterpret_cast< const uint32_t * >(ptr));
-    }
-    
-#endif
-
-    INLINEC dish::HashedSymbolTable::TableT::size_type h(const std::string &key)
-    {
-        uint32_t hashval(0);
-        
-#ifdef SYMTAB_HASH_FUNC_WHOLE_ID
-        
-        std::for_each(
-            key.begin(), key.end(),
-            [&](const std::string::value_type &elem)
-            {
-                hashval += static_cast< uint32_t >(elem);
-            }
-        );
-        
-#endif
-
-#ifdef SYMTAB_HASH_FUNC_PARTIAL_ID
-
-        {     
-            const std::string::size_type key_size(key.length());
-            
-            switch(key_size)
-            {
-                case 4:
-                {
-                    hashval += static_cast< uint32_t >(key[3]);
-                }
-                
-                case 3:
-                {
-                    hashval += static_cast< uint32_t >(key[2]);
-                }
-                
-                case 2:
-                {
-                    hashval += static_cast< uint32_t >(key[1]);
-                }
-                
-                case 1:
-                {
-                    hashval += static_cast< uint32_t >(key[0]);
-                }
-                
-                case 0:
-                {
-                    //  Empty
-                } break;
-                
-                default:
-                {
-#ifdef SYMTAB_HASH_FUNC_PARTIAL_ID_SPREAD
-                    /*
-                        The hash-function uses the first, middle, 3/4, and last ASCII
-                        values of the string. So:
-                        
-                            ID: 0123456789
-                                ^    ^ ^ ^
-                        This scheme assumes that the last half of a key value will be
-                        more evenly distributed that the first half of the key. This is
-                        assumed to be the case because developers tend to use a common 
-                        prefix for identifiers in a package, Str and TEXTIO_ are
-                        examples of this from the langage's run-time library.
-                    */
-                    hashval += static_cast< uint32_t >(key[key_size - 1]);
-                    hashval += static_cast< uint32_t >(key[3 * key_size / 4]);
-                    hashval += static_cast< uint32_t >(key[key_size / 2]);
-                    hashval += static_cast< uint32_t >(key[0]);
-#else
-                    /*
-                        The hash-function uses the first, last, last-1, and last-2 ASCII
-                        values of the string. So:
-                        
-                            ID: 0123456789
-                                ^      ^^^
-                                
-                    */
-                    
-                    hashval += static_cast< uint32_t >(key[0]);
-                    
-                    hashval += static_cast< uint32_t >(key[key_size - 3]);
-                    hashval += static_cast< uint32_t >(key[key_size - 2]);
-                    hashval += static_cast< uint32_t >(key[key_size - 1]);
-#endif
-                }
-                
-            }
-        }
-        
-#endif
-        
-#ifdef SYMTAB_HASH_FUNC_HASHED_WHOLE_ID
-        
-        std::for_each(
-            key.begin(), key.end(),
-            [&](const std::string::value_type &elem)
-            {
-                hashval = CRCTBL[static_cast< uint8_t >(elem ^ (hashval >> 24))] ^ (hashval << 8);
-            }
-        );
-        
-#endif
-
-#ifdef SYMTAB_HASH_FUNC_HASHED_PARTIAL_ID
-
-        {     
-            const std::string::size_type key_size(key.length());
-            
-            switch(key_size)
-            {
-                case 4:
-                {
-                    hashval = CRCTBL[static_cast< uint8_t >(key[3] ^ (hashval >> 24))] ^ (hashval << 8);
-                }
-                
-                case 3:
-                {
-                    hashval = CRCTBL[static_cast< uint8_t >(key[2] ^ (hashval >> 24))] ^ (hashval << 8);
-                }
-                
-                case 2:
-                {
-                    hashval = CRCTBL[static_cast< uint8_t >(key[1] ^ (hashval >> 24))] ^ (hashval << 8);
-                }
-                
-                case 1:
-                {
-                    hashval = CRCTBL[static_cast< uint8_t >(key[0] ^ (hashval >> 24))] ^ (hashval << 8);
-                }
-                
-                case 0:
-                {
-                    //  Empty
-                } break;
-                
-                default:
-                {
-#ifdef SYMTAB_HASH_FUNC_PARTIAL_ID_SPREAD
-                    /*
-                        The hash-function uses the first, middle, 3/4, and last ASCII
-                        values of the string. So:
-                        
-                            ID: 0123456789
-                                ^    ^ ^ ^
-                        This scheme assumes that the last half of a key value will be
-                        more evenly distributed that the first half of the key. This is
-                        assumed to be the case because developers tend to use a common 
-                        prefix for identifiers in a package, Str and TEXTIO_ are
-                        examples of this from the langage's run-time library.
-                    */
-                    hashval = CRCTBL[static_cast< uint8_t >(key[key_size - 1] ^ (hashval >> 24))] ^ (hashval << 8);
-                    hashval = CRCTBL[static_cast< uint8_t >(key[3 * key_size / 4] ^ (hashval >> 24))] ^ (hashval << 8);
-                    hashval = CRCTBL[static_cast< uint8_t >(key[key_size / 2] ^ (hashval >> 24))] ^ (hashval << 8);
-                    hashval = CRCTBL[static_cast< uint8_t >(key[0] ^ (hashval >> 24))] ^ (hashval << 8);
-#else
-                    /*
-                        The hash-function uses the first, last, last-1, and last-2 ASCII
-                        values of the string. So:
-                        
-                            ID: 0123456789
-                                ^      ^^^
-                                
-                    */
-                    hashval = CRCTBL[static_cast< uint8_t >(key[key_size - 3] ^ (hashval >> 24))] ^ (hashval << 8);
-                    hashval = CRCTBL[static_cast< uint8_t >(key[key_size - 2] ^ (hashval >> 24))] ^ (hashval << 8);
-                    hashval = CRCTBL[static_cast< uint8_t >(key[key_size - 1] ^ (hashval >> 24))] ^ (hashval << 8);
-                    hashval = CRCTBL[static_cast< uint8_t >(key[0] ^ (hashval >> 24))] ^ (hashval << 8);
-#endif
-                }
-                
-            }
-        }
-        
-#endif
-
-#ifdef SYMTAB_HASH_FUNC_MULTI_BYTE
-        
-        {
-            std::string::size_type key_size(key.length());
-            const char *ptr(key.c_str());
-            
-            while(key_size >= 4)
-            {
-                hashval += Sum32_32(ptr);
-                
-                key_size -= 4;
-                ptr += 4;
-            }
-            
-            switch(key_size)
-            {
-                case 0:
-                {
-                    //  Empty.
-                } break;
-                
-                case 1:
-                {
-                    hashval += Sum8_32(ptr);
-                } break;
-                
-                case 2:
-                {
-                    hashval += Sum16_32(ptr);
-                } break;
-                
-                case 3:
-                {
-                    hashval += (Sum16_32(ptr) + Sum8_32(ptr + 2));
-                } break;
-                
-                default:
-                {
-                    assert(false);
-                }
-                
-            }
-        }
-
-#endif
-
-        return static_cast< dish::HashedSymbolTable::TableT::size_type >(hashval) % dish::HashedSymbolTable::TABLE_SIZE;
-    }
-
-}
-
-dish::HashedSymbolTable::HashedSymbolTable(const dish::HashedSymbolTable &table, const dish::iSymbolTable::CloneT &type) : SymbolTable(), 
-    mTable(TABLE_SIZE)
+void dish::HashedSymbolTable::insert(const dish::InternedKeys::IdT &id, std::shared_ptr< dish::iAtomic > value)
 {
-    TableT::iterator dest_i(mTable.begin());
-    const TableT::iterator dest_last_i(mTable.end());
+    EntryT &entry(mTable[find(id)]);
     
-    TableT::const_iterator src_i(table.mTable.begin());
-    const TableT::const_iterator src_last_i(table.mTable.end());
+    entry.Id = id;
+    entry.Value = std::move(value);
     
-    while((dest_i != dest_last_i) && (src_i != src_last_i))
-    {
-        (src_i++)->Load(*dest_i++, type);
-    }
-    
-    assert(dest_i == dest_last_i);
-    assert(src_i == src_last_i);
+    ++mNum;
 }
 
 std::shared_ptr< dish::iSymbolTable > dish::HashedSymbolTable::Clone(const dish::iSymbolTable::CloneT &type) const
@@ -739,218 +810,217 @@ std::shared_ptr< dish::iSymbolTable > dish::HashedSymbolTable::Clone(const dish:
 
 void dish::HashedSymbolTable::Shuffle()
 {
-    std::for_each(
-        mTable.begin(), mTable.end(),
-        [](TableT::value_type &value)
+    //  Re-insert the entries in a random order, which shuffles the order of
+    //  the entries in each run of colliding ids.
+    static uint32_t rseed(static_cast< uint32_t >(time(NULL)));
+    
+    TableT entries;
+    entries.reserve(mNum);
+    
+    for(TableT::iterator i(mTable.begin()), last_i(mTable.end()); i != last_i; ++i)
+    {
+        if(InternedKeys::NO_ID != i->Id)
         {
-            value.Shuffle();
+            entries.push_back(std::move(*i));
+            *i = EntryT();
         }
-    );
-}
-
-int dish::HashedSymbolTable::Num() const
-{
-    int count(0);
+    }
     
-    std::for_each(
-        mTable.begin(), mTable.end(),
-        [&count](const TableT::value_type &val)
+    const TableT::size_type nentries(entries.size());
+    
+    if(nentries > 1)
+    {
+        for(TableT::size_type i(0); i != nentries; ++i)
         {
-            count += val.Num();
+            rseed = (1103515245 * rseed) + 12345;
+            std::swap(entries[i], entries[rseed % nentries]);
         }
-    );
+    }
     
-    return count;
+    mNum = 0;
+    
+    for(TableT::iterator i(entries.begin()), last_i(entries.end()); i != last_i; ++i)
+    {
+        insert(i->Id, std::move(i->Value));
+    }
 }
 
-bool dish::HashedSymbolTable::Exists(const std::string &key) const
+int dish::HashedSymbolTable::Num() const
 {
-    ++LookupCount;
-    
-    return mTable[h(key)].Exists(key);
+    return mNum;
 }
 
+bool dish::HashedSymbolTable::Exists(const std::string &key) const
+{
+    return (0 != Lookup(key).get());
+}
 
 void dish::HashedSymbolTable::Insert(const std::string &key, std::shared_ptr< dish::iAtomic > value)
 {
-    mTable[h(key)].Insert(key, value);
+    const InternedKeys::IdT id(InternedKeys::Intern(key));
+    
+    if(id == mTable[find(id)].Id)
+    {
+        std::stringstream message;
+        message << "The symbol '";
+        message << key;
+        message << "' already exists.";
+        
+        throw DuplicateSymbolException(message.str());
+    }
+    
+    //  Keep the table no more than half full.
+    if(static_cast< TableT::size_type >(2 * (mNum + 1)) > mTable.size())
+    {
+        resize(32 - mShift + 1);
+    }
+    
+    insert(id, value);
+    noteKey(key);
 }
 
 std::shared_ptr< dish::iAtomic > dish::HashedSymbolTable::Lookup(const std::string &key) const
+{
+    const InternedKeys::IdT id(InternedKeys::Find(key));
+    
+    if(InternedKeys::NO_ID == id)
+    {
+        ++LookupCount;
+        
+        return std::shared_ptr< iAtomic >(0);
+    }
+    
+    return LookupInterned(id, key);
+}
+
+std::shared_ptr< dish::iAtomic > dish::HashedSymbolTable::LookupInterned(const int &id, const std::string &key) const
 {
     ++LookupCount;
     
-    return mTable[h(key)].Lookup(key);
+    for(TableT::size_type i(home(id)); ; i = (i + 1) & mMask)
+    {
+        ++ProbeCount;
+        
+        const EntryT &entry(mTable[i]);
+        
+        if(id == entry.Id)
+        {
+            return entry.Value;
+        }
+        
+        if(InternedKeys::NO_ID == entry.Id)
+        {
+            return std::shared_ptr< iAtomic >(0);
+        }
+    }
 }
 
 void dish::HashedSymbolTable::Load(dish::iSymbolTable &symtab, const dish::iSymbolTable::CloneT &type) const
 {
-    std::for_each(
-        mTable.begin(), mTable.end(),
-        [&](const TableT::value_type &value)
+    for(TableT::const_iterator i(mTable.begin()), last_i(mTable.end()); i != last_i; ++i)
+    {
+        if(InternedKeys::NO_ID != i->Id)
         {
-            value.Load(symtab, type);
+            symtab.Insert(InternedKeys::Key(i->Id), (cloneDeep == type) ? i->Value->Clone() : i->Value);
         }
-    );
+    }
 }
 
 void dish::HashedSymbolTable::Clear()
 {
-    std::for_each(
-        mTable.begin(), mTable.end(),
-        [](TableT::value_type &val)
-        {
-            val.Clear();
-        }
-    ); 
+    resize(INITIAL_TABLE_BITS);
+    
+    mBindsExecutable = false;
 }
 
 void dish::HashedSymbolTable::Histogram(std::ostream &out) const
 {
-    const int HEIGHT(75);
-
-    int max(0);
-    int min(mTable.front().Num());
+    //  Count the entries by the length of the probe sequence which finds
+    //  them: 1 for an entry in its home slot, 2 for the slot after that, etc.
+    std::vector< int > lengths;
+    
     int sum(0);
-
-    //  Compute basic statistics.
-    std::for_each(
-        mTable.begin(), mTable.end(),
-        [&](const TableT::value_type &val)
-        {
-            const int num(val.Num());
-            
-            sum += num;
-        
-            if(num > max)
-            {
-                max = num;
-            }
-            
-            if(num < min)
-            {
-                min = num;
-            }
-        }
-    );
     
-    //  Print the histogram.
-    std::for_each(
-        mTable.begin(), mTable.end(),
-        [&](const TableT::value_type &val)
+    for(TableT::size_type i(0); i != mTable.size(); ++i)
+    {
+        if(InternedKeys::NO_ID != mTable[i].Id)
         {
-            const int num(val.Num());
-            
-            int len(static_cast< double >(HEIGHT) * static_cast< double >(num) / static_cast< double >(max) + 0.5);
-            if(num > 0)
-            {
-                if(0 == len)
-                {
-                    len = 1;
-                }
-            }
+            const TableT::size_type len(((i - home(mTable[i].Id)) & mMask) + 1);
             
-            out << num;
-            if(num < 1000)
+            if(len > lengths.size())
             {
-                out << " ";
-                
-                if(num < 100)
-                {
-                    out << " ";
-                    
-                    if(num < 10)
-                    {
-                        out << " ";
-                    }
-                }
+                lengths.resize(len, 0);
             }
             
-            out << "|";
-            if(len > 0)
-            {
-                out << std::string(len, '>');
-            }
-            out << std::endl;
+            ++lengths[len - 1];
+            sum += static_cast< int >(len);
         }
-    );
-    
-    const int len(static_cast< double >(HEIGHT) * static_cast< double >(sum) / mTable.size() / static_cast< double >(max) + 0.5);
-    out << "Avg.|";
-    if(len > 0)
-    {
-        out << std::string(len, ' ');
     }
-    out << "^" << std::endl;
     
-    //  Compute the median value.
-    double median(0.0);
+    const int max(lengths.empty() ? 0 : *std::max_element(lengths.begin(), lengths.end()));
+    
+    //  Print the histogram.
+    for(std::vector< int >::size_type i(0); i != lengths.size(); ++i)
     {
-        std::vector< int > sizes;
+        const int num(lengths[i]);
         
-        //  Fill a vector with the table sizes.
-        std::for_each(
-            mTable.begin(), mTable.end(),
-            [&](const TableT::value_type &val)
+        int len(static_cast< double >(TBL_HEIGHT) * static_cast< double >(num) / static_cast< double >(max) + 0.5);
+        if(num > 0)
+        {
+            if(0 == len)
             {
-                sizes.push_back(val.Num());
+                len = 1;
             }
-        );
+        }
         
-        //  Sort the vector.
-        std::sort(sizes.begin(), sizes.end());
+        const std::string probes(std::to_string(i + 1));
         
-        //  Select the median value.
-        const auto mid(sizes.size() / 2);
-        median = static_cast< double >(sizes[mid]);
-        if(0 == sizes.size())
+        out << probes;
+        if(probes.length() < 4)
         {
-            
-            median += static_cast< double >(sizes[mid + 1]);
-            median /= 2.0;
+            out << std::string(4 - probes.length(), ' ');
         }
+        
+        out << "|";
+        if(len > 0)
+        {
+            out << std::string(len, '>');
+        }
+        out << " " << num << std::endl;
     }
     
     //  Print basic statistics.
     out << "----+" << std::endl;
-    out << Num() << std::endl;
+    out << mNum << std::endl;
     out << std::endl;
-    out << " Maximum Table Size: " << max << std::endl;
-    out << " Minimum Table Size: " << min << std::endl;
-    out << "  Table Size Spread: " << (max - min) << std::endl;
-    out << "        Table Ratio: " << (static_cast< double >(max) / static_cast< double >(min)) << std::endl;
-    out << " Average Table Size: " << (static_cast< double >(sum) / mTable.size()) << std::endl;
-    out << "  Median Table Size: " << median << std::endl;
+    out << "          Table Size: " << mTable.size() << std::endl;
+    out << "         Load Factor: " << (static_cast< double >(mNum) / static_cast< double >(mTable.size())) << std::endl;
+    out << "Maximum Probe Length: " << lengths.size() << std::endl;
+    out << "Average Probe Length: " << ((mNum > 0) ? (static_cast< double >(sum) / static_cast< double >(mNum)) : 0.0) << std::endl;
+    out << "   Probes Per Lookup: " << ((LookupCount > 0) ? (static_cast< double >(ProbeCount) / static_cast< double >(LookupCount)) : 0.0) << std::endl;
 }
 
 void dish::HashedSymbolTable::Print(std::ostream &out, const std::string::size_type &indent) const
 {
+    std::vector< std::string > keys;
+    keys.reserve(mNum);
+    
+    for(TableT::const_iterator i(mTable.begin()), last_i(mTable.end()); i != last_i; ++i)
+    {
+        if(InternedKeys::NO_ID != i->Id)
+        {
+            keys.push_back(InternedKeys::Key(i->Id));
+        }
+    }
+    
+    std::sort(keys.begin(), keys.end());
+    
     std::for_each(
-        mTable.begin(), mTable.end(),
-        [&](const TableT::value_type &value)
+        keys.begin(), keys.end(),
+        [&](const std::string &key)
         {
-            const int num(value.Num());
-            
             printIndent(out, indent);
-            out << num;
-            if(num < 1000)
-            {
-                out << " ";
-                
-                if(num < 100)
-                {
-                    out << " ";
-                    
-                    if(num < 10)
-                    {
-                        out << " ";
-                    }
-                }
-            }
-            out << ":" << std::endl;
-        
-            value.Print(out, indent + 4);
-            out << std::endl;
+            out << key << std::endl;
         }
     );
 }
@@ -963,60 +1033,20 @@ void dish::HashedSymbolTable::Print(std::ostream &out, const std::string::size_t
 
 const int dish::StackedSymbolTable::INFINITE_STACK_DEPTH(0);
 
-#ifdef RECYCLE_SYMBOL_TABLES
+const dish::StackedSymbolTable::FramePoolT::size_type dish::StackedSymbolTable::RESERVED_FRAME_POOL_DEPTH(16);
+const dish::StackedSymbolTable::FramePoolT::size_type dish::StackedSymbolTable::MAXIMUM_FRAME_POOL_DEPTH(256);
 
-const dish::StackedSymbolTable::RecycleListT::size_type dish::StackedSymbolTable::RESERVED_RECYCLE_BIN_DEPTH(10);
-const dish::StackedSymbolTable::RecycleListT::size_type dish::StackedSymbolTable::MAXIMUM_RECYCLE_BIN_DEPTH(50);
+dish::IntegerT dish::StackedSymbolTable::FrameAllocationCount(0);
+dish::IntegerT dish::StackedSymbolTable::FrameReuseCount(0);
 
 dish::StackedSymbolTable::StackedSymbolTable(const dish::StackedSymbolTable &symtab, const dish::iSymbolTable::CloneT &type) : SymbolTable(),
     mStack(),
-    mRecycleBin(), 
+    mFramePool(),
     mMaximumStackDepth(symtab.mMaximumStackDepth),
     mMaximumStackDepthAttained(0)
 {
-    mRecycleBin.reserve(RESERVED_RECYCLE_BIN_DEPTH);
+    mFramePool.reserve(RESERVED_FRAME_POOL_DEPTH);
     
-    switch(type)
-    {
-        case cloneMinimal:
-        {
-            for(TableT::const_iterator i(symtab.mStack.begin()), last_i(symtab.mStack.end()); i != last_i; ++i)
-            {
-                mStack.push_back(*i);
-            }
-        } break;
-        
-        case cloneShallow:
-        {
-            for(TableT::const_iterator i(symtab.mStack.begin()), last_i(symtab.mStack.end()); i != last_i; ++i)
-            {
-                mStack.push_back((*i)->Clone(cloneShallow));
-            }
-        } break;
-        
-        case cloneDeep:
-        {
-            for(TableT::const_iterator i(symtab.mStack.begin()), last_i(symtab.mStack.end()); i != last_i; ++i)
-            {
-                mStack.push_back((*i)->Clone(cloneDeep));
-            }
-        } break;
-        
-        default:
-        {
-            assert(false);
-        }
-        
-    }
-}
-
-#else
-
-dish::StackedSymbolTable::StackedSymbolTable(const dish::StackedSymbolTable &symtab, const dish::iSymbolTable::CloneT &type) : SymbolTable(),
-    mStack(),
-    mMaximumStackDepth(symtab.mMaximumStackDepth),
-    mMaximumStackDepthAttained(0)
-{
     switch(type)
     {
         case cloneMinimal:
@@ -1042,8 +1072,6 @@ dish::StackedSymbolTable::StackedSymbolTable(const dish::StackedSymbolTable &sym
     }
 }
 
-#endif
-
 std::shared_ptr< dish::iSymbolTable > dish::StackedSymbolTable::Clone(const dish::iSymbolTable::CloneT &type) const
 {
     return std::shared_ptr< StackedSymbolTable >(new StackedSymbolTable(*this, type));
@@ -1064,35 +1092,13 @@ void dish::StackedSymbolTable::Push(std::shared_ptr< iSymbolTable > table)
 {
     assert(table);
     
-    mStack.push_back(table);
+    mStack.push_back(std::move(table));
     checkStackSize();
 }
 
 void dish::StackedSymbolTable::Push()
 {
-#ifdef RECYCLE_SYMBOL_TABLES
-
-    //  Do we have a recycled table?
-    if(!mRecycleBin.empty())
-    {
-        //  Yes; recycle the table by pushing it onto the stack.
-        mStack.push_back(mRecycleBin.back());
-        
-        //  And remove the recycles table from the recycling bin.
-        mRecycleBin.pop_back();
-    }
-    else
-    {
-        //  No; Create a new table and push it onto the stack.
-        mStack.push_back(BasicSymbolTable::MakeValue());
-    }
-    
-#else
-
-    mStack.push_back(BasicSymbolTable::MakeValue());
-
-#endif
-    
+    mStack.push_back(NewFrame());
     checkStackSize();
 }
 
@@ -1100,24 +1106,22 @@ void dish::StackedSymbolTable::Pop()
 {
     assert(!mStack.empty());
     
-#ifdef RECYCLE_SYMBOL_TABLES
-
-    //  Are we going to recycle the symbol-table we pop off the stack?
-    if((0 >= MAXIMUM_RECYCLE_BIN_DEPTH) || (mRecycleBin.size() < MAXIMUM_RECYCLE_BIN_DEPTH))
+    //  A frame held by nothing but the stack goes back into the pool, emptied
+    //  of its symbols but keeping its storage for the next call.
+    std::shared_ptr< iSymbolTable > &table(mStack.back());
+    
+    if((1 == table.use_count()) && (mFramePool.size() < MAXIMUM_FRAME_POOL_DEPTH) && (typeid(FrameSymbolTable) == typeid(*table)))
     {
-        //  Yes; get the table being popped off the stack.
-        std::shared_ptr< iSymbolTable > table(mStack.back());
+        std::shared_ptr< FrameSymbolTable > frame(std::static_pointer_cast< FrameSymbolTable >(table));
+        
+        mStack.pop_back();
         
-        //  Clear the table's contents.
-        table->Clear();
+        frame->Clear();
+        mFramePool.push_back(std::move(frame));
         
-        //  Add the table to the recycling bin.
-        mRecycleBin.push_back(table);
+        return;
     }
     
-#endif
-    
-    //  Pop the table off the stack.
     mStack.pop_back();
 }
 
@@ -1176,6 +1180,43 @@ std::shared_ptr< dish::iAtomic > dish::StackedSymbolTable::Lookup(const std::str
     return std::shared_ptr< iAtomic >(0);
 }
 
+std::shared_ptr< dish::iAtomic > dish::StackedSymbolTable::LookupInterned(const int &id, const std::string &key) const
+{
+    for(TableT::const_reverse_iterator tbl_i(mStack.rbegin()), last_tbl_i(mStack.rend()); last_tbl_i != tbl_i; ++tbl_i)
+    {
+        std::shared_ptr< dish::iAtomic > value((*tbl_i)->LookupInterned(id, key));
+        if(value)
+        {
+            return value;
+        }
+    }
+
+    return std::shared_ptr< iAtomic >(0);
+}
+
+std::shared_ptr< dish::iAtomic > dish::StackedSymbolTable::Lookup(const int &depth, const int &slot, const int &nearer, const std::string &key) const
+{
+    if((depth >= 0) && (static_cast< TableT::size_type >(depth) < mStack.size()))
+    {
+        //  A frame only ever holds more symbols than the parser saw declared
+        //  in it, so the count differs if anything else was added.
+        int held(0);
+        
+        TableT::const_reverse_iterator tbl_i(mStack.rbegin());
+        for(int i(0); i < depth; ++i, ++tbl_i)
+        {
+            held += (*tbl_i)->Num();
+        }
+        
+        if(nearer == held)
+        {
+            return (*tbl_i)->LookupSlot(slot, key);
+        }
+    }
+    
+    return std::shared_ptr< iAtomic >(0);
+}
+
 void dish::StackedSymbolTable::Load(dish::iSymbolTable &symtab, const dish::iSymbolTable::CloneT &type) const
 {
     for(TableT::const_iterator i(mStack.begin()), last_i(mStack.end()); i != last_i; ++i)
@@ -25,11 +25,17 @@
 
 #include "dishconfig.h"
 
+#include <stdint.h>
+
+#include <algorithm>
+#include <cctype>
 #include <iostream>
+#include <iterator>
 #include <list>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "exception.h"
@@ -46,9 +52,68 @@ namespace dish
 
     ////////////////////////////////////////////////////////////////////////////
     
+    //  Gives each distinct key a unique id the first time it is seen, which
+    //  it keeps for as long as the interpreter runs. Identifiers are interned
+    //  as they are parsed so that tables can hash and compare their keys as
+    //  integers.
+    class InternedKeys
+    {
+        public:
+            using IdT = int;
+            
+            static const IdT NO_ID;
+            
+        private:
+            using TableT = std::unordered_map< std::string, IdT >;
+            using KeyListT = std::vector< const std::string * >;
+            
+            static TableT &table();
+            static KeyListT &keys();
+            
+        public:
+        
+            //  Returns the id of key, giving it one if it has none yet.
+            static IdT Intern(const std::string &key);
+            
+            //  Returns the id of key, or NO_ID if it has never been interned.
+            static IdT Find(const std::string &key);
+            
+            static const std::string &Key(const IdT &id);
+            
+            static INLINE IntegerT Num() { return static_cast< IntegerT >(keys().size()); };
+        
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    
     class SymbolTable : public iSymbolTable
     {
+        protected:
+            bool mBindsExecutable;
+            
+            INLINE void noteKey(const std::string &key) { mBindsExecutable = (mBindsExecutable || IsExecutableKey(key)); };
+            
         public:
+            INLINE SymbolTable() : iSymbolTable(), mBindsExecutable(false) {};
+            
+            //  Executables are inserted under their name with the number of
+            //  parameters appended, as in name_N.
+            static INLINE bool IsExecutableKey(const std::string &key)
+            {
+                std::string::size_type i(key.length());
+                
+                if((0 == i) || !std::isdigit(key[i - 1]))
+                {
+                    return false;
+                }
+                
+                while((i > 0) && std::isdigit(key[i - 1]))
+                {
+                    --i;
+                }
+                
+                return ((i > 0) && ('_' == key[i - 1]));
+            }
             
             //  From iSymbolTable
             
@@ -56,6 +121,11 @@ namespace dish
             virtual void Push();
             virtual void Pop();
             virtual bool IsEmpty() const;
+            
+            virtual std::shared_ptr< iAtomic > LookupSlot(const int &slot, const std::string &key) const;
+            virtual std::shared_ptr< iAtomic > LookupInterned(const int &id, const std::string &key) const;
+            
+            virtual bool BindsExecutable() const;
         
     };
 
@@ -70,11 +140,15 @@ namespace dish
             static IntegerT LookupCount;
             
         protected:
-            INLINE SingleSymbolTable(const std::string &id, std::shared_ptr< iAtomic > &value) : SymbolTable(), mId(id), mValue(value) { assert(0 != mValue.get()); };
+            INLINE SingleSymbolTable(const std::string &id, std::shared_ptr< iAtomic > &value) : SymbolTable(), mId(id), mValue(value) { assert(0 != mValue.get()); noteKey(mId); };
         
         public:
         
             static INLINE std::shared_ptr< SingleSymbolTable > MakeValue(const std::string &id, std::shared_ptr< iAtomic > value) { return std::shared_ptr< SingleSymbolTable >(new SingleSymbolTable(id, value)); };
+            
+            //  Binds the symbol to value; a loop binds the same table to each
+            //  of its elements in turn.
+            INLINE void Bind(std::shared_ptr< iAtomic > value) { assert(0 != value.get()); mValue = std::move(value); };
         
             static INLINE IntegerT GetLookupCount() throw() { return LookupCount; };
             
@@ -89,6 +163,75 @@ namespace dish
             virtual bool Exists(const std::string &key) const;
             virtual void Insert(const std::string &key, std::shared_ptr< iAtomic > value);
             virtual std::shared_ptr< iAtomic > Lookup(const std::string &key) const;
+            virtual std::shared_ptr< iAtomic > LookupSlot(const int &slot, const std::string &key) const;
+            
+            virtual void Load(iSymbolTable &symtab, const CloneT &type = cloneMinimal) const;
+            
+            virtual void Clear();
+            
+            virtual void Histogram(std::ostream &out) const;
+            
+            //  From iPrintable
+            
+            virtual void Print(std::ostream &out, const std::string::size_type &indent = 0) const;
+            
+    };
+    
+    //  A flat frame; symbols are kept in insertion order so that each symbol
+    //  occupies a fixed slot which the parser can resolve ahead of time.
+    class FrameSymbolTable : public SymbolTable
+    {
+        public:
+        
+            using TableT = std::vector< std::pair< std::string, std::shared_ptr< iAtomic > > >;
+    
+        private:
+            TableT mTable;
+            
+            //  The slot of each symbol by name; only kept once the frame holds
+            //  more than INDEX_SIZE symbols, smaller frames are searched in
+            //  order.
+            std::unordered_map< std::string, int > mIndex;
+            
+            static IntegerT LookupCount;
+            static IntegerT SlotLookupCount;
+            
+            static const TableT::size_type INDEX_SIZE;
+            
+            //  The slot of the symbol named key, or -1.
+            int find(const std::string &key) const;
+            
+            void index(const TableT::size_type &slot);
+        
+        public:
+            INLINE FrameSymbolTable() : SymbolTable(), mTable(), mIndex()
+            {
+#ifdef LIST_TYPE_PREFER_VECTOR
+                mTable.reserve(LIST_TYPE_PREFER_VECTOR);
+#endif
+            };
+            FrameSymbolTable(const FrameSymbolTable &table, const CloneT &type = cloneMinimal);
+            
+            static INLINE std::shared_ptr< FrameSymbolTable > MakeValue() { return std::shared_ptr< FrameSymbolTable >(new FrameSymbolTable()); };
+            static INLINE std::shared_ptr< FrameSymbolTable > MakeValue(const FrameSymbolTable &table, const CloneT &type = cloneMinimal) { return std::shared_ptr< FrameSymbolTable >(new FrameSymbolTable(table, type)); };
+            
+            static INLINE IntegerT GetLookupCount() throw() { return LookupCount; };
+            static INLINE IntegerT GetSlotLookupCount() throw() { return SlotLookupCount; };
+            
+            INLINE void Reserve(const int &size) { if(size > 0) { mTable.reserve(size); } };
+            
+            //  From iSymbolTable
+            
+            virtual std::shared_ptr< iSymbolTable > Clone(const CloneT &type = cloneMinimal) const;
+            
+            virtual void Shuffle();
+            
+            virtual int Num() const;
+            
+            virtual bool Exists(const std::string &key) const;
+            virtual void Insert(const std::string &key, std::shared_ptr< iAtomic > value);
+            virtual std::shared_ptr< iAtomic > Lookup(const std::string &key) const;
+            virtual std::shared_ptr< iAtomic > LookupSlot(const int &slot, const std::string &key) const;
             
             virtual void Load(iSymbolTable &symtab, const CloneT &type = cloneMinimal) const;
             
@@ -146,34 +289,69 @@ namespace dish
             
     };
     
+    //  An open-addressed table keyed by the ids under which its keys were
+    //  interned. Ids are spread over the table by Fibonacci hashing and
+    //  collisions are resolved by linear probing; the table doubles in size
+    //  before it is half full, so probe sequences stay short.
     class HashedSymbolTable : public SymbolTable
     {
         public:
         
-            using TableT = std::vector< BasicSymbolTable >;
+            struct EntryT
+            {
+                InternedKeys::IdT Id;
+                std::shared_ptr< iAtomic > Value;
+                
+                INLINE EntryT() : Id(InternedKeys::NO_ID), Value() {};
+            };
+        
+            using TableT = std::vector< EntryT >;
             
             static IntegerT LookupCount;
+            static IntegerT ProbeCount;
             
-            static const TableT::size_type TABLE_SIZE;
+            static const int INITIAL_TABLE_BITS;
     
         private:
             TableT mTable;
+            TableT::size_type mMask;
+            int mShift;
+            int mNum;
             
         protected:
             
-            //  The hash function is defined in the .cpp file as part of the
-            //  anonymous namespace so it can be inlined without cluttering up
-            //  this here header file :)
-            //static TableT::size_type h(const std::string &key);
+            //  The slot at which the search for id begins.
+            INLINE TableT::size_type home(const InternedKeys::IdT &id) const
+            {
+                return static_cast< TableT::size_type >((static_cast< uint32_t >(id) * UINT32_C(2654435769)) >> mShift);
+            };
+            
+            //  The slot which holds id, or the empty slot at which it would be
+            //  inserted.
+            INLINE TableT::size_type find(const InternedKeys::IdT &id) const
+            {
+                TableT::size_type i(home(id));
+                
+                while((id != mTable[i].Id) && (InternedKeys::NO_ID != mTable[i].Id))
+                {
+                    i = (i + 1) & mMask;
+                }
+                
+                return i;
+            };
+            
+            void resize(const int &bits);
+            void insert(const InternedKeys::IdT &id, std::shared_ptr< iAtomic > value);
             
         public:
-            INLINE HashedSymbolTable() : SymbolTable(), mTable(TABLE_SIZE) {};
+            HashedSymbolTable();
             HashedSymbolTable(const HashedSymbolTable &table, const CloneT &type = cloneMinimal);
             
             static INLINE std::shared_ptr< HashedSymbolTable > MakeValue() { return std::shared_ptr< HashedSymbolTable >(new HashedSymbolTable()); };
             static INLINE std::shared_ptr< HashedSymbolTable > MakeValue(const HashedSymbolTable &table, const CloneT &type = cloneMinimal) { return std::shared_ptr< HashedSymbolTable >(new HashedSymbolTable(table, type)); };
             
             static INLINE IntegerT GetLookupCount() throw() { return LookupCount; };
+            static INLINE IntegerT GetProbeCount() throw() { return ProbeCount; };
             
             //  From iSymbolTable
             
@@ -186,6 +364,7 @@ namespace dish
             virtual bool Exists(const std::string &key) const;
             virtual void Insert(const std::string &key, std::shared_ptr< iAtomic > value);
             virtual std::shared_ptr< iAtomic > Lookup(const std::string &key) const;
+            virtual std::shared_ptr< iAtomic > LookupInterned(const int &id, const std::string &key) const;
             
             virtual void Load(iSymbolTable &symtab, const CloneT &type = cloneMinimal) const;
             
@@ -203,27 +382,32 @@ namespace dish
     {
         public:
         
+#ifdef LIST_TYPE_PREFER_VECTOR
+            using TableT = std::vector< std::shared_ptr< iSymbolTable > >;
+#else
             using TableT = std::list< std::shared_ptr< iSymbolTable > >;
+#endif
             
             static const int INFINITE_STACK_DEPTH;
             
-#ifdef RECYCLE_SYMBOL_TABLES
-            using RecycleListT = std::vector< std::shared_ptr< iSymbolTable > >;
+            using FramePoolT = std::vector< std::shared_ptr< FrameSymbolTable > >;
             
-            static const RecycleListT::size_type RESERVED_RECYCLE_BIN_DEPTH;
-            static const RecycleListT::size_type MAXIMUM_RECYCLE_BIN_DEPTH;
-#endif
+            static const FramePoolT::size_type RESERVED_FRAME_POOL_DEPTH;
+            static const FramePoolT::size_type MAXIMUM_FRAME_POOL_DEPTH;
     
         private:
             TableT mStack;
             
-#ifdef RECYCLE_SYMBOL_TABLES
-            RecycleListT mRecycleBin;
-#endif
+            //  Frames popped off the stack, emptied but still holding their
+            //  storage, which are handed out again last-in first-out.
+            FramePoolT mFramePool;
             
             const int mMaximumStackDepth;
             mutable int mMaximumStackDepthAttained;
             
+            static IntegerT FrameAllocationCount;
+            static IntegerT FrameReuseCount;
+            
         protected:
             
             INLINE void checkStackSize() const
@@ -245,20 +429,88 @@ namespace dish
         
         public:
         
-#ifdef RECYCLE_SYMBOL_TABLES
-            INLINE StackedSymbolTable(const int &maxdepth) : SymbolTable(), mStack(), mRecycleBin(), mMaximumStackDepth(maxdepth), mMaximumStackDepthAttained(0) { mRecycleBin.reserve(RESERVED_RECYCLE_BIN_DEPTH); };
+            INLINE StackedSymbolTable(const int &maxdepth) : SymbolTable(), mStack(), mFramePool(), mMaximumStackDepth(maxdepth), mMaximumStackDepthAttained(0) { mFramePool.reserve(RESERVED_FRAME_POOL_DEPTH); };
             StackedSymbolTable(const StackedSymbolTable &symtab, const CloneT &type = cloneMinimal);
-#else
-            INLINE StackedSymbolTable(const int &maxdepth) : SymbolTable(), mStack(), mMaximumStackDepth(maxdepth), mMaximumStackDepthAttained(0) {};
-            StackedSymbolTable(const StackedSymbolTable &symtab, const CloneT &type = cloneMinimal);
-#endif
             
             static INLINE std::shared_ptr< StackedSymbolTable > MakeValue(const int &maxdepth) { return std::shared_ptr< StackedSymbolTable >(new StackedSymbolTable(maxdepth)); };
             static INLINE std::shared_ptr< StackedSymbolTable > MakeValue(const StackedSymbolTable &symtab, const CloneT &type = cloneMinimal) { return std::shared_ptr< StackedSymbolTable >(new StackedSymbolTable(symtab, type)); };
             
             INLINE const int &MaxDepth() const throw() { return mMaximumStackDepth; };
+            
+            INLINE const std::shared_ptr< iSymbolTable > &Top() const { assert(!mStack.empty()); return mStack.back(); };
             INLINE const int &MaxDepthAttained() const throw() { return mMaximumStackDepthAttained; };
             
+            INLINE int NumTables() const throw() { return static_cast< int >(mStack.size()); };
+            
+            //  True if every symbol of the tables above the lowest depth is
+            //  bound under one of keys, the first of each of their elements.
+            template< typename KeyListT > bool HoldsOnly(const int &depth, const KeyListT &keys) const
+            {
+                TableT::const_iterator tbl_i(mStack.begin());
+                std::advance(tbl_i, depth);
+                
+                for(const TableT::const_iterator last_tbl_i(mStack.end()); tbl_i != last_tbl_i; ++tbl_i)
+                {
+                    const int held((*tbl_i)->Num());
+                    if(0 == held)
+                    {
+                        continue;
+                    }
+                    
+                    const int bound(
+                        static_cast< int >(
+                            std::count_if(
+                                keys.begin(), keys.end(),
+                                [&](const typename KeyListT::value_type &key)
+                                {
+                                    return (*tbl_i)->Exists(key.first);
+                                }
+                            )
+                        )
+                    );
+                    
+                    if(bound != held)
+                    {
+                        return false;
+                    }
+                }
+                
+                return true;
+            };
+            
+            static INLINE IntegerT GetFrameAllocationCount() throw() { return FrameAllocationCount; };
+            static INLINE IntegerT GetFrameReuseCount() throw() { return FrameReuseCount; };
+            
+            //  Returns an empty frame with room for at least size symbols,
+            //  taking it from the pool when there is one to be had.
+            INLINE std::shared_ptr< FrameSymbolTable > NewFrame(const int &size = 0)
+            {
+                std::shared_ptr< FrameSymbolTable > frame;
+                
+                if(mFramePool.empty())
+                {
+                    frame = FrameSymbolTable::MakeValue();
+                    ++FrameAllocationCount;
+                }
+                else
+                {
+                    frame = std::move(mFramePool.back());
+                    mFramePool.pop_back();
+                    ++FrameReuseCount;
+                }
+                
+                frame->Reserve(size);
+                
+                return frame;
+            };
+            
+            //  Looks up key in the given slot of the table depth levels below
+            //  the top of the stack. A null pointer is returned if that table
+            //  does not exist or does not bind key to that slot, or if the
+            //  tables above it do not hold nearer symbols between them, since
+            //  one of those may then bind key as well.
+            std::shared_ptr< iAtomic > Lookup(const int &depth, const int &slot, const int &nearer, const std::string &key) const;
+            
             
             //  From iSymbolTable
             
@@ -276,6 +528,7 @@ namespace dish
             virtual bool Exists(const std::string &key) const;
             virtual void Insert(const std::string &key, std::shared_ptr< iAtomic > value);
             virtual std::shared_ptr< iAtomic > Lookup(const std::string &key) const;
+            virtual std::shared_ptr< iAtomic > LookupInterned(const int &id, const std::string &key) const;
             
             virtual void Load(iSymbolTable &symtab, const CloneT &type = cloneMinimal) const;
             
@@ -298,7 +551,7 @@ namespace dish
             
         public:
             INLINE ScopedScope(iSymbolTable &symtab) : mSymbolTable(symtab) { mSymbolTable.Push(); };
-            INLINE ScopedScope(iSymbolTable &symtab, std::shared_ptr< iSymbolTable > table) : mSymbolTable(symtab) { mSymbolTable.Push(table); };
+            INLINE ScopedScope(iSymbolTable &symtab, std::shared_ptr< iSymbolTable > table) : mSymbolTable(symtab) { mSymbolTable.Push(std::move(table)); };
             INLINE ~ScopedScope() { mSymbolTable.Pop(); };
             
     };
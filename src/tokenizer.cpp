@@ -19,11 +19,18 @@
     FOR A PARTICULAR PURPOSE.
 */
 
-#include <cctype>
+#include <cassert>
+#include <climits>
+#include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <sstream>
 
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
 #include "exception.h"
 #include "tokenizer.h"
 #include "utility.h"
@@ -31,13 +38,239 @@
 namespace
 {
 
-    struct ci_less
+    //  The classes of each byte.
+    class CharClassTable
     {
+        private:
+            unsigned char mClasses[UCHAR_MAX + 1];
+            
+            INLINE void add(const std::string &chars, const dish::CharClassT &cls)
+            {
+                for(std::string::const_iterator i(chars.begin()), last_i(chars.end()); i != last_i; ++i)
+                {
+                    mClasses[static_cast< unsigned char >(*i)] |= cls;
+                }
+            };
+        
+        public:
+            CharClassTable() : mClasses()
+            {
+                add(dish::WHITESPACE_CHARACTERS, dish::ccWhitespace);
+                add(dish::EOLN_CHARACTERS, dish::ccEndOfLine);
+                add(dish::DIGIT_CHARACTERS, dish::ccDigit);
+                add(dish::LETTER_CHARACTERS, dish::ccLetter);
+                add(dish::VALID_ID_CHARACTERS, dish::ccIdentifier);
+            };
+            
+            INLINE bool Is(const char &ch, const dish::CharClassT &cls) const throw() { return (0 != (mClasses[static_cast< unsigned char >(ch)] & cls)); };
+            INLINE bool Is(const int &ch, const dish::CharClassT &cls) const throw() { return ((dish::iInputStream::END_OF_INPUT != ch) && Is(static_cast< char >(ch), cls)); };
+            
+            //  The first byte in [next, end) which is, or is not, of class cls;
+            //  end if there is none.
+            INLINE const char *FindFirstOf(const dish::CharClassT &cls, const char *next, const char * const end) const throw()
+            {
+                while((end != next) && !Is(*next, cls))
+                {
+                    ++next;
+                }
+                
+                return next;
+            };
+            
+            INLINE const char *FindFirstNotOf(const dish::CharClassT &cls, const char *next, const char * const end) const throw()
+            {
+                while((end != next) && Is(*next, cls))
+                {
+                    ++next;
+                }
+                
+                return next;
+            };
+        
+    };
     
-        INLINE bool operator()(const std::string &s1, const std::string &s2) const
-        {
-            return dish::IsLessThan(s1, s2, dish::CASE_INSENSITIVE);
-	    }
+    INLINE const CharClassTable &CharClasses()
+    {
+        static const CharClassTable Table;
+        
+        return Table;
+    }
+    
+    //  The first byte in [next, end) which is not whitespace, or the first
+    //  which ends a line; sixteen bytes are compared at a time where SSE2 is
+    //  available. The bytes compared against must agree with
+    //  WHITESPACE_CHARACTERS and EOLN_CHARACTERS.
+    const char *FindFirstNotOfWhitespace(const char *next, const char * const end)
+    {
+        #if defined(__SSE2__)
+            const __m128i space(_mm_set1_epi8(' '));
+            const __m128i tab(_mm_set1_epi8('\t'));
+            const __m128i vtab(_mm_set1_epi8('\v'));
+            const __m128i cr(_mm_set1_epi8('\r'));
+            const __m128i lf(_mm_set1_epi8('\n'));
+            
+            for( ; 16 <= (end - next); next += 16)
+            {
+                const __m128i bytes(_mm_loadu_si128(reinterpret_cast< const __m128i * >(next)));
+                
+                const __m128i matched(
+                    _mm_or_si128(
+                        _mm_or_si128(_mm_cmpeq_epi8(bytes, space), _mm_cmpeq_epi8(bytes, tab)),
+                        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(bytes, vtab), _mm_cmpeq_epi8(bytes, cr)), _mm_cmpeq_epi8(bytes, lf))
+                    )
+                );
+                
+                const int unmatched(_mm_movemask_epi8(matched) ^ 0xFFFF);
+                
+                if(0 != unmatched)
+                {
+                    return (next + __builtin_ctz(unmatched));
+                }
+            }
+        #endif
+        
+        return CharClasses().FindFirstNotOf(dish::ccWhitespace, next, end);
+    }
+    
+    const char *FindFirstOfEndOfLine(const char *next, const char * const end)
+    {
+        #if defined(__SSE2__)
+            const __m128i cr(_mm_set1_epi8('\r'));
+            const __m128i lf(_mm_set1_epi8('\n'));
+            
+            for( ; 16 <= (end - next); next += 16)
+            {
+                const __m128i bytes(_mm_loadu_si128(reinterpret_cast< const __m128i * >(next)));
+                
+                const int matched(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(bytes, cr), _mm_cmpeq_epi8(bytes, lf))));
+                
+                if(0 != matched)
+                {
+                    return (next + __builtin_ctz(matched));
+                }
+            }
+        #endif
+        
+        return CharClasses().FindFirstOf(dish::ccEndOfLine, next, end);
+    }
+    
+    //  The reserved words and boolean literals, found through a perfect hash
+    //  of the length and the first, second and last characters of an
+    //  identifier; no two words share a slot, so an identifier is compared
+    //  with one word at most.
+    class ReservedWordTable
+    {
+        public:
+        
+            typedef struct
+            {
+                const char *Word;
+                std::size_t Length;
+                dish::TokenTypeT Type;
+                dish::BooleanT Value;
+            } EntryT;
+        
+        private:
+            static const std::size_t SIZE = 128;
+            static const std::size_t MAX_LENGTH = 10;
+            
+            EntryT mEntries[SIZE];
+            
+            static INLINE unsigned lower(const char &ch) throw() { return (static_cast< unsigned char >(ch) | 0x20); };
+            
+            static INLINE std::size_t hash(const char * const id, const std::size_t &length) throw()
+            {
+                return ((length + 5 * (lower(id[0]) + lower(id[1]) + lower(id[length - 1]))) & (SIZE - 1));
+            };
+            
+            INLINE void add(const char * const word, const dish::TokenTypeT &type, const dish::BooleanT &value = false)
+            {
+                const std::size_t length(std::strlen(word));
+                assert((2 <= length) && (MAX_LENGTH >= length));
+                
+                EntryT &entry(mEntries[hash(word, length)]);
+                assert(0 == entry.Word);
+                
+                entry.Word = word;
+                entry.Length = length;
+                entry.Type = type;
+                entry.Value = value;
+            };
+        
+        public:
+            ReservedWordTable() : mEntries()
+            {
+                //  Each word is in lower-case.
+                add("and", dish::tknAndRW);
+                add("array", dish::tknArrayRW);
+                add("as", dish::tknAsRW);
+                add("assert", dish::tknAssertRW);
+                add("begin", dish::tknBeginRW);
+                add("boolean", dish::tknBooleanRW);
+                add("declare", dish::tknDeclareRW);
+                add("dictionary", dish::tknDictionaryRW);
+                add("do", dish::tknDoRW);
+                add("else", dish::tknElseRW);
+                add("end", dish::tknEndRW);
+                add("for", dish::tknForRW);
+                add("foreach", dish::tknForEachRW);
+                add("function", dish::tknFunctionRW);
+                add("if", dish::tknIfRW);
+                add("import", dish::tknImportRW);
+                add("in", dish::tknInRW);
+                add("integer", dish::tknIntegerRW);
+                add("lambda", dish::tknLambdaRW);
+                add("lock", dish::tknLockRW);
+                add("locked", dish::tknLockRW);     //  Treat 'locked' as a synonym for 'lock'.
+                add("not", dish::tknNotRW);
+                add("of", dish::tknOfRW);
+                add("otherwise", dish::tknOtherwiseRW);
+                add("or", dish::tknOrRW);
+                add("real", dish::tknRealRW);
+                add("reference", dish::tknReferenceRW);
+                add("repeat", dish::tknRepeatRW);
+                add("return", dish::tknReturnRW);
+                add("step", dish::tknStepRW);
+                add("string", dish::tknStringRW);
+                add("structure", dish::tknStructureRW);
+                add("switch", dish::tknSwitchRW);
+                add("then", dish::tknThenRW);
+                add("to", dish::tknToRW);
+                add("type", dish::tknTypeRW);
+                add("until", dish::tknUntilRW);
+                add("while", dish::tknWhileRW);
+                add("xor", dish::tknXorRW);
+                
+                add("true", dish::tknBooleanLit, true);
+                add("false", dish::tknBooleanLit, false);
+            };
+            
+            //  The entry for id, compared case-insensitively, or 0 if id is
+            //  not a reserved word.
+            const EntryT *Find(const std::string &id) const throw()
+            {
+                const std::size_t length(id.length());
+                
+                if((2 <= length) && (MAX_LENGTH >= length))
+                {
+                    const EntryT &entry(mEntries[hash(id.data(), length)]);
+                    
+                    if(length == entry.Length)
+                    {
+                        for(std::size_t i(0); length != i; ++i)
+                        {
+                            if(lower(id[i]) != static_cast< unsigned char >(entry.Word[i]))
+                            {
+                                return 0;
+                            }
+                        }
+                        
+                        return &entry;
+                    }
+                }
+                
+                return 0;
+            };
         
     };
 
@@ -118,14 +351,30 @@ void dish::Tokenizer::createIdentifierToken(const std::string &id)
     std::strncpy(mToken.Identifier.Id, id.c_str(), nbytes);
 }
 
-void dish::Tokenizer::skipAllOf(const std::string &skip)
+void dish::Tokenizer::skipAllOf(const CharClassT &skip)
 {
+    const CharClassTable &classes(CharClasses());
+    
+    const char *next;
+    const char *end;
+    
+    while(mInput.Buffered(next, end))
+    {
+        const char * const last(classes.FindFirstNotOf(skip, next, end));
+        mInput.Advance(last - next);
+        
+        if(end != last)
+        {
+            return;
+        }
+    }
+    
     int ch;
     
     do
     {
         ch = mInput.Get();
-    } while(std::string::npos != skip.find(ch));
+    } while(classes.Is(ch, skip));
     
     if(iInputStream::END_OF_INPUT != ch)
     {
@@ -133,14 +382,30 @@ void dish::Tokenizer::skipAllOf(const std::string &skip)
     }
 }
 
-void dish::Tokenizer::skipAllNotOf(const std::string &dontskip)
+void dish::Tokenizer::skipAllNotOf(const CharClassT &dontskip)
 {
+    const CharClassTable &classes(CharClasses());
+    
+    const char *next;
+    const char *end;
+    
+    while(mInput.Buffered(next, end))
+    {
+        const char * const last(classes.FindFirstOf(dontskip, next, end));
+        mInput.Advance(last - next);
+        
+        if(end != last)
+        {
+            return;
+        }
+    }
+    
     int ch;
     
     do
     {
         ch = mInput.Get();
-    } while(std::string::npos == dontskip.find(ch));
+    } while((iInputStream::END_OF_INPUT != ch) && !classes.Is(ch, dontskip));
     
     if(iInputStream::END_OF_INPUT != ch)
     {
@@ -148,15 +413,32 @@ void dish::Tokenizer::skipAllNotOf(const std::string &dontskip)
     }
 }
 
-void dish::Tokenizer::collectAllOf(const std::string &allow, std::string &read)
+void dish::Tokenizer::collectAllOf(const CharClassT &allow, std::string &read)
 {
+    const CharClassTable &classes(CharClasses());
+    
+    const char *next;
+    const char *end;
+    
+    while(mInput.Buffered(next, end))
+    {
+        const char * const last(classes.FindFirstNotOf(allow, next, end));
+        read.append(next, last);
+        mInput.Advance(last - next);
+        
+        if(end != last)
+        {
+            return;
+        }
+    }
+    
     int ch;
     
     for(bool done(false); !done; )
     {
         ch = mInput.Get();
         
-        if(std::string::npos != allow.find(ch))
+        if(classes.Is(ch, allow))
         {
             read.push_back(ch);
         }
@@ -172,15 +454,32 @@ void dish::Tokenizer::collectAllOf(const std::string &allow, std::string &read)
     }
 }
 
-void dish::Tokenizer::collectAllNotOf(const std::string &dontallow, std::string &read)
+void dish::Tokenizer::collectAllNotOf(const CharClassT &dontallow, std::string &read)
 {
+    const CharClassTable &classes(CharClasses());
+    
+    const char *next;
+    const char *end;
+    
+    while(mInput.Buffered(next, end))
+    {
+        const char * const last(classes.FindFirstOf(dontallow, next, end));
+        read.append(next, last);
+        mInput.Advance(last - next);
+        
+        if(end != last)
+        {
+            return;
+        }
+    }
+    
     int ch;
     
     for(bool done(false); !done; )
     {
         ch = mInput.Get();
         
-        if(std::string::npos == dontallow.find(ch))
+        if((iInputStream::END_OF_INPUT != ch) && !classes.Is(ch, dontallow))
         {
             read.push_back(ch);
         }
@@ -196,21 +495,61 @@ void dish::Tokenizer::collectAllNotOf(const std::string &dontallow, std::string
     }
 }
 
+void dish::Tokenizer::skipWhitespace()
+{
+    const char *next;
+    const char *end;
+    
+    while(mInput.Buffered(next, end))
+    {
+        const char * const last(FindFirstNotOfWhitespace(next, end));
+        mInput.Advance(last - next);
+        
+        if(end != last)
+        {
+            return;
+        }
+    }
+    
+    skipAllOf(ccWhitespace);
+}
+
+void dish::Tokenizer::skipToEndOfLine()
+{
+    const char *next;
+    const char *end;
+    
+    while(mInput.Buffered(next, end))
+    {
+        const char * const last(FindFirstOfEndOfLine(next, end));
+        mInput.Advance(last - next);
+        
+        if(end != last)
+        {
+            return;
+        }
+    }
+    
+    skipAllNotOf(ccEndOfLine);
+}
+
 void dish::Tokenizer::buildNumericToken(const bool negative)
 {
     std::string numeric;
-    collectAllOf(DIGIT_CHARACTERS, numeric);
+    collectAllOf(ccDigit, numeric);
     
+    //  A value too large to represent is the largest which can be, as it
+    //  would be if read from a stream.
     const int ch(mInput.Get());
     if('.' == ch)
     {
         numeric.push_back(ch);
-        collectAllOf(DIGIT_CHARACTERS, numeric);
+        collectAllOf(ccDigit, numeric);
         
-        RealT value;
+        RealT value(std::strtod(numeric.c_str(), 0));
+        if(std::numeric_limits< RealT >::max() < value)
         {
-            std::stringstream input(numeric);
-            input >> value;
+            value = std::numeric_limits< RealT >::max();
         }
         
         createRealLitToken(negative ? -value : value);
@@ -219,10 +558,14 @@ void dish::Tokenizer::buildNumericToken(const bool negative)
     {
         mInput.Unget(ch);
     
-        IntegerT value;
+        IntegerT value(std::numeric_limits< IntegerT >::max());
         {
-            std::stringstream input(numeric);
-            input >> value;
+            const long long parsed(std::strtoll(numeric.c_str(), 0, 10));
+            
+            if(std::numeric_limits< IntegerT >::max() > parsed)
+            {
+                value = static_cast< IntegerT >(parsed);
+            }
         }
         
         createIntegerLitToken(negative ? -value : value);
@@ -309,76 +652,24 @@ void dish::Tokenizer::buildLiteralStringToken(const bool single_quote)
 void dish::Tokenizer::buildIdentifierToken(const bool accented)
 {
     std::string id;
-    collectAllOf(VALID_ID_CHARACTERS, id);
+    collectAllOf(ccIdentifier, id);
     
     if(!id.empty())
     {
-    
-        using Id2RwT = std::map< std::string, TokenTypeT, ci_less >;
-    
-        static Id2RwT Id2RW;
-        static Id2RwT::const_iterator last_Id2RW;
-        
-        if(Id2RW.empty())
-        {
-            Id2RW[std::string("And")] = tknAndRW;
-            Id2RW[std::string("Array")] = tknArrayRW;
-            Id2RW[std::string("As")] = tknAsRW;
-            Id2RW[std::string("Assert")] = tknAssertRW;
-            Id2RW[std::string("Begin")] = tknBeginRW;
-            Id2RW[std::string("Boolean")] = tknBooleanRW;
-            Id2RW[std::string("Declare")] = tknDeclareRW;
-            Id2RW[std::string("Dictionary")] = tknDictionaryRW;
-            Id2RW[std::string("Do")] = tknDoRW;
-            Id2RW[std::string("Else")] = tknElseRW;
-            Id2RW[std::string("End")] = tknEndRW;
-            Id2RW[std::string("For")] = tknForRW;
-            Id2RW[std::string("ForEach")] = tknForEachRW;
-            Id2RW[std::string("Function")] = tknFunctionRW;
-            Id2RW[std::string("If")] = tknIfRW;
-            Id2RW[std::string("Import")] = tknImportRW;
-            Id2RW[std::string("In")] = tknInRW;
-            Id2RW[std::string("Integer")] = tknIntegerRW;
-            Id2RW[std::string("Lambda")] = tknLambdaRW;
-            Id2RW[std::string("Lock")] = tknLockRW;
-            Id2RW[std::string("Locked")] = tknLockRW;   //  Treak 'locked' as a synonym for 'lock'.
-            Id2RW[std::string("Not")] = tknNotRW;
-            Id2RW[std::string("Of")] = tknOfRW;
-            Id2RW[std::string("Otherwise")] = tknOtherwiseRW;
-            Id2RW[std::string("Or")] = tknOrRW;
-            Id2RW[std::string("Real")] = tknRealRW;
-            Id2RW[std::string("Reference")] = tknReferenceRW;
-            Id2RW[std::string("Repeat")] = tknRepeatRW;
-            Id2RW[std::string("Return")] = tknReturnRW;
-            Id2RW[std::string("Step")] = tknStepRW;
-            Id2RW[std::string("String")] = tknStringRW;
-            Id2RW[std::string("Structure")] = tknStructureRW;
-            Id2RW[std::string("Switch")] = tknSwitchRW;
-            Id2RW[std::string("Then")] = tknThenRW;
-            Id2RW[std::string("To")] = tknToRW;
-            Id2RW[std::string("Type")] = tknTypeRW;
-            Id2RW[std::string("Until")] = tknUntilRW;
-            Id2RW[std::string("While")] = tknWhileRW;
-            Id2RW[std::string("Xor")] = tknXorRW;
-            
-            last_Id2RW = Id2RW.end();
-        }
+        static const ReservedWordTable ReservedWords;
         
-        const auto rw(Id2RW.find(id));
+        const ReservedWordTable::EntryT * const rw(ReservedWords.Find(id));
         
-        if(last_Id2RW != rw)
+        if(0 != rw)
         {
-            setTokenType(rw->second);
-        }
-        
-        else if(IsEqual(id, "True", CASE_INSENSITIVE)) 
-        {
-            createBooleanLitToken(true);
-        }
-        
-        else if(IsEqual(id, "False", CASE_INSENSITIVE)) 
-        {
-            createBooleanLitToken(false);
+            if(tknBooleanLit == rw->Type)
+            {
+                createBooleanLitToken(rw->Value);
+            }
+            else
+            {
+                setTokenType(rw->Type);
+            }
         }
     
         else
@@ -416,7 +707,7 @@ const dish::TokenT &dish::Tokenizer::Next()
                 ch = mInput.Get();
                 mInput.Unget(ch);
                 
-                if(!std::isdigit(ch))
+                if(!CharClasses().Is(ch, ccDigit))
                 {
                     createPlusOpToken();
                 }
@@ -431,7 +722,7 @@ const dish::TokenT &dish::Tokenizer::Next()
                 ch = mInput.Get();
                 mInput.Unget(ch);
                 
-                if(!std::isdigit(ch))
+                if(!CharClasses().Is(ch, ccDigit))
                 {
                     createSubtractOpToken();
                 }
@@ -573,7 +864,7 @@ const dish::TokenT &dish::Tokenizer::Next()
             
             case '#':
             {
-                skipAllNotOf(EOLN_CHARACTERS);
+                skipToEndOfLine();
                 
                 done = false;
             } break;
@@ -606,13 +897,13 @@ const dish::TokenT &dish::Tokenizer::Next()
             {
                 if(iInputStream::END_OF_INPUT != ch)
                 {
-                    if(std::isdigit(ch))
+                    if(CharClasses().Is(ch, ccDigit))
                     {
                         mInput.Unget(ch);
                         buildNumericToken(NOT_ACCENTED);
                     }
                     
-                    else if(std::isalpha(ch))
+                    else if(CharClasses().Is(ch, ccLetter))
                     {
                         mInput.Unget(ch);
                         buildIdentifierToken(NOT_ACCENTED);
@@ -250,6 +250,20 @@ namespace dish
     
     extern void DestroyToken(TokenT &tkn);
     
+    ////////////////////////////////////////////////////////////////////////////
+    
+    //  The classes of characters the tokenizer scans for; each byte of the
+    //  input is looked up in a table of these rather than searched for in a
+    //  string of characters.
+    typedef enum
+    {
+        ccWhitespace = 0x01,
+        ccEndOfLine = 0x02,
+        ccDigit = 0x04,
+        ccLetter = 0x08,
+        ccIdentifier = 0x10
+    } CharClassT;
+
     ////////////////////////////////////////////////////////////////////////////
 
     class Tokenizer
@@ -349,13 +363,16 @@ namespace dish
         
             ////////////////////////////////////////////////////////////////////
             
-            void skipAllOf(const std::string &skip);
-            void skipAllNotOf(const std::string &dontskip);
+            //  The input which is buffered in memory is scanned in place, and
+            //  the rest one byte at a time.
+            void skipAllOf(const CharClassT &skip);
+            void skipAllNotOf(const CharClassT &dontskip);
             
-            void collectAllOf(const std::string &allow, std::string &read);
-            void collectAllNotOf(const std::string &dontallow, std::string &read);
+            void collectAllOf(const CharClassT &allow, std::string &read);
+            void collectAllNotOf(const CharClassT &dontallow, std::string &read);
             
-            INLINE void skipWhitespace() { skipAllOf(WHITESPACE_CHARACTERS); };
+            void skipWhitespace();
+            void skipToEndOfLine();
         
             ////////////////////////////////////////////////////////////////////
             
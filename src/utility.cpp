@@ -330,3 +330,11 @@ dish::IntegerT &dish::BucketCounts::operator[](const unsigned int &index)
     return mOverCount;
 }
 
+/******************************************************************************
+
+    dish::SharedHeap class definitions
+
+ ******************************************************************************/
+ 
+dish::IntegerT dish::SharedHeap::Count(0);
+
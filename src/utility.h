@@ -32,6 +32,7 @@
 #include <limits>
 #include <list>
 #include <memory>
+#include <new>
 #include <random>
 #include <string>
 #include <vector>
@@ -630,6 +631,68 @@ namespace dish
     };
 
     ////////////////////////////////////////////////////////////////////////////
+    
+    //  The memory of the objects made by MakeShared(), unless they are given a
+    //  heap of their own, and the count of blocks allocated for them.
+    class SharedHeap
+    {
+        private:
+            static IntegerT Count;
+        
+        public:
+            static INLINE void *Allocate(const std::size_t &nbytes) { ++Count; return ::operator new(nbytes); };
+            static INLINE void Release(void *ptr, const std::size_t &nbytes) throw() { ::operator delete(ptr); };
+            
+            static INLINE IntegerT NumAllocations() throw() { return Count; };
+        
+    };
+    
+    //  The allocator of MakeShared(): std::allocate_shared() places the object
+    //  and its reference count in the single block allocated from HeapT. The
+    //  object is constructed by the function passed on to construct(), which
+    //  is given the memory of the object to construct it in place.
+    template< typename T, typename HeapT = SharedHeap >
+    class SharedAllocator
+    {
+        public:
+            using value_type = T;
+            
+            INLINE SharedAllocator() throw() {};
+            template< typename U > INLINE SharedAllocator(const SharedAllocator< U, HeapT > &) throw() {};
+            
+            INLINE T *allocate(const std::size_t n) { return static_cast< T * >(HeapT::Allocate(n * sizeof(T))); };
+            INLINE void deallocate(T * const ptr, const std::size_t n) throw() { HeapT::Release(ptr, n * sizeof(T)); };
+            
+            template< typename U, typename ConstructT > INLINE void construct(U * const ptr, ConstructT &&make) { make(static_cast< void * >(ptr)); };
+            template< typename U > INLINE void destroy(U * const ptr) { ptr->~U(); };
+            
+            //  Members rather than functions of the namespace, which would hide
+            //  the comparisons of values from the code within it.
+            template< typename U > INLINE bool operator==(const SharedAllocator< U, HeapT > &) const throw() { return true; };
+            template< typename U > INLINE bool operator!=(const SharedAllocator< U, HeapT > &) const throw() { return false; };
+        
+    };
+    
+    //  Makes a T, in a single allocation with its reference count rather than
+    //  one for each. The factories of T pass a function constructing it in
+    //  the memory given, which can reach T's protected constructors where
+    //  std::make_shared() cannot:
+    //
+    //      MakeShared< T >([&](void *memory) { ::new(memory) T(args); });
+    //
+    //  The count is still the one std::shared_ptr keeps beside T; T holds no
+    //  count of its own. An intrusive handle is deferred: it would replace
+    //  std::shared_ptr for every value and node, along with the weak
+    //  references of packed arrays and the use_count() checks behind
+    //  copy-on-write. The count is already updated without atomics while
+    //  the interpreter runs a single thread.
+    template< typename T, typename HeapT = SharedHeap, typename ConstructT >
+    INLINE std::shared_ptr< T > MakeShared(ConstructT construct)
+    {
+        return std::allocate_shared< T >(SharedAllocator< T, HeapT >(), construct);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
 
 }
 